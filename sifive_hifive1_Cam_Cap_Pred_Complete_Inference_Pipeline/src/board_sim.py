@@ -0,0 +1,183 @@
+'''
+    board_sim.py
+    Author: Shwetank Shekhar
+
+    Host-side stand-in for the HiFive1 running main.c in UART_REALTIME_MODE.
+    Each simulated board owns a pseudo-terminal, speaks the same protocol as
+    the firmware (0xAA start byte + 144 int8 pixels in, text lines out) and
+    runs a bit-exact NumPy port of QInt8Inference from app_inference.h.
+    Like main.c with FRAME_FILTER_ENABLE, unchanged frames skip inference and
+    predictions are majority-voted (frame_filter.h); --no-filter disables it.
+
+    Usage (from the project root, Linux/macOS only):
+        python src/board_sim.py --boards 2
+    then point send_image_uart.py / uart_farm.py at the printed /dev/pts/N.
+'''
+import argparse
+import collections
+import os
+import threading
+import time
+import tty
+
+import numpy as np
+
+from model_params import MODEL_PARAMS_C, load_model_params
+
+START_BYTE = 0xAA
+FRAME_SIZE = 144
+
+# Same layer geometry as app_inference.h
+LAYERS = [(144, 64), (64, 64), (64, 10)]
+
+# Same defaults as frame_filter.h
+FRAME_CHANGE_MAX_DIFF = 0
+FRAME_VOTE_WINDOW = 5
+
+
+def processfclayer(activations, weights, biases, n_input, n_output, input_zero_point, weights_zero_point):
+    a = activations.astype(np.int32) - np.int32(input_zero_point)
+    w = weights.astype(np.int32).reshape(n_output, n_input) - np.int32(weights_zero_point)
+    return biases.astype(np.int32) + w @ a
+
+
+def quantized_relu_requantize(input_sum, input_scale, output_scale, output_zero_point):
+    # float32 throughout, round() half away from zero, exactly like the C code.
+    requantization_scale = np.float32(input_scale) / np.float32(output_scale)
+    relu_val = np.maximum(input_sum, 0)
+    scaled_val = relu_val.astype(np.float32) * requantization_scale
+    quantized_val = np.floor(scaled_val.astype(np.float64) + 0.5).astype(np.int32) + np.int32(output_zero_point)
+    return np.clip(quantized_val, -128, 127).astype(np.int8)
+
+
+def qint8_inference(p, frame):
+    """Returns (pred_digit, layer3_sum) for one int8[144] frame."""
+    x = np.asarray(frame, dtype=np.int8)
+    s1 = processfclayer(x, p["L1_weights"], p["L1_biases"], *LAYERS[0],
+                        p["L1_input_zero_point"], p["L1_weights_zero_point"])
+    a1 = quantized_relu_requantize(s1, p["L1_output_scale"], p["L2_input_scale"], p["L2_input_zero_point"])
+    s2 = processfclayer(a1, p["L2_weights"], p["L2_biases"], *LAYERS[1],
+                        p["L2_input_zero_point"], p["L2_weights_zero_point"])
+    a2 = quantized_relu_requantize(s2, p["L2_output_scale"], p["L3_input_scale"], p["L3_input_zero_point"])
+    s3 = processfclayer(a2, p["L3_weights"], p["L3_biases"], *LAYERS[2],
+                        p["L3_input_zero_point"], p["L3_weights_zero_point"])
+    return int(np.argmax(s3)), s3
+
+
+class FrameFilter:
+    """Port of frame_filter.h: change detection + majority vote over the last raw predictions."""
+
+    def __init__(self, max_diff=FRAME_CHANGE_MAX_DIFF, vote_window=FRAME_VOTE_WINDOW):
+        self.max_diff = max_diff
+        self.history = collections.deque(maxlen=vote_window)
+        self.prev_frame = None
+        self.last_pred = 0
+        self.frames = 0
+        self.skipped = 0
+
+    def unchanged(self, frame):
+        self.frames += 1
+        if self.prev_frame is not None and np.count_nonzero(frame != self.prev_frame) <= self.max_diff:
+            self.skipped += 1
+            return True
+        self.prev_frame = frame.copy()
+        return False
+
+    def vote(self, pred):
+        self.last_pred = pred
+        self.history.append(pred)
+        votes = [0] * 10
+        best = pred
+        for d in reversed(self.history):  # newest first: ties keep the most recent digit
+            votes[d] += 1
+            if votes[d] > votes[best]:
+                best = d
+        return best
+
+
+class BoardSimulator(threading.Thread):
+    """One simulated board behind a pseudo-terminal."""
+
+    def __init__(self, params, delay_ms=0.0, frame_filter=True):
+        super().__init__(daemon=True)
+        self.params = params
+        self.delay_s = delay_ms / 1000.0
+        self.filter = FrameFilter() if frame_filter else None
+        self.master_fd, slave_fd = os.openpty()
+        tty.setraw(slave_fd)
+        self.port = os.ttyname(slave_fd)
+        self._slave_fd = slave_fd  # keep open so the pty survives client reconnects
+        self.frames = 0
+
+    def _read_exact(self, n):
+        buf = b""
+        while len(buf) < n:
+            chunk = os.read(self.master_fd, n - len(buf))
+            if not chunk:
+                raise EOFError
+            buf += chunk
+        return buf
+
+    def _println(self, text):
+        os.write(self.master_fd, (text + "\r\n").encode())
+
+    def run(self):
+        try:
+            while True:
+                self._println("Waiting for image data via UART...")
+                while self._read_exact(1)[0] != START_BYTE:
+                    pass
+                t0 = time.perf_counter()
+                frame = np.frombuffer(self._read_exact(FRAME_SIZE), dtype=np.int8)
+                self._println(f"Image data received in {int((time.perf_counter() - t0) * 1e6)} us.")
+
+                if self.filter is not None and self.filter.unchanged(frame):
+                    self._println("Frame unchanged, inference skipped.")
+                    pred = self.filter.last_pred
+                else:
+                    t0 = time.perf_counter()
+                    pred, _ = qint8_inference(self.params, frame)
+                    if self.delay_s:
+                        time.sleep(self.delay_s)
+                    self._println(f"Inference completed in {int((time.perf_counter() - t0) * 1e6)} us.")
+
+                if self.filter is not None:
+                    f = self.filter
+                    smoothed = f.vote(pred)
+                    if f.frames == 1:
+                        t_first = time.perf_counter()
+                    elapsed = time.perf_counter() - t_first
+                    fps = (f.frames - 1) / elapsed if elapsed else 0.0
+                    self._println(f"Smoothed digit: {smoothed}, Skipped: {f.skipped}/{f.frames} "
+                                  f"({f.skipped * 100 // f.frames}%), Effective fps: {fps:.2f}")
+                self._println(f"Predicted digit: {pred}, True Label: 0, Status: {'PASS' if pred == 0 else 'FAIL'}")
+                self.frames += 1
+        except (EOFError, OSError):
+            pass
+
+
+def start_boards(n, c_file=MODEL_PARAMS_C, delay_ms=0.0, frame_filter=True):
+    params = load_model_params(c_file)
+    boards = [BoardSimulator(params, delay_ms, frame_filter) for _ in range(n)]
+    for b in boards:
+        b.start()
+    return boards
+
+
+if __name__ == "__main__":
+    ap = argparse.ArgumentParser(description="Simulated HiFive1 boards on pseudo-terminals.")
+    ap.add_argument("--boards", type=int, default=1)
+    ap.add_argument("--params", default=MODEL_PARAMS_C)
+    ap.add_argument("--delay-ms", type=float, default=0.0, help="extra per-frame compute time to emulate")
+    ap.add_argument("--no-filter", action="store_true", help="infer every frame (FRAME_FILTER_ENABLE 0)")
+    args = ap.parse_args()
+
+    boards = start_boards(args.boards, args.params, args.delay_ms, not args.no_filter)
+    for i, b in enumerate(boards):
+        print(f"Board {i}: {b.port}")
+    print("Press Ctrl+C to stop.")
+    try:
+        while True:
+            time.sleep(1)
+    except KeyboardInterrupt:
+        pass
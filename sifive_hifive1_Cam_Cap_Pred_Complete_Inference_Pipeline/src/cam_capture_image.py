@@ -3,43 +3,14 @@
 
 import cv2
 import numpy as np
-import tensorflow as tf
 import os
 
+# TensorFlow-free preprocessing, bit-identical to the old tf.image.resize path
+from preprocess import INPUT_SCALE, INPUT_ZERO_POINT, preprocess_image
+
 # Configuration
-# Quantization parameters from your mnist_model_params.c file
-INPUT_SCALE = 0.00392157
-INPUT_ZERO_POINT = -128
 OUTPUT_C_FILE = "src/captured_image_data.h"
 
-# Preprocessing Function
-def preprocess_image(image_28x28_raw):
-    image_float = image_28x28_raw.astype('float32') / 255.0
-    rows = np.any(image_float > 0.1, axis=1)
-    cols = np.any(image_float > 0.1, axis=0)
-
-    if not np.any(rows):
-        return np.full((12, 12), 0.0, dtype=np.float32)
-
-    ymin, ymax = np.where(rows)[0][[0, -1]]
-    xmin, xmax = np.where(cols)[0][[0, -1]]
-    buffer = 2
-    ymin = max(0, ymin - buffer)
-    ymax = min(28, ymax + buffer)
-    xmin = max(0, xmin - buffer)
-    xmax = min(28, xmax + buffer)
-
-    cropped_image = image_float[ymin:ymax, xmin:xmax]
-    resized_image = tf.image.resize(
-        np.expand_dims(cropped_image, axis=-1), 
-        (12, 12), 
-        method='bilinear'
-    ).numpy().squeeze()
-    
-    final_image_binary = (resized_image > 0.4).astype('float32')
-    # cv2.imwrite('src/processed_frame.png', final_image_binary * 255) # Save the processed image for debugging and verification
-    return final_image_binary
-
 # Main script
 def capture_and_save_image():
     cap = cv2.VideoCapture(0)
@@ -0,0 +1,110 @@
+/*
+    Frame change detection and prediction smoothing for the real-time UART loop
+    Author: Shwetank Shekhar
+
+    Webcam frames arriving back to back are usually identical once binarized to
+    12x12. Each new frame is compared with the previous one; if no more than
+    FRAME_CHANGE_MAX_DIFF pixels differ, inference is skipped and the last raw
+    prediction is reused. Raw predictions then go through a FRAME_VOTE_WINDOW
+    majority vote so a single noisy frame does not flip the reported digit.
+*/
+
+#ifndef FRAME_FILTER_H
+#define FRAME_FILTER_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define FRAME_SIZE 144
+
+// Pixels allowed to differ before a frame counts as changed (0 = identical).
+#ifndef FRAME_CHANGE_MAX_DIFF
+#define FRAME_CHANGE_MAX_DIFF 0
+#endif
+
+// Number of recent raw predictions in the majority vote (1 disables smoothing).
+#ifndef FRAME_VOTE_WINDOW
+#define FRAME_VOTE_WINDOW 5
+#endif
+
+typedef struct {
+    int8_t prev_frame[FRAME_SIZE];
+    uint8_t has_prev;
+    uint8_t last_pred;
+    uint8_t history[FRAME_VOTE_WINDOW];
+    uint32_t history_len;
+    uint32_t history_pos;
+    unsigned long frames;
+    unsigned long skipped;
+} frame_filter_t;
+
+/**
+ * @brief Resets the filter; the next frame always runs inference.
+ *
+ * @param f Pointer to the filter state.
+ */
+void frame_filter_init(frame_filter_t* f) {
+    memset(f, 0, sizeof(*f));
+}
+
+/**
+ * @brief Compares a frame with the previous one and remembers it.
+ *
+ * Stops counting as soon as the difference exceeds the threshold, so a changed
+ * frame usually costs only a few byte compares.
+ *
+ * @param f Pointer to the filter state.
+ * @param frame Pointer to the incoming int8 frame (FRAME_SIZE bytes).
+ * @return 1 if inference can be skipped, 0 if the frame changed.
+ */
+int frame_filter_unchanged(frame_filter_t* f, const int8_t* frame) {
+    int unchanged = f->has_prev;
+    uint32_t diff = 0;
+
+    f->frames++;
+    for (uint32_t i = 0; unchanged && i < FRAME_SIZE; i++) {
+        if (frame[i] != f->prev_frame[i] && ++diff > FRAME_CHANGE_MAX_DIFF) {
+            unchanged = 0;
+        }
+    }
+    if (unchanged) {
+        f->skipped++;
+    } else {
+        memcpy(f->prev_frame, frame, FRAME_SIZE);
+        f->has_prev = 1;
+    }
+    return unchanged;
+}
+
+/**
+ * @brief Adds a raw prediction to the vote window and returns the majority digit.
+ *
+ * Ties go to the digit seen most recently.
+ *
+ * @param f Pointer to the filter state.
+ * @param pred Raw prediction (0-9) of the current frame.
+ * @return The smoothed prediction.
+ */
+uint8_t frame_filter_vote(frame_filter_t* f, uint8_t pred) {
+    uint8_t votes[10] = {0};
+    uint8_t best = pred;
+
+    f->last_pred = pred;
+    f->history[f->history_pos] = pred;
+    f->history_pos = (f->history_pos + 1) % FRAME_VOTE_WINDOW;
+    if (f->history_len < FRAME_VOTE_WINDOW) {
+        f->history_len++;
+    }
+
+    // Walk from the newest entry backwards so ties keep the most recent digit.
+    for (uint32_t k = 0; k < f->history_len; k++) {
+        uint8_t d = f->history[(f->history_pos + FRAME_VOTE_WINDOW - 1 - k) % FRAME_VOTE_WINDOW];
+        votes[d]++;
+        if (votes[d] > votes[best]) {
+            best = d;
+        }
+    }
+    return best;
+}
+
+#endif // FRAME_FILTER_H
@@ -0,0 +1,119 @@
+'''
+    frame_stream.py
+    Author: Shwetank Shekhar
+
+    Compact binary recording of preprocessed frames, so the camera pipeline can
+    be benchmarked without a webcam (send_image_uart.py --record / --replay,
+    uart_farm.py --replay).
+
+    File layout (little endian):
+        header : 8s magic "MNISTFS1", uint16 frame_size, uint16 reserved
+        record : uint64 timestamp_us (since the first frame), int8 label
+                 (-1 = unknown, e.g. live webcam), int8 pixels[frame_size]
+
+    Records are appended as they arrive, so a recording cut short by Ctrl+C
+    is still readable up to the last complete frame.
+
+    python src/frame_stream.py --info rec.bin
+    python src/frame_stream.py --from-params rec.bin --count 1000 --fps 30
+'''
+import argparse
+import struct
+import time
+
+import numpy as np
+
+MAGIC = b"MNISTFS1"
+HEADER = struct.Struct("<8sHH")
+RECORD_HEADER = struct.Struct("<Qb")
+FRAME_SIZE = 144
+UNKNOWN_LABEL = -1
+
+
+class FrameRecorder:
+    """Appends (timestamp, frame, label) records; timestamps are relative to the first frame."""
+
+    def __init__(self, path, frame_size=FRAME_SIZE):
+        self.frame_size = frame_size
+        self.f = open(path, "wb")
+        self.f.write(HEADER.pack(MAGIC, frame_size, 0))
+        self.t0 = None
+        self.count = 0
+
+    def write(self, frame, label=UNKNOWN_LABEL, t=None):
+        t = time.perf_counter() if t is None else t
+        if self.t0 is None:
+            self.t0 = t
+        data = np.asarray(frame, dtype=np.int8).tobytes()
+        if len(data) != self.frame_size:
+            raise ValueError(f"frame has {len(data)} bytes, expected {self.frame_size}")
+        self.f.write(RECORD_HEADER.pack(int(round((t - self.t0) * 1e6)), label) + data)
+        self.count += 1
+
+    def close(self):
+        self.f.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+
+def read_frames(path):
+    """Returns (timestamps_s float64[N], frames int8[N, frame_size], labels int8[N])."""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, frame_size, _ = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise ValueError(f"{path}: not a frame stream (magic {magic!r})")
+    record = np.dtype([("t_us", "<u8"), ("label", "i1"), ("pixels", "i1", (frame_size,))])
+    n = (len(data) - HEADER.size) // record.itemsize  # ignore a truncated last record
+    records = np.frombuffer(data, dtype=record, count=n, offset=HEADER.size)
+    return records["t_us"] / 1e6, records["pixels"].copy(), records["label"].copy()
+
+
+def replay(timestamps, frames, labels, rate="original", stop=None):
+    """Yields (frame, label) pacing them at the recorded timestamps, or back to back for rate="max"."""
+    t_start = time.perf_counter()
+    for t, frame, label in zip(timestamps, frames, labels):
+        if stop is not None and stop.is_set():
+            return
+        if rate == "original":
+            delay = t_start + t - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+        yield frame, int(label)
+
+
+def record_from_params(path, count, fps, params_file):
+    """Synthesizes a labelled recording from the test-set samples at a fixed frame rate."""
+    from model_params import load_test_samples
+    samples = load_test_samples(params_file)
+    with FrameRecorder(path) as rec:
+        for i in range(count):
+            frame, label = samples[i % len(samples)]
+            rec.write(frame, label, t=i / fps)
+    return count
+
+
+if __name__ == "__main__":
+    from model_params import MODEL_PARAMS_C
+
+    ap = argparse.ArgumentParser(description="Inspect or synthesize frame recordings.")
+    ap.add_argument("--info", metavar="FILE", help="print a summary of a recording")
+    ap.add_argument("--from-params", metavar="FILE", help="write a recording of the built-in sample frames")
+    ap.add_argument("--count", type=int, default=100)
+    ap.add_argument("--fps", type=float, default=30.0)
+    ap.add_argument("--params", default=MODEL_PARAMS_C)
+    args = ap.parse_args()
+
+    if args.from_params:
+        n = record_from_params(args.from_params, args.count, args.fps, args.params)
+        print(f"Wrote {n} frames to {args.from_params}")
+    if args.info:
+        ts, frames, labels = read_frames(args.info)
+        span = ts[-1] if len(ts) else 0.0
+        print(f"{args.info}: {len(frames)} frames of {frames.shape[1]} bytes, {span:.2f} s, "
+              f"{(len(ts) - 1) / span if span else 0:.2f} fps, "
+              f"{int(np.sum(labels >= 0))} labelled")
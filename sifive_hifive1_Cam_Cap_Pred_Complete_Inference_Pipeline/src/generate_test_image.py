@@ -1,7 +1,6 @@
 import numpy as np
-import tensorflow as tf
-from skimage.transform import resize
-import io
+
+from preprocess import preprocess_image, quantize_image
 
 def generate_c_hex_array(digit, INPUT_SCALE, INPUT_ZERO_POINT):
     """
@@ -23,40 +22,9 @@ def generate_c_hex_array(digit, INPUT_SCALE, INPUT_ZERO_POINT):
         # Fallback for other digits, prints a simple square to avoid error
         image_28x28_raw[10:18, 10:18] = 255
 
-    # Normalize the image
-    image_28x28 = image_28x28_raw.astype('float32') / 255.0
-
-    # Find bounding box
-    rows = np.any(image_28x28 > 0.05, axis=1) # Use a very low threshold
-    cols = np.any(image_28x28 > 0.05, axis=0)
-
-    # Check if any non-zero pixels were found
-    if not np.any(rows):
-        # Return an array of all zeroes if no digit is found
-        quantized_image = np.full((144,), INPUT_ZERO_POINT, dtype=np.int8)
-    else:
-        ymin, ymax = np.where(rows)[0][[0, -1]]
-        xmin, xmax = np.where(cols)[0][[0, -1]]
-        
-        buffer = 2
-        ymin = max(0, ymin - buffer)
-        ymax = min(28, ymax + buffer)
-        xmin = max(0, xmin - buffer)
-        xmax = min(28, xmax + buffer)
-
-        cropped_image = image_28x28[ymin:ymax, xmin:xmax]
-
-        resized_image = tf.image.resize(
-            np.expand_dims(cropped_image, axis=-1), 
-            (12, 12), 
-            method='bilinear'
-        ).numpy().squeeze()
-
-        final_image_binary = (resized_image > 0.4).astype('float32')
-        
-        # Quantize the image to int8
-        quantized_image = np.round(final_image_binary / INPUT_SCALE + INPUT_ZERO_POINT)
-        quantized_image = np.clip(quantized_image, -128, 127).astype(np.int8)
+    # Use a very low bounding-box threshold for the synthetic strokes
+    final_image_binary = preprocess_image(image_28x28_raw, bbox_threshold=0.05)
+    quantized_image = quantize_image(final_image_binary, INPUT_SCALE, INPUT_ZERO_POINT)
 
     # Convert the flattened array to a C-style hex string
     hex_string = ", ".join([f"{val}" for val in quantized_image.flatten()])
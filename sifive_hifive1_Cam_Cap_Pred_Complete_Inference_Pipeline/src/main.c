@@ -16,15 +16,37 @@
 
 // FOR TIMER
 #include <metal/timer.h>
+#include <metal/clock.h>
+#include <metal/machine.h>
 
 // int metal_uart_read(struct metal_uart *uart, uint8_t *c, size_t length);
 
+// Per-layer prints plus the UART settle delays after them. Both run inside
+// the timed region, so leave them off when reading the mean cycle count.
+#ifndef DEBUG_PRINTS
+#define DEBUG_PRINTS 0
+#endif
+
 #include "app_inference.h"
 #include "mnist_model_params.h"
+#include "mnist_testset.h"
+#include "frame_filter.h"
 
 // Include the header file for captured image data
 #include "captured_image_data.h"
 
+// Set to 1 to run the real-time UART loop driven by send_image_uart.py or
+// uart_farm.py, 0 to run the static captured-image test below.
+#define UART_REALTIME_MODE 0
+
+// Real-time mode only: skip inference on frames identical to the previous one
+// and majority-vote the predictions (see frame_filter.h). 0 runs every frame.
+#define FRAME_FILTER_ENABLE 1
+
+// Static mode only: sweep mnist_testset (accuracy and mean cycles) before the
+// captured-image test.
+#define TESTSET_BENCHMARK 1
+
 // 12x12=144.
 #define L1_incoming_weights 144
 #define L1_outgoing_weights 64
@@ -49,7 +71,7 @@ void display_banner(void) {
     printf("By Shwetank Shekhar\n");
 }
 
-void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t sample) {
+uint32_t QInt8Predict(const int8_t *input) {
     static int32_t layer1_sum[L1_outgoing_weights];
     static int8_t layer1_out[L1_outgoing_weights];
     static int32_t layer2_sum[L2_outgoing_weights];
@@ -57,34 +79,19 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
     static int32_t layer3_sum[L3_outgoing_weights];
     uint32_t pred_digit;
 
-    printf("Clearing arrays...\n");
     memset(layer1_sum, 0, sizeof(layer1_sum));
     memset(layer1_out, 0, sizeof(layer1_out));
     memset(layer2_sum, 0, sizeof(layer2_sum));
     memset(layer2_out, 0, sizeof(layer2_out));
     memset(layer3_sum, 0, sizeof(layer3_sum));
 
-    printf("Processing input for sample %d\n", sample);
-    software_delay(1000);
-
-    unsigned long long start_time;
-    unsigned long long end_time;
-    unsigned long long timebase_freq;
-    
-    metal_timer_get_timebase_frequency(0, &timebase_freq);
-    metal_timer_get_cyclecount(0, &start_time);
-
     // Layer 1 Processing
-    printf("Starting first layer...\n");
     processfclayer(input, L1_weights, L1_biases, L1_incoming_weights, L1_outgoing_weights, layer1_sum,
                    L1_input_zero_point, L1_weights_zero_point);
-    software_delay(1000);
-
-    printf("Applying ReLU and Requantizing first layer...\n");
     quantized_relu_requantize(layer1_sum, layer1_out, L1_outgoing_weights, 
                              L1_output_scale, L2_input_scale, L2_input_zero_point);
-    software_delay(1000);
 
+#if DEBUG_PRINTS
     // Debug prints
     int min1 = 0, max1 = 0;
     for(int i=0; i<L1_outgoing_weights; i++) {
@@ -93,18 +100,16 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
     }
     printf("Layer1 ReLU range: %d to %d\n", min1, max1);
     printf("Layer1 sample activations: %d %d %d %d\n", layer1_out[0], layer1_out[1], layer1_out[2], layer1_out[3]);
+    software_delay(1000);
+#endif
 
     // Layer 2 Processing
-    printf("Starting second layer...\n");
     processfclayer(layer1_out, L2_weights, L2_biases, L2_incoming_weights, L2_outgoing_weights, layer2_sum,
                    L2_input_zero_point, L2_weights_zero_point);
-    software_delay(1000);
-
-    printf("Applying ReLU and Requantizing second layer...\n");
     quantized_relu_requantize(layer2_sum, layer2_out, L2_outgoing_weights, 
                              L2_output_scale, L3_input_scale, L3_input_zero_point);
-    software_delay(1000);
 
+#if DEBUG_PRINTS
     // Debug prints
     int min2 = 0, max2 = 0;
     for(int i=0; i<L2_outgoing_weights; i++) {
@@ -113,26 +118,24 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
     }
     printf("Layer2 ReLU range: %d to %d\n", min2, max2);
     printf("Layer2 sample activations: %d %d %d %d\n", layer2_out[0], layer2_out[1], layer2_out[2], layer2_out[3]);
+    software_delay(1000);
+#endif
 
     // Layer 3 Processing (Output Layer)
-    printf("Starting final layer...\n");
     processfclayer(layer2_out, L3_weights, L3_biases, L3_incoming_weights, L3_outgoing_weights, layer3_sum,
                    L3_input_zero_point, L3_weights_zero_point);
-    software_delay(1000);
 
+#if DEBUG_PRINTS
     // Before prediction, print all output values
     printf("Output layer values: ");
     for(int i=0; i<L3_outgoing_weights; i++) {
         printf("%ld ", layer3_sum[i]);
     }
     printf("\n");
-
-    metal_timer_get_cyclecount(0, &end_time);
-    unsigned long long inference_time_us = (end_time - start_time) * 1000000ULL / timebase_freq;
-    printf("Inference completed in %llu us.\n", inference_time_us);
+    software_delay(1000);
+#endif
 
     // Find prediction
-    printf("Finding prediction...\n");
     int32_t max_val = layer3_sum[0];
     pred_digit = 0;
     
@@ -141,9 +144,23 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
             max_val = layer3_sum[i];
             pred_digit = i;
         }
-        software_delay(100);
     }
-    
+    return pred_digit;
+}
+
+void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t sample) {
+    unsigned long long start_time;
+    unsigned long long end_time;
+    unsigned long long timebase_freq;
+
+    printf("Processing input for sample %d\n", sample);
+    metal_timer_get_timebase_frequency(0, &timebase_freq);
+    metal_timer_get_cyclecount(0, &start_time);
+    uint32_t pred_digit = QInt8Predict(input);
+    metal_timer_get_cyclecount(0, &end_time);
+    unsigned long long inference_time_us = (end_time - start_time) * 1000000ULL / timebase_freq;
+    printf("Inference completed in %llu us.\n", inference_time_us);
+
     printf("Predicted digit: %ld, True Label: %d, Status: %s\n",
            pred_digit, label, (pred_digit == label) ? "PASS" : "FAIL");
     software_delay(1000);
@@ -151,6 +168,36 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
     printf("\n\n");
 }
 
+// Sweeps every sample in mnist_testset (see tools/model_compiler/testset.py)
+// and reports accuracy and the mean cycle count of QInt8Predict().
+void QInt8Benchmark(void) {
+    static int8_t buffer[MNIST_TESTSET_SAMPLE_SIZE];
+    testset_iter_t it;
+    const int8_t *input;
+    uint8_t label;
+    uint32_t correct = 0;
+    unsigned long long start_time, end_time, total_cycles = 0;
+
+    testset_begin(&it, &mnist_testset);
+    while ((input = testset_next(&it, buffer, &label)) != NULL) {
+        metal_timer_get_cyclecount(0, &start_time);
+        uint32_t pred_digit = QInt8Predict(input);
+        metal_timer_get_cyclecount(0, &end_time);
+        total_cycles += end_time - start_time;
+        correct += (pred_digit == label);
+
+        printf("Sample %lu: Predicted digit: %lu, True Label: %d, Status: %s, Cycles: %llu\n",
+               (unsigned long)it.index, (unsigned long)pred_digit, label,
+               (pred_digit == label) ? "PASS" : "FAIL", end_time - start_time);
+    }
+
+    printf("\nAccuracy: %lu/%lu (%lu.%02lu%%), mean cycles per inference: %llu\n",
+           (unsigned long)correct, (unsigned long)MNIST_TESTSET_COUNT,
+           (unsigned long)(correct * 100 / MNIST_TESTSET_COUNT),
+           (unsigned long)(correct * 10000 / MNIST_TESTSET_COUNT % 100),
+           total_cycles / MNIST_TESTSET_COUNT);
+}
+
 // New input data for testing
 const int8_t input_data_new[144] = {
     -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, 127, 127, 127, 127, 127, 127, 127, 127, 127, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, 127, 127, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, 127, 127, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, 127, 127, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, 127, 127, 127, 127, 127, 127, 127, 127, 127, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, 127, 127, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, 127, 127, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, 127, 127, 127, 127, 127, 127, 127, 127, 127, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128
@@ -214,43 +261,72 @@ void read_image_from_uart_with_timer(int8_t* buffer) {
 int main(void) {
     display_banner();
     printf("Starting MNIST inference...\n");
-    /*
-     * Uncomment when you want to test the below:
-     *
-    QInt8Inference(input_data_0, label_0, 1);
-    QInt8Inference(input_data_1, label_1, 2);
-    QInt8Inference(input_data_2, label_2, 3);
-    QInt8Inference(input_data_3, label_3, 4);
-    QInt8Inference(input_data_4, label_4, 5);
-    QInt8Inference(input_data_5, label_5, 6);
-    QInt8Inference(input_data_6, label_6, 7);
-    QInt8Inference(input_data_7, label_7, 8);
-    QInt8Inference(input_data_8, label_8, 9);
-    QInt8Inference(input_data_9, label_9, 10);
-    */
 
     //TEST GENERATED IMAGE FROM THE generate_test_image.py
     // printf("Custom Test Image...\n");
     // QInt8Inference(input_data_new, 3, 11);
 
-    // Uncomment to test with the captured image data
-    // Test with the captured image
-    printf("Testing with captured webcam image...\n");
-    // The second parameter is the true label; we don't know it, so we'll use a placeholder (0)
-    QInt8Inference(captured_image, 8, 12);
-
-    // Uncomment for Real-time inference mode using UART
-    /*
+#if UART_REALTIME_MODE
     printf("Starting MNIST inference in real-time mode...\n");
 
     int8_t input_buffer[144];
+#if FRAME_FILTER_ENABLE
+    static frame_filter_t filter;
+    unsigned long long first_frame_time = 0, now;
+    // mcycle counts core clock cycles, and the FE310 core runs from the PLL.
+    const unsigned long long core_freq =
+        metal_clock_get_rate_hz(&__METAL_DT_SIFIVE_FE310_G000_PLL_HANDLE->clock);
+
+    frame_filter_init(&filter);
+    while(1) {
+        read_image_from_uart_with_timer(input_buffer);
+
+        uint32_t pred_digit;
+        if (frame_filter_unchanged(&filter, input_buffer)) {
+            printf("Frame unchanged, inference skipped.\n");
+            pred_digit = filter.last_pred;
+        } else {
+            pred_digit = QInt8Predict(input_buffer);
+        }
+        uint8_t smoothed = frame_filter_vote(&filter, (uint8_t)pred_digit);
+
+        // Effective fps counts every frame answered, inferred or skipped.
+        metal_timer_get_cyclecount(0, &now);
+        if (filter.frames == 1) {
+            first_frame_time = now;
+        }
+        unsigned long long elapsed = now - first_frame_time;
+        unsigned long fps_x100 = elapsed ? (unsigned long)((filter.frames - 1) * core_freq * 100ULL / elapsed) : 0;
+        printf("Smoothed digit: %d, Skipped: %lu/%lu (%lu%%), Effective fps: %lu.%02lu\n",
+               smoothed, filter.skipped, filter.frames, filter.skipped * 100 / filter.frames,
+               fps_x100 / 100, fps_x100 % 100);
+
+        // Last line: the host scores this frame's own prediction against its
+        // label and sends the next frame as soon as it sees it. The vote spans
+        // unrelated frames when the host streams a test set, so it stays on
+        // the line above.
+        printf("Predicted digit: %lu, True Label: %d, Status: %s\n",
+               (unsigned long)pred_digit, 0, (pred_digit == 0) ? "PASS" : "FAIL");
+    }
+#else
     while(1) {
         read_image_from_uart_with_timer(input_buffer);
         // Assuming we send a label along with the image for testing
         // For now, let's assume the label is known on the host side
         QInt8Inference(input_buffer, 0, 0); // Label and sample ID can be placeholder for now
     }
-	*/
+#endif
+#else
+#if TESTSET_BENCHMARK
+    printf("Sweeping %d test samples...\n", MNIST_TESTSET_COUNT);
+    QInt8Benchmark();
+#endif
+
+    // Test with the captured image
+    printf("Testing with captured webcam image...\n");
+    // The second parameter is the true label; we don't know it, so we'll use a placeholder (0)
+    QInt8Inference(captured_image, 8, 12);
+#endif
     return 0;
 }
 
@@ -0,0 +1,44 @@
+/*
+ * This file is auto-generated by tools/model_compiler/testset.py.
+ * Do not modify manually.
+ */
+#include "mnist_testset.h"
+
+static const uint8_t mnist_testset_blob[MNIST_TESTSET_BLOB_SIZE] = {
+    138, 128, 129, 127, 136, 128, 132, 127, 135, 128, 1, 127, 127, 134, 128, 1, 127, 127, 135, 128, 0, 127, 135, 128,
+    1, 127, 127, 134, 128, 1, 127, 127, 135, 128, 0, 127, 135, 128, 1, 127, 127, 134, 128, 1, 127, 127, 143, 128,
+    140, 128, 128, 127, 133, 128, 130, 127, 131, 128, 4, 127, 127, 128, 128, 127, 135, 128, 1, 127, 127, 135, 128, 1,
+    127, 127, 134, 128, 1, 127, 127, 134, 128, 1, 127, 127, 135, 128, 1, 127, 127, 135, 128, 0, 127, 131, 128, 1,
+    127, 127, 128, 128, 134, 127, 131, 128, 0, 127, 131, 128, 145, 128, 1, 127, 127, 135, 128, 1, 127, 127, 134, 128,
+    1, 127, 127, 134, 128, 128, 127, 134, 128, 1, 127, 127, 134, 128, 128, 127, 133, 128, 128, 127, 133, 128, 128, 127,
+    134, 128, 128, 127, 133, 128, 128, 127, 144, 128, 142, 128, 1, 127, 127, 134, 128, 128, 127, 133, 128, 131, 127, 130,
+    128, 129, 127, 3, 128, 128, 127, 127, 129, 128, 1, 127, 127, 130, 128, 1, 127, 127, 128, 128, 0, 127, 131, 128,
+    5, 127, 127, 128, 128, 127, 127, 130, 128, 128, 127, 3, 128, 128, 127, 127, 128, 128, 129, 127, 128, 128, 133, 127,
+    130, 128, 131, 127, 141, 128, 141, 128, 0, 127, 135, 128, 1, 127, 127, 130, 128, 0, 127, 129, 128, 0, 127, 131,
+    128, 0, 127, 128, 128, 1, 127, 127, 130, 128, 5, 127, 127, 128, 128, 127, 127, 131, 128, 5, 127, 127, 128, 128,
+    127, 127, 130, 128, 1, 127, 127, 129, 128, 133, 127, 135, 128, 1, 127, 127, 135, 128, 1, 127, 127, 135, 128, 1,
+    127, 127, 139, 128, 145, 128, 128, 127, 133, 128, 129, 127, 132, 128, 129, 127, 132, 128, 129, 127, 133, 128, 128, 127,
+    133, 128, 129, 127, 132, 128, 129, 127, 133, 128, 128, 127, 133, 128, 129, 127, 133, 128, 128, 127, 144, 128, 140, 128,
+    0, 127, 131, 128, 0, 127, 128, 128, 1, 127, 127, 130, 128, 0, 127, 129, 128, 0, 127, 130, 128, 1, 127, 127,
+    128, 128, 1, 127, 127, 129, 128, 1, 127, 127, 130, 128, 132, 127, 135, 128, 0, 127, 135, 128, 1, 127, 127, 135,
+    128, 0, 127, 135, 128, 1, 127, 127, 135, 128, 128, 127, 141, 128, 141, 128, 0, 127, 134, 128, 129, 127, 133, 128,
+    130, 127, 132, 128, 2, 127, 128, 128, 128, 127, 131, 128, 1, 127, 128, 129, 127, 131, 128, 128, 127, 2, 128, 127,
+    127, 136, 128, 1, 127, 127, 136, 128, 1, 127, 127, 136, 128, 0, 127, 136, 128, 1, 127, 127, 138, 128, 145, 128,
+    2, 127, 128, 127, 131, 128, 132, 127, 128, 128, 1, 127, 128, 128, 127, 131, 128, 0, 127, 135, 128, 1, 127, 127,
+    135, 128, 1, 127, 127, 135, 128, 132, 127, 132, 128, 131, 127, 133, 128, 129, 127, 133, 128, 128, 127, 141, 128, 143,
+    128, 129, 127, 130, 128, 129, 127, 0, 128, 128, 127, 128, 128, 1, 127, 127, 129, 128, 128, 127, 128, 128, 134, 127,
+    129, 128, 131, 127, 134, 128, 1, 127, 127, 134, 128, 1, 127, 127, 134, 128, 128, 127, 133, 128, 128, 127, 134, 128,
+    1, 127, 127, 144, 128
+};
+
+static const uint8_t mnist_testset_labels[MNIST_TESTSET_COUNT] = {
+    7, 2, 1, 0, 4, 1, 4, 9, 5, 9
+};
+
+const testset_t mnist_testset = {
+    mnist_testset_blob,
+    mnist_testset_labels,
+    MNIST_TESTSET_COUNT,
+    MNIST_TESTSET_SAMPLE_SIZE,
+    TESTSET_RLE,
+};
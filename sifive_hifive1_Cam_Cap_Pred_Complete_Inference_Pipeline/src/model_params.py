@@ -0,0 +1,92 @@
+'''
+    model_params.py
+    Author: Shwetank Shekhar
+
+    Loads the generated mnist_model_params.c and mnist_testset.c back into
+    NumPy so host-side tools (board simulator, inference farm, preprocessing
+    checks) use exactly the weights and sample images that are flashed on the
+    board.
+'''
+import os
+import re
+import sys
+
+import numpy as np
+
+MODEL_PARAMS_C = "src/mnist_model_params.c"
+TESTSET_C = "mnist_testset.c"  # next to the params file
+TOOLS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "tools", "model_compiler")
+
+C_TYPES = {
+    "int8_t": np.int8,
+    "uint8_t": np.uint8,
+    "int32_t": np.int32,
+    "uint32_t": np.uint32,
+    "float": np.float32,
+}
+
+# const <type> [ALIGN_16] <name>[<n>] = { ... };   or   const <type> <name> = <value>;
+DEFINITION_RE = re.compile(
+    r"const\s+(\w+)\s+(?:ALIGN_16\s+)?(\w+)\s*(\[\s*\d*\s*\])?\s*=\s*(\{.*?\}|[^;]+);",
+    re.S,
+)
+
+
+def _parse_value(text, dtype):
+    text = text.strip().rstrip("f")
+    if dtype == np.float32:
+        return np.float32(float(text))
+    return dtype(int(text, 0))
+
+
+def load_model_params(c_file=MODEL_PARAMS_C):
+    """Returns {name: ndarray or scalar} for every const definition in c_file."""
+    with open(c_file) as f:
+        source = f.read()
+    # Drop comments so commented-out arrays are not picked up.
+    source = re.sub(r"/\*.*?\*/", "", source, flags=re.S)
+    source = re.sub(r"//[^\n]*", "", source)
+
+    params = {}
+    for c_type, name, is_array, body in DEFINITION_RE.findall(source):
+        if c_type not in C_TYPES:
+            continue
+        dtype = C_TYPES[c_type]
+        if is_array:
+            items = [v for v in body.strip("{} \n").split(",") if v.strip()]
+            values = [_parse_value(v, dtype) for v in items]
+            params[name] = np.array(values, dtype=dtype)
+        else:
+            params[name] = _parse_value(body, dtype)
+    return params
+
+
+def load_samples(params):
+    """Returns [(image_int8[144], label)] for the input_data_N / label_N pairs."""
+    samples = []
+    i = 0
+    while f"input_data_{i}" in params:
+        samples.append((params[f"input_data_{i}"], int(params[f"label_{i}"])))
+        i += 1
+    return samples
+
+
+def load_test_samples(params_file=MODEL_PARAMS_C):
+    """[(image_int8[144], label)] from the test-set blob next to params_file.
+
+    Falls back to input_data_N / label_N in params_file for params generated
+    before the blob existed.
+    """
+    testset_c = os.path.join(os.path.dirname(params_file), TESTSET_C)
+    if not os.path.exists(testset_c):
+        return load_samples(load_model_params(params_file))
+    sys.path.insert(0, TOOLS_DIR)
+    from testset import load_testset
+    return load_testset(testset_c)
+
+
+if __name__ == "__main__":
+    p = load_model_params()
+    for k, v in p.items():
+        shape = v.shape if isinstance(v, np.ndarray) else "scalar"
+        print(f"{k}: {shape}")
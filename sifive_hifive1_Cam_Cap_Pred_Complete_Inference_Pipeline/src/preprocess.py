@@ -0,0 +1,207 @@
+'''
+    preprocess.py
+    Author: Shwetank Shekhar
+
+    NumPy/OpenCV-only version of the 28x28 -> 12x12 preprocessing used to build
+    the board's inputs (crop to the digit's bounding box + 2px, bilinear resize
+    to 12x12, threshold at 0.4, quantize to int8). It replaces the
+    tf.image.resize call so the host scripts no longer import TensorFlow.
+
+    The resize reproduces TensorFlow's ResizeBilinear kernel with
+    half_pixel_centers=True (the tf.image.resize default) operation for
+    operation in float32, so the int8 frames are bit-identical to the ones
+    the firmware was validated with.
+
+    python src/preprocess.py --verify     # check against the on-device golden inputs
+    python src/preprocess.py --bench      # frames per second, single and batched
+'''
+import argparse
+import os
+import re
+import time
+
+import cv2
+import numpy as np
+
+# Quantization parameters from mnist_model_params.c (L1 input)
+INPUT_SCALE = 0.00392157
+INPUT_ZERO_POINT = -128
+
+OUT_SIZE = 12
+BBOX_THRESHOLD = 0.1
+BINARY_THRESHOLD = 0.4
+BBOX_BUFFER = 2
+
+
+def _resize_weights(in_sizes, out_size=OUT_SIZE):
+    """TF compute_interpolation_weights() for a batch of input sizes -> (lower, upper, lerp), each (N, out)."""
+    scale = in_sizes.astype(np.float32) / np.float32(out_size)
+    centers = np.arange(out_size, dtype=np.float32) + np.float32(0.5)
+    src = centers[None, :] * scale[:, None] - np.float32(0.5)
+    src_floor = np.floor(src)
+    lower = np.maximum(src_floor.astype(np.int64), 0)
+    upper = np.minimum(np.ceil(src).astype(np.int64), (in_sizes - 1)[:, None])
+    lerp = (src - src_floor).astype(np.float32)
+    return lower, upper, lerp
+
+
+def _bounding_boxes(images_float, bbox_threshold):
+    """Per-image [ymin, ymax) / [xmin, xmax) crop, exactly as the original scripts slice it."""
+    mask = images_float > bbox_threshold
+    rows = mask.any(axis=2)
+    cols = mask.any(axis=1)
+    found = rows.any(axis=1)
+    n, h, w = images_float.shape
+    ymin = np.argmax(rows, axis=1)
+    ymax = h - 1 - np.argmax(rows[:, ::-1], axis=1)
+    xmin = np.argmax(cols, axis=1)
+    xmax = w - 1 - np.argmax(cols[:, ::-1], axis=1)
+    ymin = np.maximum(0, ymin - BBOX_BUFFER)
+    ymax = np.minimum(h, ymax + BBOX_BUFFER)
+    xmin = np.maximum(0, xmin - BBOX_BUFFER)
+    xmax = np.minimum(w, xmax + BBOX_BUFFER)
+    return found, ymin, ymax, xmin, xmax
+
+
+def preprocess_batch(images_28x28_raw, bbox_threshold=BBOX_THRESHOLD):
+    """(N, 28, 28) uint8 -> (N, 12, 12) float32 binary images, fully vectorized."""
+    images = np.asarray(images_28x28_raw)
+    if images.ndim == 2:
+        images = images[None]
+    image_float = images.astype('float32') / 255.0
+    found, ymin, ymax, xmin, xmax = _bounding_boxes(image_float, bbox_threshold)
+
+    y0, y1, ly = _resize_weights(ymax - ymin)
+    x0, x1, lx = _resize_weights(xmax - xmin)
+    n = np.arange(len(images))[:, None, None]
+    y0 = (ymin[:, None] + y0)[:, :, None]
+    y1 = (ymin[:, None] + y1)[:, :, None]
+    x0 = (xmin[:, None] + x0)[:, None, :]
+    x1 = (xmin[:, None] + x1)[:, None, :]
+    lx = lx[:, None, :]
+    ly = ly[:, :, None]
+
+    # Same association order as TF's compute_lerp() so float32 rounding matches.
+    top_left, top_right = image_float[n, y0, x0], image_float[n, y0, x1]
+    bottom_left, bottom_right = image_float[n, y1, x0], image_float[n, y1, x1]
+    top = top_left + (top_right - top_left) * lx
+    bottom = bottom_left + (bottom_right - bottom_left) * lx
+    resized = top + (bottom - top) * ly
+
+    binary = (resized > BINARY_THRESHOLD).astype('float32')
+    binary[~found] = 0.0
+    return binary
+
+
+def preprocess_image(image_28x28_raw, bbox_threshold=BBOX_THRESHOLD):
+    """Drop-in replacement for the old TensorFlow preprocess_image(): 28x28 -> 12x12 float32."""
+    return preprocess_batch(image_28x28_raw, bbox_threshold)[0]
+
+
+def quantize_image(image_float, scale=INPUT_SCALE, zero_point=INPUT_ZERO_POINT):
+    quantized = np.round(image_float / scale + zero_point)
+    return np.clip(quantized, -128, 127).astype(np.int8)
+
+
+def frame_to_input(frame_bgr):
+    """Webcam BGR frame -> flattened int8[144] ready to send to the board."""
+    gray_frame = cv2.cvtColor(frame_bgr, cv2.COLOR_BGR2GRAY)
+    resized_frame = cv2.resize(gray_frame, (28, 28), interpolation=cv2.INTER_AREA)
+    return quantize_image(preprocess_image(resized_frame)).flatten()
+
+
+# --- Golden-reference checks ---
+
+def _read_c_array(path, name):
+    with open(path) as f:
+        src = f.read()
+    m = re.search(name + r"\s*\[\s*\d*\s*\]\s*=\s*\{(.*?)\}", src, re.S)
+    return np.array([int(v) for v in m.group(1).split(",") if v.strip()], dtype=np.int8)
+
+
+def _synthetic_three():
+    # Same drawing as generate_test_image.py
+    image = np.zeros((28, 28), dtype=np.uint8)
+    image[4:6, 10:18] = 255
+    image[6:10, 16:18] = 255
+    image[12:14, 10:18] = 255
+    image[14:18, 16:18] = 255
+    image[20:22, 10:18] = 255
+    return image
+
+
+def verify(src_dir="src", mnist_path=os.path.expanduser("~/.keras/datasets/mnist.npz")):
+    ok = True
+
+    def check(name, got, want):
+        nonlocal ok
+        same = np.array_equal(got, want)
+        ok &= same
+        print(f"{name:<48} {'OK' if same else 'MISMATCH'} ({int(np.sum(got != want))} px differ)")
+
+    # 1. generate_test_image.py's synthetic '3' -> input_data_new[] in main.c (bbox threshold 0.05).
+    check("synthetic 3 -> input_data_new[]",
+          quantize_image(preprocess_image(_synthetic_three(), bbox_threshold=0.05)).flatten(),
+          _read_c_array(os.path.join(src_dir, "main.c"), "input_data_new"))
+
+    # 2. MNIST test images -> the mnist_testset.c blob (needs the Keras cache).
+    if os.path.exists(mnist_path):
+        from model_params import load_test_samples
+        samples = load_test_samples(os.path.join(src_dir, "mnist_model_params.c"))
+        x_test = np.load(mnist_path)["x_test"][:len(samples)]
+        got = quantize_image(preprocess_batch(x_test)).reshape(len(samples), -1)
+        for i, (want, _) in enumerate(samples):
+            check(f"MNIST x_test[{i}] -> mnist_testset[{i}]", got[i], want)
+
+        # 3. Bit-exactness against TensorFlow itself, when it is installed.
+        try:
+            import tensorflow as tf
+        except ImportError:
+            tf = None
+        if tf is not None:
+            x_all = np.load(mnist_path)["x_test"]
+            mine = preprocess_batch(x_all)
+            for i, img in enumerate(x_all):
+                f = img.astype('float32') / 255.0
+                _, ymin, ymax, xmin, xmax = [v[0] for v in _bounding_boxes(f[None], BBOX_THRESHOLD)]
+                ref = tf.image.resize(np.expand_dims(f[ymin:ymax, xmin:xmax], -1), (12, 12),
+                                      method='bilinear').numpy().squeeze()
+                if not np.array_equal(mine[i], (ref > BINARY_THRESHOLD).astype('float32')):
+                    ok = False
+                    print(f"tf.image.resize mismatch on x_test[{i}]")
+            print(f"tf.image.resize on {len(x_all)} MNIST test images done")
+    else:
+        print(f"{mnist_path} not found, skipping MNIST checks")
+    return ok
+
+
+def bench(n_frames=10000, seed=0):
+    rng = np.random.default_rng(seed)
+    images = np.zeros((n_frames, 28, 28), dtype=np.uint8)
+    for img in images:
+        y, x = rng.integers(2, 12, size=2)
+        h, w = rng.integers(8, 14, size=2)
+        img[y:y + h, x:x + w] = rng.integers(0, 256, size=(h, w))
+
+    t0 = time.perf_counter()
+    for img in images[:2000]:
+        quantize_image(preprocess_image(img))
+    single = 2000 / (time.perf_counter() - t0)
+
+    t0 = time.perf_counter()
+    quantize_image(preprocess_batch(images))
+    batched = n_frames / (time.perf_counter() - t0)
+    print(f"single-frame: {single:10.0f} frames/s")
+    print(f"batched:      {batched:10.0f} frames/s ({n_frames} frames)")
+
+
+if __name__ == "__main__":
+    ap = argparse.ArgumentParser(description="TensorFlow-free 12x12 preprocessing.")
+    ap.add_argument("--verify", action="store_true", help="compare against the on-device golden inputs")
+    ap.add_argument("--bench", action="store_true", help="measure frames per second")
+    ap.add_argument("--src", default="src")
+    args = ap.parse_args()
+    if args.verify:
+        raise SystemExit(0 if verify(args.src) else 1)
+    if args.bench:
+        bench()
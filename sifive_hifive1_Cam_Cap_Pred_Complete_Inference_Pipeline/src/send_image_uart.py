@@ -1,90 +1,311 @@
+'''
+    send_image_uart.py
+    Author: Shwetank Shekhar
+
+    Real-time webcam -> UART -> HiFive1 pipeline (main.c with UART_REALTIME_MODE 1).
+
+    Capture, transfer and display run decoupled:
+      * a capture thread grabs and preprocesses frames and drops them into a
+        one-slot, latest-frame-wins mailbox (older unsent frames are skipped),
+      * a serial worker always sends the newest frame and waits for the board's
+        "Predicted digit:" reply,
+      * the main thread only shows the feed (OpenCV GUI calls must stay there).
+    The serial link is never idle waiting for imshow, and latency is measured
+    from capture of the frame that was actually sent, not of a stale one.
+
+    On exit a summary (captured / sent / skipped frames, end-to-end latency
+    histogram) is printed and optionally written to --stats-out as JSON.
+
+    --record FILE stores every preprocessed frame with its capture time
+    (frame_stream.py format). --replay FILE feeds such a recording instead of
+    the webcam, either at the recorded pace (--rate original, frames can still
+    be skipped like live) or back to back (--rate max, every frame is sent).
+    With --sim the frames go to a simulated board, so fps/latency benchmarks
+    run deterministically on a headless box:
+        python src/send_image_uart.py --sim --replay rec.bin --rate max --stats-out s.json
+'''
+import argparse
+import json
+import re
+import threading
+import time
+
 import serial
 import cv2
 import numpy as np
-import tensorflow as tf
+
+# TensorFlow-free preprocessing, bit-identical to the old tf.image.resize path
+from preprocess import frame_to_input
+from frame_stream import FrameRecorder, UNKNOWN_LABEL, read_frames, replay
 
 # --- Configuration ---
-# !!! IMPORTANT: Replace with your actual serial port and quantization values
+# !!! IMPORTANT: Replace with your actual serial port
 SERIAL_PORT = 'COM10'  # Example: 'COM3' on Windows or '/dev/ttyUSB0' on Linux
 BAUD_RATE = 115200
+START_BYTE = b'\xAA'
+REPLY_TIMEOUT_S = 5.0
+PREDICTION_RE = re.compile(r"Predicted digit:\s*(-?\d+)")
+
+# Upper bucket edges of the end-to-end latency histogram, in ms
+LATENCY_BUCKETS_MS = [10, 20, 50, 100, 200, 500, 1000, 2000, 5000]
+
+
+class LatestFrameSlot:
+    """One-element mailbox: put() overwrites an unread item, get() blocks until one arrives.
+
+    put(item, block=True) instead waits for the previous item to be taken, so
+    nothing is skipped (used for max-rate replay).
+    """
+
+    def __init__(self):
+        self._cond = threading.Condition()
+        self._item = None
+        self.skipped = 0
+
+    def put(self, item, block=False, stop=None):
+        with self._cond:
+            while block and self._item is not None and not (stop and stop.is_set()):
+                self._cond.wait(0.1)
+            if self._item is not None:
+                self.skipped += 1
+            self._item = item
+            self._cond.notify_all()
+
+    def get(self, timeout=None):
+        with self._cond:
+            if self._item is None:
+                self._cond.wait(timeout)
+            item, self._item = self._item, None
+            self._cond.notify_all()
+            return item
+
+    def empty(self):
+        with self._cond:
+            return self._item is None
+
+
+class LatencyHistogram:
+    def __init__(self, edges_ms=LATENCY_BUCKETS_MS):
+        self.edges_ms = list(edges_ms)
+        self.counts = [0] * (len(self.edges_ms) + 1)
+        self.samples = []
+
+    def add(self, latency_ms):
+        self.samples.append(latency_ms)
+        for i, edge in enumerate(self.edges_ms):
+            if latency_ms <= edge:
+                self.counts[i] += 1
+                return
+        self.counts[-1] += 1
+
+    def percentile(self, q):
+        if not self.samples:
+            return float("nan")
+        return float(np.percentile(self.samples, q))
 
-# Quantization parameters from your mnist_model_params.c file
-INPUT_SCALE = 0.00392157
-INPUT_ZERO_POINT = -128
-
-# --- Preprocessing Function (from your other scripts) ---
-def preprocess_image(image_28x28_raw):
-    image_float = image_28x28_raw.astype('float32') / 255.0
-    rows = np.any(image_float > 0.1, axis=1)
-    cols = np.any(image_float > 0.1, axis=0)
-
-    if not np.any(rows):
-        return np.full((12, 12), 0.0, dtype=np.float32)
-
-    ymin, ymax = np.where(rows)[0][[0, -1]]
-    xmin, xmax = np.where(cols)[0][[0, -1]]
-    buffer = 2
-    ymin = max(0, ymin - buffer)
-    ymax = min(28, ymax + buffer)
-    xmin = max(0, xmin - buffer)
-    xmax = min(28, xmax + buffer)
-
-    cropped_image = image_float[ymin:ymax, xmin:xmax]
-    resized_image = tf.image.resize(
-        np.expand_dims(cropped_image, axis=-1), 
-        (12, 12), 
-        method='bilinear'
-    ).numpy().squeeze()
-
-    final_image_binary = (resized_image > 0.4).astype('float32')
-    return final_image_binary
-
-# --- Main script ---
-try:
-    ser = serial.Serial(SERIAL_PORT, BAUD_RATE, timeout=1)
-    print(f"Connected to {SERIAL_PORT} at {BAUD_RATE} baud.")
-
-    cap = cv2.VideoCapture(0)
-    if not cap.isOpened():
-        print("Error: Could not open webcam.")
-        exit()
-
-    while True:
+    def to_dict(self):
+        labels = [f"<={e}ms" for e in self.edges_ms] + [f">{self.edges_ms[-1]}ms"]
+        return {
+            "buckets": dict(zip(labels, self.counts)),
+            "p50_ms": self.percentile(50),
+            "p90_ms": self.percentile(90),
+            "p99_ms": self.percentile(99),
+            "max_ms": max(self.samples) if self.samples else float("nan"),
+        }
+
+
+class PipelineStats:
+    def __init__(self):
+        self.captured = 0
+        self.sent = 0
+        self.replied = 0
+        self.timeouts = 0
+        self.labelled = 0
+        self.correct = 0
+        self.latency = LatencyHistogram()
+        self.t_start = time.perf_counter()
+
+    def to_dict(self, skipped):
+        elapsed = time.perf_counter() - self.t_start
+        return {
+            "elapsed_s": elapsed,
+            "captured": self.captured,
+            "sent": self.sent,
+            "skipped": skipped,
+            "replied": self.replied,
+            "timeouts": self.timeouts,
+            "capture_fps": self.captured / elapsed if elapsed else 0.0,
+            "inference_fps": self.replied / elapsed if elapsed else 0.0,
+            "accuracy": 100.0 * self.correct / self.labelled if self.labelled else float("nan"),
+            "end_to_end_latency": self.latency.to_dict(),
+        }
+
+
+def capture_loop(cap, send_slot, display_slot, stats, stop, recorder=None):
+    while not stop.is_set():
         ret, frame = cap.read()
         if not ret:
             continue
+        t_capture = time.perf_counter()
+        stats.captured += 1
+        image = frame_to_input(frame)
+        if recorder is not None:
+            recorder.write(image, t=t_capture)
+        send_slot.put((t_capture, image, UNKNOWN_LABEL))
+        display_slot.put(frame)
+
+
+def replay_loop(recording, rate, send_slot, stats, stop, done):
+    """Stands in for capture_loop: the replay time of a frame counts as its capture time."""
+    for image, label in replay(*recording, rate=rate, stop=stop):
+        stats.captured += 1
+        send_slot.put((time.perf_counter(), image, label), block=(rate == "max"), stop=stop)
+    done.set()
+
+
+def serial_loop(ser, send_slot, stats, stop, on_reply=None):
+    while not stop.is_set():
+        item = send_slot.get(timeout=0.1)
+        if item is None:
+            continue
+        t_capture, image, label = item
+        ser.write(START_BYTE + image.tobytes())
+        stats.sent += 1
+
+        deadline = time.perf_counter() + REPLY_TIMEOUT_S
+        while time.perf_counter() < deadline and not stop.is_set():
+            line = ser.readline().decode('utf-8', errors='replace').strip()
+            m = PREDICTION_RE.search(line)
+            if m:
+                stats.replied += 1
+                stats.latency.add((time.perf_counter() - t_capture) * 1000.0)
+                if label >= 0:
+                    stats.labelled += 1
+                    stats.correct += int(int(m.group(1)) == label)
+                if on_reply:
+                    on_reply(int(m.group(1)), line)
+                break
+        else:
+            if not stop.is_set():
+                stats.timeouts += 1
+
+
+def print_summary(summary):
+    print("\n--- Pipeline statistics ---")
+    for k in ("elapsed_s", "captured", "sent", "skipped", "replied", "timeouts", "capture_fps", "inference_fps",
+              "accuracy"):
+        v = summary[k]
+        print(f"{k:>14}: {v:.2f}" if isinstance(v, float) else f"{k:>14}: {v}")
+    lat = summary["end_to_end_latency"]
+    print(f"{'latency p50':>14}: {lat['p50_ms']:.1f} ms, p99: {lat['p99_ms']:.1f} ms")
+    for bucket, count in lat["buckets"].items():
+        print(f"{bucket:>14}: {count}")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Stream webcam digits to the HiFive1 over UART.")
+    ap.add_argument("--port", default=SERIAL_PORT)
+    ap.add_argument("--baud", type=int, default=BAUD_RATE)
+    ap.add_argument("--camera", type=int, default=0)
+    ap.add_argument("--no-display", action="store_true", help="run headless")
+    ap.add_argument("--stats-out", help="write pipeline statistics as JSON")
+    ap.add_argument("--record", metavar="FILE", help="save preprocessed frames + timestamps")
+    ap.add_argument("--replay", metavar="FILE", help="send a recording instead of the webcam feed")
+    ap.add_argument("--rate", choices=("original", "max"), default="original",
+                    help="replay pace: as recorded, or back to back without skipping")
+    ap.add_argument("--sim", action="store_true", help="talk to a simulated board (board_sim.py)")
+    args = ap.parse_args()
+    if args.replay and args.record:
+        ap.error("--record and --replay are mutually exclusive")
+    if args.replay:
+        args.no_display = True  # nothing to show, the recording holds 12x12 frames only
+
+    stats = PipelineStats()
+    send_slot = LatestFrameSlot()
+    display_slot = LatestFrameSlot()
+    stop = threading.Event()
+    last_reply = {"text": ""}
+
+    def on_reply(digit, line):
+        last_reply["text"] = f"Predicted: {digit}"
+        if not args.replay:
+            print(f"Board response: {line}")
 
-        # Convert to grayscale and resize to 28x28
-        gray_frame = cv2.cvtColor(frame, cv2.COLOR_BGR2GRAY)
-        resized_frame = cv2.resize(gray_frame, (28, 28), interpolation=cv2.INTER_AREA)
+    replay_done = threading.Event()
 
-        # Preprocess and quantize the image for the board
-        preprocessed_image = preprocess_image(resized_frame)
-        quantized_image = np.round(preprocessed_image / INPUT_SCALE + INPUT_ZERO_POINT).astype(np.int8)
+    def replay_finished():
+        # Last frame handed over and answered (or timed out).
+        return (replay_done.is_set() and send_slot.empty()
+                and stats.sent == stats.replied + stats.timeouts)
 
-        # Flatten and send data over UART
-        image_bytes = quantized_image.flatten().tobytes()
+    ser = cap = recorder = None
+    try:
+        port = args.port
+        if args.sim:
+            from board_sim import start_boards
+            port = start_boards(1)[0].port
+        ser = serial.Serial(port, args.baud, timeout=0.2)
+        print(f"Connected to {port} at {args.baud} baud.")
 
-        ser.write(b'\xAA')  # Send start byte
-        ser.write(image_bytes)
+        if args.replay:
+            recording = read_frames(args.replay)
+            print(f"Replaying {len(recording[1])} frames from {args.replay} at {args.rate} rate.")
+            source = threading.Thread(target=replay_loop,
+                                      args=(recording, args.rate, send_slot, stats, stop, replay_done), daemon=True)
+        else:
+            cap = cv2.VideoCapture(args.camera)
+            if not cap.isOpened():
+                print("Error: Could not open webcam.")
+                return
+            if args.record:
+                recorder = FrameRecorder(args.record)
+            source = threading.Thread(target=capture_loop,
+                                      args=(cap, send_slot, display_slot, stats, stop, recorder), daemon=True)
 
-        print("Image sent. Waiting for prediction...")
+        # Restart the clock so fps is not diluted by port/camera/recording setup.
+        stats.t_start = time.perf_counter()
+        workers = [
+            source,
+            threading.Thread(target=serial_loop, args=(ser, send_slot, stats, stop, on_reply), daemon=True),
+        ]
+        for w in workers:
+            w.start()
 
-        # Read and print response from board
-        response = ser.readline().decode('utf-8').strip()
-        if response:
-            print(f"Board response: {response}")
+        while not stop.is_set():
+            if args.replay and replay_finished():
+                break
+            if args.no_display:
+                time.sleep(0.01 if args.replay else 0.1)
+                continue
+            frame = display_slot.get(timeout=0.1)
+            if frame is not None:
+                cv2.putText(frame, last_reply["text"], (10, 30), cv2.FONT_HERSHEY_SIMPLEX, 1, (0, 255, 0), 2)
+                cv2.imshow('Webcam Feed', frame)
+            if cv2.waitKey(1) & 0xFF == ord('q'):
+                break
+    except serial.SerialException as e:
+        print(f"Serial Port Error: {e}")
+    except KeyboardInterrupt:
+        pass
+    finally:
+        summary = stats.to_dict(send_slot.skipped)
+        stop.set()
+        time.sleep(0.3)
+        if recorder is not None:
+            recorder.close()
+            print(f"Recorded {recorder.count} frames to {args.record}")
+        print_summary(summary)
+        if args.stats_out:
+            with open(args.stats_out, "w") as f:
+                json.dump(summary, f, indent=2)
+            print(f"Statistics written to {args.stats_out}")
+        if ser is not None and ser.is_open:
+            ser.close()
+            print("Serial port closed.")
+        if cap is not None:
+            cap.release()
+            cv2.destroyAllWindows()
 
-        cv2.imshow('Webcam Feed', frame)
-        if cv2.waitKey(1) & 0xFF == ord('q'):
-            break
 
-except serial.SerialException as e:
-    print(f"Serial Port Error: {e}")
-finally:
-    if 'ser' in locals() and ser.is_open:
-        ser.close()
-        print("Serial port closed.")
-    if 'cap' in locals():
-        cap.release()
-        cv2.destroyAllWindows()
\ No newline at end of file
+if __name__ == "__main__":
+    main()
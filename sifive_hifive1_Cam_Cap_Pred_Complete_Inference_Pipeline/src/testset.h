@@ -0,0 +1,63 @@
+/*
+    Iterator over the labelled test-set blob written by tools/model_compiler/testset.py
+    Author: Shwetank Shekhar
+
+    The samples live in one const blob in flash, either raw (sample_size bytes
+    per image) or run-length encoded one image at a time, so a benchmark loop
+    can sweep hundreds of images with a single sample_size RAM buffer:
+
+        testset_iter_t it;
+        int8_t buffer[MNIST_TESTSET_SAMPLE_SIZE];
+        const int8_t* image;
+        uint8_t label;
+
+        testset_begin(&it, &mnist_testset);
+        while ((image = testset_next(&it, buffer, &label)) != NULL) {
+            ...
+        }
+*/
+
+#ifndef TESTSET_H
+#define TESTSET_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    TESTSET_RAW = 0,  // images stored back to back
+    TESTSET_RLE = 1,  // ctrl < 128: ctrl + 1 literals follow; else next byte repeated ctrl - 125 times
+} testset_encoding_t;
+
+typedef struct {
+    const uint8_t* blob;
+    const uint8_t* labels;
+    uint32_t count;
+    uint32_t sample_size;
+    uint32_t encoding;
+} testset_t;
+
+typedef struct {
+    const testset_t* set;
+    const uint8_t* next;
+    uint32_t index;
+} testset_iter_t;
+
+/**
+ * @brief Positions the iterator on the first sample.
+ *
+ * @param it Iterator to initialize.
+ * @param set Generated test set, e.g. &mnist_testset.
+ */
+void testset_begin(testset_iter_t* it, const testset_t* set);
+
+/**
+ * @brief Returns the next sample and advances the iterator.
+ *
+ * @param it Iterator from testset_begin().
+ * @param buffer At least sample_size bytes; only written for RLE sets.
+ * @param label Receives the sample's label.
+ * @return The int8 image (points into flash for raw sets), NULL after the last sample.
+ */
+const int8_t* testset_next(testset_iter_t* it, int8_t* buffer, uint8_t* label);
+
+#endif // TESTSET_H
@@ -0,0 +1,180 @@
+'''
+    uart_farm.py
+    Author: Shwetank Shekhar
+
+    asyncio host driver for a rig of HiFive1 boards (main.c built with
+    UART_REALTIME_MODE 1) or simulated boards from board_sim.py.
+
+    Frames are pulled from one shared queue by every board, so faster links
+    take more work. Each board keeps at most --in-flight frames outstanding;
+    replies are matched to frames in FIFO order via the "Predicted digit:" line.
+    At the end accuracy, throughput and p50/p99 latency are reported per board
+    and for the whole farm.
+
+    Examples (from the project root):
+        python src/uart_farm.py --ports COM10 COM11
+        python src/uart_farm.py --sim 4 --frames 1000
+        python src/uart_farm.py --sim 4 --replay rec.bin   # frames from frame_stream.py
+'''
+import argparse
+import asyncio
+import collections
+import re
+import time
+
+import numpy as np
+import serial
+
+from frame_stream import read_frames
+from model_params import MODEL_PARAMS_C, load_test_samples
+
+BAUD_RATE = 115200
+START_BYTE = b'\xAA'
+REPLY_TIMEOUT_S = 5.0
+PREDICTION_RE = re.compile(rb"Predicted digit:\s*(-?\d+)")
+
+
+def percentile(sorted_values, q):
+    if not sorted_values:
+        return float("nan")
+    idx = min(len(sorted_values) - 1, max(0, int(round(q / 100.0 * (len(sorted_values) - 1)))))
+    return sorted_values[idx]
+
+
+class LinkStats:
+    def __init__(self, name):
+        self.name = name
+        self.latencies_ms = []
+        self.correct = 0
+        self.labelled = 0
+        self.lost = 0
+
+    def record(self, latency_ms, pred, label):
+        self.latencies_ms.append(latency_ms)
+        if label is not None and label >= 0:
+            self.labelled += 1
+            self.correct += int(pred == label)
+
+    def merge(self, others):
+        for o in others:
+            self.latencies_ms += o.latencies_ms
+            self.correct += o.correct
+            self.labelled += o.labelled
+            self.lost += o.lost
+        return self
+
+    def summary(self, elapsed_s):
+        lat = sorted(self.latencies_ms)
+        n = len(lat)
+        acc = 100.0 * self.correct / self.labelled if self.labelled else float("nan")
+        return (f"{self.name:>12}: frames={n:6d} lost={self.lost:4d} "
+                f"acc={acc:6.2f}% fps={n / elapsed_s if elapsed_s else 0:8.2f} "
+                f"p50={percentile(lat, 50):8.2f}ms p99={percentile(lat, 99):8.2f}ms")
+
+
+class BoardLink:
+    """One serial port with a bounded window of in-flight frames."""
+
+    def __init__(self, port, baud, in_flight):
+        self.port = port
+        self.ser = serial.Serial(port, baud, timeout=0.2)
+        self.window = asyncio.Semaphore(in_flight)
+        self.pending = collections.deque()   # (send_time, label)
+        self.stats = LinkStats(port)
+        self.sending_done = False
+
+    async def writer(self, queue):
+        while True:
+            await self.window.acquire()
+            item = await queue.get()
+            if item is None:
+                queue.put_nowait(None)  # let the other boards see the end marker too
+                self.window.release()
+                break
+            frame, label = item
+            self.pending.append((time.perf_counter(), label))
+            await asyncio.to_thread(self.ser.write, START_BYTE + frame.tobytes())
+        self.sending_done = True
+
+    async def reader(self):
+        while not (self.sending_done and not self.pending):
+            line = await asyncio.to_thread(self.ser.readline)
+            now = time.perf_counter()
+            m = PREDICTION_RE.search(line) if line else None
+            if m and self.pending:
+                sent, label = self.pending.popleft()
+                self.stats.record((now - sent) * 1000.0, int(m.group(1)), label)
+                self.window.release()
+            elif self.pending and now - self.pending[0][0] > REPLY_TIMEOUT_S:
+                # The board dropped this frame (UART overrun, reset...); free its slot.
+                self.pending.popleft()
+                self.stats.lost += 1
+                self.window.release()
+
+    def close(self):
+        self.ser.close()
+
+
+async def run_farm(ports, frames, baud, in_flight):
+    queue = asyncio.Queue()
+    for item in frames:
+        queue.put_nowait(item)
+    queue.put_nowait(None)
+
+    links = [BoardLink(p, baud, in_flight) for p in ports]
+    t0 = time.perf_counter()
+    try:
+        await asyncio.gather(*[coro for l in links for coro in (l.writer(queue), l.reader())])
+    finally:
+        for l in links:
+            l.close()
+    elapsed = time.perf_counter() - t0
+
+    print(f"\n--- Inference farm: {len(links)} board(s), {elapsed:.2f} s ---")
+    for l in links:
+        print(l.stats.summary(elapsed))
+    total = LinkStats("TOTAL").merge([l.stats for l in links])
+    print(total.summary(elapsed))
+    return total
+
+
+def load_recording(path, count=None):
+    _, frames, labels = read_frames(path)
+    n = len(frames) if count is None else count
+    return [(frames[i % len(frames)], int(labels[i % len(frames)])) for i in range(n)]
+
+
+def load_frames(params_file, count=None):
+    samples = load_test_samples(params_file)
+    if not samples:
+        raise SystemExit(f"No test samples found for {params_file}")
+    count = len(samples) if count is None else count
+    return [(np.asarray(img, dtype=np.int8), label) for img, label in
+            (samples[i % len(samples)] for i in range(count))]
+
+
+if __name__ == "__main__":
+    ap = argparse.ArgumentParser(description="Fan MNIST frames out over several boards.")
+    target = ap.add_mutually_exclusive_group(required=True)
+    target.add_argument("--ports", nargs="+", help="serial ports, e.g. COM10 /dev/ttyUSB1")
+    target.add_argument("--sim", type=int, metavar="N", help="spawn N simulated boards on pseudo-terminals")
+    ap.add_argument("--baud", type=int, default=BAUD_RATE)
+    ap.add_argument("--in-flight", type=int, default=1,
+                    help="max unanswered frames per board; the FE310 UART FIFO is 8 bytes, "
+                         "so keep this at 1 for real boards")
+    ap.add_argument("--frames", type=int, default=None, help="default: the whole test set or --replay file")
+    ap.add_argument("--replay", metavar="FILE", help="send a recorded frame stream instead of the sample frames")
+    ap.add_argument("--params", default=MODEL_PARAMS_C, help="source of labelled sample frames")
+    ap.add_argument("--sim-delay-ms", type=float, default=0.0)
+    args = ap.parse_args()
+
+    ports = args.ports
+    if args.sim:
+        from board_sim import start_boards
+        ports = [b.port for b in start_boards(args.sim, args.params, args.sim_delay_ms)]
+
+    if args.replay:
+        frames = load_recording(args.replay, args.frames)
+    else:
+        frames = load_frames(args.params, args.frames)
+    asyncio.run(run_farm(ports, frames, args.baud, args.in_flight))
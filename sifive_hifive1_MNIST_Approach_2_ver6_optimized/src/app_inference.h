@@ -70,6 +70,27 @@ uint32_t ReLUNorm(int32_t *input, int8_t *output, uint32_t n_input) {
     return max_pos;
 }
 
+/**
+ * @brief ReLUNorm with a fixed shift: no max scan, the scaling does not depend on the input.
+ *
+ * @param input Pointer to the input array of 32-bit integers.
+ * @param output Pointer to the output array of 8-bit integers.
+ * @param n_input The number of elements in the input array.
+ * @param shift Right shift calibrated offline (L<n>_relu_shift from tools/model_compiler/relunorm.py).
+ */
+void ReLUNormStatic(const int32_t *input, int8_t *output, uint32_t n_input, uint32_t shift) {
+    int32_t rounding = (shift > 0) ? (1 << (shift - 1)) : 0;
+
+    for (uint32_t i = 0; i < n_input; i++) {
+        if (input[i] < 0) {
+            output[i] = 0;
+        } else {
+            int32_t scaled_val = (input[i] + rounding) >> shift;
+            output[i] = (scaled_val > 127) ? 127 : (int8_t)scaled_val;
+        }
+    }
+}
+
 /**
  * @brief Processes a fully connected layer with 8-bit quantized weights.
  *
@@ -5,14 +5,28 @@
 #include <metal/led.h>
 #include <metal/button.h>
 #include <metal/switch.h>
+#include <metal/timer.h>
 
 #include "app_inference.h"
 #include "mnist_model_data.h"
 #include "mnist_model_params.h"
+#include "mnist_testset.h"
 
 #define RTC_FREQ 32768
 #define MAX_N_ACTIVATIONS 64
-#define DEBUG_PRINTS 1
+
+// Per-layer progress prints. They go over the UART inside the timed region,
+// so leave them off when reading the mean cycle count.
+#ifndef DEBUG_PRINTS
+#define DEBUG_PRINTS 0
+#endif
+
+// 1: sweep the test set with the dynamic ReLUNorm and again with the static
+// shifts from mnist_model_params.h, to compare accuracy and cycles.
+// 0: static shifts only.
+#ifndef RELUNORM_COMPARE
+#define RELUNORM_COMPARE 1
+#endif
 
 // Helper function for software delay
 static inline void software_delay(volatile int cycles) {
@@ -31,7 +45,7 @@ void display_banner (void) {
     printf("By Shwetank Shekhar\n");
 }
 
-void BitMnistInference(const int8_t *input, const uint8_t label, const uint8_t sample) {
+uint32_t BitMnistPredict(const int8_t *input, int static_shifts) {
     // Corrected to use local arrays to avoid static VLA error
     // MAX_N_ACTIVATIONS is sufficient for layer 2 output (16) and layer 3 output (10)
     int32_t layer1_sum[L1_outgoing_weights]; // 32 neurons
@@ -43,27 +57,45 @@ void BitMnistInference(const int8_t *input, const uint8_t label, const uint8_t s
     int32_t layer3_sum[L3_outgoing_weights]; // 10 neurons
     uint32_t pred_digit;
 
-    printf("Processing input for sample %d\n", sample);
-
     // --- Layer 1 Processing ---
+#if DEBUG_PRINTS
     printf("Debug: Starting first layer processing\n");
+#endif
     processfclayer((int8_t*)input, L1_weights, L1_biases, L1_incoming_weights, L1_outgoing_weights, layer1_sum);
     
+#if DEBUG_PRINTS
     printf("Debug: First layer complete, applying ReLU\n");
-    ReLUNorm(layer1_sum, layer1_out, L1_outgoing_weights);
+#endif
+    if (static_shifts) {
+        ReLUNormStatic(layer1_sum, layer1_out, L1_outgoing_weights, L1_relu_shift);
+    } else {
+        ReLUNorm(layer1_sum, layer1_out, L1_outgoing_weights);
+    }
 
     // --- Layer 2 Processing ---
+#if DEBUG_PRINTS
     printf("Debug: Starting second layer\n");
+#endif
     processfclayer(layer1_out, L2_weights, L2_biases, L2_incoming_weights, L2_outgoing_weights, layer2_sum);
     
+#if DEBUG_PRINTS
     printf("Debug: Second layer complete, applying ReLU\n");
-    ReLUNorm(layer2_sum, layer2_out, L2_outgoing_weights);
+#endif
+    if (static_shifts) {
+        ReLUNormStatic(layer2_sum, layer2_out, L2_outgoing_weights, L2_relu_shift);
+    } else {
+        ReLUNorm(layer2_sum, layer2_out, L2_outgoing_weights);
+    }
     
     // --- Layer 3 Processing (Final Output Layer) ---
+#if DEBUG_PRINTS
     printf("Debug: Starting third layer\n");
+#endif
     processfclayer(layer2_out, L3_weights, L3_biases, L3_incoming_weights, L3_outgoing_weights, layer3_sum);
 
+#if DEBUG_PRINTS
     printf("Debug: Third layer complete, scaling outputs\n");
+#endif
     
     // Final prediction using a custom scaling function (not ReLUNorm)
     int32_t max_val = layer3_sum[0];
@@ -75,27 +107,59 @@ void BitMnistInference(const int8_t *input, const uint8_t label, const uint8_t s
             pred_digit = i;
         }
     }
-    
-    // Print results for validation
-    printf("Predicted digit: %d, True Label: %d, Status: %s\n",
-           pred_digit, label, (pred_digit == label) ? "PASS" : "FAIL");
-    printf("\n");
+    return pred_digit;
+}
+
+// Sweeps the mnist_testset samples the ReLUNorm shifts were not calibrated on
+// (see tools/model_compiler/testset.py and relunorm.py) and reports accuracy
+// and the mean cycle count of BitMnistPredict().
+void BitMnistBenchmark(int static_shifts) {
+    static int8_t buffer[MNIST_TESTSET_SAMPLE_SIZE];
+    testset_iter_t it;
+    const int8_t *input;
+    uint8_t label;
+    uint32_t correct = 0, count = 0;
+    unsigned long long start_time, end_time, total_cycles = 0;
+
+    testset_begin(&it, &mnist_testset);
+    while ((input = testset_next(&it, buffer, &label)) != NULL) {
+        if (it.index <= relu_shift_calibration_samples) {
+            continue;
+        }
+        metal_timer_get_cyclecount(0, &start_time);
+        uint32_t pred_digit = BitMnistPredict(input, static_shifts);
+        metal_timer_get_cyclecount(0, &end_time);
+        total_cycles += end_time - start_time;
+        correct += (pred_digit == label);
+        count++;
+
+        // Print results for validation
+        printf("Sample %lu: Predicted digit: %lu, True Label: %d, Status: %s, Cycles: %llu\n",
+               (unsigned long)it.index, (unsigned long)pred_digit, label,
+               (pred_digit == label) ? "PASS" : "FAIL", end_time - start_time);
+    }
+    if (count == 0) {
+        printf("No held-out samples: every test sample was used to calibrate the ReLUNorm shifts\n");
+        return;
+    }
+
+    printf("\nReLUNorm %s: Accuracy: %lu/%lu (%lu.%02lu%%), mean cycles per inference: %llu\n\n",
+           static_shifts ? "static" : "dynamic", (unsigned long)correct, (unsigned long)count,
+           (unsigned long)(correct * 100 / count),
+           (unsigned long)(correct * 10000 / count % 100),
+           total_cycles / count);
 }
 
 int main (void) {
     display_banner();
-    printf("Starting MNIST inference...\n");
-
-    BitMnistInference((const int8_t*)input_data_0, label_0, 1);
-    BitMnistInference((const int8_t*)input_data_1, label_1, 2);
-    BitMnistInference((const int8_t*)input_data_2, label_2, 3);
-    BitMnistInference((const int8_t*)input_data_3, label_3, 4);
-    BitMnistInference((const int8_t*)input_data_4, label_4, 5);
-    BitMnistInference((const int8_t*)input_data_5, label_5, 6);
-    BitMnistInference((const int8_t*)input_data_6, label_6, 7);
-    BitMnistInference((const int8_t*)input_data_7, label_7, 8);
-    BitMnistInference((const int8_t*)input_data_8, label_8, 9);
-    BitMnistInference((const int8_t*)input_data_9, label_9, 10);
+    printf("Starting MNIST inference on %lu held-out test samples (%lu calibrated the ReLUNorm shifts)...\n",
+           (unsigned long)(MNIST_TESTSET_COUNT - relu_shift_calibration_samples),
+           (unsigned long)relu_shift_calibration_samples);
+
+#if RELUNORM_COMPARE
+    BitMnistBenchmark(0);
+#endif
+    BitMnistBenchmark(1);
 
     return 0;
 }
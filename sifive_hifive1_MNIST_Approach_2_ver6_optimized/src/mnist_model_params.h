@@ -24,6 +24,7 @@ extern const int32_t ALIGN_16 L1_biases[32];
 extern const int32_t L1_bitperweight;
 extern const uint32_t L1_incoming_weights;
 extern const uint32_t L1_outgoing_weights;
+extern const uint32_t L1_relu_shift;
 extern const float L1_input_scale;
 extern const int32_t L1_input_zero_point;
 extern const float L1_output_scale;
@@ -37,6 +38,7 @@ extern const int32_t ALIGN_16 L2_biases[16];
 extern const int32_t L2_bitperweight;
 extern const uint32_t L2_incoming_weights;
 extern const uint32_t L2_outgoing_weights;
+extern const uint32_t L2_relu_shift;
 extern const float L2_input_scale;
 extern const int32_t L2_input_zero_point;
 extern const float L2_output_scale;
@@ -57,26 +59,7 @@ extern const int32_t L3_output_zero_point;
 extern const float L3_weights_scale;
 extern const int32_t L3_weights_zero_point;
 
-// Quantized sample input images and their labels
-extern const int8_t input_data_0[784];
-extern const uint8_t label_0;
-extern const int8_t input_data_1[784];
-extern const uint8_t label_1;
-extern const int8_t input_data_2[784];
-extern const uint8_t label_2;
-extern const int8_t input_data_3[784];
-extern const uint8_t label_3;
-extern const int8_t input_data_4[784];
-extern const uint8_t label_4;
-extern const int8_t input_data_5[784];
-extern const uint8_t label_5;
-extern const int8_t input_data_6[784];
-extern const uint8_t label_6;
-extern const int8_t input_data_7[784];
-extern const uint8_t label_7;
-extern const int8_t input_data_8[784];
-extern const uint8_t label_8;
-extern const int8_t input_data_9[784];
-extern const uint8_t label_9;
+// Leading mnist_testset samples the ReLUNorm shifts were calibrated on
+extern const uint32_t relu_shift_calibration_samples;
 
 #endif // MNIST_MODEL_PARAMS_H
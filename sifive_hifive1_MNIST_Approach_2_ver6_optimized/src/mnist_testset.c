@@ -0,0 +1,105 @@
+/*
+ * This file is auto-generated by tools/model_compiler/testset.py.
+ * Do not modify manually.
+ */
+#include "mnist_testset.h"
+
+static const uint8_t mnist_testset_blob[MNIST_TESTSET_BLOB_SIZE] = {
+    255, 128, 197, 128, 5, 212, 57, 31, 23, 188, 164, 147, 128, 0, 94, 129, 126, 0, 113, 133, 70, 1, 42, 180,
+    137, 128, 7, 195, 242, 200, 242, 35, 99, 126, 97, 128, 126, 4, 122, 101, 126, 126, 12, 142, 128, 2, 145, 194,
+    142, 128, 195, 4, 187, 149, 108, 126, 234, 149, 128, 3, 211, 125, 81, 146, 148, 128, 3, 150, 105, 127, 211, 149,
+    128, 3, 1, 126, 110, 172, 148, 128, 3, 187, 121, 126, 190, 149, 128, 3, 5, 126, 59, 133, 148, 128, 3, 137,
+    77, 120, 186, 149, 128, 2, 254, 126, 54, 149, 128, 3, 203, 123, 112, 185, 148, 128, 3, 147, 93, 126, 38, 148,
+    128, 4, 131, 75, 126, 91, 163, 148, 128, 3, 166, 126, 126, 205, 148, 128, 4, 159, 96, 126, 243, 129, 148, 128,
+    3, 5, 126, 126, 180, 148, 128, 4, 189, 114, 126, 126, 180, 148, 128, 4, 249, 126, 126, 91, 168, 148, 128, 3,
+    249, 126, 79, 146, 167, 128, 219, 128, 6, 244, 253, 43, 127, 127, 22, 221, 145, 128, 0, 41, 131, 125, 1, 90,
+    158, 143, 128, 0, 41, 128, 125, 5, 85, 14, 48, 125, 125, 250, 142, 128, 10, 180, 122, 125, 82, 160, 140, 128,
+    134, 78, 125, 12, 142, 128, 3, 205, 123, 82, 153, 128, 128, 3, 250, 120, 125, 193, 143, 128, 1, 159, 146, 129,
+    128, 3, 81, 125, 125, 193, 148, 128, 4, 245, 119, 125, 70, 138, 147, 128, 4, 204, 119, 125, 103, 191, 148, 128,
+    3, 0, 125, 125, 16, 148, 128, 4, 48, 118, 125, 31, 140, 147, 128, 4, 153, 106, 125, 105, 163, 148, 128, 3,
+    70, 125, 125, 13, 148, 128, 4, 206, 120, 125, 61, 140, 147, 128, 4, 147, 72, 125, 125, 13, 148, 128, 4, 6,
+    125, 125, 45, 140, 148, 128, 3, 120, 125, 125, 153, 149, 128, 3, 120, 125, 125, 171, 129, 148, 5, 133, 128, 133,
+    148, 148, 165, 128, 22, 1, 19, 138, 134, 128, 0, 120, 132, 125, 2, 40, 15, 38, 132, 125, 0, 251, 134, 128,
+    0, 46, 136, 125, 6, 121, 119, 119, 41, 245, 245, 185, 135, 128, 0, 246, 128, 251, 0, 38, 128, 125, 3, 27,
+    251, 251, 169, 255, 128, 142, 128, 253, 128, 2, 166, 126, 237, 150, 128, 2, 215, 124, 210, 150, 128, 1, 7, 113,
+    150, 128, 2, 173, 116, 22, 150, 128, 2, 212, 126, 191, 150, 128, 2, 74, 95, 139, 149, 128, 2, 160, 126, 88,
+    150, 128, 2, 223, 126, 67, 150, 128, 2, 12, 126, 205, 149, 128, 3, 185, 109, 77, 136, 149, 128, 2, 252, 127,
+    37, 150, 128, 2, 43, 126, 209, 149, 128, 2, 152, 104, 87, 150, 128, 2, 248, 126, 31, 150, 128, 2, 23, 126,
+    14, 150, 128, 2, 100, 126, 194, 149, 128, 3, 189, 123, 126, 194, 149, 128, 3, 13, 126, 77, 131, 148, 128, 3,
+    138, 87, 126, 249, 149, 128, 3, 133, 70, 48, 138, 251, 128, 249, 128, 4, 139, 22, 125, 74, 159, 148, 128, 4,
+    165, 123, 123, 125, 235, 147, 128, 5, 149, 69, 123, 123, 125, 235, 146, 128, 1, 238, 62, 128, 123, 3, 125, 41,
+    237, 190, 144, 128, 0, 125, 129, 123, 4, 125, 123, 123, 92, 179, 142, 128, 1, 54, 127, 129, 125, 1, 106, 94,
+    128, 125, 141, 128, 2, 191, 93, 125, 128, 123, 6, 19, 205, 190, 0, 123, 123, 233, 139, 128, 15, 160, 103, 123,
+    125, 123, 92, 9, 138, 128, 128, 159, 102, 123, 115, 241, 133, 137, 128, 5, 165, 123, 123, 125, 60, 148, 130, 128,
+    4, 237, 123, 125, 123, 163, 137, 128, 4, 165, 123, 123, 73, 158, 131, 128, 4, 159, 72, 125, 123, 163, 137, 128,
+    2, 165, 125, 125, 133, 128, 4, 160, 74, 127, 125, 36, 137, 128, 2, 12, 123, 123, 133, 128, 4, 237, 123, 125,
+    123, 163, 137, 128, 2, 89, 123, 123, 131, 128, 6, 149, 191, 103, 123, 125, 102, 158, 137, 128, 2, 89, 123, 123,
+    131, 128, 0, 16, 128, 123, 1, 93, 189, 138, 128, 2, 89, 123, 123, 130, 128, 1, 54, 93, 128, 123, 0, 52,
+    139, 128, 8, 90, 125, 125, 201, 201, 100, 125, 125, 127, 129, 125, 140, 128, 3, 241, 123, 123, 125, 129, 123, 0,
+    125, 128, 123, 0, 19, 140, 128, 3, 159, 102, 123, 125, 129, 123, 4, 125, 102, 61, 163, 138, 141, 128, 2, 190,
+    14, 125, 129, 123, 1, 125, 235, 146, 128, 6, 200, 46, 123, 45, 199, 200, 158, 248, 128, 255, 128, 145, 128, 1,
+    178, 96, 132, 128, 1, 198, 157, 142, 128, 1, 249, 103, 132, 128, 1, 20, 40, 141, 128, 2, 132, 67, 103, 132,
+    128, 2, 224, 82, 139, 140, 128, 2, 197, 124, 6, 132, 128, 2, 242, 124, 149, 139, 128, 3, 173, 108, 89, 140,
+    132, 128, 2, 64, 124, 149, 139, 128, 2, 40, 119, 181, 132, 128, 3, 146, 127, 125, 149, 138, 128, 2, 212, 114,
+    83, 133, 128, 3, 13, 125, 61, 133, 138, 128, 2, 41, 124, 234, 132, 128, 3, 160, 104, 122, 194, 138, 128, 2,
+    143, 97, 124, 133, 128, 2, 6, 124, 83, 139, 128, 2, 150, 124, 36, 133, 128, 2, 41, 124, 39, 139, 128, 3,
+    137, 76, 81, 146, 131, 128, 3, 150, 125, 125, 235, 140, 128, 2, 41, 124, 71, 129, 213, 5, 1, 36, 67, 124,
+    124, 234, 140, 128, 2, 169, 42, 117, 129, 124, 5, 104, 103, 123, 124, 124, 137, 142, 128, 0, 177, 129, 212, 4,
+    128, 128, 33, 124, 124, 150, 128, 3, 255, 124, 124, 173, 149, 128, 2, 0, 125, 125, 150, 128, 2, 255, 124, 124,
+    150, 128, 2, 7, 124, 116, 150, 128, 2, 104, 108, 239, 150, 128, 1, 51, 194, 219, 128, 255, 128, 151, 128, 3,
+    205, 126, 235, 131, 148, 128, 4, 147, 99, 126, 126, 137, 148, 128, 4, 209, 126, 126, 37, 129, 147, 128, 4, 135,
+    75, 126, 126, 201, 148, 128, 3, 181, 126, 126, 122, 149, 128, 3, 6, 126, 126, 52, 149, 128, 3, 68, 126, 120,
+    176, 148, 128, 3, 186, 126, 126, 109, 149, 128, 3, 239, 126, 126, 4, 149, 128, 3, 35, 126, 110, 156, 148, 128,
+    3, 188, 124, 126, 95, 149, 128, 3, 207, 126, 126, 26, 149, 128, 3, 35, 126, 110, 181, 148, 128, 3, 156, 124,
+    126, 82, 149, 128, 3, 214, 126, 126, 3, 149, 128, 3, 233, 126, 106, 148, 149, 128, 3, 47, 126, 76, 133, 148,
+    128, 3, 133, 83, 126, 68, 149, 128, 3, 131, 30, 126, 32, 150, 128, 2, 154, 29, 235, 223, 128, 255, 128, 144,
+    128, 3, 150, 64, 6, 160, 133, 128, 2, 143, 205, 133, 137, 128, 3, 145, 107, 122, 41, 133, 128, 3, 143, 92,
+    113, 165, 136, 128, 3, 148, 61, 125, 19, 134, 128, 2, 11, 125, 228, 137, 128, 3, 198, 125, 125, 149, 133, 128,
+    3, 171, 126, 45, 141, 136, 128, 3, 150, 25, 125, 224, 133, 128, 3, 171, 103, 126, 220, 137, 128, 3, 35, 127,
+    76, 139, 133, 128, 2, 232, 126, 30, 138, 128, 3, 34, 125, 50, 133, 131, 128, 3, 137, 3, 109, 125, 139, 128,
+    4, 34, 125, 125, 63, 47, 129, 198, 4, 5, 69, 125, 125, 41, 139, 128, 4, 179, 100, 125, 125, 126, 129, 125,
+    4, 126, 125, 125, 91, 163, 140, 128, 4, 145, 193, 9, 126, 104, 128, 9, 3, 172, 125, 125, 33, 149, 128, 3,
+    162, 126, 78, 149, 149, 128, 2, 32, 125, 197, 149, 128, 3, 213, 126, 113, 178, 149, 128, 2, 30, 126, 37, 150,
+    128, 2, 103, 116, 178, 149, 128, 2, 232, 126, 104, 150, 128, 5, 80, 125, 29, 128, 141, 158, 147, 128, 5, 80,
+    125, 26, 219, 76, 33, 147, 128, 5, 80, 125, 126, 125, 26, 157, 147, 128, 4, 189, 62, 0, 151, 134, 219, 128,
+    255, 128, 174, 128, 3, 142, 21, 65, 133, 148, 128, 4, 219, 96, 125, 125, 147, 147, 128, 6, 156, 107, 126, 125,
+    125, 38, 146, 146, 128, 2, 16, 125, 126, 128, 125, 2, 110, 243, 134, 143, 128, 4, 159, 113, 125, 80, 57, 128,
+    125, 1, 103, 152, 143, 128, 10, 207, 126, 65, 128, 136, 226, 91, 126, 127, 73, 146, 142, 128, 2, 214, 125, 208,
+    128, 128, 4, 54, 125, 126, 63, 140, 142, 128, 2, 47, 125, 27, 128, 128, 3, 106, 125, 126, 7, 143, 128, 10,
+    214, 125, 80, 168, 213, 38, 123, 109, 126, 108, 170, 142, 128, 10, 146, 110, 125, 126, 125, 125, 57, 164, 88, 125,
+    24, 143, 128, 10, 196, 112, 127, 126, 17, 136, 128, 6, 126, 95, 163, 143, 128, 9, 196, 30, 14, 140, 128, 128,
+    137, 47, 125, 33, 150, 128, 3, 216, 125, 98, 146, 149, 128, 3, 130, 38, 125, 254, 150, 128, 3, 176, 117, 125,
+    166, 150, 128, 3, 243, 126, 44, 137, 149, 128, 3, 149, 90, 126, 174, 150, 128, 2, 158, 126, 37, 151, 128, 2,
+    58, 116, 170, 150, 128, 2, 142, 95, 206, 185, 128, 254, 128, 0, 145, 128, 175, 3, 144, 1, 213, 175, 143, 128,
+    2, 203, 25, 89, 128, 125, 3, 87, 118, 125, 125, 140, 128, 3, 163, 14, 116, 124, 134, 125, 140, 128, 0, 191,
+    132, 125, 0, 85, 129, 42, 136, 128, 12, 148, 4, 200, 128, 185, 110, 99, 110, 40, 252, 197, 148, 139, 139, 128,
+    9, 139, 78, 125, 206, 128, 128, 160, 128, 158, 130, 142, 128, 4, 134, 49, 125, 4, 138, 147, 128, 4, 140, 5,
+    125, 105, 143, 148, 128, 3, 220, 125, 95, 156, 149, 128, 2, 22, 125, 46, 150, 128, 4, 106, 125, 118, 255, 177,
+    148, 128, 0, 127, 128, 125, 8, 123, 19, 219, 249, 213, 170, 170, 213, 156, 140, 128, 0, 11, 136, 125, 1, 104,
+    40, 139, 128, 4, 131, 181, 90, 94, 123, 133, 125, 1, 124, 252, 142, 128, 2, 195, 200, 72, 132, 125, 0, 47,
+    144, 128, 8, 248, 125, 121, 24, 179, 36, 125, 125, 47, 144, 128, 0, 178, 128, 125, 4, 60, 124, 125, 125, 20,
+    144, 128, 1, 137, 39, 129, 125, 2, 122, 47, 139, 145, 128, 5, 151, 52, 103, 125, 93, 0, 149, 128, 2, 221,
+    21, 150, 248, 128, 255, 128, 204, 128, 6, 164, 184, 9, 73, 71, 223, 165, 144, 128, 2, 173, 24, 106, 130, 126,
+    3, 122, 83, 23, 134, 139, 128, 13, 174, 25, 112, 126, 126, 99, 38, 5, 123, 72, 126, 101, 97, 232, 138, 128,
+    15, 25, 106, 126, 126, 59, 14, 136, 128, 128, 63, 168, 70, 118, 95, 125, 149, 135, 128, 6, 136, 254, 125, 126,
+    105, 0, 139, 129, 128, 2, 82, 171, 198, 128, 126, 0, 149, 135, 128, 4, 200, 115, 126, 100, 182, 129, 128, 8,
+    131, 160, 244, 97, 114, 126, 127, 34, 133, 135, 128, 11, 203, 112, 126, 95, 237, 10, 50, 50, 41, 82, 123, 103,
+    128, 126, 1, 104, 166, 136, 128, 7, 137, 47, 116, 125, 127, 126, 126, 123, 130, 126, 2, 124, 43, 153, 139, 128,
+    6, 144, 8, 67, 48, 18, 25, 72, 129, 126, 1, 22, 144, 146, 128, 5, 34, 126, 126, 113, 227, 131, 146, 128,
+    4, 246, 122, 126, 126, 218, 147, 128, 5, 228, 114, 126, 126, 83, 135, 146, 128, 5, 182, 113, 126, 126, 114, 187,
+    147, 128, 4, 3, 126, 126, 116, 192, 147, 128, 4, 141, 121, 126, 126, 24, 147, 128, 5, 140, 100, 126, 126, 80,
+    136, 147, 128, 4, 206, 127, 126, 126, 194, 148, 128, 3, 81, 126, 126, 9, 149, 128, 3, 99, 127, 105, 153, 149,
+    128, 2, 241, 127, 236, 169, 128
+};
+
+static const uint8_t mnist_testset_labels[MNIST_TESTSET_COUNT] = {
+    7, 2, 1, 0, 4, 1, 4, 9, 5, 9
+};
+
+const testset_t mnist_testset = {
+    mnist_testset_blob,
+    mnist_testset_labels,
+    MNIST_TESTSET_COUNT,
+    MNIST_TESTSET_SAMPLE_SIZE,
+    TESTSET_RLE,
+};
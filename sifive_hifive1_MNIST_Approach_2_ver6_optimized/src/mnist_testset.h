@@ -0,0 +1,16 @@
+/*
+ * This file is auto-generated by tools/model_compiler/testset.py.
+ * Do not modify manually.
+ */
+#ifndef MNIST_TESTSET_H
+#define MNIST_TESTSET_H
+
+#include "testset.h"
+
+#define MNIST_TESTSET_COUNT 10
+#define MNIST_TESTSET_SAMPLE_SIZE 784
+#define MNIST_TESTSET_BLOB_SIZE 2023  // TESTSET_RLE, raw 7840
+
+extern const testset_t mnist_testset;
+
+#endif // MNIST_TESTSET_H
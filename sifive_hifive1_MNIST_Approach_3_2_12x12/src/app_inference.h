@@ -70,7 +70,9 @@ void quantized_relu_requantize(const int32_t* input_sum, int8_t* output_q, uint3
 void processfclayer(const int8_t* activations, const int8_t* weights, const int32_t* biases,
                     uint32_t n_input, uint32_t n_output, int32_t* output,
                     int32_t input_zero_point, int32_t weights_zero_point) {
+#if defined(DEBUG_PRINTS) && DEBUG_PRINTS
     printf("Processing layer: in=%d, out=%d\n", n_input, n_output);
+#endif
 
     for (uint32_t o = 0; o < n_output; o++) {
         int32_t sum = biases[o];
@@ -6,9 +6,17 @@
 #include <metal/led.h>
 #include <metal/button.h>
 #include <metal/switch.h>
+#include <metal/timer.h>
+
+// Per-layer prints plus the UART settle delays after them. Both run inside
+// the timed region, so leave them off when reading the mean cycle count.
+#ifndef DEBUG_PRINTS
+#define DEBUG_PRINTS 0
+#endif
 
 #include "app_inference.h"
 #include "mnist_model_params.h"
+#include "mnist_testset.h"
 
 // 12x12=144.
 #define L1_incoming_weights 144
@@ -34,7 +42,7 @@ void display_banner(void) {
     printf("By Shwetank Shekhar\n");
 }
 
-void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t sample) {
+uint32_t QInt8Predict(const int8_t *input) {
     static int32_t layer1_sum[L1_outgoing_weights];
     static int8_t layer1_out[L1_outgoing_weights];
     static int32_t layer2_sum[L2_outgoing_weights];
@@ -42,27 +50,19 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
     static int32_t layer3_sum[L3_outgoing_weights];
     uint32_t pred_digit;
 
-    printf("Clearing arrays...\n");
     memset(layer1_sum, 0, sizeof(layer1_sum));
     memset(layer1_out, 0, sizeof(layer1_out));
     memset(layer2_sum, 0, sizeof(layer2_sum));
     memset(layer2_out, 0, sizeof(layer2_out));
     memset(layer3_sum, 0, sizeof(layer3_sum));
 
-    printf("Processing input for sample %d\n", sample);
-    software_delay(1000);
-
     // --- Layer 1 Processing ---
-    printf("Starting first layer...\n");
     processfclayer(input, L1_weights, L1_biases, L1_incoming_weights, L1_outgoing_weights, layer1_sum,
                    L1_input_zero_point, L1_weights_zero_point);
-    software_delay(1000);
-
-    printf("Applying ReLU and Requantizing first layer...\n");
     quantized_relu_requantize(layer1_sum, layer1_out, L1_outgoing_weights, 
                              L1_output_scale, L2_input_scale, L2_input_zero_point);
-    software_delay(1000);
 
+#if DEBUG_PRINTS
     // Debug prints
     int min1 = 0, max1 = 0;
     for(int i=0; i<L1_outgoing_weights; i++) {
@@ -71,18 +71,16 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
     }
     printf("Layer1 ReLU range: %d to %d\n", min1, max1);
     printf("Layer1 sample activations: %d %d %d %d\n", layer1_out[0], layer1_out[1], layer1_out[2], layer1_out[3]);
+    software_delay(1000);
+#endif
 
     // --- Layer 2 Processing ---
-    printf("Starting second layer...\n");
     processfclayer(layer1_out, L2_weights, L2_biases, L2_incoming_weights, L2_outgoing_weights, layer2_sum,
                    L2_input_zero_point, L2_weights_zero_point);
-    software_delay(1000);
-
-    printf("Applying ReLU and Requantizing second layer...\n");
     quantized_relu_requantize(layer2_sum, layer2_out, L2_outgoing_weights, 
                              L2_output_scale, L3_input_scale, L3_input_zero_point);
-    software_delay(1000);
 
+#if DEBUG_PRINTS
     // Debug prints
     int min2 = 0, max2 = 0;
     for(int i=0; i<L2_outgoing_weights; i++) {
@@ -91,22 +89,24 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
     }
     printf("Layer2 ReLU range: %d to %d\n", min2, max2);
     printf("Layer2 sample activations: %d %d %d %d\n", layer2_out[0], layer2_out[1], layer2_out[2], layer2_out[3]);
+    software_delay(1000);
+#endif
 
     // --- Layer 3 Processing (Output Layer) ---
-    printf("Starting final layer...\n");
     processfclayer(layer2_out, L3_weights, L3_biases, L3_incoming_weights, L3_outgoing_weights, layer3_sum,
                    L3_input_zero_point, L3_weights_zero_point);
-    software_delay(1000);
 
+#if DEBUG_PRINTS
     // Before prediction, print all output values
     printf("Output layer values: ");
     for(int i=0; i<L3_outgoing_weights; i++) {
         printf("%ld ", layer3_sum[i]);
     }
     printf("\n");
+    software_delay(1000);
+#endif
 
     // Find prediction
-    printf("Finding prediction...\n");
     int32_t max_val = layer3_sum[0];
     pred_digit = 0;
     
@@ -115,30 +115,45 @@ void QInt8Inference(const int8_t *input, const uint8_t label, const uint8_t samp
             max_val = layer3_sum[i];
             pred_digit = i;
         }
-        software_delay(100);
     }
-    
-    printf("Predicted digit: %ld, True Label: %d, Status: %s\n",
-           pred_digit, label, (pred_digit == label) ? "PASS" : "FAIL");
-    software_delay(1000);
+    return pred_digit;
+}
+
+// Sweeps every sample in mnist_testset (see tools/model_compiler/testset.py)
+// and reports accuracy and the mean cycle count of QInt8Predict().
+void QInt8Benchmark(void) {
+    static int8_t buffer[MNIST_TESTSET_SAMPLE_SIZE];
+    testset_iter_t it;
+    const int8_t *input;
+    uint8_t label;
+    uint32_t correct = 0;
+    unsigned long long start_time, end_time, total_cycles = 0;
+
+    testset_begin(&it, &mnist_testset);
+    while ((input = testset_next(&it, buffer, &label)) != NULL) {
+        metal_timer_get_cyclecount(0, &start_time);
+        uint32_t pred_digit = QInt8Predict(input);
+        metal_timer_get_cyclecount(0, &end_time);
+        total_cycles += end_time - start_time;
+        correct += (pred_digit == label);
+
+        printf("Sample %lu: Predicted digit: %lu, True Label: %d, Status: %s, Cycles: %llu\n",
+               (unsigned long)it.index, (unsigned long)pred_digit, label,
+               (pred_digit == label) ? "PASS" : "FAIL", end_time - start_time);
+    }
 
-    printf("\n\n");
+    printf("\nAccuracy: %lu/%lu (%lu.%02lu%%), mean cycles per inference: %llu\n",
+           (unsigned long)correct, (unsigned long)MNIST_TESTSET_COUNT,
+           (unsigned long)(correct * 100 / MNIST_TESTSET_COUNT),
+           (unsigned long)(correct * 10000 / MNIST_TESTSET_COUNT % 100),
+           total_cycles / MNIST_TESTSET_COUNT);
 }
 
 int main(void) {
     display_banner();
-    printf("Starting MNIST inference...\n");
-
-    QInt8Inference(input_data_0, label_0, 1);
-    QInt8Inference(input_data_1, label_1, 2);
-    QInt8Inference(input_data_2, label_2, 3);
-    QInt8Inference(input_data_3, label_3, 4);
-    QInt8Inference(input_data_4, label_4, 5);
-    QInt8Inference(input_data_5, label_5, 6);
-    QInt8Inference(input_data_6, label_6, 7);
-    QInt8Inference(input_data_7, label_7, 8);
-    QInt8Inference(input_data_8, label_8, 9);
-    QInt8Inference(input_data_9, label_9, 10);
+    printf("Starting MNIST inference on %d test samples...\n", MNIST_TESTSET_COUNT);
+
+    QInt8Benchmark();
 
     return 0;
 }
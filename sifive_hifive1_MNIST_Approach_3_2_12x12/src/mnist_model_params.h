@@ -36,26 +36,4 @@ extern const int32_t L3_output_zero_point;
 extern const float L3_weights_scale;
 extern const int32_t L3_weights_zero_point;
 
-// --- Quantized sample input images and their labels ---
-extern const int8_t input_data_0[144];
-extern const uint8_t label_0;
-extern const int8_t input_data_1[144];
-extern const uint8_t label_1;
-extern const int8_t input_data_2[144];
-extern const uint8_t label_2;
-extern const int8_t input_data_3[144];
-extern const uint8_t label_3;
-extern const int8_t input_data_4[144];
-extern const uint8_t label_4;
-extern const int8_t input_data_5[144];
-extern const uint8_t label_5;
-extern const int8_t input_data_6[144];
-extern const uint8_t label_6;
-extern const int8_t input_data_7[144];
-extern const uint8_t label_7;
-extern const int8_t input_data_8[144];
-extern const uint8_t label_8;
-extern const int8_t input_data_9[144];
-extern const uint8_t label_9;
-
 #endif // MNIST_MODEL_PARAMS_H
@@ -0,0 +1,261 @@
+// Smallest tensor arena for a model, op resolver and memory planner.
+//
+// FindMinimumArena() records where the arena goes with RecordingMicroAllocator
+// (tensor data, scratch, eval tensors, persistent), then sets the model up in
+// the first `size` bytes of a probe arena with a plain MicroAllocator and
+// keeps the smallest size for which AllocateTensors() and one Invoke()
+// succeed. Head plus tail after AllocateTensors() is a lower bound, but
+// preparing the model needs some temporary room on top (scratch buffer
+// requests, the planner's working lists), so the search starts at that bound,
+// doubles a step until a probe succeeds and bisects down to the byte. Failed
+// probes log their out-of-memory errors; that is expected.
+//
+// It then searches the same way for the split layout of
+// MicroAllocator::Create(persistent, non_persistent): the smallest
+// non-persistent arena, then the persistent bytes a run next to it takes. Interpreters that
+// run one at a time can share the non-persistent one; PrintSharedArenaTotals()
+// compares that with one arena per model.
+//
+// PrintArenaHeader() prints the result between "// BEGIN ArenaSize" and
+// "// END ArenaSize" as a header the firmware takes kTensorArenaSize from
+// (`make arena-tune` saves it as mnist_arena_size.h). The eval tensors, nodes
+// and other persistent structs hold pointers, so a size measured on a 64-bit
+// host is an upper bound for the FE310; a TFLM_ARENA_TUNE=1 firmware build
+// prints the exact RV32 figure.
+
+#ifndef ARENA_TUNE_H
+#define ARENA_TUNE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/micro/recording_micro_allocator.h"
+#include "tensorflow/lite/micro/recording_micro_interpreter.h"
+
+struct ArenaBreakdown {
+  size_t arena_size;        // smallest arena that allocates and invokes
+  size_t tensor_data;       // head: the memory plan, scratch buffers included
+  size_t scratch;           // scratch buffers requested by kernels (aligned)
+  size_t eval_tensors;      // TfLiteEvalTensor array
+  size_t persistent;        // rest of the tail: nodes, op data, allocator, planner
+  size_t prepare_headroom;  // only needed while AllocateTensors() runs
+  size_t split_persistent;      // persistent arena of the split layout
+  size_t split_non_persistent;  // non-persistent arena next to it, shareable
+};
+
+// Sets the model up with `allocator` the way the firmware does and runs it
+// once. Returns the interpreter's arena_used_bytes(), 0 on failure.
+inline size_t ProbeAllocator(const tflite::Model* model, const tflite::MicroOpResolver& resolver,
+                             tflite::MicroAllocator* allocator) {
+  if (allocator == nullptr) {
+    return 0;
+  }
+  tflite::MicroInterpreter interpreter(model, resolver, allocator);
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    return 0;
+  }
+  for (size_t i = 0; i < interpreter.inputs_size(); ++i) {
+    TfLiteTensor* input = interpreter.input(i);
+    memset(input->data.raw, 0, input->bytes);
+    // The firmware binds its image with BindInput(), whose first call takes
+    // the saved input pointers from the persistent arena. Binding the arena
+    // buffer itself makes that allocation and leaves the input unbound.
+    if (interpreter.BindInput(i, input->data.raw, input->bytes) != kTfLiteOk) {
+      return 0;
+    }
+  }
+  if (interpreter.Invoke() != kTfLiteOk) {
+    return 0;
+  }
+  return interpreter.arena_used_bytes();
+}
+
+inline size_t ProbeArena(const tflite::Model* model, const tflite::MicroOpResolver& resolver,
+                         tflite::MemoryPlannerType planner, uint8_t* arena, size_t size) {
+  return ProbeAllocator(model, resolver, tflite::MicroAllocator::Create(arena, size, planner));
+}
+
+// Split layout: the persistent arena takes the last `persistent_size` bytes
+// of `arena`, the non-persistent one the first `non_persistent_size`.
+inline size_t ProbeSplitArena(const tflite::Model* model, const tflite::MicroOpResolver& resolver,
+                              tflite::MemoryPlannerType planner, uint8_t* arena,
+                              size_t arena_size, size_t persistent_size,
+                              size_t non_persistent_size) {
+  return ProbeAllocator(
+      model, resolver,
+      tflite::MicroAllocator::Create(arena + arena_size - persistent_size, persistent_size,
+                                     arena, non_persistent_size, planner));
+}
+
+// Smallest size in (fail, limit] for which probe(size) succeeds, 0 if none
+// does: steps up from `fail` with doubling strides, then bisects.
+template <typename Probe>
+inline size_t SearchArenaSize(size_t fail, size_t limit, Probe probe) {
+  size_t ok = 0;
+  for (size_t step = 1; fail < limit; step *= 2) {
+    size_t size = fail + step < limit ? fail + step : limit;
+    if (probe(size)) {
+      ok = size;
+      break;
+    }
+    fail = size;
+  }
+  if (ok == 0) {
+    return 0;
+  }
+  while (ok - fail > 1) {
+    size_t size = fail + (ok - fail) / 2;
+    if (probe(size)) {
+      ok = size;
+    } else {
+      fail = size;
+    }
+  }
+  return ok;
+}
+
+// Searches sizes up to `arena_size`; `arena` must be aligned like the
+// firmware's tensor_arena (alignas(16)) and `arena_size` a multiple of 16.
+inline bool FindMinimumArena(const tflite::Model* model, const tflite::MicroOpResolver& resolver,
+                             tflite::MemoryPlannerType planner, uint8_t* arena,
+                             size_t arena_size, ArenaBreakdown* result) {
+  *result = ArenaBreakdown{};
+  // The categories come from one recorded run in the whole probe arena; head
+  // and eval tensors do not depend on the allocator class.
+  {
+    tflite::RecordingMicroAllocator* allocator =
+        tflite::RecordingMicroAllocator::Create(arena, arena_size, planner);
+    tflite::RecordingMicroInterpreter interpreter(model, resolver, allocator);
+    if (interpreter.AllocateTensors() != kTfLiteOk) {
+      MicroPrintf("Model does not fit the %u byte probe arena.",
+                  static_cast<unsigned>(arena_size));
+      return false;
+    }
+    result->tensor_data = allocator->GetSimpleMemoryAllocator()->GetNonPersistentUsedBytes();
+    result->scratch =
+        allocator->GetRecordedAllocation(tflite::RecordedAllocationType::kScratchBufferData)
+            .used_bytes;
+    result->eval_tensors =
+        allocator->GetRecordedAllocation(tflite::RecordedAllocationType::kTfLiteEvalTensorData)
+            .used_bytes;
+  }
+
+  size_t used = ProbeArena(model, resolver, planner, arena, arena_size);
+  if (used == 0) {
+    return false;
+  }
+  result->arena_size = SearchArenaSize(used - 1, arena_size, [&](size_t size) {
+    return ProbeArena(model, resolver, planner, arena, size) != 0;
+  });
+  result->persistent = used - result->tensor_data - result->eval_tensors;
+  result->prepare_headroom = result->arena_size - used;
+
+  // The non-persistent search leaves the rest of the probe arena, at least
+  // the single arena's persistent section, to the persistent side: an
+  // undersized persistent arena is not always caught (kernels that get no op
+  // data in Init write through the null pointer in Prepare), so only the
+  // non-persistent side is probed down. The persistent size is then read off
+  // a run that fits, rounded up to the arena alignment: the allocator aligns
+  // the end of the persistent arena down, so an alignas(16) array of that
+  // size loses nothing.
+  const size_t alignment = tflite::MicroArenaBufferAlignment();
+  const size_t non_persistent_limit = arena_size - (used - result->tensor_data);
+  // The planned head has to fit, so that is where the search starts.
+  size_t fail = result->tensor_data > 0 ? result->tensor_data - 1 : 0;
+  result->split_non_persistent =
+      SearchArenaSize(fail, non_persistent_limit, [&](size_t size) {
+        return ProbeSplitArena(model, resolver, planner, arena, arena_size, arena_size - size,
+                               size) != 0;
+      });
+  const size_t non_persistent = result->split_non_persistent;
+  size_t split_used = 0;
+  if (non_persistent != 0) {
+    split_used = ProbeSplitArena(model, resolver, planner, arena, arena_size,
+                                 arena_size - non_persistent, non_persistent);
+  }
+  // After AllocateTensors the non-persistent arena holds just the head.
+  if (split_used > result->tensor_data) {
+    result->split_persistent =
+        (split_used - result->tensor_data + alignment - 1) / alignment * alignment;
+  }
+  if (result->split_persistent == 0 ||
+      ProbeSplitArena(model, resolver, planner, arena, arena_size, result->split_persistent,
+                      non_persistent) == 0) {
+    MicroPrintf("Model does not fit a split %u byte probe arena.",
+                static_cast<unsigned>(arena_size));
+    return false;
+  }
+  return true;
+}
+
+// `prefix` names the macros, e.g. "MNIST_ARENA" for MNIST_ARENA_SIZE_GREEDY.
+inline void PrintArenaHeader(const char* prefix, const ArenaBreakdown& greedy,
+                             const ArenaBreakdown& offline) {
+  MicroPrintf("// BEGIN ArenaSize %s", prefix);
+  MicroPrintf("// Printed by PrintArenaHeader() (arena_tune.h), do not edit.");
+  MicroPrintf("// Smallest tensor arena per memory planner, measured with");
+  MicroPrintf("// %u-byte pointers.", static_cast<unsigned>(sizeof(void*)));
+  MicroPrintf("//                      greedy  offline");
+  MicroPrintf("//   tensor data      %8u %8u", static_cast<unsigned>(greedy.tensor_data),
+              static_cast<unsigned>(offline.tensor_data));
+  MicroPrintf("//     of it scratch  %8u %8u", static_cast<unsigned>(greedy.scratch),
+              static_cast<unsigned>(offline.scratch));
+  MicroPrintf("//   eval tensors     %8u %8u", static_cast<unsigned>(greedy.eval_tensors),
+              static_cast<unsigned>(offline.eval_tensors));
+  MicroPrintf("//   persistent       %8u %8u", static_cast<unsigned>(greedy.persistent),
+              static_cast<unsigned>(offline.persistent));
+  MicroPrintf("//   prepare headroom %8u %8u", static_cast<unsigned>(greedy.prepare_headroom),
+              static_cast<unsigned>(offline.prepare_headroom));
+  MicroPrintf("//   split arenas:");
+  MicroPrintf("//     persistent     %8u %8u", static_cast<unsigned>(greedy.split_persistent),
+              static_cast<unsigned>(offline.split_persistent));
+  MicroPrintf("//     non-persistent %8u %8u",
+              static_cast<unsigned>(greedy.split_non_persistent),
+              static_cast<unsigned>(offline.split_non_persistent));
+  MicroPrintf("#ifndef %s_SIZE_H", prefix);
+  MicroPrintf("#define %s_SIZE_H", prefix);
+  MicroPrintf("#define %s_POINTER_SIZE %u", prefix, static_cast<unsigned>(sizeof(void*)));
+  MicroPrintf("#define %s_SIZE_GREEDY %u", prefix, static_cast<unsigned>(greedy.arena_size));
+  MicroPrintf("#define %s_SIZE_OFFLINE %u", prefix, static_cast<unsigned>(offline.arena_size));
+  MicroPrintf("#define %s_PERSISTENT_SIZE_GREEDY %u", prefix,
+              static_cast<unsigned>(greedy.split_persistent));
+  MicroPrintf("#define %s_PERSISTENT_SIZE_OFFLINE %u", prefix,
+              static_cast<unsigned>(offline.split_persistent));
+  MicroPrintf("#define %s_NON_PERSISTENT_SIZE_GREEDY %u", prefix,
+              static_cast<unsigned>(greedy.split_non_persistent));
+  MicroPrintf("#define %s_NON_PERSISTENT_SIZE_OFFLINE %u", prefix,
+              static_cast<unsigned>(offline.split_non_persistent));
+  MicroPrintf("#endif  // %s_SIZE_H", prefix);
+  MicroPrintf("// END ArenaSize %s", prefix);
+}
+
+// RAM for `count` models that run one at a time: one arena per model against
+// split arenas that share the non-persistent one.
+inline void PrintSharedArenaTotals(const char* planner, const char* const names[],
+                                   const ArenaBreakdown results[], int count) {
+  size_t separate = 0, persistent = 0, shared = 0;
+  MicroPrintf("Shared non-persistent arena, %s planner:", planner);
+  MicroPrintf("  %-8s %8s %11s %15s", "model", "arena", "persistent", "non-persistent");
+  for (int i = 0; i < count; ++i) {
+    const ArenaBreakdown& r = results[i];
+    MicroPrintf("  %-8s %8u %11u %15u", names[i], static_cast<unsigned>(r.arena_size),
+                static_cast<unsigned>(r.split_persistent),
+                static_cast<unsigned>(r.split_non_persistent));
+    separate += r.arena_size;
+    persistent += r.split_persistent;
+    if (r.split_non_persistent > shared) {
+      shared = r.split_non_persistent;
+    }
+  }
+  MicroPrintf("  separate arenas %u bytes, shared %u + %u = %u bytes",
+              static_cast<unsigned>(separate), static_cast<unsigned>(persistent),
+              static_cast<unsigned>(shared), static_cast<unsigned>(persistent + shared));
+}
+
+#endif  // ARENA_TUNE_H
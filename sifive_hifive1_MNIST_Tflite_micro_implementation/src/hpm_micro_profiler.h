@@ -0,0 +1,19 @@
+// MicroProfilerInterface on top of hpm_profile.[ch] (tools/model_compiler/runtime):
+// every op the interpreter runs becomes one row of cycles, retired
+// instructions, I-cache misses and load-use stalls. Call hpm_profile_init()
+// before the first Invoke() and hpm_profile_dump_csv() after each one.
+
+#ifndef HPM_MICRO_PROFILER_H
+#define HPM_MICRO_PROFILER_H
+
+#include "hpm_profile.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+
+class HpmMicroProfiler : public tflite::MicroProfilerInterface {
+ public:
+  uint32_t BeginEvent(const char* tag) override { return hpm_profile_begin(tag); }
+
+  void EndEvent(uint32_t event_handle) override { hpm_profile_end(event_handle); }
+};
+
+#endif  // HPM_MICRO_PROFILER_H
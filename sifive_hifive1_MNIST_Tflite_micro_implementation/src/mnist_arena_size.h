@@ -0,0 +1,48 @@
+// BEGIN ArenaSize MNIST_ARENA
+// Printed by PrintArenaHeader() (arena_tune.h), do not edit.
+// Smallest tensor arena per memory planner, measured with
+// 8-byte pointers.
+//                      greedy  offline
+//   tensor data           208      208
+//     of it scratch         0        0
+//   eval tensors          360      360
+//   persistent           1640     1592
+//   prepare headroom      456      304
+//   split arenas:
+//     persistent         2016     1968
+//     non-persistent     1008      848
+#ifndef MNIST_ARENA_SIZE_H
+#define MNIST_ARENA_SIZE_H
+#define MNIST_ARENA_POINTER_SIZE 8
+#define MNIST_ARENA_SIZE_GREEDY 2664
+#define MNIST_ARENA_SIZE_OFFLINE 2464
+#define MNIST_ARENA_PERSISTENT_SIZE_GREEDY 2016
+#define MNIST_ARENA_PERSISTENT_SIZE_OFFLINE 1968
+#define MNIST_ARENA_NON_PERSISTENT_SIZE_GREEDY 1008
+#define MNIST_ARENA_NON_PERSISTENT_SIZE_OFFLINE 848
+#endif  // MNIST_ARENA_SIZE_H
+// END ArenaSize MNIST_ARENA
+// BEGIN ArenaSize SINE_ARENA
+// Printed by PrintArenaHeader() (arena_tune.h), do not edit.
+// Smallest tensor arena per memory planner, measured with
+// 8-byte pointers.
+//                      greedy  offline
+//   tensor data            32       32
+//     of it scratch         0        0
+//   eval tensors          240      240
+//   persistent           1088     1056
+//   prepare headroom      400      392
+//   split arenas:
+//     persistent         1344     1312
+//     non-persistent      768      768
+#ifndef SINE_ARENA_SIZE_H
+#define SINE_ARENA_SIZE_H
+#define SINE_ARENA_POINTER_SIZE 8
+#define SINE_ARENA_SIZE_GREEDY 1760
+#define SINE_ARENA_SIZE_OFFLINE 1720
+#define SINE_ARENA_PERSISTENT_SIZE_GREEDY 1344
+#define SINE_ARENA_PERSISTENT_SIZE_OFFLINE 1312
+#define SINE_ARENA_NON_PERSISTENT_SIZE_GREEDY 768
+#define SINE_ARENA_NON_PERSISTENT_SIZE_OFFLINE 768
+#endif  // SINE_ARENA_SIZE_H
+// END ArenaSize SINE_ARENA
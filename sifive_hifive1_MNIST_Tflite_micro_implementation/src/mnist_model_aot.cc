@@ -0,0 +1,1019 @@
+/*
+ * This file is auto-generated by tools/model_compiler/tflm_aot.py from mnist_model_int8.tflite.
+ * Do not modify manually.
+ */
+#include "mnist_model_aot.h"
+
+#include "tensorflow/lite/kernels/internal/runtime_shape.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/leaky_relu.h"
+#include "tensorflow/lite/kernels/internal/reference/softmax.h"
+
+namespace {
+
+// Activation buffers; offsets come from a greedy first-fit plan over tensor lifetimes.
+//   [    0,   144) serving_default_flatten_12_input:0
+//   [    0,    64) sequential_12/leaky_re_lu_6/LeakyRelu
+//   [    0,    64) sequential_12/leaky_re_lu_7/LeakyRelu
+//   [    0,    10) StatefulPartitionedCall:0
+//   [   64,   128) sequential_12/dense_37/MatMul;sequential_12/dense_37/BiasAdd
+//   [   64,    74) sequential_12/dense_38/MatMul;sequential_12/dense_38/BiasAdd
+//   [  144,   208) sequential_12/dense_36/MatMul;sequential_12/dense_36/BiasAdd
+alignas(16) int8_t g_arena[MNIST_MODEL_AOT_ARENA_SIZE];
+
+const int32_t kDims64[] = {64};
+const int32_t kDims1x144[] = {1, 144};
+const int32_t kDims64x144[] = {64, 144};
+const int32_t kDims1x64[] = {1, 64};
+const int32_t kDims64x64[] = {64, 64};
+const int32_t kDims10[] = {10};
+const int32_t kDims10x64[] = {10, 64};
+const int32_t kDims1x10[] = {1, 10};
+
+alignas(4) const int8_t kOp1Weights[9216] = {
+    3, -12, 2, -1, 8, -12, -26, -14, -3, -14, -11, 9, -7, -28, -4, 4,
+    -4, 5, 21, 6, -24, -6, -4, 40, 9, -14, -20, -20, 6, -11, 1, -3,
+    -4, 20, -6, 16, 17, 37, 4, -3, 11, -26, 34, 17, 0, -2, 33, 29,
+    1, -7, 0, 18, -1, -20, -6, -4, 10, 25, 13, -5, -10, -37, -28, 15,
+    7, 9, 0, 19, -12, 6, 13, 10, 11, -16, 25, -1, -17, 10, 5, 0,
+    -7, -9, -10, -30, 8, 10, -5, 10, 7, 16, 18, 19, -21, -14, -68, -36,
+    -6, 12, -17, -4, 13, 1, 23, -6, -42, -21, -75, -41, -4, -15, -4, -10,
+    5, 29, 26, -4, -27, -83, -64, 0, -9, 16, -1, 13, 9, 19, 14, -25,
+    -96, -88, 15, 13, -9, -24, 30, 17, 24, 36, 4, -94, -88, 2, -21, -9,
+    -12, -6, 3, 6, 14, -1, 15, -32, 5, 1, 0, -13, -17, -36, -2, -18,
+    -26, -31, 6, -23, -29, -16, 6, 27, -20, 40, -3, -4, 9, -4, -18, -31,
+    -16, -2, 18, -15, 6, 11, 12, -21, 28, 25, -5, -12, 22, 29, 37, -5,
+    -3, -34, 30, -15, -32, -46, -32, 6, 14, 24, 18, 27, 12, 14, 15, 2,
+    -11, -1, -8, 6, -18, -18, -4, 25, 9, 23, -12, -42, -21, -9, 6, -34,
+    2, 10, -7, -14, -2, -3, -27, 10, 9, 0, 11, 1, -3, -7, -16, -6,
+    12, -8, -23, 12, 16, 9, -3, -7, 24, 33, -41, 31, 13, 15, 16, 29,
+    11, 15, 15, 14, 33, 40, 32, 35, -3, 5, 6, 10, 36, 14, 48, -11,
+    -12, 28, -22, -5, -13, 16, -4, 0, -9, 4, 10, 7, -14, 34, 13, 6,
+    8, 8, 3, -16, -13, -6, 5, 38, 1, -20, 11, -13, -14, 33, -44, -31,
+    -31, -16, 12, -12, -33, -1, -7, -7, -35, -40, -12, -4, -14, 3, -4, -5,
+    -8, 8, 11, 7, -20, -13, -1, 16, 9, -9, -20, 0, -7, 38, 28, 46,
+    -12, -1, -6, -10, -12, 14, 7, 3, -4, -20, 17, 26, 11, 0, -38, -3,
+    14, 27, 10, 0, -17, -12, -10, -45, 13, -12, -14, 2, 31, 23, 14, 2,
+    15, 16, -17, -9, -10, -38, 3, 2, 19, 4, -11, 3, 32, -11, 11, 7,
+    1, -26, 8, -13, -26, 22, 24, 6, -2, -6, 17, 42, -10, -16, -1, -15,
+    -16, 24, 28, -17, 15, -9, 39, 65, -7, 55, 7, -1, 20, -7, -5, -6,
+    45, 12, 25, 0, 11, -5, 29, 9, -34, -15, -1, -9, 19, 35, 43, 0,
+    6, 1, -1, 7, -11, 12, 2, 26, 12, -4, 11, -5, 5, -3, 3, -1,
+    4, 23, 2, 28, -11, 14, 11, -38, 5, -11, 18, 6, 12, 2, -1, -7,
+    14, 16, 21, -31, 10, -37, -4, 19, 7, -3, 8, -23, -19, -3, -6, -24,
+    -5, -47, -23, -2, 34, 27, 22, 34, -4, -4, -20, 15, -6, -6, -47, -23,
+    9, 8, 2, 10, 26, -5, -19, -34, -12, 17, 3, -10, -14, 8, 7, 33,
+    34, 17, -19, -55, -7, 23, -2, 8, 6, -14, 9, 27, 23, -18, -26, -21,
+    11, 9, -40, -21, 6, 18, 5, 14, 24, -3, -23, -34, -6, -39, -6, 6,
+    -8, -17, -7, 12, 29, -13, -49, -45, 1, -33, -27, -15, -18, -18, 3, 20,
+    25, -15, -7, -19, -11, 24, -15, -39, 1, 21, 2, 23, 11, 9, -26, -6,
+    1, -9, 4, 3, 8, 8, -5, -10, 0, 9, -12, -7, 9, 21, 3, 18,
+    -15, -22, -8, 22, 7, -15, -14, -47, 16, 6, -9, -15, -4, -3, -10, 3,
+    0, -17, -47, -64, 13, 9, 3, -30, -18, -33, -20, 6, 28, -18, -54, -6,
+    3, 5, -10, 7, -20, -17, -27, 43, -12, -11, 6, 33, 12, 15, 13, -6,
+    -22, -29, 19, 15, -27, -20, 2, -38, -4, -18, 10, 26, -2, 11, 31, 11,
+    15, 0, 2, -4, 4, -13, 33, 4, 10, 0, 16, 16, -17, 24, 12, -46,
+    5, 4, 26, 2, -18, 17, 3, 21, 3, 15, 12, 36, 1, -5, 34, 23,
+    -33, 8, 3, 9, 0, -17, -15, -73, -11, -18, 6, 22, 10, 13, -23, -15,
+    -15, -29, -23, -33, 6, -43, -12, 10, 5, 8, -2, 2, -3, -9, -60, 3,
+    -13, -13, 12, -2, 27, -4, 18, 33, -12, -6, 12, -7, -4, 2, 5, 13,
+    33, 31, 17, 6, 13, 2, 12, -16, -12, 4, 19, 40, 18, 33, 26, -1,
+    -5, 1, -10, -20, -19, 3, 32, 34, 18, 45, -21, -49, -66, -23, -25, -27,
+    -8, -7, 27, 25, 29, 2, -47, -14, -2, 5, 11, -40, 0, 29, 9, 10,
+    -13, -16, -13, 8, -2, -12, 16, 10, 7, 7, 20, 6, -15, 7, -14, -40,
+    11, 0, 22, 34, 11, -13, -18, 0, 9, 12, -9, -16, -9, 3, 20, -4,
+    2, -19, 5, 1, -20, -27, -3, 11, 1, -11, -13, 25, 10, -42, -13, -21,
+    -2, 2, 3, 20, 7, -8, 32, 2, -6, 3, 22, 24, 24, 11, 13, 0,
+    28, 22, 6, 9, -2, 68, -18, -2, -8, 28, -18, -1, 1, -3, -10, -12,
+    8, -3, -3, 5, 3, 4, 5, -20, 0, -14, -4, -8, 10, 8, -39, -19,
+    -9, -27, -26, -31, -7, 5, 19, 5, 14, -1, 17, 26, 18, 15, 32, 28,
+    26, 1, 33, 17, -11, 18, 39, 30, 36, 11, 6, -4, -13, -12, -4, 4,
+    -9, 23, -11, 9, -13, -45, -43, -25, -1, -12, -14, 4, -13, -25, -34, -43,
+    -20, 12, 24, 30, 12, 12, 0, 1, -6, -19, -29, -15, -2, 19, 1, 11,
+    9, 18, -14, 24, -6, -34, -28, -25, -41, -7, -33, -1, -1, 1, 1, 33,
+    -8, 37, 37, 15, 10, -16, -10, 11, 8, 26, -13, -14, -2, 19, 26, 24,
+    16, 28, 23, 2, -19, 9, 2, 13, 13, 15, -5, -13, -20, -19, 6, -4,
+    0, -1, -18, 28, 10, -12, -26, -4, 34, -5, -8, 20, -10, 45, -34, 6,
+    -10, 6, 12, 1, -12, 2, 13, -15, 4, 18, -10, 4, 9, 9, -26, -18,
+    12, 18, 9, -12, -16, 16, 6, 27, 5, 0, 11, 10, 11, -3, -27, -15,
+    -6, 11, 11, -24, 0, -13, 8, 12, 18, -2, -23, -9, 23, 17, -15, 11,
+    -2, -17, 31, 22, 6, -16, -7, 1, 7, -8, -15, 55, -10, 1, 13, 14,
+    14, -12, 7, 17, 9, 25, -3, 9, 7, 7, 18, 27, 3, 18, 34, 18,
+    16, 29, 55, 35, -7, 35, 34, -28, -32, 11, 16, 19, 13, -21, -25, -5,
+    13, 55, 1, -34, -8, 1, -1, -13, -28, -33, -26, -18, 11, 21, -5, -32,
+    -10, 7, -22, -9, -25, -22, -28, -31, 8, -25, -14, -25, -15, -14, 10, -3,
+    -7, 16, 20, -43, 4, -18, -15, -65, 15, 31, -46, 41, -34, -48, -32, -5,
+    -10, 12, 15, -1, -7, -10, 14, -5, 12, 3, -8, -9, -2, -4, 0, 1,
+    -3, -6, 17, 0, -11, -7, -41, -6, 26, 37, -5, 21, 31, 4, 0, 28,
+    23, -6, 11, -6, -11, 18, 10, -11, 6, 11, 24, 17, 11, -11, 16, 49,
+    7, -43, -15, -7, -6, 16, 16, 5, -20, 2, -12, 34, 12, -33, -19, 27,
+    33, 20, -5, -4, 2, -10, 14, 24, 12, 55, 60, 54, 28, 3, -24, -12,
+    7, 0, -16, 10, 5, 40, 31, 10, 15, -11, -41, -10, -15, 3, -5, -17,
+    0, -4, 5, 13, 8, -15, -38, -21, -26, -44, -33, 33, -12, -16, 27, 26,
+    7, -5, -6, -8, -34, -30, -20, 34, 11, 2, -2, 20, 11, 9, 8, -16,
+    -10, -17, -16, -37, 1, -8, -11, 27, 30, 2, -14, 5, 10, 19, -12, -7,
+    11, 3, -9, -5, -17, 5, 23, 0, 9, 8, 5, -9, -5, 35, 13, 21,
+    10, 33, 45, 18, 2, 23, 9, -6, 32, 0, -4, -1, 18, 14, 18, 26,
+    9, 3, 8, -3, 12, -49, -16, 12, -24, -24, -23, -8, 14, 27, -5, 23,
+    2, -17, 2, -19, -55, -68, -28, 12, -6, -3, 15, 42, 1, -47, -21, -2,
+    -9, 3, 11, 10, -4, -3, 14, 20, 0, 45, 32, -2, -9, -12, -2, -21,
+    -25, -5, 8, -32, -10, -29, -14, -26, -22, 2, 10, -15, -9, -13, -13, -18,
+    0, -38, 5, 14, -3, -2, -12, -35, -17, -3, 18, 11, -1, -21, -12, 4,
+    -10, -23, -27, 7, 4, 15, 39, -9, -1, 28, 0, 22, -2, 2, -10, 9,
+    8, -3, -25, -29, -2, 25, 6, -38, -16, 14, 15, -7, 11, -12, 45, 10,
+    -8, 13, -3, 5, -6, 3, 27, 37, 10, 9, -9, 3, 4, 2, -2, 4,
+    -1, 13, -12, -12, -9, -24, -50, 22, 9, -8, 28, 11, 0, 7, 10, -6,
+    -7, -17, -29, 48, 15, -15, -9, 0, -1, -7, 3, 15, 17, -18, -21, -18,
+    -2, -18, -24, -3, -12, -5, -2, 5, 27, -5, -30, -53, -10, -9, 0, -13,
+    -13, 3, 0, 21, 45, 17, 3, -19, -11, 12, -3, -13, -9, 9, 27, 34,
+    15, 6, 24, 36, 2, 3, -29, 2, -12, 36, 25, 24, 3, 10, -13, 8,
+    -9, -36, -32, -36, 5, 52, 5, 9, -11, 2, -18, -35, -5, -25, -42, -16,
+    7, 22, 20, 14, 10, 19, -22, 10, -2, -52, -27, 6, 7, 16, -13, -6,
+    -14, 15, -13, -38, 3, -53, -59, -6, -2, -17, 1, -14, 13, 4, 0, -13,
+    10, -7, 11, 0, 20, -1, 2, 28, 11, -9, 8, -1, -1, -17, -6, 33,
+    38, 17, -23, -44, -38, 8, 12, 10, -8, -43, 14, 31, 26, 14, -14, -42,
+    6, 22, 28, 22, 6, -36, -10, 51, 21, -28, -62, -23, 9, 1, -5, -6,
+    -10, -8, -2, 55, 50, -25, -62, -26, -31, -10, 5, 9, 3, -21, 7, 6,
+    16, 24, -14, -5, -8, -4, -1, 45, 7, -3, 23, 3, 1, 4, -9, 3,
+    -15, -8, -1, 0, 2, 16, 8, 6, -6, -5, -10, 14, -11, -3, 0, 27,
+    3, 1, 11, 6, 13, -12, 18, -10, -7, 14, 2, 21, 10, -21, -4, -13,
+    7, 4, 13, 3, -2, 12, 14, -10, -12, 12, 20, 26, -16, 14, 5, -4,
+    15, -5, -28, 30, -4, 0, 2, -31, 22, 4, -10, -31, -17, 25, -23, 12,
+    6, 13, -4, -1, 2, -6, -12, -9, 12, 2, 11, 7, 8, -9, 20, -6,
+    8, 18, 24, 16, 23, 12, 34, -8, -6, -25, -1, 7, -12, 8, -20, -23,
+    -13, -4, 9, 4, -5, 23, 24, 7, -1, -4, -23, -18, -10, -5, -12, 19,
+    7, 7, 31, -4, 14, 0, 6, 21, -6, -7, -14, -26, 9, 33, 32, 6,
+    -12, 19, 10, -4, -10, -1, 2, 15, 6, 13, 15, -33, -26, 18, 4, -4,
+    3, -30, -28, -13, -8, 11, 5, -8, -28, -9, 4, 0, -10, -7, 36, -6,
+    12, -9, 25, -23, -18, 14, 14, 10, 2, 36, -11, 22, 8, 13, -7, 1,
+    17, 5, 28, 9, -1, 13, 3, 3, 1, 12, 10, 2, 25, 10, 13, 14,
+    4, 8, 11, 57, -5, -18, -45, -14, -6, -62, -14, -19, 18, 18, 7, -2,
+    -10, -5, 8, 9, 0, 9, -9, -27, -4, -2, -10, 2, -8, 26, 54, 30,
+    -4, 20, 1, -8, -3, -9, 1, 40, 17, 14, 15, -7, 5, -10, 7, 12,
+    -2, 5, -2, -31, 12, 10, 48, -16, -22, 21, 13, 20, 28, 36, 34, -44,
+    4, 49, 45, 15, -4, 6, -3, -25, -24, 3, 39, 18, -7, -6, 26, 26,
+    7, -4, -13, -5, -3, 1, 19, 17, -10, 12, 12, 41, 4, 19, -47, -9,
+    6, 3, 14, -3, -6, 15, -2, -25, 2, -17, -24, -7, -14, 13, 40, -1,
+    5, 1, -12, -20, -15, 10, -4, -24, -47, 5, 26, 8, -7, 30, -16, -1,
+    13, 4, -21, -22, -35, -8, 28, 29, 5, -11, 6, -4, -2, -10, -14, 5,
+    2, 6, 7, 0, -1, -4, -31, -16, -16, 2, 5, -20, 25, 4, -4, -11,
+    -9, 6, -15, 9, -2, -1, 10, -14, 2, -1, -1, -6, -9, 10, 14, 6,
+    -56, -40, -33, -4, 11, 0, 14, 8, -1, 3, 16, 4, 9, 14, -11, -22,
+    2, 11, -9, 16, 3, 55, -7, 13, 17, 21, 30, 18, 3, -7, -11, 27,
+    9, -2, 21, 19, 16, 25, 6, 52, 7, 19, 5, 31, 0, -37, 4, -1,
+    -20, -15, -21, -11, -8, -7, 32, -3, -5, -16, -10, -6, -5, -17, 16, -26,
+    -31, 1, 28, 9, -8, -22, -6, 3, 16, 1, 4, -23, -10, 13, 20, 0,
+    -4, 16, 6, 1, 30, -6, -18, 31, -16, -11, 0, -9, 11, 15, -8, 6,
+    -15, 22, -7, 29, 18, 4, -7, 15, -12, 14, -22, -26, 10, 24, 10, -10,
+    -3, -6, -19, -54, -13, 5, 14, -8, -7, 6, 9, -11, -16, -7, -3, 0,
+    -5, 10, 1, -4, -11, -9, -28, -17, 8, -1, 2, -1, -9, 5, 16, -9,
+    -12, 6, 10, 11, -6, 9, -18, -8, -14, 5, 13, 8, -3, -1, -12, -2,
+    -5, -8, -8, 1, 9, -9, 12, 11, 2, -5, -3, 14, 3, -5, 7, -14,
+    -1, 8, 20, 6, 14, 36, -6, 14, -3, 0, 2, -1, -6, 35, 6, 13,
+    2, 16, 10, -1, 16, 15, 10, 54, -2, 3, 24, 31, 46, 30, 23, 9,
+    15, 9, 3, -30, 4, -66, -104, -54, -27, -5, -11, -3, -9, -23, -21, -22,
+    9, -63, -66, -81, -69, -45, -36, -35, -12, -6, -16, -44, -9, 18, 30, 5,
+    -1, -11, -11, -3, -16, -29, 8, -8, 8, 24, 22, 33, 19, 14, 7, -10,
+    -9, 3, -23, -20, 11, 8, 2, 9, -14, 15, 23, 10, 0, -13, -7, 4,
+    11, 6, 0, 0, 5, -1, 14, -32, 0, -5, -1, -4, 1, 7, -29, -37,
+    -21, -16, -7, 3, -1, 0, 6, 26, 19, 33, 23, 23, 34, 6, -13, 22,
+    21, 15, 3, -14, 7, 12, 8, 8, 7, 31, 14, 0, 30, 24, 21, 23,
+    5, 22, 0, 23, 42, -13, 11, 1, 0, 3, 26, 48, 5, 26, 31, -36,
+    -26, -28, 11, -24, -3, -24, -41, 5, -8, 11, -13, -9, 4, 6, 2, -6,
+    -7, -21, 13, 13, 0, -16, -14, 8, 22, 11, -7, -5, -18, 4, 10, -11,
+    8, 3, -22, 6, 13, 2, -11, -7, 14, 1, 26, 18, -2, 6, 4, -8,
+    -4, -15, -5, -7, 11, -6, -24, 0, 8, -18, 2, 9, 12, 6, 7, -9,
+    -12, -1, -22, 15, 0, -3, 13, -12, -19, 16, -24, -8, -5, -7, 14, -1,
+    -1, -5, -5, -9, 1, 11, -16, -18, -4, 6, -3, -3, 11, -1, -25, 2,
+    -11, -5, -1, -7, -10, -20, -1, -26, -39, 12, -36, 0, -9, -20, 4, 21,
+    3, -3, 2, -31, -18, 18, -9, -14, -29, -20, 1, 10, -22, -9, -2, -2,
+    -5, 15, 30, -1, -3, -30, -68, -32, -31, 10, -3, 23, 8, -12, 16, 13,
+    1, 20, 2, -7, -1, 15, 26, -44, -13, 7, 6, 28, 9, 2, 38, 6,
+    1, -14, -25, -35, 8, -16, -31, 1, 28, 46, 19, 6, -21, -25, -32, -83,
+    -2, -5, -35, -6, 0, 23, 4, 29, 14, 5, -18, 3, -1, -10, 14, 10,
+    -41, -7, -3, -2, 26, 9, 9, 8, 3, -14, 10, -5, 9, 19, 3, 5,
+    15, 28, 17, 30, -2, 7, 7, 25, -8, 15, 1, 23, 12, -23, 12, -7,
+    -3, -11, 3, 13, 9, 2, -2, 5, 11, -3, -5, 0, -9, 16, 8, -15,
+    20, 7, 27, 25, 13, 16, 33, -15, 1, -6, -13, -3, -8, 19, 19, 18,
+    12, 16, -18, 25, -13, -20, -25, -44, -46, -17, 16, 5, 5, -9, -32, 23,
+    -1, -10, -81, -50, -24, 33, 9, -8, -11, -32, -31, -24, -6, 9, -32, -10,
+    21, 14, 4, 14, 19, 3, -44, -43, 9, 27, -12, -17, -7, 6, 14, 20,
+    9, -1, 9, 53, 9, -20, -11, -9, -21, -6, -8, 8, 23, 12, 30, 28,
+    10, 31, -7, 1, 5, 25, 21, -1, -21, 6, 21, 4, 2, 3, 4, -9,
+    0, 29, -4, 10, 4, 22, 3, -2, 0, -26, -6, -7, 4, 13, 11, 19,
+    13, 31, 11, -33, 7, 11, -1, 14, 8, 30, 3, 26, 5, -4, 7, -2,
+    -2, -6, -12, 10, -12, -3, -5, -22, -9, 4, -7, 5, 10, 54, 22, 24,
+    25, 26, 8, -6, 2, 9, 1, 45, 7, 40, 23, -12, 27, 7, -12, -8,
+    -25, 16, 7, 14, -13, 1, -32, -29, -49, -39, -26, -21, -1, -10, -6, -6,
+    -7, -63, -29, -2, 10, -5, 17, 8, 9, -16, 12, -10, 4, 13, 17, 7,
+    0, -11, 18, -11, 2, 8, -12, -6, 13, 15, 10, -13, 2, -11, 2, -1,
+    -5, 1, 18, -14, -8, 0, -26, 11, -2, -3, -31, -2, 20, 20, 18, 39,
+    -2, -31, -2, 9, 11, -42, -41, -23, 9, 13, 40, 63, -12, -3, -17, -14,
+    11, 13, 7, 8, 2, -6, -2, 13, 4, -32, -11, 5, 24, 63, 43, 30,
+    18, 3, -34, -99, 13, 3, -2, 10, 2, 13, 37, 15, -23, -30, -35, -11,
+    -8, -2, 4, -7, 3, 1, -4, -4, 1, 1, 9, -6, 3, -29, -12, 5,
+    -11, -4, -21, -21, -29, -25, -9, 12, -5, -19, -3, -30, -17, -1, -13, -2,
+    12, 29, 17, -23, -2, -42, -11, -4, 28, 4, 3, 20, 44, 21, 19, 15,
+    11, 29, -19, 22, 23, 3, -5, 26, -18, -28, -44, -21, 8, 12, 0, 16,
+    21, 21, -3, -26, -10, -11, -17, -36, -1, -11, -22, 11, 36, 24, 3, 14,
+    -9, 48, 12, 20, -11, 14, 11, -25, -7, 14, -5, -5, 11, 27, 20, 14,
+    12, -1, 3, -26, -3, 11, -2, -2, 23, 13, 1, -44, 7, 9, -28, 8,
+    2, 24, 8, 25, 14, 4, -28, 25, 13, 0, 0, -14, -7, 4, 10, 20,
+    -4, -40, -56, -8, 2, 49, -34, -12, 17, -4, 14, 2, -6, -71, -76, -10,
+    -1, 3, -2, -11, -14, 4, 8, 2, -2, 2, 2, -5, 14, 11, 36, 13,
+    3, 0, 4, 18, 20, 16, 25, 35, 14, 4, 27, 28, 12, 20, 29, 11,
+    10, 1, -18, -14, 15, 5, -9, 9, 29, 20, 1, 6, 53, 24, -4, -7,
+    8, -7, 5, 1, -9, -9, 23, 29, 39, -17, 13, 50, 10, 39, 14, -18,
+    -23, -25, -28, -14, -20, -10, 25, -14, -7, 9, -5, 21, -5, -20, -25, 0,
+    11, 4, -3, 1, 0, -3, -21, 25, 25, -24, 3, 14, 2, 6, 34, -2,
+    9, -38, 2, 7, -10, -1, -5, 5, -10, 13, 10, -8, -9, 24, -8, -23,
+    -37, -64, -37, 7, 13, 15, -3, 31, -3, 6, 1, 3, -8, -37, -18, -1,
+    -10, 0, -8, 14, -1, 21, -83, -11, 12, 8, 14, -17, 13, -2, 5, -6,
+    -13, -2, 8, 11, -19, -1, -4, 39, -4, -1, -9, 5, -9, 5, 20, 6,
+    -10, -30, -2, 31, 29, 54, 11, 14, -25, -16, -19, -18, -23, -27, -14, 3,
+    16, 47, 59, -7, -21, -36, -17, -21, 16, -12, -33, -19, -2, 37, 33, 24,
+    -3, -26, -4, 14, -14, -49, -42, -4, 17, 30, 42, 24, 4, -12, -2, 15,
+    6, -8, -17, 2, 16, 4, -15, -45, 4, -7, 6, 9, -10, 1, 7, 21,
+    10, -3, -17, 15, 11, 28, 14, -12, 12, -4, -3, 11, -26, -11, -2, 49,
+    8, 16, 6, -2, 2, -3, -1, 15, 6, -1, -5, -69, -10, -14, 2, -7,
+    -5, 9, 10, -4, -10, -13, 12, -12, -12, -6, 3, 3, 4, -8, 7, 3,
+    -2, -12, -16, -37, 7, -14, 6, -11, 15, 10, 1, -15, 2, -23, 30, -4,
+    3, -9, -12, -8, -5, 5, -11, 17, 6, 5, 11, 9, 7, -31, -23, 25,
+    -13, 5, 4, 6, 24, 18, 2, 28, -9, -9, -10, -1, 17, 13, 3, -6,
+    15, -11, -8, -18, 20, 0, -27, 17, 13, -17, 14, 7, 10, 24, 11, 8,
+    7, -34, 0, 3, -16, 18, 17, -10, 17, -5, 12, 40, -9, -7, 11, 7,
+    16, 37, 15, 1, -2, -6, -42, -34, -4, -47, -36, -14, -14, 1, 32, 4,
+    -2, -5, -37, -9, 12, -43, -32, -3, -33, -6, 14, 13, 3, -1, -10, 5,
+    -10, -29, -17, -21, -23, 14, 0, -8, -26, -30, -8, 12, -4, 12, -22, -12,
+    -23, -18, -27, -27, -12, 8, -4, -6, -12, -4, 4, 7, 28, -4, 23, 24,
+    31, 30, -28, -28, 3, -1, 4, -37, 10, -11, 1, 6, -11, 1, -57, 13,
+    -11, 3, -2, 4, -4, -8, -8, 22, 4, -22, 2, 13, 14, -18, 33, 7,
+    -28, -11, -11, 17, 32, 27, 10, -8, -4, -29, 17, 24, -18, -34, -7, 29,
+    15, 21, 1, 23, 12, -20, 18, 5, 3, -15, -4, 16, 30, 14, 8, -39,
+    -6, 14, 11, -4, 4, -6, -1, -2, 9, 0, 26, -50, 2, 2, 10, -17,
+    3, 7, 13, 17, 27, 12, -12, -32, -2, -11, 15, 0, 6, 2, 6, -2,
+    -7, -14, -10, 31, -2, -48, -22, 12, 10, 26, -11, -1, -17, 8, 19, 31,
+    11, -40, -28, 11, 8, 10, -20, -21, -21, 5, -37, 44, -11, -5, 13, 25,
+    17, -22, -62, -23, -28, -21, -10, 14, 5, -52, -30, -18, -27, -12, -24, -33,
+    0, -13, -9, -14, -3, -37, 9, 30, -6, 4, -50, -48, -16, 2, -20, -12,
+    -3, 4, -5, -2, -6, 0, 20, -4, -3, -2, 10, 9, 17, 47, 15, 23,
+    7, 21, 3, -16, -9, -3, 15, 16, 16, 29, 5, 2, 0, 16, 1, -11,
+    8, 3, 12, 12, -10, -7, -1, -14, 14, -7, 11, -11, -10, 6, 9, -7,
+    11, 21, 2, -1, 10, 10, 13, 3, -7, -1, 27, -43, 7, 12, -3, 8,
+    10, 17, -6, 7, -2, 23, 23, -8, 4, -1, 1, 7, 10, -15, 13, 24,
+    35, 29, 6, 3, -7, -35, 1, 33, 29, 1, 27, 18, 22, 20, 41, -1,
+    2, -11, 1, 17, 0, 9, 9, -15, -17, -11, -40, -10, 4, -29, -7, -14,
+    -31, 6, -9, -17, -53, -40, -60, -20, 10, 0, -38, -35, -7, -28, -2, -16,
+    -1, -14, -58, -35, -11, 3, -15, -26, 7, -2, 19, 3, 3, -15, -47, 9,
+    -9, -3, 2, -4, -8, -9, 21, -32, 3, 24, 2, 0, 6, -17, 51, 27,
+    37, 25, 30, 1, 10, 14, 29, -16, 23, 14, -9, -13, 2, 16, 12, 13,
+    24, 27, 10, 14, 10, -32, -17, -27, -22, -11, -16, -26, 6, -4, -5, 37,
+    -13, 37, 8, 8, 9, -10, -14, -13, -6, -9, -21, -26, 11, 46, 4, -1,
+    -16, -27, -24, -9, 8, 11, -16, -32, 6, -22, -25, -22, -15, -10, -15, -6,
+    -3, 1, -4, -20, 8, -38, -38, 15, 0, -10, -14, -5, 7, 0, -10, -49,
+    2, 14, 3, 7, 1, 9, -11, -27, -49, -67, -77, -87, -7, 13, -6, 18,
+    4, -18, 7, 0, -13, 4, -21, 12, -6, -3, 14, -17, 10, 12, 1, 51,
+    25, 7, 45, 17, 0, 12, 6, 8, 1, -1, 6, -8, 18, 27, -7, 1,
+    -4, -2, -5, 7, -20, 13, 6, 1, -6, 0, -5, 13, 12, 5, -10, 7,
+    3, -10, 3, -15, 14, 5, 9, -17, 10, 1, 25, -17, 6, -1, -9, -14,
+    5, 10, 5, 5, 17, 14, -11, -4, -11, -4, -20, -4, -2, 19, 45, 37,
+    11, -45, -43, -19, -2, 35, 8, -39, 18, 13, 19, 45, -4, 3, -11, 23,
+    37, 16, -26, -46, -9, 19, 8, 34, -3, -7, 19, 27, -8, -13, -41, -25,
+    5, -5, -15, -51, -4, -6, 9, 12, -8, -18, -21, -16, -6, 1, 19, 6,
+    -10, 11, -14, -9, -12, -19, 7, 29, 21, 34, 28, 18, 1, -3, -15, -2,
+    -11, 27, 12, 5, 13, 5, 38, 28, 10, 10, 12, -1, 0, 0, -27, -1,
+    -4, -13, 7, 61, -8, -1, 24, -23, -9, -7, -10, 2, -26, -21, 16, 8,
+    10, 11, 2, -1, 13, 12, -4, -13, 2, 23, -12, -7, 5, 16, 20, 27,
+    -23, -28, -15, -13, 13, 15, 17, 14, -1, -19, 24, 17, 7, -42, -40, 13,
+    -1, 6, 0, 3, -17, 10, 39, -2, 12, -31, -52, 16, -14, -10, -8, 4,
+    12, -1, 13, 8, 19, 7, 16, -7, 6, 23, 36, -18, 6, 17, -25, -24,
+    6, 29, 7, -37, -23, 21, 21, -21, 10, -15, 11, 5, -6, 3, 9, 16,
+    -15, -46, -6, 23, -9, -13, 8, 5, -13, 11, 24, -9, 8, -36, -2, -4,
+    -12, 12, 4, 16, -17, 8, 4, 0, 3, 11, -1, 13, -10, 20, 12, -15,
+    -18, 23, 8, 7, 20, -12, 10, -2, 7, 21, 20, 26, 1, -19, 11, 7,
+    26, 25, 9, 30, -2, -32, -5, -18, -27, 7, 4, -29, -34, 1, 31, -5,
+    -7, -10, 8, 2, 3, -7, -13, 11, 0, -4, -6, -6, -14, 8, -5, 5,
+    21, 2, 6, -4, 15, 7, 47, 2, -7, 15, 8, -26, -33, 15, -2, 14,
+    30, -5, 10, 14, -11, -10, -17, -38, -25, -1, 10, -23, -19, -21, -39, 5,
+    7, -24, 19, -2, 2, -5, -6, 28, -6, 10, -10, -31, -5, -13, 29, 24,
+    -20, -8, 4, 20, 30, 9, 2, 10, -1, 23, -4, 12, 5, -7, 17, 20,
+    23, 19, 18, 4, -6, -12, 2, 44, 7, -13, 21, 12, 32, 21, 30, 34,
+    -13, -14, -7, 36, 3, -19, -17, 3, -24, 3, 24, -10, -12, -15, -12, 8,
+    -7, -1, 7, -23, -14, 7, -6, 15, 4, -1, -16, 5, -2, 11, 13, 14,
+    16, 6, 13, 4, -5, -30, 13, -18, 9, 10, 24, -11, -6, 19, -1, 8,
+    2, -5, -2, -6, -1, -3, 7, 17, 8, 12, 11, -8, -11, -47, -64, -92,
+    -32, -17, 13, -4, 1, 16, -3, -3, 11, 24, -45, -71, 1, -3, 6, 0,
+    17, -1, 25, -7, -3, -34, -73, -57, 28, 43, 15, -37, -40, -38, -14, 55,
+    -10, -5, -66, 7, 29, 27, 12, -15, -3, -24, 20, 1, -2, -36, -45, 2,
+    31, 26, 28, 6, -28, 24, 11, 42, 8, -20, 12, 33, 31, -5, -1, -11,
+    -1, 0, 28, 21, 5, -33, 2, 41, -15, -14, -17, -1, -16, -7, -1, 13,
+    3, -12, 27, 1, -20, -19, -33, -8, -2, 2, -1, -15, -10, 9, 4, 6,
+    -13, 0, -3, -22, -9, -8, 11, 4, -3, 13, 5, 2, 31, 0, -17, -26,
+    -25, -14, -39, 6, 11, 10, 8, 19, 2, -4, 4, 26, -16, 26, 9, -5,
+    1, -6, -9, 10, 1, 6, 2, 29, -7, -21, -5, 8, 6, 45, 16, 9,
+    11, 3, -29, -9, -5, -22, 22, -2, 28, -22, -4, 23, 2, -7, -3, 1,
+    12, -12, 31, 1, 10, -9, 9, 31, 16, 27, -7, -19, -1, 17, 28, 0,
+    -3, 38, 49, 39, 19, -10, -57, -19, -8, 5, 19, -18, -4, 29, 22, -6,
+    -29, -50, -3, -5, 6, -18, 0, 21, -7, 22, 7, -15, -46, -29, 4, 9,
+    7, 5, -30, -12, 10, 8, -33, -35, -14, -6, 0, 19, -8, -8, -12, -22,
+    -12, -9, -27, -34, -22, -6, -12, 2, -3, -8, 6, -13, 9, 19, 24, -3,
+    10, -21, -24, -18, 5, 14, 11, -5, -3, 5, 22, 9, 16, 4, 9, 8,
+    -6, 10, 5, -78, 8, -18, 6, 8, -13, 7, -9, 19, 26, -1, 11, 6,
+    9, -8, 14, 6, 3, -5, -9, 34, 16, -16, -8, -12, 3, -18, -76, -12,
+    10, -6, 7, 0, 29, 35, 15, -28, 4, -16, -28, -6, 26, 1, 1, 6,
+    11, 13, 13, -16, -11, -12, 16, 12, -22, -4, 14, 18, 16, 8, 0, -39,
+    11, -12, -8, -51, -44, -10, 34, 21, 1, 11, -24, 18, -4, -28, -34, -41,
+    7, 45, 15, -12, -7, -32, -4, -42, -11, -11, -36, 34, 47, -6, 7, 2,
+    -1, -11, 18, 2, 10, -47, -51, 7, 21, 6, -2, 19, 3, 3, -9, 6,
+    -1, -69, -28, -1, 19, -19, -1, 15, -1, -6, -15, 46, 2, -20, -29, -35,
+    -20, 18, 10, 42, 11, 10, 15, -27, -6, -4, 15, 5, -11, 6, -2, 11,
+    -4, 7, -24, -16, -1, 7, -9, 0, -7, 9, 7, -4, 13, 14, -37, -8,
+    2, -13, 1, 11, -16, -4, 30, 30, -2, -6, -6, 1, 2, -8, 28, -3,
+    24, 2, 7, -6, -1, -17, -32, -50, -3, -28, 2, -7, 7, 16, -1, 15,
+    -30, -19, -25, -46, 13, 21, 28, 18, 10, 20, 17, 19, 7, -38, -30, -34,
+    -8, -4, -17, 17, 19, 1, 8, 37, -20, -67, -34, 9, 1, -12, -18, -1,
+    -1, 22, 60, 29, 4, -63, -29, 31, -2, -17, 36, 8, 20, 21, 31, 1,
+    -53, -56, 1, 30, 2, -32, 11, 11, 12, 3, 22, -33, -22, -15, -15, 36,
+    -7, 11, 23, -7, 16, -8, -25, -25, -56, -17, -11, -19, 1, -12, 13, 14,
+    1, -10, -1, -11, -12, -22, -25, -33, 11, -25, -6, -7, -9, 9, 12, -7,
+    -3, -10, 8, -63, 0, 61, -13, 34, 11, -4, 17, 8, 20, -4, -24, -10,
+    8, 2, -1, -6, 1, -1, -9, -20, 5, -7, 4, -5, 0, -66, -16, -43,
+    -21, -5, -17, -6, -8, -22, -17, 58, -20, -1, -15, -23, -4, -17, -1, 15,
+    7, -5, 28, -13, -16, 0, -17, -1, 13, 12, 4, 38, 31, 41, 49, 27,
+    8, -7, 28, -4, -19, -20, -30, -42, -25, -45, -20, 20, 9, -13, 3, 4,
+    -2, 3, -11, -30, -42, -93, -100, -127, 11, 4, -10, 9, -6, 5, 8, 13,
+    -6, -10, -100, -32, 7, -13, 12, 6, 31, -16, 10, -14, -14, 2, -7, 13,
+    12, 6, 1, 13, 17, 20, 2, 9, -2, -10, 11, -43, 13, -12, 8, 19,
+    17, -8, 3, 1, 9, 24, -2, 2, -2, -18, 14, 19, 11, 10, 3, 13,
+    1, 12, 33, -25, -2, 58, -4, 10, -1, 15, -3, -6, -2, -25, -7, -6,
+    -12, -5, 8, 5, 9, 6, 7, -34, -2, 19, -6, -10, 5, 9, -13, -19,
+    -25, -24, 29, -4, -11, -11, 2, -4, 11, -28, -6, -39, -12, -3, 1, 14,
+    -35, -4, -11, -4, 11, -2, -25, -40, -24, -1, 26, 9, 3, 11, 2, 6,
+    13, -30, -1, -24, 7, -14, -29, -26, -36, -16, -24, 6, 12, -16, -4, 23,
+    -3, 19, -17, -10, -20, -22, -4, 46, 7, 12, 14, 23, 24, -4, 2, 7,
+    5, 25, 41, -32, -9, 12, 40, 13, 7, -9, 10, 13, 26, 9, 41, -41,
+    9, 18, 23, 31, 5, 6, 31, 34, 45, 15, 23, 14, -3, 33, 3, -4,
+    13, 18, -4, 19, 4, -3, -6, -26, -13, -3, -10, -14, 5, -21, -20, -16,
+    12, 19, 45, 2, 13, 31, -25, 11, 8, -3, 3, -74, -11, 20, 30, 8,
+    -2, -1, -12, -10, 3, 9, 20, 21, -4, -2, 7, 5, 8, 13, -20, -11,
+    4, 3, 5, -12, -8, 22, 14, 50, 16, -30, -18, -13, 8, 19, 4, -11,
+    4, 21, 30, 2, 12, 25, -2, 1, -8, 7, -21, 10, 15, 27, 18, 18,
+    -9, 18, -1, 13, 16, 3, -26, 3, 12, 21, 13, 9, 3, -7, -5, 10,
+    -11, 0, -33, -34, 14, 11, 34, 37, 7, 15, -23, 3, -1, -8, -41, -40,
+    18, 29, 32, 13, -5, -19, 7, -7, -4, 3, -55, -3, 39, 51, 22, 29,
+    -7, -23, -17, -18, -14, -43, -38, 38, 24, 7, 0, -19, 0, 8, -2, -37,
+    -44, 3, 28, 18, 10, 11, 18, 9, -12, -19, 1, -7, 16, 15, 5, 4,
+    25, 18, 21, 47, -5, 18, -27, 10, 2, -1, 7, -2, 2, 18, 38, 2,
+    12, -7, -4, 10, 3, -2, 13, 17, 4, 11, -13, -1, 14, 71, -24, -20,
+    1, 9, -25, -7, 14, 18, -3, -17, -1, -19, -18, -13, 8, -4, 14, 11,
+    22, -11, 16, 45, -7, 12, 21, -4, 18, 23, -6, -17, -13, 6, -4, 22,
+    -11, -26, 33, 5, -1, -8, 35, 35, 20, -7, -6, 2, -5, 16, 3, 16,
+    0, 3, 21, 29, 27, -19, -11, -7, 11, 19, -12, -22, -25, -31, 2, 50,
+    -3, -47, -25, 11, -12, -47, -6, -21, -15, 8, 8, -2, -16, -19, 5, -1,
+    -10, 17, 13, -4, 7, -1, 3, 8, -55, -5, 6, -21, -9, -7, 8, 9,
+    16, -9, 1, 1, -2, -31, 30, 2, -7, 30, 31, 12, -13, -19, -7, -2,
+    -37, 0, -3, 7, 11, 38, 3, -22, -31, -21, -18, 7, -10, -27, -15, 7,
+    -9, -7, 9, 7, 4, 3, 12, -16, 8, 16, 13, -5, 5, 14, -2, -1,
+    43, 33, 10, -13, -30, -31, -10, -67, -29, -21, 23, 46, 14, -21, 1, 6,
+    39, 15, -16, -11, -7, 16, 18, -21, 7, -4, 26, 14, 9, 21, -1, -5,
+    7, 2, -11, 8, 15, 10, -19, -17, -7, -22, 32, 24, -10, 34, -30, -6,
+    -8, 6, -7, -15, -29, -17, 3, -6, 7, 13, 5, 1, -20, -5, -37, 17,
+    7, 5, 9, -17, 3, 26, 5, -14, -24, -32, -6, 15, 22, 16, -3, 16,
+    11, 53, 8, -15, 17, 3, 6, -27, -5, -3, 29, 8, -2, 17, 12, 8,
+    -8, 13, -2, -9, 7, -2, -9, 1, -3, -44, 34, -2, -7, 0, 27, 2,
+    -7, -16, 30, 31, -7, -83, 8, 4, 29, 6, -36, -14, 22, -14, -13, -1,
+    2, 5, -1, 5, -9, -2, 15, -36, -15, 19, -3, -11, 8, 6, -47, -28,
+    -19, -14, -3, -19, -4, 10, -15, -27, 18, 32, 0, 11, -9, -6, 9, 4,
+    7, 12, -4, -2, -7, 28, 25, 33, 22, -20, 2, 6, -5, 5, 5, -12,
+    -9, 23, 49, -13, -7, -43, -16, 5, -25, -19, -2, -17, 7, -52, -59, -50,
+    -66, 2, -7, -8, -19, -15, -24, -14, -3, -59, -85, -4, 7, 22, 8, -15,
+    12, -1, 9, 43, 5, 2, 10, 26, 17, 17, 7, 7, 26, -6, -9, -6,
+    7, 27, 8, -16, 16, 2, 30, 26, -15, 9, 7, -32, 9, 20, 20, 19,
+    -2, 1, 15, 2, 10, 3, 25, 44, 4, -4, 3, 8, 1, -4, 1, 5,
+    9, 24, 11, 8, 11, 36, -2, 13, 18, 19, -4, -10, 19, 6, -10, -5,
+    -7, 7, 2, -3, -4, 8, -1, -4, 7, -5, -10, -1, 11, -17, 7, 19,
+    20, -9, -7, -8, -12, 0, -12, 17, 9, 8, 22, -25, 3, -11, 3, 14,
+    3, 16, -4, -42, -2, 13, -7, 14, 17, 4, -5, -11, -9, -10, 6, 3,
+    3, -12, -9, -26, -28, -30, -11, -5, 3, -1, 1, -9, -10, -14, -15, -10,
+    -16, 3, -7, 16, -27, 1, -16, 42, 9, 38, 43, 24, 23, 13, 11, 6,
+    13, -10, 20, 6, -7, 49, 59, 75, 59, 54, 27, 6, 14, 19, 5, -36,
+    3, -38, -25, -33, -21, 24, -1, 9, 14, 5, -22, 38, 2, -36, -52, -38,
+    -58, -16, -33, -10, -3, -6, -2, -34, -9, 4, 0, 5, -1, -10, 1, -15,
+    -22, -5, -4, 34, 3, 13, 14, 20, 8, 16, -14, -15, -6, -15, -16, -12,
+    -2, -7, 5, 10, 5, -12, -1, -29, -5, -1, -1, -5, -5, 25, 18, -22,
+    -28, -36, -13, 7, 46, 16, 3, -43, -12, -17, -8, -20, 6, 4, 6, 0,
+    15, 15, 9, 29, 4, -2, -23, 36, 24, -32, -9, -2, 8, -48, -20, 8,
+    6, -1, -1, 18, 3, 20, 28, -3, -24, -20, -9, -44, 10, 44, 30, 3,
+    2, 12, 9, -28, -1, 6, 1, -42, 0, 8, 14, 5, 7, -1, -20, -18,
+    5, 18, -9, 44, -1, -7, 14, -18, -18, -1, 11, 11, 1, 8, 32, 0,
+    9, 0, -1, -14, -18, 17, 4, -6, -1, 35, -3, -6, 3, 34, 6, -16,
+    10, -2, -5, 19, -15, 3, 23, -35, -5, 55, 24, 22, 18, -1, 10, -19,
+    8, -8, -11, 44, 8, -2, 25, -30, 18, -6, 0, -4, 11, 10, 37, -8,
+    2, 9, -1, -4, -4, 11, 13, -6, 2, 2, -1, -6, -16, 0, -5, -5,
+    5, 4, 0, -20, -14, -12, 25, 28, 0, -4, 10, 7, 22, -28, 3, -23,
+    -12, -19, -15, 13, 3, -5, 12, 20, -16, -41, 10, 32, 12, 2, -25, 16,
+    3, -6, 12, 4, -22, -12, 8, 6, 25, 28, -7, -27, -3, 31, -4, -27,
+    5, 40, -34, 17, 48, 18, -30, 42, 0, 11, -58, -21, 41, 3, -22, -8,
+    -10, -34, -25, -6, 12, -22, -20, 32, 37, 10, -8, 15, 14, -15, 7, -15,
+    -6, -21, 16, 6, -8, 9, 9, 0, 21, 6, 17, -49, -5, 16, 23, 9,
+    12, 6, -15, 10, -17, 18, -13, 5, -1, 7, -12, -5, -25, 16, -11, -10,
+    -3, 43, 7, 21, 7, 11, -19, -39, -3, 3, 16, -23, 22, -8, -31, 1,
+    -11, 5, -5, 0, 6, 11, 21, -30, 3, 13, 9, -3, -2, -2, -13, 8,
+    3, -11, -1, -1, -7, 0, -14, 26, -8, -21, -18, -11, 1, -9, 4, 18,
+    -5, 5, -5, -34, -15, -24, -15, -8, -18, -22, -21, -16, -8, -6, 0, 33,
+    -10, -9, -12, -20, -8, -38, 1, 20, 21, 7, 25, 8, 8, -54, -23, -16,
+    20, 24, 7, 3, 3, 28, 15, 16, 13, 8, 6, -5, 6, 35, -2, -10,
+    12, 13, 24, 10, 8, 21, 21, 7, 22, 15, -6, 11, 5, 23, -5, 28,
+    7, 21, 36, 19, 3, -12, 25, -13, 14, 9, -14, 57, 4, 27, 22, 17,
+    10, 14, 2, -6, 7, 3, 15, -1, 13, 13, 34, 36, -13, 3, 3, 10,
+    17, 33, 33, 45, -12, 4, -21, -4, 7, -4, -7, -12, 16, -11, 54, -6,
+    -6, -10, -2, 5, 16, 8, -18, -17, 3, -14, 11, -11, 11, 13, 5, 32,
+    -9, -7, 6, 17, 28, 22, 11, -20, 14, -5, 7, 14, 27, 1, 13, -4,
+    15, -2, 18, -14, 16, -7, -14, 1, 17, -5, -18, 21, 7, 3, 1, 34,
+    -13, 27, 23, 30, 34, 9, 16, 17, 17, -3, -17, 16, -8, -14, 7, 32,
+    7, -11, 3, -28, -1, -5, 7, -16, 6, -33, -18, 17, 9, 12, -8, 15,
+    27, 15, -13, -2, 0, -25, 13, 33, 20, -8, -1, -8, 11, 14, 4, 11,
+    -4, 13, 4, 15, 6, 19, -20, -21, -30, -12, -8, -12, -3, -21, -2, 7,
+    -1, -18, -6, -28, -27, -8, -18, -8, -1, 0, -10, -15, -1, -20, 15, -28,
+    -8, 5, -6, 7, 2, -32, 15, 1, 0, -3, 17, 29, 28, 22, 18, -10,
+    9, 8, -8, 11, 6, -10, 16, 24, 2, 19, 9, 5, -6, -6, -29, -38,
+    -9, 0, -20, -1, 7, 10, 26, 47, -4, -40, -36, -36, 1, 3, 18, -1,
+    3, -14, 13, 13, 9, -10, -3, -28, -21, -32, 25, 22, 31, 12, 13, 11,
+    10, 40, 24, -1, 11, -20, -21, 15, 26, 27, 23, -4, 10, 39, 45, 16,
+    5, 4, -29, -20, 1, 13, 1, -59, 0, 36, 24, -1, -6, -32, -11, 16,
+    23, 17, -21, -10, -9, -3, -23, -26, -20, 3, 14, 16, -6, -10, -28, -52,
+    -10, -50, -17, 3, 17, 1, 4, 4, 22, 25, 26, -10, -8, -23, -29, -12,
+    -2, 24, 19, -13, -19, -6, 23, 0, 0, 8, -19, -11, 6, -14, 20, -15,
+    8, 6, 2, 7, 5, 35, 20, 13, -1, 30, -2, 21, -36, 22, 39, -10,
+    -3, 8, 4, -5, -3, -5, 21, 11, 12, 16, 12, -6, 7, -15, 3, 26,
+    16, 11, -6, 7, 22, 29, 12, -7, 20, 5, 7, 23, 25, 8, 5, 31,
+    26, 20, 16, 19, 5, 5, 19, 9, 2, 2, -17, -27, 0, -23, 0, 19,
+    8, -46, 8, -3, -21, -27, -43, -25, -28, -12, -43, -53, 8, 7, 11, -15,
+    3, -4, 43, 28, -5, -14, -54, 48, 1, -14, -11, -9, -2, 16, 15, 5,
+    31, -20, -40, 1, 9, -5, 10, 6, -5, 3, 3, 40, 18, -37, -33, -53,
+    7, 4, 0, 3, 2, -1, 36, 5, -8, -46, -22, 13, 0, 40, 30, 14,
+    18, 11, 10, -6, -15, 3, -4, -21, 0, -8, -3, 14, -12, 5, -19, -39,
+    -28, -5, 5, 71, 9, 13, -14, -17, 5, 1, -17, 4, -25, 15, 25, 6,
+    -10, -8, 14, 3, 0, -8, -19, -13, -11, 4, -8, -8, -14, -4, -3, -7,
+    -16, -14, 18, -15, -32, 16, 9, 16, -5, 28, -19, 5, 1, -4, -7, -29,
+    -8, 16, 22, -14, -1, -12, 4, 12, -13, 0, -18, -13, 8, 39, 35, 9,
+    11, 17, 1, -30, -39, -7, -17, 1, 20, 29, 53, 3, 6, -21, -31, -21,
+    -5, 32, 34, 27, 11, 2, -12, -10, 8, -9, -19, 5, 1, 16, 10, 2,
+    21, -21, -42, -49, -13, 20, -14, 12, -9, 29, 7, 17, 7, -13, -1, -24,
+    6, 26, 23, 17, 1, 4, -8, -26, -3, 16, 21, 12, 7, 31, 2, 5,
+    -10, -41, -29, -14, -5, -9, 24, 11, 8, -2, -14, -2, 13, -5, -1, 29,
+    17, 8, -11, -22, 11, -4, -15, 22, -9, 21, 12, -3, 13, -3, -18, 1,
+    -5, -8, -14, -4, -2, 11, 17, -16, 9, -11, 7, 10, 1, 68, -1, -11,
+    29, 2, -10, 7, -1, 17, -5, 18, 10, 35, 21, -2, -8, -11, -1, -8,
+    0, 5, 3, 16, 12, 16, 5, 11, 0, -4, 24, -3, -5, 8, -4, -39,
+    -10, 14, 13, -16, -28, 12, -18, -3, -7, 8, -3, -13, 5, 24, -9, -21,
+    -30, -13, 12, 0, -9, -13, 1, 4, 8, -71, -52, -12, 29, 14, 9, -15,
+    -1, -3, -15, 13, -6, -35, -12, 41, 43, 36, 10, 18, -12, -6, -30, -23,
+    -9, 0, 1, 44, 31, -2, -21, -21, -22, -38, -20, -37, 1, 24, 28, 9,
+    -9, -18, -19, -4, -25, 3, -7, -30, 10, -6, 13, -12, 26, 51, 13, 1,
+    -34, -42, -27, -25, -3, -17, -9, 22, 8, 8, 21, -8, 24, -27, -11, -6,
+    -3, -3, -15, -5, -3, -1, 1, -15, -14, -13, -5, 4, 1, 10, 0, 13,
+    22, 43, 31, 37, 14, -10, 9, 34, -20, 43, 42, 21, -3, 8, -12, 5,
+    -6, 12, 24, 19, -4, 10, 38, 9, -27, -5, -6, 13, 14, 29, 13, 48,
+    -6, 26, 23, -10, 20, 23, 7, 19, 15, -2, -35, -34, -8, -14, -24, -9,
+    5, 31, 3, -9, -8, -19, -43, -19, 0, -14, -25, -31, -2, 9, 7, -19,
+    -22, -13, -14, -16, 7, 13, -15, -6, 9, -17, -37, -22, -10, 8, 24, 0,
+    -5, -17, 19, 6, -22, -30, -14, -12, 9, -7, -5, 2, -10, 4, 1, -20,
+    -17, 9, -12, 7, -18, 5, -13, 0, 10, -14, -3, 16, 17, 10, -8, -18,
+    -25, -8, 23, -62, 11, -18, -4, -23, -2, -18, -7, -29, -3, -11, -11, -5,
+    -4, 4, -12, -9, -4, 13, 10, 11, -3, -4, 6, -11, -12, 9, -2, -9,
+    13, 40, -12, 10, 0, 11, -3, 39, -5, -18, -3, -7, 1, 13, -8, 18,
+    21, 7, -5, -16, -17, -4, -9, -22, -2, 34, 19, 29, 48, -6, -7, 47,
+    5, -9, -37, 12, -3, 19, 9, 29, 8, 15, -22, 37, 9, -12, -17, -7,
+    -23, -20, 45, 29, 6, -6, -5, -84, 3, -3, -15, -13, 7, -9, 12, 53,
+    3, -21, 6, -34, 12, -18, -8, 4, -28, -20, 38, -31, 8, -10, 28, -16,
+    -9, 5, 13, 2, -24, -38, -13, 0, -6, -2, 17, -3, -5, 5, 1, 3,
+    -13, 8, -16, 11, 4, 18, -6, -25, 2, -21, -24, 35, 10, 2, 13, -24,
+    -11, -17, -15, -16, 13, 11, -9, -71, -5, -6, -3, 26, -11, 4, -28, 7,
+    7, 12, 4, -2, 12, -3, -12, 26, 11, 10, 11, 12, -11, -17, 15, -3,
+    4, 4, 0, 20, -2, 11, -38, 4, -2, -27, 7, -4, -2, -19, -7, 9,
+    14, -15, -10, -13, -14, -48, 20, 33, 16, 11, 34, 1, 4, 13, -1, 48,
+    -11, 7, 15, 39, -5, 12, -25, -12, 5, -9, 10, 3, -11, 8, 14, 9,
+    -11, -6, -13, -18, 1, -2, -3, -23, 13, -27, 9, 3, 10, 24, -10, -22,
+    -28, 3, -17, -22, 5, -14, -9, 18, -6, 13, -24, -41, 5, 7, 13, -21,
+    8, 6, 0, 7, -5, -4, -10, 8, 7, 1, -1, 8, 4, 10, 18, 6,
+    10, -9, -2, -9, -1, 7, 31, 20, 5, 16, 22, 18, 19, 61, 44, 23,
+    1, 8, -27, -35, 4, 10, -6, 8, 17, 13, 33, 6, 32, -9, 8, -7,
+    -12, 10, 5, -10, 6, 0, 3, -37, 10, -9, 8, 11, 7, -9, 3, 17,
+    21, 24, 21, 12, -13, 15, 4, -67, -13, 10, -30, 34, 22, 26, 21, 4,
+    4, 27, 24, 38, -6, 4, 15, 16, 12, 11, 10, 23, 22, -7, 47, 9,
+    13, 5, 44, 38, -19, -29, -10, 6, -5, 0, -2, 25, -11, 41, 39, 28,
+    -7, -49, -10, -25, 1, 4, -13, 20, -7, 19, 8, 10, 9, -34, -38, -15,
+    -7, -18, -18, -10, -13, 4, 4, 21, -39, -59, -19, -8, 12, -20, -21, 34,
+    -8, 16, 12, -4, 4, -17, 13, -6, -2, -26, 6, 26, -8, 15, 5, 17,
+    13, -1, 5, -18, -4, -5, -12, 6, -7, -15, 9, 9, 11, -13, -27, -11,
+    -10, -27, -9, -18, -8, -15, 9, 27, 26, 31, 9, -6, 39, 3, 49, 0,
+    8, 13, -6, 8, 0, -1, -22, -19, 0, -11, 5, -7, 7, 66, 23, 0,
+    -37, -64, -17, 5, 35, -6, -17, -1, 10, 11, 31, 18, -25, -46, -11, 37,
+    11, 12, -14, 9, 22, 19, 35, 5, -6, -26, 3, 14, -14, -20, -27, 31,
+    -3, -16, 12, 30, -20, -10, 25, 19, 14, 3, 9, 3, 11, 1, 30, 18,
+    -15, -18, 14, -9, 0, 15, -6, 2, 13, 2, -16, -4, -11, -17, -16, 4,
+    -4, -8, -15, -13, 12, -12, 18, -32, 8, -30, -6, -6, -12, 11, 22, -3,
+    12, 36, 36, 17, 17, -16, 7, 0, 15, -7, 38, 19, -7, 30, 33, 11,
+    -2, 4, 10, -5, 14, -10, 2, 16, 13, -28, -42, -12, -1, 4, 16, 4,
+    6, 12, 15, 5, 13, -13, -22, -34, -6, -17, 3, -8, 31, -11, 19, 0,
+    -1, -6, -4, 2, -21, -2, -4, 13, 3, -6, -10, 4, 8, 3, 21, 19,
+    20, 3, 8, 1, -23, -44, -15, 30, 3, 24, -1, 13, 4, 10, -18, -17,
+    -29, -14, 12, 8, 9, -19, -26, -17, 7, 31, 47, 20, -9, -5, 21, 44,
+    5, -16, -1, 39, 62, 47, 25, -21, -15, -16, 29, -11, -12, 41, 49, 44,
+    41, 15, 1, -27, -22, -21, -9, -52, 4, 11, -14, -10, -8, 7, -3, -4,
+    -8, -12, 0, 32, -4, -30, -57, -33, -24, 4, 7, 1, -8, 7, -4, -6,
+    8, -10, -4, 6, -36, -6, -2, -15, 11, -32, 10, 44, -12, 6, -1, -9,
+    2, 2, 7, 3, -9, 7, 0, 48, -7, -6, -2, 22, -10, -7, -19, -20,
+    -5, -6, -23, -35, 9, 9, 20, 16, 4, 20, -5, -9, -12, -44, 10, -3,
+    -13, 4, -7, -2, 17, 5, -4, -15, -2, 6, -9, 3, -3, -18, 1, -10,
+    -18, -21, -17, -52, -29, -16, 22, 44, 1, 0, 25, 3, 16, -5, -5, -2,
+    6, 19, 20, 13, -9, -9, -4, 14, 25, -8, -5, 10, 25, 6, -1, 4,
+    0, 26, -9, 8, 6, -14, 3, 25, 27, 7, 17, -3, -1, 48, 6, -22,
+    -9, -2, 7, 21, 6, 41, 19, -30, -7, 35, 27, -19, 22, -3, -4, 16,
+    -22, 40, 42, 25, 5, -1, 36, -21, 4, 21, 4, 15, -32, -30, -1, -7,
+    -11, 30, 0, -1, -20, -13, 4, 9, 11, -21, -41, -3, -1, 22, -11, 4,
+    4, -5, -4, 8, 9, -14, -51, 4, -7, 0, -1, 0, 1, 3, 3, -28,
+    1, -16, -60, 13, -4, 25, -6, -40, 33, 28, 23, 14, -7, -63, -87, -2,
+    11, 5, 10, -3, -16, -7, -14, -14, 11, -9, 2, -10, -3, 58, -10, 44,
+    28, 27, 35, 36, 33, 39, 17, 7, 11, -11, 9, 18, 21, 17, 23, -6,
+    7, -16, 10, 18, 7, -11, 25, -35, -23, -26, -40, -55, -29, -19, -25, -35,
+    -12, -15, -16, -15, -28, -20, -5, -3, 9, 16, -35, -12, 11, -13, 5, 4,
+    27, 27, 20, 10, 21, -9, -4, -28, -6, -31, -7, 26, 14, 18, 9, -21,
+    -15, -7, 19, 54, 0, -9, -5, -10, -30, -9, 12, 10, 14, 18, 23, 37,
+    4, -3, -10, -21, 1, -27, -7, -2, 6, 0, 11, 2, -12, 23, 12, -6,
+    17, -10, 22, -3, -2, -13, 2, 41, -7, -25, 13, 7, 0, -8, -13, -6,
+    -7, -12, 2, 5, 6, -53, -3, -7, -6, -6, -5, -8, 8, 10, -40, 10,
+    13, 4, 8, 10, -18, -12, 16, -27, -9, 18, 2, 3, 0, -20, 3, 3,
+    2, 22, -14, 14, 28, 3, -9, 30, 8, 11, 23, -15, -2, 23, -9, 13,
+    8, 28, 14, 7, 7, 32, 21, 21, 0, 13, 5, 3, -13, -8, -11, -16,
+    0, -1, 3, -10, 13, 16, -15, -23, -32, -7, 28, -18, -9, -1, 9, -21,
+    -16, -35, -17, -5, 5, 23, 8, 9, -2, -13, -57, -63, -51, -4, 23, 49,
+    -5, -1, 3, 15, 10, -65, -51, -1, 6, 46, 5, 20, -8, -3, -1, 8,
+    -12, -55, -32, -5, 28, 23, 8, -24, -9, -13, 5, -29, -2, -24, 17, 22,
+    6, 9, -9, -12, -26, -10, -7, 54, 10, -3, -4, 4, -16, 5, -3, -19,
+    5, 23, 7, 70, 8, -6, -3, 0, -30, 9, 1, 0, -17, -5, -3, 7,
+    0, 3, -1, -7, -13, 4, 21, 23, -12, 5, -9, -1, -11, -40, -36, -14,
+    10, 12, 4, -7, -9, -10, -30, -55, 0, -17, 40, 55, -5, -5, -4, -35,
+    -21, -5, 6, -79, -8, 31, 18, 7, 5, 20, 19, 33, 22, 32, 0, -17,
+    12, 46, 6, 0, 2, 27, 15, 15, -2, 13, -8, 67, -4, -29, -33, -7,
+    9, 21, 29, -4, 18, 11, -21, -74, -12, -6, -2, -21, -26, -19, -6, 15,
+    -8, 17, -44, -24, -4, 13, 3, 24, 3, -28, 18, -20, -35, -14, -10, 9,
+    13, 11, 14, 5, -21, 28, 4, -10, -18, -6, 4, 3, -12, -11, 4, 6,
+    21, 15, 13, -1, 7, 6, 5, -23, 4, -5, 11, 14, 3, -6, -23, -4,
+    10, 3, 9, 34, 1, -15, -25, -1, -28, -22, -22, 6, -6, 11, -50, -5,
+    -12, 6, -8, 7, 1, 13, 11, 38, -12, -9, -5, -10, 6, 38, -37, -4,
+    22, 7, -2, 41, 7, -1, -7, 26, 4, 24, 20, 10, 8, 19, -5, 19,
+    32, 3, 14, 1, -2, -43, 10, 4, -1, 19, 33, 13, -13, -15, -5, -14,
+    -3, -13, 20, 20, 2, 22, 9, 8, -18, 8, 16, 4, -1, -8, 11, 11,
+    -5, 10, 11, -44, -28, -36, 12, -9, -9, 10, -35, -9, 7, -9, 11, -6,
+    -35, -4, 16, -40, 13, 11, -8, -12, 7, -24, -40, -14, -37, -25, -4, -33,
+    6, -38, 15, 68, 46, -16, -77, -48, -10, -18, 3, 3, 10, -32, -12, 12,
+    -28, 4, -32, -39, -35, -30, -26, 13, -2, 11, -9, -40, 6, -36, -11, -28,
+    -11, -21, 6, -16, -9, -37, -29, -14, -7, -3, -16, -51, 43, 30, -28, 6,
+    -6, 11, -5, -15, 10, 13, 15, 16, -1, -27, -4, -2, -2, -2, 12, 4,
+    5, 25, 12, 15, -4, -49, 3, 3, 9, 17, -13, 0, 25, 39, 6, 12,
+    7, 21, -10, 7, 17, 33, 20, 2, -6, -6, 17, 51, 27, 25, 17, -18,
+    -1, -47, -22, -13, -43, -21, -14, -3, -6, 15, 13, 56, 0, -62, -43, -14,
+    -22, -16, -20, -26, 14, 17, 28, 6, 0, -13, -9, 6, -9, -3, 9, -4,
+    12, 7, -1, -33, 12, 5, 13, -18, -2, -11, -3, 23, -6, 13, -9, -13,
+    5, -9, -7, -7, -32, 5, 13, 23, -8, -9, 7, 16, -2, -28, 1, -11,
+    -16, -7, -12, -6, 6, -2, -18, -3, -11, 10, -8, 22, -2, -6, -7, 12,
+    18, 32, 17, -17, 7, -33, -39, 30, 21, 19, -16, -7, -3, 9, -5, 11,
+    13, 7, 2, 3, 4, -10, 11, -15, -9, 21, -8, 13, 14, 7, 24, 18,
+    15, -15, -5, 5, 2, 5, 3, 9, 3, -18, 8, 3, -2, -22, 17, 3,
+    10, 28, 6, -25, -5, 0, 18, 13, 8, -3, 0, -9, -13, 4, 21, -8,
+    -6, 17, 20, 20, -7, -16, 16, -17, -1, 22, 48, 45, 2, 2, 15, 1,
+    -1, 31, 38, 9, 10, 24, 24, 9, 3, 15, 7, -6, 13, 20, 18, 18,
+    -6, 12, 13, -58, -3, -10, 4, -2, 31, 40, -3, -28, -7, 7, -20, -33,
+    -13, -26, 12, 10, -13, -19, -23, 9, 6, -2, -12, 14, 11, -9, 9, -28,
+    -12, -30, -17, -11, -7, -1, -11, 5, -8, 1, -6, -11, 0, -27, -13, 4,
+    -22, -4, 25, 6, 13, 15, 17, 15, -19, 24, -27, 1, -42, -33, -24, 4,
+    4, -8, -1, 6, -2, -9, -11, 25, 4, -12, 1, -6, 2, 8, -15, -15,
+    -6, -6, -43, -35, -30, 14, 22, 11, -5, -11, -14, 1, 19, -55, -21, -54,
+    -14, 29, 8, 16, -9, 33, 7, 16, -5, -33, -38, 7, 41, 20, -22, -32,
+    6, 33, 14, -49, -48, -46, -15, 12, 26, 27, -7, -97, 13, -17, -27, -55,
+    -8, 5, 20, -1, -3, -2, 27, -33, 12, -10, -13, -29, -7, 25, -1, 4,
+    -23, -9, -10, -7, 7, -2, 12, 23, -14, 14, -8, 9, -5, 4, -3, -71,
+    -13, 19, -10, 22, 10, -27, -5, -15, -17, -25, 20, 16, 11, 52, 16, 24,
+    11, -16, 9, -12, 5, -11, 12, 11, -8, -2, -18, 1, -38, -15, 37, 5,
+    -2, -10, 23, 36, 10, -27, 15, -15, -5, -7, 2, 7, -54, 9, 52, -9,
+    0, -13, 14, 11, 10, 13, -7, 31, -1, 5, -1, 1, -12, -24, -37, -33,
+    -22, -21, -3, 6, 5, -3, 14, 21, -13, -12, -36, -9, 5, 9, 12, 0,
+    -2, -3, 15, -22, 7, 14, 3, -12, -13, -24, -35, -20, -5, 7, 22, 16,
+    2, -16, 30, 14, 9, -29, 12, -17, 4, 9, 9, -25, -13, 14, 7, 5,
+    0, 5, 1, 13, 8, 10, -2, -23, -8, 2, 2, 10, 16, -20, 9, 18,
+    14, -22, -3, -16, -7, -34, -2, 10, -1, 21, 3, 14, 6, 3, 6, 2,
+    11, -22, 12, 37, 4, 11, 23, 1, 6, 13, 6, 10, -1, -12, 8, -2,
+    26, 21, 31, -1, 19, 8, -6, 6, -1, -1, -17, -7, -14, -7, 12, 21,
+    29, 32, -22, 67, -5, 11, 23, 9, 14, 5, -13, 9, -13, -5, 14, 0
+};
+const int32_t kOp1Bias[64] = {
+    7140, 5430, -2572, -3857, 4238, 141, -3382, 1476, -2991, 4913, -1198, 3321, 1842, -773, -138, 5768,
+    5110, 2009, -703, 5578, -1080, 57, -2547, 2465, -1223, -1867, 3066, -442, 987, 2011, 3774, 1160,
+    -5990, -820, 3468, 2227, -3923, 5799, -253, 167, 854, 4480, 3337, 127, 1546, -2507, -1271, 4544,
+    6467, 441, -1941, -3879, 1159, 3456, 2875, 370, -309, -192, -1622, 2757, -4280, 3782, 5059, -267
+};
+alignas(4) const int8_t kOp3Weights[4096] = {
+    -70, 25, -11, -66, 51, 44, -9, 51, 30, 24, 25, -9, 19, -74, 29, 3,
+    9, -75, 19, 2, -2, -42, -16, -82, -25, 18, 24, 40, 22, -18, 34, 46,
+    41, 41, 22, 27, -1, 55, 4, 38, -58, -10, 23, 5, -32, 14, -15, -43,
+    22, -28, -18, 37, 27, -67, -21, -24, -15, 24, 15, -8, -1, -18, 9, 9,
+    18, -38, -33, 4, -22, 51, -12, -1, 14, 28, -10, 21, -3, -11, -40, -54,
+    -7, -50, -7, -10, -44, 11, 52, -12, -27, 29, 12, 21, -47, 33, 28, 53,
+    -7, 5, 34, 40, 46, -90, 8, -44, -58, -41, -30, -36, 18, 10, 13, -57,
+    -59, -15, -37, 9, 30, 1, -25, -7, 1, 15, -65, -47, 30, 13, -16, 18,
+    48, 6, 32, 10, -18, -16, -25, 19, -22, -76, -36, 37, 44, 44, -13, 11,
+    3, 59, 18, -13, 13, 9, -30, 30, -11, -23, -89, 10, -3, -11, 3, -5,
+    26, -21, -5, 10, 27, 19, -23, -23, -34, -5, -5, 14, 2, -23, -47, 49,
+    26, 19, 14, 8, 35, 18, -10, -16, -29, -17, 23, 16, -19, -15, -5, 14,
+    30, 36, 10, -28, 1, -26, 84, 0, 5, 3, 11, -14, 8, 3, -24, -29,
+    42, -38, -37, 5, -13, 20, 43, 3, -15, -37, -45, -42, -53, -18, 13, -4,
+    7, 16, -23, -49, 18, 6, -4, 28, 14, -42, 8, 12, -4, -18, 15, 34,
+    1, 69, 1, -29, -18, -13, -77, 35, 36, -16, -1, 18, 18, 27, -62, 33,
+    48, -2, -29, 28, -12, 2, 13, 14, 7, 21, -30, 3, -7, -26, 70, 51,
+    6, -42, 21, 46, 12, 34, -44, -10, -29, 35, 43, 9, -7, 21, -4, 36,
+    -20, -43, 35, 2, 9, 11, -39, 26, 47, 2, -50, -26, 9, 28, -15, -41,
+    9, -2, 23, -16, -10, 25, 20, 27, 49, 18, 19, 6, 3, -11, -56, -10,
+    -18, 29, -17, 1, 3, 22, -54, 31, -15, 36, 52, -99, -3, -89, 29, -3,
+    6, -52, 22, 9, -57, -13, 33, 51, 49, 41, 27, 10, 0, 40, 46, -3,
+    1, 85, 46, -20, 15, 41, -27, 17, -75, 1, 4, -31, -33, 51, 6, -26,
+    16, -36, 30, -14, -36, -27, -18, -4, -15, 26, 16, 37, 25, -36, 56, -3,
+    32, 44, -23, 36, 25, 22, 3, 28, -2, -40, -25, 67, 10, -21, -25, 27,
+    -13, 0, 17, 24, -2, 7, -32, 19, -19, -14, -111, 0, -16, 30, 57, -20,
+    -4, -7, 16, 50, 29, 39, -20, -60, -20, 13, 9, 34, 13, -48, -27, 42,
+    -21, -3, -15, -22, 40, -11, -82, 34, -35, -45, -30, 33, -12, -25, 65, 21,
+    -24, 56, 11, -13, -37, -5, 12, 29, -34, -6, 27, 23, 23, -27, -3, -1,
+    -13, -7, -43, -47, -6, 2, 39, -43, -35, 8, 40, 70, 47, -20, -17, 66,
+    -43, -37, -4, 9, 45, 34, -8, 30, 4, 9, 32, 6, -10, 43, 12, -25,
+    6, -41, -4, -8, 17, 64, 33, -8, -10, 54, -20, -79, -1, 15, -74, 5,
+    13, 7, -11, 18, -5, -17, -18, 39, -28, -33, 15, -25, 23, 60, -47, 6,
+    1, 36, 1, -11, 7, 13, -17, 30, 15, 54, -64, -16, -9, 29, 28, -41,
+    37, 11, -24, 40, 16, -12, 40, -17, -20, 29, 39, 19, -9, -10, -25, 7,
+    23, 14, -29, 2, 16, 8, -53, -15, -27, 42, -13, 8, 8, 21, -71, 29,
+    24, -47, 3, 43, 21, -18, -10, 51, 18, 7, 47, -83, -24, -29, -11, -10,
+    -10, -66, -16, -3, -36, 19, 16, 17, 51, 105, 24, 23, -12, 20, -13, -15,
+    -25, 53, -32, 61, 25, -16, -51, 18, 5, -36, 4, -4, 24, 27, -2, 24,
+    15, 0, -3, -67, -19, -19, 27, 32, -13, 21, 3, 64, 21, 12, 75, -8,
+    49, 13, -12, -22, -31, 49, 61, 14, 11, 40, -77, 18, 56, 24, 45, 12,
+    5, 18, 34, 38, 9, -35, -30, -28, -26, -65, -5, -19, -24, -18, 13, 37,
+    -17, -50, 32, -32, 12, 38, 42, -5, -6, 12, -39, -28, 5, 2, 7, -40,
+    -40, 12, -5, -4, 36, 25, 45, 9, 11, -51, 53, -15, -23, -54, -49, -10,
+    -13, -16, 33, -23, -22, -12, 39, -27, 10, -23, -63, -17, 24, -34, 37, 0,
+    -6, -6, 23, 21, 19, 44, 13, 1, -49, -14, 20, -10, -15, 40, -20, 11,
+    13, -32, 97, -2, -46, 4, 19, 107, 69, 24, -59, -22, 5, -30, 21, 18,
+    -9, 28, 32, -12, -18, 5, 31, -36, 44, -21, -42, -25, -3, -27, -4, -3,
+    24, 14, 20, -29, 30, -11, -83, 18, 6, -22, 44, -10, 24, 63, -12, -79,
+    23, 2, -6, -13, 38, 2, 20, 32, 84, -9, -90, -12, -22, 20, 22, -13,
+    35, 29, -61, 2, 1, -8, 58, -45, -33, 7, 22, -4, -5, -31, 6, 31,
+    5, 3, -40, 25, 42, 6, -47, 35, -73, 14, -13, 25, -49, -13, 31, 29,
+    7, -38, -40, 3, 40, 40, 1, 13, -2, 20, 24, 5, 55, 20, -16, -13,
+    19, -35, -44, 39, -40, 3, 1, -5, -31, 51, -33, -6, -34, -18, 11, -28,
+    -111, -51, 57, -4, 15, -35, 54, -14, -8, 4, 24, 17, 19, -16, 81, -53,
+    -37, 2, -94, 6, 16, -28, -104, -12, 12, 13, -8, -61, 28, 10, -44, 5,
+    -39, -1, 59, -3, 23, 23, -22, -10, 48, -52, 7, 30, 12, 18, 45, -75,
+    -2, 44, 16, 25, -10, -15, 1, -2, -26, -15, -32, -23, 83, 14, -34, -3,
+    34, -39, 43, -5, -48, 20, 10, 5, -59, 33, -8, 18, -1, -7, -29, 4,
+    36, 32, 2, 32, 18, -70, -57, 12, -34, 14, -27, -84, 16, 10, 52, -15,
+    -36, -1, -1, -13, -35, -1, 12, 0, -2, 1, -36, -45, 1, 50, 16, -2,
+    1, 33, -5, 45, 49, 10, -43, 2, -4, -40, -21, -29, -27, 15, 5, -59,
+    -71, -3, 13, 0, 3, -20, 64, -30, 15, 35, 33, 1, 33, 35, 29, 9,
+    -16, 37, -18, 19, 6, -36, -13, -2, 25, 35, 2, -19, 25, -9, -8, 29,
+    21, 13, 6, -2, -1, -14, 45, 13, -4, -1, -8, 21, 12, 3, -21, 60,
+    22, 2, 2, -43, -22, 31, 18, 31, 39, -3, 74, 21, -23, 18, -59, -13,
+    -8, 80, -37, 15, 56, 44, -6, -36, 51, 10, 3, 2, -18, 25, 30, 1,
+    -1, 10, 32, 24, -15, 44, 59, -36, 25, -6, 38, 48, -5, -2, -58, 12,
+    9, 17, 29, -13, -45, 15, 16, -70, 18, 9, -13, -70, 3, 3, 37, -26,
+    24, -34, 8, 47, 1, -14, 58, 3, -16, 37, -34, -30, 10, 29, 14, 43,
+    23, -28, -20, -3, -14, -26, 49, -42, -26, 6, -56, 20, 20, -4, -45, -2,
+    -86, 7, -26, 29, 13, 10, -21, 69, -15, -37, -10, 19, 16, -15, -8, 26,
+    -22, -39, 23, 25, 6, 16, -121, -36, 32, -57, 34, 4, -4, 32, -28, -77,
+    -10, -40, 16, -25, 16, 12, -12, 20, 57, 40, -71, 47, 15, 49, 26, -1,
+    74, 16, -25, 41, 41, -21, 0, -45, -43, -15, 35, 3, 35, -45, 18, -15,
+    -14, -72, -1, 7, 11, 31, 6, -35, -39, -100, -48, 27, -21, -2, -5, 19,
+    17, -38, 23, 12, 49, 24, -32, 19, 35, 31, 12, 62, -12, -2, -2, -11,
+    14, -18, 47, 18, 12, -51, -41, -48, 2, 12, -45, 33, 4, -3, 55, 16,
+    61, -30, 12, 41, 35, -22, -36, -3, -15, -1, 42, 20, 8, -2, 40, 6,
+    -7, -67, -28, -13, -34, 46, -32, 0, -28, -64, -36, 30, -3, 34, 93, 17,
+    11, 2, -10, -29, 34, -9, -4, -28, -1, 42, 24, -45, 22, -30, 32, 10,
+    -13, -80, -2, -13, 16, -7, 1, -50, -15, 35, -14, 35, -16, 10, 8, 22,
+    42, -43, -10, 33, -5, -15, 38, 43, 42, -19, 54, 20, -6, -37, 31, -8,
+    -29, -34, -14, -7, -1, 35, 27, 29, 1, 13, -7, -24, 10, -13, 7, 15,
+    14, -31, 5, -7, -47, 14, 35, -41, -3, 16, -14, -29, 6, 51, 39, 21,
+    -10, 1, -18, 64, 45, 23, 24, -3, -21, -39, -42, -20, -38, 26, -3, -31,
+    5, -54, -15, -10, 10, 7, 34, -24, 55, 18, -2, 31, 30, -4, 20, 31,
+    -72, 6, 5, 30, 30, -7, 8, -8, 18, -43, -14, 28, 20, -23, -10, 7,
+    23, -62, -10, -25, -33, -43, -59, -8, -18, -8, -23, -76, -13, -36, -14, -16,
+    22, -13, -23, -41, 8, 37, 68, 36, -7, 8, -82, -13, -56, -18, 19, -36,
+    25, 37, -10, 4, 24, 22, 23, -24, -35, 65, 15, -14, 42, 22, 30, 0,
+    -46, -14, 22, 9, 16, -49, -46, 16, -65, -25, 12, 15, 24, -15, 36, 27,
+    -30, -30, 6, -26, 50, -43, -74, 28, 58, 43, 54, -3, -22, -13, 14, 8,
+    -1, -18, 12, 79, -4, -21, -49, 13, 2, 35, 73, 43, -7, 9, -51, 6,
+    -42, 59, -3, 31, -46, -35, 52, 13, -59, 24, 43, 18, 6, 1, -12, 9,
+    -8, 4, 0, -3, -34, -7, 13, -28, 13, 26, 24, -36, 13, -38, -13, -24,
+    -19, 8, -1, 0, -19, 10, 41, -10, -43, 35, -25, 48, -20, -30, -6, 88,
+    -6, 0, -29, -31, -1, 15, 0, 10, 30, 10, 25, 59, 15, -26, -34, -30,
+    -31, 74, -5, 54, 60, 18, 7, 21, 35, -24, 0, 22, 16, 49, 23, -24,
+    38, 10, 26, 10, -16, 38, 30, -50, 9, 14, 47, 42, 33, 9, 3, 20,
+    -56, -34, 23, -34, 30, -42, 32, 49, 34, 15, 30, -44, -37, -24, -15, -34,
+    11, -32, -8, 43, -28, -24, 47, -38, -3, 14, 34, 4, 13, -31, 35, 13,
+    2, 40, -35, 39, -16, 0, 8, 52, 51, -40, 0, 50, -29, 21, 56, 22,
+    5, 62, -42, -31, -53, -48, -38, -13, 51, 8, 1, 23, 38, -1, 27, -1,
+    19, -6, 21, -27, 35, 19, -4, -17, 68, 14, -36, -34, -33, -11, 25, -59,
+    12, -8, -37, 10, -21, 62, 8, -1, -62, 4, 32, -2, 4, 10, 27, 25,
+    12, -28, -65, -26, -41, -4, 13, 60, -38, -7, -2, 22, -10, -34, 33, -16,
+    48, 11, 36, -10, 58, -2, 5, 22, 29, 0, 3, -57, 10, -14, -47, -17,
+    0, -10, 23, 38, 6, -2, -15, 18, -16, -11, -10, -17, 9, 27, -44, -33,
+    1, 46, 6, -30, -24, 10, -4, 46, 20, 21, -59, -7, 7, 4, 36, -74,
+    25, 22, 11, 10, -9, -5, -5, -18, -30, 30, 3, 13, 12, 4, -34, 14,
+    29, 27, 17, 0, -10, -32, -47, 6, -15, 32, 5, -15, 24, 22, -6, 22,
+    26, -18, 41, -10, -6, 1, 61, -23, 15, -38, -27, 14, 10, 15, 14, 66,
+    -22, 6, 11, 48, -1, -69, -16, -9, -85, -36, -49, -27, -4, 25, 27, 8,
+    -29, -65, 2, -28, 11, 12, 25, 32, 5, 27, -5, 52, 15, -20, 5, -3,
+    -6, 50, 21, 37, 19, 21, -6, 9, 11, 21, -27, -26, -28, -41, -31, -28,
+    -36, -17, 22, -47, -42, -12, 2, -17, -41, -4, -52, -72, -20, 2, 21, 27,
+    3, -24, 3, 1, -29, 30, 22, 4, -22, -25, -1, 1, -49, 9, -29, -52,
+    14, 33, -66, 22, 22, 19, 44, -40, 77, 10, -3, 31, -3, 23, 34, 31,
+    -45, 9, 22, 26, 34, -39, -26, 13, 5, -1, 40, 24, 33, -5, -51, 27,
+    25, 16, 35, 68, 8, 3, 37, 6, -24, -31, -81, 23, -12, 20, -21, 25,
+    38, 21, 14, -57, 31, -3, 2, 17, 50, -4, 93, 5, 7, -20, -11, 29,
+    -8, -8, 40, 50, 43, 52, -43, -1, 49, -8, 0, 17, 15, 25, -3, 18,
+    48, -19, 47, -3, 13, 16, 6, -3, -45, -60, 44, 20, 12, -30, 49, -6,
+    18, 5, 16, -39, -57, -13, 24, -93, 1, 20, 0, -61, -9, -21, -10, 45,
+    -8, 4, 33, 23, -23, -34, 24, 18, 29, -2, 45, -10, -28, 12, 10, 29,
+    44, 30, 15, -43, 35, -4, 10, -28, -8, 7, -16, 12, -24, 6, 11, 2,
+    10, 9, 25, 25, 7, 4, 4, 15, 0, -37, 41, 58, 35, -20, 44, -14,
+    -46, 6, 69, 26, 14, 13, -37, 22, 18, -7, 58, 20, 19, -13, -6, -67,
+    10, 15, -25, -17, -18, -34, 40, 20, 42, 1, -17, 12, 30, -4, 13, -54,
+    33, 80, -56, -16, -13, 24, 9, -36, -67, 25, 21, 9, 13, 41, 13, -16,
+    10, 15, 24, 25, 3, -11, -6, -26, -44, 7, 24, -29, 4, -5, -7, 25,
+    17, -32, -10, 15, -25, -23, 32, -9, 1, -36, -67, -2, 2, 68, 20, 15,
+    26, 30, 16, 39, 37, 19, -50, 16, -36, -42, -16, -36, 0, -6, 33, -56,
+    -28, -29, 28, 3, 3, 0, 31, -3, 54, 5, -10, -2, -1, 42, 21, 26,
+    -15, 13, -7, -9, 32, -17, -24, 18, 41, 16, 23, 11, 16, -3, -34, 23,
+    48, 18, -33, 10, -41, -11, 11, 23, -26, -74, 18, 41, 50, -19, -23, 6,
+    -31, 36, 25, 6, 21, 31, 0, 41, -73, 44, -27, 8, 2, 39, -68, 32,
+    11, 28, -6, 4, 4, -64, 8, 9, -27, 7, -22, -21, -1, -4, -36, 7,
+    -20, 48, 47, 1, -31, 8, -24, 32, 32, -19, -7, -26, 30, -14, -49, 34,
+    5, -26, 11, 14, -31, -5, -13, -5, -12, 4, 33, -39, -23, -9, -25, -11,
+    41, 42, -36, -23, -8, 33, 52, 9, 3, -10, -51, -12, -6, 24, 35, -5,
+    7, 65, -25, 12, 26, -16, -16, -29, 6, -5, 8, 25, -16, 18, 22, 26,
+    10, 55, -15, -29, -25, -73, -69, 38, 24, 38, 20, -12, 53, 16, -36, 34,
+    33, -20, 37, 4, -30, -20, 41, -16, 16, -28, -22, 7, 3, 12, -16, -30,
+    5, -46, 13, 19, 32, 27, 25, 12, -23, -2, -65, 11, -16, 9, -13, -13,
+    1, 7, -61, -42, -8, -5, 23, -20, -6, -14, 4, 15, 22, -18, 30, 49,
+    -19, 46, 23, 1, 28, 12, 38, 31, 33, 8, 5, 10, 4, 6, -76, 4,
+    28, 29, 0, 34, -4, -30, -17, 16, 42, 26, 24, 39, -24, 1, -26, 5,
+    0, -93, -5, -27, 24, 41, -41, 3, 52, 42, -13, 58, 15, -12, -14, 51,
+    -20, 22, -53, 43, 62, 5, -55, -19, -20, -65, 43, 0, 44, 30, 26, -17,
+    16, -59, 14, 25, 1, 42, 14, 0, -56, -45, 4, 36, 10, -4, 19, 7,
+    -11, -20, 24, -1, -3, 2, 15, -69, 22, -8, 21, -42, 23, -59, 26, 15,
+    -2, -32, 15, 0, 9, 7, 42, 15, -15, -24, 38, 31, -11, 31, -111, 28,
+    15, -19, -47, -45, 2, 7, 5, 11, 18, 8, -21, 20, -4, -6, 20, -36,
+    -32, -3, 10, 23, -45, -73, 43, 1, 43, 0, 30, -71, 32, -23, -35, 5,
+    13, 21, 3, 21, 37, 30, 1, -26, 35, 26, 28, 13, -5, 18, 13, -91,
+    33, -23, -20, -10, 24, 31, -14, -5, -10, 13, 14, 73, 20, -19, -13, 16,
+    -18, 17, -23, -39, 20, -17, -13, 42, -111, 0, 6, -27, 17, 27, 20, -39,
+    58, -16, 32, 13, 6, -18, 20, -31, 4, 18, -3, -49, 24, -30, -34, -13,
+    22, 42, 6, -8, 22, -5, -15, -6, 52, -3, -10, 5, -15, 20, 3, -77,
+    -3, 31, 28, -2, 40, 6, -17, 1, -29, -11, -34, -30, 7, 3, 20, 44,
+    36, -27, 72, -17, -20, -30, -13, 56, -42, 10, 32, -33, 33, 3, -17, 9,
+    40, -1, 0, -15, -10, -13, -24, 40, 27, 28, -32, -23, 13, 33, -3, 0,
+    -64, 53, -48, -45, 45, -28, -8, 1, -34, 28, -9, 4, 7, -57, 42, -53,
+    22, -55, 35, 25, -11, -35, 17, -50, -34, 22, 65, 27, 11, -25, -24, -14,
+    -21, 25, 75, 62, -6, 12, 26, 24, 55, -7, 43, 3, -27, -40, -1, 42,
+    43, -14, -27, -12, 25, -10, 30, -45, 41, 14, 12, -42, 27, -42, -24, 9,
+    17, -17, -2, 45, -22, 5, 23, -11, -16, -62, -20, 35, 29, 66, -37, 8,
+    1, 69, -9, -42, 18, 7, -58, 49, -6, -28, -17, -22, 42, -15, 60, -38,
+    -36, 3, 3, 14, 30, -11, 5, -57, 3, 14, 28, 3, 14, 10, -8, 20,
+    46, 37, -27, 3, 27, 8, 0, -29, 6, -11, 15, 27, -38, 14, -37, 19,
+    7, 73, 45, -62, 58, 9, -10, 37, -5, -6, -32, -39, -15, 8, -38, -10,
+    -3, 6, -16, -50, -34, -6, 19, 19, 10, -5, -27, -18, 32, 35, 12, -99,
+    17, -13, 26, 56, 22, 9, -40, -11, 29, 17, -5, 35, 19, 17, -16, 12,
+    -8, -19, -17, 4, 12, 12, -49, 12, -53, -38, -56, -49, -43, 26, -13, 45,
+    -48, 31, 23, -60, -17, 41, 30, -28, 22, 86, 26, -38, -1, 11, 28, -37,
+    54, 7, -69, 8, 47, -2, 11, -28, -18, 1, 61, 12, -17, -31, 27, -21,
+    27, -21, -54, -25, 21, -50, 30, 57, -50, -2, 28, -11, -42, -39, -3, -40,
+    58, 44, -43, 48, 34, -10, -15, -14, -24, 59, -24, 33, 42, -5, 2, -47,
+    -35, 11, 24, -4, -13, 54, -5, -2, 44, -5, 30, 55, -16, -16, 17, -85,
+    -17, 70, 16, -2, -40, -3, -6, -23, -22, -7, 40, -1, 49, 9, -10, 7,
+    -18, -3, 73, 3, -20, -1, 2, 20, 1, -3, -19, 7, -16, 8, -4, 32,
+    36, -18, 16, 9, -27, -71, 19, 5, -13, 15, -33, -63, 0, 23, 34, 22,
+    58, 0, 31, -32, 49, 5, -61, 17, 54, 18, -39, -48, -1, 28, -13, -54,
+    -23, 28, -41, 34, 13, -12, 18, -7, 12, -10, -24, 8, 16, 30, 50, 64,
+    27, -19, -44, -37, -28, 25, 26, -22, -87, 18, 23, -2, 4, -45, 3, 2,
+    32, -35, 16, 44, 64, -41, -46, 14, -21, -44, -20, -58, -37, 25, -31, -39,
+    9, -5, 16, -32, -13, -87, 21, 19, 44, 7, -18, -55, -27, -28, 14, 60,
+    16, 21, 29, 10, 23, -15, 16, -10, -2, 11, 59, 8, 11, -9, -48, -36,
+    10, 9, -34, 1, -36, 15, -34, 20, 67, -11, 32, 33, 3, 3, -8, 29,
+    17, 9, 13, -17, 7, 25, 21, 21, 41, 26, 38, -6, -25, 36, -75, 2,
+    14, 16, -31, -11, 28, 22, -36, 50, 19, -126, 25, 53, 5, 15, -29, 8,
+    -26, -9, 26, -23, -37, -30, 18, 52, 43, 36, 10, 32, -4, 17, -28, 45,
+    -18, 61, 27, 29, 24, 20, 2, -7, -20, 13, 0, -11, -5, -13, -43, -6,
+    38, -18, 9, 0, -5, 47, 11, -20, -42, -45, -34, -27, -45, 35, 80, -10,
+    55, -19, -2, -4, 34, -28, 8, -6, -28, 77, 17, 8, -16, 1, 13, 48,
+    18, -6, -43, -31, 4, 56, 30, -11, 65, 18, -8, 31, -68, 15, -32, 107,
+    2, 6, -65, -27, 58, -17, -16, 15, -16, -14, 19, 13, 9, 8, 3, 4,
+    -30, -29, 55, -20, -29, 27, -24, 31, -28, 10, -14, 13, 26, 12, 64, -15,
+    -45, -31, 22, 23, -4, 44, -12, -11, 33, -20, 9, -20, 17, -16, 17, 6,
+    6, 44, -6, 34, 40, 8, 1, 5, -33, -5, 27, -30, 46, -21, 30, -65,
+    -13, 21, 8, -3, -38, -19, 42, -2, -7, 40, -12, 18, -17, 21, 26, -19,
+    5, 53, -12, 19, 14, -76, -24, -39, 21, 11, 23, -49, 34, 25, -62, 9,
+    34, 1, -13, 5, -48, 14, 20, -47, 32, 39, -15, 36, 1, 6, 13, 19,
+    6, -2, -14, -14, 38, 29, -2, 15, 0, 3, -32, -7, 18, -32, -5, -8,
+    -44, 29, 35, -11, 24, -30, 6, 43, 20, 13, -22, 4, -11, 31, 26, -17,
+    16, 43, 25, -1, -6, -6, 24, 24, 57, 5, 25, 51, 62, -15, -30, -17,
+    12, -40, 6, 25, -47, 42, -12, -6, 50, -21, -25, 58, 18, 18, -15, 67,
+    14, 36, 53, -30, 28, -32, -105, 6, -8, -14, 27, -9, 13, -4, 63, 62,
+    -3, -13, 127, 8, -64, 0, -62, 63, 56, 31, -18, -7, 42, -61, -12, -22,
+    18, 19, -29, 23, 3, 20, -13, 9, 18, -39, -17, 61, -12, -8, 43, -14,
+    -29, 9, 55, 5, 21, 4, 0, -52, 53, -18, 29, -7, 5, 2, 29, -90,
+    18, 33, 36, 30, -9, 31, 8, -2, 3, -27, 40, 31, 49, 12, -56, 25,
+    -18, 7, 8, -41, -46, -6, -29, 48, -12, 16, -13, 19, -6, 53, -5, 24,
+    33, 4, 27, 15, -12, -56, 62, -35, 14, 27, 5, -55, 23, -27, -7, 6,
+    48, -20, 23, -6, 32, -5, -2, -67, 5, -9, 22, -17, -34, 15, -18, -16,
+    -8, 1, 44, 10, 5, -36, 27, 6, 45, -73, 4, 39, -32, -20, 47, 87,
+    45, 4, 42, 21, 50, -1, -42, 38, -46, -9, 30, 30, -48, 11, -41, 28,
+    12, -38, 33, -31, -64, 9, 47, 12, -19, -21, 22, 52, 40, -73, 110, 12,
+    13, -51, -59, 5, -21, 61, 39, -32, -43, 16, -48, 14, 31, -23, -15, 17,
+    -29, 60, 22, 36, -34, -1, -55, -29, 11, 0, 36, -94, 32, 41, 57, -43,
+    -27, -37, 40, -9, -43, 4, -19, -27, 51, 54, -10, 13, -11, -17, 74, -53,
+    -8, 5, -47, -14, -20, 33, -99, -15, 54, 29, -34, 34, -41, 13, -53, 14,
+    44, -67, -16, -16, -47, -63, 20, 24, -45, 53, 0, -12, 10, 13, -15, 58,
+    -9, -26, -43, -15, -55, 37, 6, 29, 32, 37, -21, -3, -31, -15, 50, 22,
+    43, 62, -46, -38, 23, 42, 4, -32, 19, -19, -30, -21, 17, 4, 60, -20,
+    -24, 11, -21, -65, 20, -53, -24, 5, -13, 30, 48, 85, 38, 40, 10, -16,
+    -39, -16, -2, -2, 19, 53, 16, 25, -5, -83, 29, -4, -1, -20, 1, -46,
+    -3, 35, -13, -41, -53, -24, 37, -4, -29, 33, -49, -43, 59, 6, 50, 46,
+    2, 17, 11, 4, -78, -2, 45, 32, -27, -1, -20, 36, 3, 7, -18, -18,
+    40, 7, -10, 29, -41, -65, -46, -22, -11, 38, -16, -36, 31, 47, -28, 17,
+    -39, 23, -3, -32, 74, 9, -9, 64, -9, -35, 58, -18, 20, -1, -9, -26,
+    29, -50, 12, 14, -1, -36, -44, -39, 0, 29, -7, 39, 16, -18, 46, 18,
+    -1, -1, -12, 29, 4, 12, 2, 8, -8, 31, 60, -15, -5, -3, -23, 1,
+    -7, -40, -2, 0, 50, -10, -39, 28, -7, 27, -1, -97, 13, 11, -14, 17,
+    89, -50, -7, 15, 25, -4, -5, 34, 1, 41, 13, 29, -29, 41, 28, 79,
+    29, -34, 26, -10, 4, 33, 14, -4, 32, 15, -43, -10, -69, 16, 10, 63,
+    1, 74, -79, -45, 30, -16, 21, -2, 70, -8, -61, -38, 36, -15, -33, 18,
+    7, -3, 14, -54, -35, 47, 64, 21, 19, 42, -11, 80, 8, 12, -3, -3,
+    37, 9, 10, -5, -33, -48, 37, -63, 32, 29, 5, -69, 14, 18, -24, 55,
+    -66, 20, 25, 13, 12, 6, 20, 32, 37, -5, -17, 16, 36, -38, -60, 81,
+    62, -44, 8, -35, -24, -34, -34, 58, 44, 15, 26, 32, -23, -41, -9, 46,
+    -27, -24, -8, -41, -97, -3, 28, 56, 26, -24, 50, -38, 40, -18, 107, -4,
+    36, 21, 9, -27, 8, -5, 12, -12, 31, 30, -37, -2, -13, 32, 42, -101,
+    36, -19, -27, 49, 30, 38, -19, -2, -45, -33, 15, 8, 24, -9, 22, 32,
+    -2, -38, 44, 4, 12, 17, 32, 17, -45, 26, 28, -31, -16, 13, 33, -34,
+    -8, 1, -9, 9, 45, 5, 9, 37, -45, 27, -28, -44, 26, -13, 30, 20,
+    17, 2, -28, 30, -46, 17, -88, 37, -69, -6, -18, -39, -3, 4, 39, 39,
+    25, 28, -46, -43, -84, 29, -15, 19, -10, -18, -41, -6, -3, -27, -61, -3,
+    19, 13, 1, -66, -11, -28, 49, 1, 75, -51, 11, -4, 14, 1, 27, 39,
+    14, 6, 5, 24, 13, -96, -25, -44, -25, 28, 42, -3, 46, 7, -75, -4,
+    -14, 0, 20, -19, -10, -67, -1, 38, -5, 37, -11, -29, -35, -15, -1, 69,
+    48, 12, -18, -2, 4, 9, 7, 4, -23, 12, 29, 32, -13, -25, -23, -30,
+    -22, 9, -48, 31, 10, 39, 6, -2, 80, 5, 48, 8, -9, 30, 33, 37,
+    7, 47, -4, -13, 27, -2, -14, 15, 19, 47, 21, 16, 25, 44, -96, 44
+};
+const int32_t kOp3Bias[64] = {
+    112, -383, 1182, -80, 433, -17, 450, 105, 1290, -641, -11, 322, 320, -13, 493, 316,
+    315, -56, -794, -779, -394, -74, -361, 415, 336, -183, -245, 743, 782, -439, 537, -483,
+    -495, 955, 393, -84, -61, -713, -468, -497, 382, 642, 1008, 445, -211, 1056, 130, 728,
+    674, -852, -95, -141, 1080, -59, -369, 313, 556, -417, 503, 555, -1035, -216, 594, 581
+};
+alignas(4) const int8_t kOp5Weights[640] = {
+    7, 3, -13, -10, -54, 22, -11, -15, 4, -37, 30, -82, 55, 32, 12, -2,
+    -19, 25, 44, 23, 17, 16, 35, -3, -54, 31, 23, -19, 0, -20, -40, -29,
+    33, -21, -52, -13, 9, 3, -23, 23, -20, -61, -59, 11, 100, -12, 67, -9,
+    -42, -1, 2, -29, -83, 7, 19, 6, 8, -11, 29, -50, 3, 21, -59, -5,
+    5, 32, -13, -9, -40, 48, -23, 2, -28, 30, -1, -6, 24, -49, 7, -58,
+    1, 1, 48, 21, -18, -30, 33, -54, 6, 25, -35, -4, -21, -5, 6, 37,
+    25, -49, 24, 10, -17, 42, 49, 22, -21, -86, -12, -19, 46, 25, -34, -57,
+    40, 62, 24, 8, 40, 29, 48, -11, -83, 36, -60, -3, 17, -63, -82, -53,
+    43, -41, -47, -19, -2, 38, -32, 43, -14, 35, -25, -4, -88, 2, 10, -1,
+    5, -31, -75, 3, 7, -19, 7, 74, 26, 62, 23, -10, 5, 34, -3, -33,
+    30, -8, -66, 7, -24, -4, 4, 37, -24, 41, -31, 16, 68, 15, -13, 38,
+    42, -56, 23, -2, -69, 23, -59, -118, -71, 32, 32, -85, -43, -11, -58, 31,
+    -7, 0, -20, 25, 17, -111, -30, 5, -11, -72, 17, 50, -48, -87, -9, -10,
+    14, 28, 8, -61, 10, 19, 24, 29, -17, -12, 5, -30, 14, 27, -44, 27,
+    -23, -2, 24, -6, 22, -71, 37, -36, -11, 0, -69, 10, -48, 9, -36, 40,
+    -23, 37, -5, 0, 1, 26, -19, -80, 2, 10, -15, 40, 50, -22, 52, 10,
+    35, -15, 30, -31, -8, -54, 41, 34, 28, 16, -47, -37, 8, -44, -25, -46,
+    42, -71, 29, 12, 2, -41, -67, -84, 22, -39, -52, -5, -15, -21, 29, -14,
+    6, -23, 16, -19, -9, 40, -15, -32, -32, 64, 21, 28, -33, -13, -70, 22,
+    49, 12, -63, -30, 7, -18, -35, -32, 7, -74, 27, 44, -35, -58, -38, 15,
+    -60, -99, 17, -105, 45, -4, 14, -88, -14, 16, 44, 23, -44, -5, -1, 12,
+    -15, -20, -65, 48, -26, 26, -63, -80, -8, -36, -2, -19, 26, -7, 49, -9,
+    -59, 42, -4, -79, -6, 39, -17, 5, 7, -24, 41, 8, -12, 0, -17, -19,
+    -60, -47, 1, 17, 38, 0, 90, 103, 40, -49, -38, -19, 59, 18, 62, -22,
+    31, 42, -8, -15, -15, -8, 27, -23, 25, 1, -31, 26, 23, 69, 33, -20,
+    -78, 18, 22, 37, 25, -31, 6, -8, -75, -83, -28, 15, 15, -125, -45, -15,
+    -26, -24, 10, -36, -43, -46, -58, -80, 29, 32, -22, 25, -62, 12, 39, -40,
+    32, -8, 5, -62, 45, -21, 32, 39, 16, 45, 38, -57, 45, 11, -1, -61,
+    17, 56, -48, 23, 23, 29, -83, 37, 4, 31, -2, 32, -27, 49, -76, -13,
+    6, -15, 10, 39, 41, -26, -49, -11, 18, 34, 7, -27, -127, -22, -16, -9,
+    -27, -5, 15, -2, 6, 26, -22, 21, 18, 53, -16, -113, 11, -62, 28, 24,
+    -20, 28, -35, 24, 3, -16, -32, -72, 25, -16, 13, 33, 75, 28, -53, 23,
+    -64, -8, 15, 31, -13, -8, -17, -23, 28, -65, -63, 5, 21, -57, 18, 13,
+    -1, -27, -70, -54, -64, -7, -31, 23, -25, -2, 59, 38, 11, -8, -10, -56,
+    19, 12, 25, 28, 26, -63, -24, 24, 28, -62, 30, 13, -53, 9, 32, 9,
+    -16, -59, 20, 3, -12, 32, -35, -20, -70, 20, 8, 12, -71, 10, -19, 16,
+    -44, -23, 3, 23, -27, 16, 37, -28, 31, 11, -14, -69, 27, 14, -50, 19,
+    11, 25, 7, -34, 15, 14, 91, -15, 17, -76, -72, 12, 26, 38, -7, 49,
+    -2, 8, 6, 24, 7, -33, -29, -37, -63, 5, 33, 14, -18, -37, -67, -32,
+    -35, 6, 15, 12, -46, -64, -53, 17, 51, 6, -27, 19, -95, -22, 78, 13
+};
+const int32_t kOp5Bias[10] = {
+    -397, -342, 89, -91, 247, 177, 102, -85, 196, -98
+};
+
+}  // namespace
+
+int8_t* mnist_model_aot_input(void) { return g_arena + 0; }
+
+const int8_t* mnist_model_aot_output(void) { return g_arena + 0; }
+
+void mnist_model_aot_invoke(void) {
+  // Op 1: FULLY_CONNECTED 144 -> 64, NONE
+  {
+    tflite::FullyConnectedParams params = {};
+    params.input_offset = 128;
+    params.weights_offset = 0;
+    params.output_offset = 22;
+    params.output_multiplier = 1958583013;
+    params.output_shift = -10;
+    params.quantized_activation_min = -128;
+    params.quantized_activation_max = 127;
+    tflite::reference_integer_ops::FullyConnected(
+        params, tflite::RuntimeShape(2, kDims1x144), g_arena + 0,
+        tflite::RuntimeShape(2, kDims64x144), kOp1Weights,
+        tflite::RuntimeShape(1, kDims64), kOp1Bias,
+        tflite::RuntimeShape(2, kDims1x64), g_arena + 144);
+  }
+  // Op 2: LEAKY_RELU alpha=0.10000000
+  {
+    tflite::LeakyReluParams params = {};
+    params.input_offset = 22;
+    params.output_offset = -96;
+    params.output_multiplier_alpha = 1830798080;
+    params.output_shift_alpha = -2;
+    params.output_multiplier_identity = 1144248704;
+    params.output_shift_identity = 2;
+    tflite::reference_ops::QuantizeLeakyRelu(
+        params, tflite::RuntimeShape(2, kDims1x64), g_arena + 144,
+        tflite::RuntimeShape(2, kDims1x64), g_arena + 0);
+  }
+  // Op 3: FULLY_CONNECTED 64 -> 64, NONE
+  {
+    tflite::FullyConnectedParams params = {};
+    params.input_offset = 96;
+    params.weights_offset = 0;
+    params.output_offset = 4;
+    params.output_multiplier = 1285366644;
+    params.output_shift = -8;
+    params.quantized_activation_min = -128;
+    params.quantized_activation_max = 127;
+    tflite::reference_integer_ops::FullyConnected(
+        params, tflite::RuntimeShape(2, kDims1x64), g_arena + 0,
+        tflite::RuntimeShape(2, kDims64x64), kOp3Weights,
+        tflite::RuntimeShape(1, kDims64), kOp3Bias,
+        tflite::RuntimeShape(2, kDims1x64), g_arena + 64);
+  }
+  // Op 4: LEAKY_RELU alpha=0.10000000
+  {
+    tflite::LeakyReluParams params = {};
+    params.input_offset = 4;
+    params.output_offset = -103;
+    params.output_multiplier_alpha = 1611527424;
+    params.output_shift_alpha = -2;
+    params.output_multiplier_identity = 2014409216;
+    params.output_shift_identity = 1;
+    tflite::reference_ops::QuantizeLeakyRelu(
+        params, tflite::RuntimeShape(2, kDims1x64), g_arena + 64,
+        tflite::RuntimeShape(2, kDims1x64), g_arena + 0);
+  }
+  // Op 5: FULLY_CONNECTED 64 -> 10, NONE
+  {
+    tflite::FullyConnectedParams params = {};
+    params.input_offset = 103;
+    params.weights_offset = 0;
+    params.output_offset = 28;
+    params.output_multiplier = 1134502598;
+    params.output_shift = -8;
+    params.quantized_activation_min = -128;
+    params.quantized_activation_max = 127;
+    tflite::reference_integer_ops::FullyConnected(
+        params, tflite::RuntimeShape(2, kDims1x64), g_arena + 0,
+        tflite::RuntimeShape(2, kDims10x64), kOp5Weights,
+        tflite::RuntimeShape(1, kDims10), kOp5Bias,
+        tflite::RuntimeShape(2, kDims1x10), g_arena + 64);
+  }
+  // Op 6: SOFTMAX beta=1.00000000
+  {
+    tflite::SoftmaxParams params = {};
+    params.input_multiplier = 1952949632;
+    params.input_left_shift = 25;
+    params.diff_min = -62;
+    tflite::reference_ops::Softmax(
+        params, tflite::RuntimeShape(2, kDims1x10), g_arena + 64,
+        tflite::RuntimeShape(2, kDims1x10), g_arena + 0);
+  }
+}
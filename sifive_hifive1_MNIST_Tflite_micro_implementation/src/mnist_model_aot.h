@@ -0,0 +1,23 @@
+/*
+ * This file is auto-generated by tools/model_compiler/tflm_aot.py from mnist_model_int8.tflite.
+ * Do not modify manually.
+ */
+#ifndef MNIST_MODEL_AOT_H
+#define MNIST_MODEL_AOT_H
+
+#include <stdint.h>
+
+#define MNIST_MODEL_AOT_ARENA_SIZE 208
+#define MNIST_MODEL_AOT_INPUT_SIZE 144
+#define MNIST_MODEL_AOT_INPUT_SCALE 0.00392157f
+#define MNIST_MODEL_AOT_INPUT_ZERO_POINT -128
+#define MNIST_MODEL_AOT_OUTPUT_SIZE 10
+#define MNIST_MODEL_AOT_OUTPUT_SCALE 0.00390625f
+#define MNIST_MODEL_AOT_OUTPUT_ZERO_POINT -128
+
+// Same numerics as MicroInterpreter::Invoke() on the original model, without the interpreter.
+int8_t* mnist_model_aot_input(void);
+const int8_t* mnist_model_aot_output(void);
+void mnist_model_aot_invoke(void);
+
+#endif // MNIST_MODEL_AOT_H
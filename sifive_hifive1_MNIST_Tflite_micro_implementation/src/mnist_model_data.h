@@ -3,6 +3,8 @@
  * Auto-generated header file for SiFive HiFive1 Board
  * Model: 8x8 MNIST Classifier
  * Quantization: INT8
+ * Memory plan: OfflineMemoryAllocation metadata, 208 B arena
+ * (tools/model_compiler/memory_plan.py)
  */
 
 #ifndef MNIST_MODEL_DATA_H_
@@ -11,1119 +13,1137 @@
 #include <stdint.h>
 
 const unsigned char mnist_model_int8_data[] = {
-    0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00,
-    0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
-    0xe4, 0x3a, 0x00, 0x00, 0xf4, 0x3a, 0x00, 0x00, 0xcc, 0x44, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-    0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-    0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
-    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x8c, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x3e, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x32, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0xdc, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-    0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44,
-    0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
-    0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
-    0x12, 0x00, 0x00, 0x00, 0xec, 0x39, 0x00, 0x00, 0xe4, 0x39, 0x00, 0x00, 0xcc, 0x39, 0x00, 0x00,
-    0x94, 0x39, 0x00, 0x00, 0x04, 0x37, 0x00, 0x00, 0xf4, 0x35, 0x00, 0x00, 0xe4, 0x25, 0x00, 0x00,
-    0xd4, 0x24, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
-    0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
-    0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0xc5, 0xff, 0xff,
-    0x04, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
-    0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-    0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x35, 0x2e, 0x30, 0x00, 0x00,
-    0x6a, 0xc5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
-    0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xbd, 0xff, 0xff,
-    0xd4, 0xbd, 0xff, 0xff, 0xd8, 0xbd, 0xff, 0xff, 0xdc, 0xbd, 0xff, 0xff, 0xe0, 0xbd, 0xff, 0xff,
-    0xe4, 0xbd, 0xff, 0xff, 0xe8, 0xbd, 0xff, 0xff, 0xa2, 0xc5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x03, 0xf4, 0x02, 0xff, 0x08, 0xf4, 0xe6, 0xf2, 0xfd, 0xf2, 0xf5, 0x09,
-    0xf9, 0xe4, 0xfc, 0x04, 0xfc, 0x05, 0x15, 0x06, 0xe8, 0xfa, 0xfc, 0x28, 0x09, 0xf2, 0xec, 0xec,
-    0x06, 0xf5, 0x01, 0xfd, 0xfc, 0x14, 0xfa, 0x10, 0x11, 0x25, 0x04, 0xfd, 0x0b, 0xe6, 0x22, 0x11,
-    0x00, 0xfe, 0x21, 0x1d, 0x01, 0xf9, 0x00, 0x12, 0xff, 0xec, 0xfa, 0xfc, 0x0a, 0x19, 0x0d, 0xfb,
-    0xf6, 0xdb, 0xe4, 0x0f, 0x07, 0x09, 0x00, 0x13, 0xf4, 0x06, 0x0d, 0x0a, 0x0b, 0xf0, 0x19, 0xff,
-    0xef, 0x0a, 0x05, 0x00, 0xf9, 0xf7, 0xf6, 0xe2, 0x08, 0x0a, 0xfb, 0x0a, 0x07, 0x10, 0x12, 0x13,
-    0xeb, 0xf2, 0xbc, 0xdc, 0xfa, 0x0c, 0xef, 0xfc, 0x0d, 0x01, 0x17, 0xfa, 0xd6, 0xeb, 0xb5, 0xd7,
-    0xfc, 0xf1, 0xfc, 0xf6, 0x05, 0x1d, 0x1a, 0xfc, 0xe5, 0xad, 0xc0, 0x00, 0xf7, 0x10, 0xff, 0x0d,
-    0x09, 0x13, 0x0e, 0xe7, 0xa0, 0xa8, 0x0f, 0x0d, 0xf7, 0xe8, 0x1e, 0x11, 0x18, 0x24, 0x04, 0xa2,
-    0xa8, 0x02, 0xeb, 0xf7, 0xf4, 0xfa, 0x03, 0x06, 0x0e, 0xff, 0x0f, 0xe0, 0x05, 0x01, 0x00, 0xf3,
-    0xef, 0xdc, 0xfe, 0xee, 0xe6, 0xe1, 0x06, 0xe9, 0xe3, 0xf0, 0x06, 0x1b, 0xec, 0x28, 0xfd, 0xfc,
-    0x09, 0xfc, 0xee, 0xe1, 0xf0, 0xfe, 0x12, 0xf1, 0x06, 0x0b, 0x0c, 0xeb, 0x1c, 0x19, 0xfb, 0xf4,
-    0x16, 0x1d, 0x25, 0xfb, 0xfd, 0xde, 0x1e, 0xf1, 0xe0, 0xd2, 0xe0, 0x06, 0x0e, 0x18, 0x12, 0x1b,
-    0x0c, 0x0e, 0x0f, 0x02, 0xf5, 0xff, 0xf8, 0x06, 0xee, 0xee, 0xfc, 0x19, 0x09, 0x17, 0xf4, 0xd6,
-    0xeb, 0xf7, 0x06, 0xde, 0x02, 0x0a, 0xf9, 0xf2, 0xfe, 0xfd, 0xe5, 0x0a, 0x09, 0x00, 0x0b, 0x01,
-    0xfd, 0xf9, 0xf0, 0xfa, 0x0c, 0xf8, 0xe9, 0x0c, 0x10, 0x09, 0xfd, 0xf9, 0x18, 0x21, 0xd7, 0x1f,
-    0x0d, 0x0f, 0x10, 0x1d, 0x0b, 0x0f, 0x0f, 0x0e, 0x21, 0x28, 0x20, 0x23, 0xfd, 0x05, 0x06, 0x0a,
-    0x24, 0x0e, 0x30, 0xf5, 0xf4, 0x1c, 0xea, 0xfb, 0xf3, 0x10, 0xfc, 0x00, 0xf7, 0x04, 0x0a, 0x07,
-    0xf2, 0x22, 0x0d, 0x06, 0x08, 0x08, 0x03, 0xf0, 0xf3, 0xfa, 0x05, 0x26, 0x01, 0xec, 0x0b, 0xf3,
-    0xf2, 0x21, 0xd4, 0xe1, 0xe1, 0xf0, 0x0c, 0xf4, 0xdf, 0xff, 0xf9, 0xf9, 0xdd, 0xd8, 0xf4, 0xfc,
-    0xf2, 0x03, 0xfc, 0xfb, 0xf8, 0x08, 0x0b, 0x07, 0xec, 0xf3, 0xff, 0x10, 0x09, 0xf7, 0xec, 0x00,
-    0xf9, 0x26, 0x1c, 0x2e, 0xf4, 0xff, 0xfa, 0xf6, 0xf4, 0x0e, 0x07, 0x03, 0xfc, 0xec, 0x11, 0x1a,
-    0x0b, 0x00, 0xda, 0xfd, 0x0e, 0x1b, 0x0a, 0x00, 0xef, 0xf4, 0xf6, 0xd3, 0x0d, 0xf4, 0xf2, 0x02,
-    0x1f, 0x17, 0x0e, 0x02, 0x0f, 0x10, 0xef, 0xf7, 0xf6, 0xda, 0x03, 0x02, 0x13, 0x04, 0xf5, 0x03,
-    0x20, 0xf5, 0x0b, 0x07, 0x01, 0xe6, 0x08, 0xf3, 0xe6, 0x16, 0x18, 0x06, 0xfe, 0xfa, 0x11, 0x2a,
-    0xf6, 0xf0, 0xff, 0xf1, 0xf0, 0x18, 0x1c, 0xef, 0x0f, 0xf7, 0x27, 0x41, 0xf9, 0x37, 0x07, 0xff,
-    0x14, 0xf9, 0xfb, 0xfa, 0x2d, 0x0c, 0x19, 0x00, 0x0b, 0xfb, 0x1d, 0x09, 0xde, 0xf1, 0xff, 0xf7,
-    0x13, 0x23, 0x2b, 0x00, 0x06, 0x01, 0xff, 0x07, 0xf5, 0x0c, 0x02, 0x1a, 0x0c, 0xfc, 0x0b, 0xfb,
-    0x05, 0xfd, 0x03, 0xff, 0x04, 0x17, 0x02, 0x1c, 0xf5, 0x0e, 0x0b, 0xda, 0x05, 0xf5, 0x12, 0x06,
-    0x0c, 0x02, 0xff, 0xf9, 0x0e, 0x10, 0x15, 0xe1, 0x0a, 0xdb, 0xfc, 0x13, 0x07, 0xfd, 0x08, 0xe9,
-    0xed, 0xfd, 0xfa, 0xe8, 0xfb, 0xd1, 0xe9, 0xfe, 0x22, 0x1b, 0x16, 0x22, 0xfc, 0xfc, 0xec, 0x0f,
-    0xfa, 0xfa, 0xd1, 0xe9, 0x09, 0x08, 0x02, 0x0a, 0x1a, 0xfb, 0xed, 0xde, 0xf4, 0x11, 0x03, 0xf6,
-    0xf2, 0x08, 0x07, 0x21, 0x22, 0x11, 0xed, 0xc9, 0xf9, 0x17, 0xfe, 0x08, 0x06, 0xf2, 0x09, 0x1b,
-    0x17, 0xee, 0xe6, 0xeb, 0x0b, 0x09, 0xd8, 0xeb, 0x06, 0x12, 0x05, 0x0e, 0x18, 0xfd, 0xe9, 0xde,
-    0xfa, 0xd9, 0xfa, 0x06, 0xf8, 0xef, 0xf9, 0x0c, 0x1d, 0xf3, 0xcf, 0xd3, 0x01, 0xdf, 0xe5, 0xf1,
-    0xee, 0xee, 0x03, 0x14, 0x19, 0xf1, 0xf9, 0xed, 0xf5, 0x18, 0xf1, 0xd9, 0x01, 0x15, 0x02, 0x17,
-    0x0b, 0x09, 0xe6, 0xfa, 0x01, 0xf7, 0x04, 0x03, 0x08, 0x08, 0xfb, 0xf6, 0x00, 0x09, 0xf4, 0xf9,
-    0x09, 0x15, 0x03, 0x12, 0xf1, 0xea, 0xf8, 0x16, 0x07, 0xf1, 0xf2, 0xd1, 0x10, 0x06, 0xf7, 0xf1,
-    0xfc, 0xfd, 0xf6, 0x03, 0x00, 0xef, 0xd1, 0xc0, 0x0d, 0x09, 0x03, 0xe2, 0xee, 0xdf, 0xec, 0x06,
-    0x1c, 0xee, 0xca, 0xfa, 0x03, 0x05, 0xf6, 0x07, 0xec, 0xef, 0xe5, 0x2b, 0xf4, 0xf5, 0x06, 0x21,
-    0x0c, 0x0f, 0x0d, 0xfa, 0xea, 0xe3, 0x13, 0x0f, 0xe5, 0xec, 0x02, 0xda, 0xfc, 0xee, 0x0a, 0x1a,
-    0xfe, 0x0b, 0x1f, 0x0b, 0x0f, 0x00, 0x02, 0xfc, 0x04, 0xf3, 0x21, 0x04, 0x0a, 0x00, 0x10, 0x10,
-    0xef, 0x18, 0x0c, 0xd2, 0x05, 0x04, 0x1a, 0x02, 0xee, 0x11, 0x03, 0x15, 0x03, 0x0f, 0x0c, 0x24,
-    0x01, 0xfb, 0x22, 0x17, 0xdf, 0x08, 0x03, 0x09, 0x00, 0xef, 0xf1, 0xb7, 0xf5, 0xee, 0x06, 0x16,
-    0x0a, 0x0d, 0xe9, 0xf1, 0xf1, 0xe3, 0xe9, 0xdf, 0x06, 0xd5, 0xf4, 0x0a, 0x05, 0x08, 0xfe, 0x02,
-    0xfd, 0xf7, 0xc4, 0x03, 0xf3, 0xf3, 0x0c, 0xfe, 0x1b, 0xfc, 0x12, 0x21, 0xf4, 0xfa, 0x0c, 0xf9,
-    0xfc, 0x02, 0x05, 0x0d, 0x21, 0x1f, 0x11, 0x06, 0x0d, 0x02, 0x0c, 0xf0, 0xf4, 0x04, 0x13, 0x28,
-    0x12, 0x21, 0x1a, 0xff, 0xfb, 0x01, 0xf6, 0xec, 0xed, 0x03, 0x20, 0x22, 0x12, 0x2d, 0xeb, 0xcf,
-    0xbe, 0xe9, 0xe7, 0xe5, 0xf8, 0xf9, 0x1b, 0x19, 0x1d, 0x02, 0xd1, 0xf2, 0xfe, 0x05, 0x0b, 0xd8,
-    0x00, 0x1d, 0x09, 0x0a, 0xf3, 0xf0, 0xf3, 0x08, 0xfe, 0xf4, 0x10, 0x0a, 0x07, 0x07, 0x14, 0x06,
-    0xf1, 0x07, 0xf2, 0xd8, 0x0b, 0x00, 0x16, 0x22, 0x0b, 0xf3, 0xee, 0x00, 0x09, 0x0c, 0xf7, 0xf0,
-    0xf7, 0x03, 0x14, 0xfc, 0x02, 0xed, 0x05, 0x01, 0xec, 0xe5, 0xfd, 0x0b, 0x01, 0xf5, 0xf3, 0x19,
-    0x0a, 0xd6, 0xf3, 0xeb, 0xfe, 0x02, 0x03, 0x14, 0x07, 0xf8, 0x20, 0x02, 0xfa, 0x03, 0x16, 0x18,
-    0x18, 0x0b, 0x0d, 0x00, 0x1c, 0x16, 0x06, 0x09, 0xfe, 0x44, 0xee, 0xfe, 0xf8, 0x1c, 0xee, 0xff,
-    0x01, 0xfd, 0xf6, 0xf4, 0x08, 0xfd, 0xfd, 0x05, 0x03, 0x04, 0x05, 0xec, 0x00, 0xf2, 0xfc, 0xf8,
-    0x0a, 0x08, 0xd9, 0xed, 0xf7, 0xe5, 0xe6, 0xe1, 0xf9, 0x05, 0x13, 0x05, 0x0e, 0xff, 0x11, 0x1a,
-    0x12, 0x0f, 0x20, 0x1c, 0x1a, 0x01, 0x21, 0x11, 0xf5, 0x12, 0x27, 0x1e, 0x24, 0x0b, 0x06, 0xfc,
-    0xf3, 0xf4, 0xfc, 0x04, 0xf7, 0x17, 0xf5, 0x09, 0xf3, 0xd3, 0xd5, 0xe7, 0xff, 0xf4, 0xf2, 0x04,
-    0xf3, 0xe7, 0xde, 0xd5, 0xec, 0x0c, 0x18, 0x1e, 0x0c, 0x0c, 0x00, 0x01, 0xfa, 0xed, 0xe3, 0xf1,
-    0xfe, 0x13, 0x01, 0x0b, 0x09, 0x12, 0xf2, 0x18, 0xfa, 0xde, 0xe4, 0xe7, 0xd7, 0xf9, 0xdf, 0xff,
-    0xff, 0x01, 0x01, 0x21, 0xf8, 0x25, 0x25, 0x0f, 0x0a, 0xf0, 0xf6, 0x0b, 0x08, 0x1a, 0xf3, 0xf2,
-    0xfe, 0x13, 0x1a, 0x18, 0x10, 0x1c, 0x17, 0x02, 0xed, 0x09, 0x02, 0x0d, 0x0d, 0x0f, 0xfb, 0xf3,
-    0xec, 0xed, 0x06, 0xfc, 0x00, 0xff, 0xee, 0x1c, 0x0a, 0xf4, 0xe6, 0xfc, 0x22, 0xfb, 0xf8, 0x14,
-    0xf6, 0x2d, 0xde, 0x06, 0xf6, 0x06, 0x0c, 0x01, 0xf4, 0x02, 0x0d, 0xf1, 0x04, 0x12, 0xf6, 0x04,
-    0x09, 0x09, 0xe6, 0xee, 0x0c, 0x12, 0x09, 0xf4, 0xf0, 0x10, 0x06, 0x1b, 0x05, 0x00, 0x0b, 0x0a,
-    0x0b, 0xfd, 0xe5, 0xf1, 0xfa, 0x0b, 0x0b, 0xe8, 0x00, 0xf3, 0x08, 0x0c, 0x12, 0xfe, 0xe9, 0xf7,
-    0x17, 0x11, 0xf1, 0x0b, 0xfe, 0xef, 0x1f, 0x16, 0x06, 0xf0, 0xf9, 0x01, 0x07, 0xf8, 0xf1, 0x37,
-    0xf6, 0x01, 0x0d, 0x0e, 0x0e, 0xf4, 0x07, 0x11, 0x09, 0x19, 0xfd, 0x09, 0x07, 0x07, 0x12, 0x1b,
-    0x03, 0x12, 0x22, 0x12, 0x10, 0x1d, 0x37, 0x23, 0xf9, 0x23, 0x22, 0xe4, 0xe0, 0x0b, 0x10, 0x13,
-    0x0d, 0xeb, 0xe7, 0xfb, 0x0d, 0x37, 0x01, 0xde, 0xf8, 0x01, 0xff, 0xf3, 0xe4, 0xdf, 0xe6, 0xee,
-    0x0b, 0x15, 0xfb, 0xe0, 0xf6, 0x07, 0xea, 0xf7, 0xe7, 0xea, 0xe4, 0xe1, 0x08, 0xe7, 0xf2, 0xe7,
-    0xf1, 0xf2, 0x0a, 0xfd, 0xf9, 0x10, 0x14, 0xd5, 0x04, 0xee, 0xf1, 0xbf, 0x0f, 0x1f, 0xd2, 0x29,
-    0xde, 0xd0, 0xe0, 0xfb, 0xf6, 0x0c, 0x0f, 0xff, 0xf9, 0xf6, 0x0e, 0xfb, 0x0c, 0x03, 0xf8, 0xf7,
-    0xfe, 0xfc, 0x00, 0x01, 0xfd, 0xfa, 0x11, 0x00, 0xf5, 0xf9, 0xd7, 0xfa, 0x1a, 0x25, 0xfb, 0x15,
-    0x1f, 0x04, 0x00, 0x1c, 0x17, 0xfa, 0x0b, 0xfa, 0xf5, 0x12, 0x0a, 0xf5, 0x06, 0x0b, 0x18, 0x11,
-    0x0b, 0xf5, 0x10, 0x31, 0x07, 0xd5, 0xf1, 0xf9, 0xfa, 0x10, 0x10, 0x05, 0xec, 0x02, 0xf4, 0x22,
-    0x0c, 0xdf, 0xed, 0x1b, 0x21, 0x14, 0xfb, 0xfc, 0x02, 0xf6, 0x0e, 0x18, 0x0c, 0x37, 0x3c, 0x36,
-    0x1c, 0x03, 0xe8, 0xf4, 0x07, 0x00, 0xf0, 0x0a, 0x05, 0x28, 0x1f, 0x0a, 0x0f, 0xf5, 0xd7, 0xf6,
-    0xf1, 0x03, 0xfb, 0xef, 0x00, 0xfc, 0x05, 0x0d, 0x08, 0xf1, 0xda, 0xeb, 0xe6, 0xd4, 0xdf, 0x21,
-    0xf4, 0xf0, 0x1b, 0x1a, 0x07, 0xfb, 0xfa, 0xf8, 0xde, 0xe2, 0xec, 0x22, 0x0b, 0x02, 0xfe, 0x14,
-    0x0b, 0x09, 0x08, 0xf0, 0xf6, 0xef, 0xf0, 0xdb, 0x01, 0xf8, 0xf5, 0x1b, 0x1e, 0x02, 0xf2, 0x05,
-    0x0a, 0x13, 0xf4, 0xf9, 0x0b, 0x03, 0xf7, 0xfb, 0xef, 0x05, 0x17, 0x00, 0x09, 0x08, 0x05, 0xf7,
-    0xfb, 0x23, 0x0d, 0x15, 0x0a, 0x21, 0x2d, 0x12, 0x02, 0x17, 0x09, 0xfa, 0x20, 0x00, 0xfc, 0xff,
-    0x12, 0x0e, 0x12, 0x1a, 0x09, 0x03, 0x08, 0xfd, 0x0c, 0xcf, 0xf0, 0x0c, 0xe8, 0xe8, 0xe9, 0xf8,
-    0x0e, 0x1b, 0xfb, 0x17, 0x02, 0xef, 0x02, 0xed, 0xc9, 0xbc, 0xe4, 0x0c, 0xfa, 0xfd, 0x0f, 0x2a,
-    0x01, 0xd1, 0xeb, 0xfe, 0xf7, 0x03, 0x0b, 0x0a, 0xfc, 0xfd, 0x0e, 0x14, 0x00, 0x2d, 0x20, 0xfe,
-    0xf7, 0xf4, 0xfe, 0xeb, 0xe7, 0xfb, 0x08, 0xe0, 0xf6, 0xe3, 0xf2, 0xe6, 0xea, 0x02, 0x0a, 0xf1,
-    0xf7, 0xf3, 0xf3, 0xee, 0x00, 0xda, 0x05, 0x0e, 0xfd, 0xfe, 0xf4, 0xdd, 0xef, 0xfd, 0x12, 0x0b,
-    0xff, 0xeb, 0xf4, 0x04, 0xf6, 0xe9, 0xe5, 0x07, 0x04, 0x0f, 0x27, 0xf7, 0xff, 0x1c, 0x00, 0x16,
-    0xfe, 0x02, 0xf6, 0x09, 0x08, 0xfd, 0xe7, 0xe3, 0xfe, 0x19, 0x06, 0xda, 0xf0, 0x0e, 0x0f, 0xf9,
-    0x0b, 0xf4, 0x2d, 0x0a, 0xf8, 0x0d, 0xfd, 0x05, 0xfa, 0x03, 0x1b, 0x25, 0x0a, 0x09, 0xf7, 0x03,
-    0x04, 0x02, 0xfe, 0x04, 0xff, 0x0d, 0xf4, 0xf4, 0xf7, 0xe8, 0xce, 0x16, 0x09, 0xf8, 0x1c, 0x0b,
-    0x00, 0x07, 0x0a, 0xfa, 0xf9, 0xef, 0xe3, 0x30, 0x0f, 0xf1, 0xf7, 0x00, 0xff, 0xf9, 0x03, 0x0f,
-    0x11, 0xee, 0xeb, 0xee, 0xfe, 0xee, 0xe8, 0xfd, 0xf4, 0xfb, 0xfe, 0x05, 0x1b, 0xfb, 0xe2, 0xcb,
-    0xf6, 0xf7, 0x00, 0xf3, 0xf3, 0x03, 0x00, 0x15, 0x2d, 0x11, 0x03, 0xed, 0xf5, 0x0c, 0xfd, 0xf3,
-    0xf7, 0x09, 0x1b, 0x22, 0x0f, 0x06, 0x18, 0x24, 0x02, 0x03, 0xe3, 0x02, 0xf4, 0x24, 0x19, 0x18,
-    0x03, 0x0a, 0xf3, 0x08, 0xf7, 0xdc, 0xe0, 0xdc, 0x05, 0x34, 0x05, 0x09, 0xf5, 0x02, 0xee, 0xdd,
-    0xfb, 0xe7, 0xd6, 0xf0, 0x07, 0x16, 0x14, 0x0e, 0x0a, 0x13, 0xea, 0x0a, 0xfe, 0xcc, 0xe5, 0x06,
-    0x07, 0x10, 0xf3, 0xfa, 0xf2, 0x0f, 0xf3, 0xda, 0x03, 0xcb, 0xc5, 0xfa, 0xfe, 0xef, 0x01, 0xf2,
-    0x0d, 0x04, 0x00, 0xf3, 0x0a, 0xf9, 0x0b, 0x00, 0x14, 0xff, 0x02, 0x1c, 0x0b, 0xf7, 0x08, 0xff,
-    0xff, 0xef, 0xfa, 0x21, 0x26, 0x11, 0xe9, 0xd4, 0xda, 0x08, 0x0c, 0x0a, 0xf8, 0xd5, 0x0e, 0x1f,
-    0x1a, 0x0e, 0xf2, 0xd6, 0x06, 0x16, 0x1c, 0x16, 0x06, 0xdc, 0xf6, 0x33, 0x15, 0xe4, 0xc2, 0xe9,
-    0x09, 0x01, 0xfb, 0xfa, 0xf6, 0xf8, 0xfe, 0x37, 0x32, 0xe7, 0xc2, 0xe6, 0xe1, 0xf6, 0x05, 0x09,
-    0x03, 0xeb, 0x07, 0x06, 0x10, 0x18, 0xf2, 0xfb, 0xf8, 0xfc, 0xff, 0x2d, 0x07, 0xfd, 0x17, 0x03,
-    0x01, 0x04, 0xf7, 0x03, 0xf1, 0xf8, 0xff, 0x00, 0x02, 0x10, 0x08, 0x06, 0xfa, 0xfb, 0xf6, 0x0e,
-    0xf5, 0xfd, 0x00, 0x1b, 0x03, 0x01, 0x0b, 0x06, 0x0d, 0xf4, 0x12, 0xf6, 0xf9, 0x0e, 0x02, 0x15,
-    0x0a, 0xeb, 0xfc, 0xf3, 0x07, 0x04, 0x0d, 0x03, 0xfe, 0x0c, 0x0e, 0xf6, 0xf4, 0x0c, 0x14, 0x1a,
-    0xf0, 0x0e, 0x05, 0xfc, 0x0f, 0xfb, 0xe4, 0x1e, 0xfc, 0x00, 0x02, 0xe1, 0x16, 0x04, 0xf6, 0xe1,
-    0xef, 0x19, 0xe9, 0x0c, 0x06, 0x0d, 0xfc, 0xff, 0x02, 0xfa, 0xf4, 0xf7, 0x0c, 0x02, 0x0b, 0x07,
-    0x08, 0xf7, 0x14, 0xfa, 0x08, 0x12, 0x18, 0x10, 0x17, 0x0c, 0x22, 0xf8, 0xfa, 0xe7, 0xff, 0x07,
-    0xf4, 0x08, 0xec, 0xe9, 0xf3, 0xfc, 0x09, 0x04, 0xfb, 0x17, 0x18, 0x07, 0xff, 0xfc, 0xe9, 0xee,
-    0xf6, 0xfb, 0xf4, 0x13, 0x07, 0x07, 0x1f, 0xfc, 0x0e, 0x00, 0x06, 0x15, 0xfa, 0xf9, 0xf2, 0xe6,
-    0x09, 0x21, 0x20, 0x06, 0xf4, 0x13, 0x0a, 0xfc, 0xf6, 0xff, 0x02, 0x0f, 0x06, 0x0d, 0x0f, 0xdf,
-    0xe6, 0x12, 0x04, 0xfc, 0x03, 0xe2, 0xe4, 0xf3, 0xf8, 0x0b, 0x05, 0xf8, 0xe4, 0xf7, 0x04, 0x00,
-    0xf6, 0xf9, 0x24, 0xfa, 0x0c, 0xf7, 0x19, 0xe9, 0xee, 0x0e, 0x0e, 0x0a, 0x02, 0x24, 0xf5, 0x16,
-    0x08, 0x0d, 0xf9, 0x01, 0x11, 0x05, 0x1c, 0x09, 0xff, 0x0d, 0x03, 0x03, 0x01, 0x0c, 0x0a, 0x02,
-    0x19, 0x0a, 0x0d, 0x0e, 0x04, 0x08, 0x0b, 0x39, 0xfb, 0xee, 0xd3, 0xf2, 0xfa, 0xc2, 0xf2, 0xed,
-    0x12, 0x12, 0x07, 0xfe, 0xf6, 0xfb, 0x08, 0x09, 0x00, 0x09, 0xf7, 0xe5, 0xfc, 0xfe, 0xf6, 0x02,
-    0xf8, 0x1a, 0x36, 0x1e, 0xfc, 0x14, 0x01, 0xf8, 0xfd, 0xf7, 0x01, 0x28, 0x11, 0x0e, 0x0f, 0xf9,
-    0x05, 0xf6, 0x07, 0x0c, 0xfe, 0x05, 0xfe, 0xe1, 0x0c, 0x0a, 0x30, 0xf0, 0xea, 0x15, 0x0d, 0x14,
-    0x1c, 0x24, 0x22, 0xd4, 0x04, 0x31, 0x2d, 0x0f, 0xfc, 0x06, 0xfd, 0xe7, 0xe8, 0x03, 0x27, 0x12,
-    0xf9, 0xfa, 0x1a, 0x1a, 0x07, 0xfc, 0xf3, 0xfb, 0xfd, 0x01, 0x13, 0x11, 0xf6, 0x0c, 0x0c, 0x29,
-    0x04, 0x13, 0xd1, 0xf7, 0x06, 0x03, 0x0e, 0xfd, 0xfa, 0x0f, 0xfe, 0xe7, 0x02, 0xef, 0xe8, 0xf9,
-    0xf2, 0x0d, 0x28, 0xff, 0x05, 0x01, 0xf4, 0xec, 0xf1, 0x0a, 0xfc, 0xe8, 0xd1, 0x05, 0x1a, 0x08,
-    0xf9, 0x1e, 0xf0, 0xff, 0x0d, 0x04, 0xeb, 0xea, 0xdd, 0xf8, 0x1c, 0x1d, 0x05, 0xf5, 0x06, 0xfc,
-    0xfe, 0xf6, 0xf2, 0x05, 0x02, 0x06, 0x07, 0x00, 0xff, 0xfc, 0xe1, 0xf0, 0xf0, 0x02, 0x05, 0xec,
-    0x19, 0x04, 0xfc, 0xf5, 0xf7, 0x06, 0xf1, 0x09, 0xfe, 0xff, 0x0a, 0xf2, 0x02, 0xff, 0xff, 0xfa,
-    0xf7, 0x0a, 0x0e, 0x06, 0xc8, 0xd8, 0xdf, 0xfc, 0x0b, 0x00, 0x0e, 0x08, 0xff, 0x03, 0x10, 0x04,
-    0x09, 0x0e, 0xf5, 0xea, 0x02, 0x0b, 0xf7, 0x10, 0x03, 0x37, 0xf9, 0x0d, 0x11, 0x15, 0x1e, 0x12,
-    0x03, 0xf9, 0xf5, 0x1b, 0x09, 0xfe, 0x15, 0x13, 0x10, 0x19, 0x06, 0x34, 0x07, 0x13, 0x05, 0x1f,
-    0x00, 0xdb, 0x04, 0xff, 0xec, 0xf1, 0xeb, 0xf5, 0xf8, 0xf9, 0x20, 0xfd, 0xfb, 0xf0, 0xf6, 0xfa,
-    0xfb, 0xef, 0x10, 0xe6, 0xe1, 0x01, 0x1c, 0x09, 0xf8, 0xea, 0xfa, 0x03, 0x10, 0x01, 0x04, 0xe9,
-    0xf6, 0x0d, 0x14, 0x00, 0xfc, 0x10, 0x06, 0x01, 0x1e, 0xfa, 0xee, 0x1f, 0xf0, 0xf5, 0x00, 0xf7,
-    0x0b, 0x0f, 0xf8, 0x06, 0xf1, 0x16, 0xf9, 0x1d, 0x12, 0x04, 0xf9, 0x0f, 0xf4, 0x0e, 0xea, 0xe6,
-    0x0a, 0x18, 0x0a, 0xf6, 0xfd, 0xfa, 0xed, 0xca, 0xf3, 0x05, 0x0e, 0xf8, 0xf9, 0x06, 0x09, 0xf5,
-    0xf0, 0xf9, 0xfd, 0x00, 0xfb, 0x0a, 0x01, 0xfc, 0xf5, 0xf7, 0xe4, 0xef, 0x08, 0xff, 0x02, 0xff,
-    0xf7, 0x05, 0x10, 0xf7, 0xf4, 0x06, 0x0a, 0x0b, 0xfa, 0x09, 0xee, 0xf8, 0xf2, 0x05, 0x0d, 0x08,
-    0xfd, 0xff, 0xf4, 0xfe, 0xfb, 0xf8, 0xf8, 0x01, 0x09, 0xf7, 0x0c, 0x0b, 0x02, 0xfb, 0xfd, 0x0e,
-    0x03, 0xfb, 0x07, 0xf2, 0xff, 0x08, 0x14, 0x06, 0x0e, 0x24, 0xfa, 0x0e, 0xfd, 0x00, 0x02, 0xff,
-    0xfa, 0x23, 0x06, 0x0d, 0x02, 0x10, 0x0a, 0xff, 0x10, 0x0f, 0x0a, 0x36, 0xfe, 0x03, 0x18, 0x1f,
-    0x2e, 0x1e, 0x17, 0x09, 0x0f, 0x09, 0x03, 0xe2, 0x04, 0xbe, 0x98, 0xca, 0xe5, 0xfb, 0xf5, 0xfd,
-    0xf7, 0xe9, 0xeb, 0xea, 0x09, 0xc1, 0xbe, 0xaf, 0xbb, 0xd3, 0xdc, 0xdd, 0xf4, 0xfa, 0xf0, 0xd4,
-    0xf7, 0x12, 0x1e, 0x05, 0xff, 0xf5, 0xf5, 0xfd, 0xf0, 0xe3, 0x08, 0xf8, 0x08, 0x18, 0x16, 0x21,
-    0x13, 0x0e, 0x07, 0xf6, 0xf7, 0x03, 0xe9, 0xec, 0x0b, 0x08, 0x02, 0x09, 0xf2, 0x0f, 0x17, 0x0a,
-    0x00, 0xf3, 0xf9, 0x04, 0x0b, 0x06, 0x00, 0x00, 0x05, 0xff, 0x0e, 0xe0, 0x00, 0xfb, 0xff, 0xfc,
-    0x01, 0x07, 0xe3, 0xdb, 0xeb, 0xf0, 0xf9, 0x03, 0xff, 0x00, 0x06, 0x1a, 0x13, 0x21, 0x17, 0x17,
-    0x22, 0x06, 0xf3, 0x16, 0x15, 0x0f, 0x03, 0xf2, 0x07, 0x0c, 0x08, 0x08, 0x07, 0x1f, 0x0e, 0x00,
-    0x1e, 0x18, 0x15, 0x17, 0x05, 0x16, 0x00, 0x17, 0x2a, 0xf3, 0x0b, 0x01, 0x00, 0x03, 0x1a, 0x30,
-    0x05, 0x1a, 0x1f, 0xdc, 0xe6, 0xe4, 0x0b, 0xe8, 0xfd, 0xe8, 0xd7, 0x05, 0xf8, 0x0b, 0xf3, 0xf7,
-    0x04, 0x06, 0x02, 0xfa, 0xf9, 0xeb, 0x0d, 0x0d, 0x00, 0xf0, 0xf2, 0x08, 0x16, 0x0b, 0xf9, 0xfb,
-    0xee, 0x04, 0x0a, 0xf5, 0x08, 0x03, 0xea, 0x06, 0x0d, 0x02, 0xf5, 0xf9, 0x0e, 0x01, 0x1a, 0x12,
-    0xfe, 0x06, 0x04, 0xf8, 0xfc, 0xf1, 0xfb, 0xf9, 0x0b, 0xfa, 0xe8, 0x00, 0x08, 0xee, 0x02, 0x09,
-    0x0c, 0x06, 0x07, 0xf7, 0xf4, 0xff, 0xea, 0x0f, 0x00, 0xfd, 0x0d, 0xf4, 0xed, 0x10, 0xe8, 0xf8,
-    0xfb, 0xf9, 0x0e, 0xff, 0xff, 0xfb, 0xfb, 0xf7, 0x01, 0x0b, 0xf0, 0xee, 0xfc, 0x06, 0xfd, 0xfd,
-    0x0b, 0xff, 0xe7, 0x02, 0xf5, 0xfb, 0xff, 0xf9, 0xf6, 0xec, 0xff, 0xe6, 0xd9, 0x0c, 0xdc, 0x00,
-    0xf7, 0xec, 0x04, 0x15, 0x03, 0xfd, 0x02, 0xe1, 0xee, 0x12, 0xf7, 0xf2, 0xe3, 0xec, 0x01, 0x0a,
-    0xea, 0xf7, 0xfe, 0xfe, 0xfb, 0x0f, 0x1e, 0xff, 0xfd, 0xe2, 0xbc, 0xe0, 0xe1, 0x0a, 0xfd, 0x17,
-    0x08, 0xf4, 0x10, 0x0d, 0x01, 0x14, 0x02, 0xf9, 0xff, 0x0f, 0x1a, 0xd4, 0xf3, 0x07, 0x06, 0x1c,
-    0x09, 0x02, 0x26, 0x06, 0x01, 0xf2, 0xe7, 0xdd, 0x08, 0xf0, 0xe1, 0x01, 0x1c, 0x2e, 0x13, 0x06,
-    0xeb, 0xe7, 0xe0, 0xad, 0xfe, 0xfb, 0xdd, 0xfa, 0x00, 0x17, 0x04, 0x1d, 0x0e, 0x05, 0xee, 0x03,
-    0xff, 0xf6, 0x0e, 0x0a, 0xd7, 0xf9, 0xfd, 0xfe, 0x1a, 0x09, 0x09, 0x08, 0x03, 0xf2, 0x0a, 0xfb,
-    0x09, 0x13, 0x03, 0x05, 0x0f, 0x1c, 0x11, 0x1e, 0xfe, 0x07, 0x07, 0x19, 0xf8, 0x0f, 0x01, 0x17,
-    0x0c, 0xe9, 0x0c, 0xf9, 0xfd, 0xf5, 0x03, 0x0d, 0x09, 0x02, 0xfe, 0x05, 0x0b, 0xfd, 0xfb, 0x00,
-    0xf7, 0x10, 0x08, 0xf1, 0x14, 0x07, 0x1b, 0x19, 0x0d, 0x10, 0x21, 0xf1, 0x01, 0xfa, 0xf3, 0xfd,
-    0xf8, 0x13, 0x13, 0x12, 0x0c, 0x10, 0xee, 0x19, 0xf3, 0xec, 0xe7, 0xd4, 0xd2, 0xef, 0x10, 0x05,
-    0x05, 0xf7, 0xe0, 0x17, 0xff, 0xf6, 0xaf, 0xce, 0xe8, 0x21, 0x09, 0xf8, 0xf5, 0xe0, 0xe1, 0xe8,
-    0xfa, 0x09, 0xe0, 0xf6, 0x15, 0x0e, 0x04, 0x0e, 0x13, 0x03, 0xd4, 0xd5, 0x09, 0x1b, 0xf4, 0xef,
-    0xf9, 0x06, 0x0e, 0x14, 0x09, 0xff, 0x09, 0x35, 0x09, 0xec, 0xf5, 0xf7, 0xeb, 0xfa, 0xf8, 0x08,
-    0x17, 0x0c, 0x1e, 0x1c, 0x0a, 0x1f, 0xf9, 0x01, 0x05, 0x19, 0x15, 0xff, 0xeb, 0x06, 0x15, 0x04,
-    0x02, 0x03, 0x04, 0xf7, 0x00, 0x1d, 0xfc, 0x0a, 0x04, 0x16, 0x03, 0xfe, 0x00, 0xe6, 0xfa, 0xf9,
-    0x04, 0x0d, 0x0b, 0x13, 0x0d, 0x1f, 0x0b, 0xdf, 0x07, 0x0b, 0xff, 0x0e, 0x08, 0x1e, 0x03, 0x1a,
-    0x05, 0xfc, 0x07, 0xfe, 0xfe, 0xfa, 0xf4, 0x0a, 0xf4, 0xfd, 0xfb, 0xea, 0xf7, 0x04, 0xf9, 0x05,
-    0x0a, 0x36, 0x16, 0x18, 0x19, 0x1a, 0x08, 0xfa, 0x02, 0x09, 0x01, 0x2d, 0x07, 0x28, 0x17, 0xf4,
-    0x1b, 0x07, 0xf4, 0xf8, 0xe7, 0x10, 0x07, 0x0e, 0xf3, 0x01, 0xe0, 0xe3, 0xcf, 0xd9, 0xe6, 0xeb,
-    0xff, 0xf6, 0xfa, 0xfa, 0xf9, 0xc1, 0xe3, 0xfe, 0x0a, 0xfb, 0x11, 0x08, 0x09, 0xf0, 0x0c, 0xf6,
-    0x04, 0x0d, 0x11, 0x07, 0x00, 0xf5, 0x12, 0xf5, 0x02, 0x08, 0xf4, 0xfa, 0x0d, 0x0f, 0x0a, 0xf3,
-    0x02, 0xf5, 0x02, 0xff, 0xfb, 0x01, 0x12, 0xf2, 0xf8, 0x00, 0xe6, 0x0b, 0xfe, 0xfd, 0xe1, 0xfe,
-    0x14, 0x14, 0x12, 0x27, 0xfe, 0xe1, 0xfe, 0x09, 0x0b, 0xd6, 0xd7, 0xe9, 0x09, 0x0d, 0x28, 0x3f,
-    0xf4, 0xfd, 0xef, 0xf2, 0x0b, 0x0d, 0x07, 0x08, 0x02, 0xfa, 0xfe, 0x0d, 0x04, 0xe0, 0xf5, 0x05,
-    0x18, 0x3f, 0x2b, 0x1e, 0x12, 0x03, 0xde, 0x9d, 0x0d, 0x03, 0xfe, 0x0a, 0x02, 0x0d, 0x25, 0x0f,
-    0xe9, 0xe2, 0xdd, 0xf5, 0xf8, 0xfe, 0x04, 0xf9, 0x03, 0x01, 0xfc, 0xfc, 0x01, 0x01, 0x09, 0xfa,
-    0x03, 0xe3, 0xf4, 0x05, 0xf5, 0xfc, 0xeb, 0xeb, 0xe3, 0xe7, 0xf7, 0x0c, 0xfb, 0xed, 0xfd, 0xe2,
-    0xef, 0xff, 0xf3, 0xfe, 0x0c, 0x1d, 0x11, 0xe9, 0xfe, 0xd6, 0xf5, 0xfc, 0x1c, 0x04, 0x03, 0x14,
-    0x2c, 0x15, 0x13, 0x0f, 0x0b, 0x1d, 0xed, 0x16, 0x17, 0x03, 0xfb, 0x1a, 0xee, 0xe4, 0xd4, 0xeb,
-    0x08, 0x0c, 0x00, 0x10, 0x15, 0x15, 0xfd, 0xe6, 0xf6, 0xf5, 0xef, 0xdc, 0xff, 0xf5, 0xea, 0x0b,
-    0x24, 0x18, 0x03, 0x0e, 0xf7, 0x30, 0x0c, 0x14, 0xf5, 0x0e, 0x0b, 0xe7, 0xf9, 0x0e, 0xfb, 0xfb,
-    0x0b, 0x1b, 0x14, 0x0e, 0x0c, 0xff, 0x03, 0xe6, 0xfd, 0x0b, 0xfe, 0xfe, 0x17, 0x0d, 0x01, 0xd4,
-    0x07, 0x09, 0xe4, 0x08, 0x02, 0x18, 0x08, 0x19, 0x0e, 0x04, 0xe4, 0x19, 0x0d, 0x00, 0x00, 0xf2,
-    0xf9, 0x04, 0x0a, 0x14, 0xfc, 0xd8, 0xc8, 0xf8, 0x02, 0x31, 0xde, 0xf4, 0x11, 0xfc, 0x0e, 0x02,
-    0xfa, 0xb9, 0xb4, 0xf6, 0xff, 0x03, 0xfe, 0xf5, 0xf2, 0x04, 0x08, 0x02, 0xfe, 0x02, 0x02, 0xfb,
-    0x0e, 0x0b, 0x24, 0x0d, 0x03, 0x00, 0x04, 0x12, 0x14, 0x10, 0x19, 0x23, 0x0e, 0x04, 0x1b, 0x1c,
-    0x0c, 0x14, 0x1d, 0x0b, 0x0a, 0x01, 0xee, 0xf2, 0x0f, 0x05, 0xf7, 0x09, 0x1d, 0x14, 0x01, 0x06,
-    0x35, 0x18, 0xfc, 0xf9, 0x08, 0xf9, 0x05, 0x01, 0xf7, 0xf7, 0x17, 0x1d, 0x27, 0xef, 0x0d, 0x32,
-    0x0a, 0x27, 0x0e, 0xee, 0xe9, 0xe7, 0xe4, 0xf2, 0xec, 0xf6, 0x19, 0xf2, 0xf9, 0x09, 0xfb, 0x15,
-    0xfb, 0xec, 0xe7, 0x00, 0x0b, 0x04, 0xfd, 0x01, 0x00, 0xfd, 0xeb, 0x19, 0x19, 0xe8, 0x03, 0x0e,
-    0x02, 0x06, 0x22, 0xfe, 0x09, 0xda, 0x02, 0x07, 0xf6, 0xff, 0xfb, 0x05, 0xf6, 0x0d, 0x0a, 0xf8,
-    0xf7, 0x18, 0xf8, 0xe9, 0xdb, 0xc0, 0xdb, 0x07, 0x0d, 0x0f, 0xfd, 0x1f, 0xfd, 0x06, 0x01, 0x03,
-    0xf8, 0xdb, 0xee, 0xff, 0xf6, 0x00, 0xf8, 0x0e, 0xff, 0x15, 0xad, 0xf5, 0x0c, 0x08, 0x0e, 0xef,
-    0x0d, 0xfe, 0x05, 0xfa, 0xf3, 0xfe, 0x08, 0x0b, 0xed, 0xff, 0xfc, 0x27, 0xfc, 0xff, 0xf7, 0x05,
-    0xf7, 0x05, 0x14, 0x06, 0xf6, 0xe2, 0xfe, 0x1f, 0x1d, 0x36, 0x0b, 0x0e, 0xe7, 0xf0, 0xed, 0xee,
-    0xe9, 0xe5, 0xf2, 0x03, 0x10, 0x2f, 0x3b, 0xf9, 0xeb, 0xdc, 0xef, 0xeb, 0x10, 0xf4, 0xdf, 0xed,
-    0xfe, 0x25, 0x21, 0x18, 0xfd, 0xe6, 0xfc, 0x0e, 0xf2, 0xcf, 0xd6, 0xfc, 0x11, 0x1e, 0x2a, 0x18,
-    0x04, 0xf4, 0xfe, 0x0f, 0x06, 0xf8, 0xef, 0x02, 0x10, 0x04, 0xf1, 0xd3, 0x04, 0xf9, 0x06, 0x09,
-    0xf6, 0x01, 0x07, 0x15, 0x0a, 0xfd, 0xef, 0x0f, 0x0b, 0x1c, 0x0e, 0xf4, 0x0c, 0xfc, 0xfd, 0x0b,
-    0xe6, 0xf5, 0xfe, 0x31, 0x08, 0x10, 0x06, 0xfe, 0x02, 0xfd, 0xff, 0x0f, 0x06, 0xff, 0xfb, 0xbb,
-    0xf6, 0xf2, 0x02, 0xf9, 0xfb, 0x09, 0x0a, 0xfc, 0xf6, 0xf3, 0x0c, 0xf4, 0xf4, 0xfa, 0x03, 0x03,
-    0x04, 0xf8, 0x07, 0x03, 0xfe, 0xf4, 0xf0, 0xdb, 0x07, 0xf2, 0x06, 0xf5, 0x0f, 0x0a, 0x01, 0xf1,
-    0x02, 0xe9, 0x1e, 0xfc, 0x03, 0xf7, 0xf4, 0xf8, 0xfb, 0x05, 0xf5, 0x11, 0x06, 0x05, 0x0b, 0x09,
-    0x07, 0xe1, 0xe9, 0x19, 0xf3, 0x05, 0x04, 0x06, 0x18, 0x12, 0x02, 0x1c, 0xf7, 0xf7, 0xf6, 0xff,
-    0x11, 0x0d, 0x03, 0xfa, 0x0f, 0xf5, 0xf8, 0xee, 0x14, 0x00, 0xe5, 0x11, 0x0d, 0xef, 0x0e, 0x07,
-    0x0a, 0x18, 0x0b, 0x08, 0x07, 0xde, 0x00, 0x03, 0xf0, 0x12, 0x11, 0xf6, 0x11, 0xfb, 0x0c, 0x28,
-    0xf7, 0xf9, 0x0b, 0x07, 0x10, 0x25, 0x0f, 0x01, 0xfe, 0xfa, 0xd6, 0xde, 0xfc, 0xd1, 0xdc, 0xf2,
-    0xf2, 0x01, 0x20, 0x04, 0xfe, 0xfb, 0xdb, 0xf7, 0x0c, 0xd5, 0xe0, 0xfd, 0xdf, 0xfa, 0x0e, 0x0d,
-    0x03, 0xff, 0xf6, 0x05, 0xf6, 0xe3, 0xef, 0xeb, 0xe9, 0x0e, 0x00, 0xf8, 0xe6, 0xe2, 0xf8, 0x0c,
-    0xfc, 0x0c, 0xea, 0xf4, 0xe9, 0xee, 0xe5, 0xe5, 0xf4, 0x08, 0xfc, 0xfa, 0xf4, 0xfc, 0x04, 0x07,
-    0x1c, 0xfc, 0x17, 0x18, 0x1f, 0x1e, 0xe4, 0xe4, 0x03, 0xff, 0x04, 0xdb, 0x0a, 0xf5, 0x01, 0x06,
-    0xf5, 0x01, 0xc7, 0x0d, 0xf5, 0x03, 0xfe, 0x04, 0xfc, 0xf8, 0xf8, 0x16, 0x04, 0xea, 0x02, 0x0d,
-    0x0e, 0xee, 0x21, 0x07, 0xe4, 0xf5, 0xf5, 0x11, 0x20, 0x1b, 0x0a, 0xf8, 0xfc, 0xe3, 0x11, 0x18,
-    0xee, 0xde, 0xf9, 0x1d, 0x0f, 0x15, 0x01, 0x17, 0x0c, 0xec, 0x12, 0x05, 0x03, 0xf1, 0xfc, 0x10,
-    0x1e, 0x0e, 0x08, 0xd9, 0xfa, 0x0e, 0x0b, 0xfc, 0x04, 0xfa, 0xff, 0xfe, 0x09, 0x00, 0x1a, 0xce,
-    0x02, 0x02, 0x0a, 0xef, 0x03, 0x07, 0x0d, 0x11, 0x1b, 0x0c, 0xf4, 0xe0, 0xfe, 0xf5, 0x0f, 0x00,
-    0x06, 0x02, 0x06, 0xfe, 0xf9, 0xf2, 0xf6, 0x1f, 0xfe, 0xd0, 0xea, 0x0c, 0x0a, 0x1a, 0xf5, 0xff,
-    0xef, 0x08, 0x13, 0x1f, 0x0b, 0xd8, 0xe4, 0x0b, 0x08, 0x0a, 0xec, 0xeb, 0xeb, 0x05, 0xdb, 0x2c,
-    0xf5, 0xfb, 0x0d, 0x19, 0x11, 0xea, 0xc2, 0xe9, 0xe4, 0xeb, 0xf6, 0x0e, 0x05, 0xcc, 0xe2, 0xee,
-    0xe5, 0xf4, 0xe8, 0xdf, 0x00, 0xf3, 0xf7, 0xf2, 0xfd, 0xdb, 0x09, 0x1e, 0xfa, 0x04, 0xce, 0xd0,
-    0xf0, 0x02, 0xec, 0xf4, 0xfd, 0x04, 0xfb, 0xfe, 0xfa, 0x00, 0x14, 0xfc, 0xfd, 0xfe, 0x0a, 0x09,
-    0x11, 0x2f, 0x0f, 0x17, 0x07, 0x15, 0x03, 0xf0, 0xf7, 0xfd, 0x0f, 0x10, 0x10, 0x1d, 0x05, 0x02,
-    0x00, 0x10, 0x01, 0xf5, 0x08, 0x03, 0x0c, 0x0c, 0xf6, 0xf9, 0xff, 0xf2, 0x0e, 0xf9, 0x0b, 0xf5,
-    0xf6, 0x06, 0x09, 0xf9, 0x0b, 0x15, 0x02, 0xff, 0x0a, 0x0a, 0x0d, 0x03, 0xf9, 0xff, 0x1b, 0xd5,
-    0x07, 0x0c, 0xfd, 0x08, 0x0a, 0x11, 0xfa, 0x07, 0xfe, 0x17, 0x17, 0xf8, 0x04, 0xff, 0x01, 0x07,
-    0x0a, 0xf1, 0x0d, 0x18, 0x23, 0x1d, 0x06, 0x03, 0xf9, 0xdd, 0x01, 0x21, 0x1d, 0x01, 0x1b, 0x12,
-    0x16, 0x14, 0x29, 0xff, 0x02, 0xf5, 0x01, 0x11, 0x00, 0x09, 0x09, 0xf1, 0xef, 0xf5, 0xd8, 0xf6,
-    0x04, 0xe3, 0xf9, 0xf2, 0xe1, 0x06, 0xf7, 0xef, 0xcb, 0xd8, 0xc4, 0xec, 0x0a, 0x00, 0xda, 0xdd,
-    0xf9, 0xe4, 0xfe, 0xf0, 0xff, 0xf2, 0xc6, 0xdd, 0xf5, 0x03, 0xf1, 0xe6, 0x07, 0xfe, 0x13, 0x03,
-    0x03, 0xf1, 0xd1, 0x09, 0xf7, 0xfd, 0x02, 0xfc, 0xf8, 0xf7, 0x15, 0xe0, 0x03, 0x18, 0x02, 0x00,
-    0x06, 0xef, 0x33, 0x1b, 0x25, 0x19, 0x1e, 0x01, 0x0a, 0x0e, 0x1d, 0xf0, 0x17, 0x0e, 0xf7, 0xf3,
-    0x02, 0x10, 0x0c, 0x0d, 0x18, 0x1b, 0x0a, 0x0e, 0x0a, 0xe0, 0xef, 0xe5, 0xea, 0xf5, 0xf0, 0xe6,
-    0x06, 0xfc, 0xfb, 0x25, 0xf3, 0x25, 0x08, 0x08, 0x09, 0xf6, 0xf2, 0xf3, 0xfa, 0xf7, 0xeb, 0xe6,
-    0x0b, 0x2e, 0x04, 0xff, 0xf0, 0xe5, 0xe8, 0xf7, 0x08, 0x0b, 0xf0, 0xe0, 0x06, 0xea, 0xe7, 0xea,
-    0xf1, 0xf6, 0xf1, 0xfa, 0xfd, 0x01, 0xfc, 0xec, 0x08, 0xda, 0xda, 0x0f, 0x00, 0xf6, 0xf2, 0xfb,
-    0x07, 0x00, 0xf6, 0xcf, 0x02, 0x0e, 0x03, 0x07, 0x01, 0x09, 0xf5, 0xe5, 0xcf, 0xbd, 0xb3, 0xa9,
-    0xf9, 0x0d, 0xfa, 0x12, 0x04, 0xee, 0x07, 0x00, 0xf3, 0x04, 0xeb, 0x0c, 0xfa, 0xfd, 0x0e, 0xef,
-    0x0a, 0x0c, 0x01, 0x33, 0x19, 0x07, 0x2d, 0x11, 0x00, 0x0c, 0x06, 0x08, 0x01, 0xff, 0x06, 0xf8,
-    0x12, 0x1b, 0xf9, 0x01, 0xfc, 0xfe, 0xfb, 0x07, 0xec, 0x0d, 0x06, 0x01, 0xfa, 0x00, 0xfb, 0x0d,
-    0x0c, 0x05, 0xf6, 0x07, 0x03, 0xf6, 0x03, 0xf1, 0x0e, 0x05, 0x09, 0xef, 0x0a, 0x01, 0x19, 0xef,
-    0x06, 0xff, 0xf7, 0xf2, 0x05, 0x0a, 0x05, 0x05, 0x11, 0x0e, 0xf5, 0xfc, 0xf5, 0xfc, 0xec, 0xfc,
-    0xfe, 0x13, 0x2d, 0x25, 0x0b, 0xd3, 0xd5, 0xed, 0xfe, 0x23, 0x08, 0xd9, 0x12, 0x0d, 0x13, 0x2d,
-    0xfc, 0x03, 0xf5, 0x17, 0x25, 0x10, 0xe6, 0xd2, 0xf7, 0x13, 0x08, 0x22, 0xfd, 0xf9, 0x13, 0x1b,
-    0xf8, 0xf3, 0xd7, 0xe7, 0x05, 0xfb, 0xf1, 0xcd, 0xfc, 0xfa, 0x09, 0x0c, 0xf8, 0xee, 0xeb, 0xf0,
-    0xfa, 0x01, 0x13, 0x06, 0xf6, 0x0b, 0xf2, 0xf7, 0xf4, 0xed, 0x07, 0x1d, 0x15, 0x22, 0x1c, 0x12,
-    0x01, 0xfd, 0xf1, 0xfe, 0xf5, 0x1b, 0x0c, 0x05, 0x0d, 0x05, 0x26, 0x1c, 0x0a, 0x0a, 0x0c, 0xff,
-    0x00, 0x00, 0xe5, 0xff, 0xfc, 0xf3, 0x07, 0x3d, 0xf8, 0xff, 0x18, 0xe9, 0xf7, 0xf9, 0xf6, 0x02,
-    0xe6, 0xeb, 0x10, 0x08, 0x0a, 0x0b, 0x02, 0xff, 0x0d, 0x0c, 0xfc, 0xf3, 0x02, 0x17, 0xf4, 0xf9,
-    0x05, 0x10, 0x14, 0x1b, 0xe9, 0xe4, 0xf1, 0xf3, 0x0d, 0x0f, 0x11, 0x0e, 0xff, 0xed, 0x18, 0x11,
-    0x07, 0xd6, 0xd8, 0x0d, 0xff, 0x06, 0x00, 0x03, 0xef, 0x0a, 0x27, 0xfe, 0x0c, 0xe1, 0xcc, 0x10,
-    0xf2, 0xf6, 0xf8, 0x04, 0x0c, 0xff, 0x0d, 0x08, 0x13, 0x07, 0x10, 0xf9, 0x06, 0x17, 0x24, 0xee,
-    0x06, 0x11, 0xe7, 0xe8, 0x06, 0x1d, 0x07, 0xdb, 0xe9, 0x15, 0x15, 0xeb, 0x0a, 0xf1, 0x0b, 0x05,
-    0xfa, 0x03, 0x09, 0x10, 0xf1, 0xd2, 0xfa, 0x17, 0xf7, 0xf3, 0x08, 0x05, 0xf3, 0x0b, 0x18, 0xf7,
-    0x08, 0xdc, 0xfe, 0xfc, 0xf4, 0x0c, 0x04, 0x10, 0xef, 0x08, 0x04, 0x00, 0x03, 0x0b, 0xff, 0x0d,
-    0xf6, 0x14, 0x0c, 0xf1, 0xee, 0x17, 0x08, 0x07, 0x14, 0xf4, 0x0a, 0xfe, 0x07, 0x15, 0x14, 0x1a,
-    0x01, 0xed, 0x0b, 0x07, 0x1a, 0x19, 0x09, 0x1e, 0xfe, 0xe0, 0xfb, 0xee, 0xe5, 0x07, 0x04, 0xe3,
-    0xde, 0x01, 0x1f, 0xfb, 0xf9, 0xf6, 0x08, 0x02, 0x03, 0xf9, 0xf3, 0x0b, 0x00, 0xfc, 0xfa, 0xfa,
-    0xf2, 0x08, 0xfb, 0x05, 0x15, 0x02, 0x06, 0xfc, 0x0f, 0x07, 0x2f, 0x02, 0xf9, 0x0f, 0x08, 0xe6,
-    0xdf, 0x0f, 0xfe, 0x0e, 0x1e, 0xfb, 0x0a, 0x0e, 0xf5, 0xf6, 0xef, 0xda, 0xe7, 0xff, 0x0a, 0xe9,
-    0xed, 0xeb, 0xd9, 0x05, 0x07, 0xe8, 0x13, 0xfe, 0x02, 0xfb, 0xfa, 0x1c, 0xfa, 0x0a, 0xf6, 0xe1,
-    0xfb, 0xf3, 0x1d, 0x18, 0xec, 0xf8, 0x04, 0x14, 0x1e, 0x09, 0x02, 0x0a, 0xff, 0x17, 0xfc, 0x0c,
-    0x05, 0xf9, 0x11, 0x14, 0x17, 0x13, 0x12, 0x04, 0xfa, 0xf4, 0x02, 0x2c, 0x07, 0xf3, 0x15, 0x0c,
-    0x20, 0x15, 0x1e, 0x22, 0xf3, 0xf2, 0xf9, 0x24, 0x03, 0xed, 0xef, 0x03, 0xe8, 0x03, 0x18, 0xf6,
-    0xf4, 0xf1, 0xf4, 0x08, 0xf9, 0xff, 0x07, 0xe9, 0xf2, 0x07, 0xfa, 0x0f, 0x04, 0xff, 0xf0, 0x05,
-    0xfe, 0x0b, 0x0d, 0x0e, 0x10, 0x06, 0x0d, 0x04, 0xfb, 0xe2, 0x0d, 0xee, 0x09, 0x0a, 0x18, 0xf5,
-    0xfa, 0x13, 0xff, 0x08, 0x02, 0xfb, 0xfe, 0xfa, 0xff, 0xfd, 0x07, 0x11, 0x08, 0x0c, 0x0b, 0xf8,
-    0xf5, 0xd1, 0xc0, 0xa4, 0xe0, 0xef, 0x0d, 0xfc, 0x01, 0x10, 0xfd, 0xfd, 0x0b, 0x18, 0xd3, 0xb9,
-    0x01, 0xfd, 0x06, 0x00, 0x11, 0xff, 0x19, 0xf9, 0xfd, 0xde, 0xb7, 0xc7, 0x1c, 0x2b, 0x0f, 0xdb,
-    0xd8, 0xda, 0xf2, 0x37, 0xf6, 0xfb, 0xbe, 0x07, 0x1d, 0x1b, 0x0c, 0xf1, 0xfd, 0xe8, 0x14, 0x01,
-    0xfe, 0xdc, 0xd3, 0x02, 0x1f, 0x1a, 0x1c, 0x06, 0xe4, 0x18, 0x0b, 0x2a, 0x08, 0xec, 0x0c, 0x21,
-    0x1f, 0xfb, 0xff, 0xf5, 0xff, 0x00, 0x1c, 0x15, 0x05, 0xdf, 0x02, 0x29, 0xf1, 0xf2, 0xef, 0xff,
-    0xf0, 0xf9, 0xff, 0x0d, 0x03, 0xf4, 0x1b, 0x01, 0xec, 0xed, 0xdf, 0xf8, 0xfe, 0x02, 0xff, 0xf1,
-    0xf6, 0x09, 0x04, 0x06, 0xf3, 0x00, 0xfd, 0xea, 0xf7, 0xf8, 0x0b, 0x04, 0xfd, 0x0d, 0x05, 0x02,
-    0x1f, 0x00, 0xef, 0xe6, 0xe7, 0xf2, 0xd9, 0x06, 0x0b, 0x0a, 0x08, 0x13, 0x02, 0xfc, 0x04, 0x1a,
-    0xf0, 0x1a, 0x09, 0xfb, 0x01, 0xfa, 0xf7, 0x0a, 0x01, 0x06, 0x02, 0x1d, 0xf9, 0xeb, 0xfb, 0x08,
-    0x06, 0x2d, 0x10, 0x09, 0x0b, 0x03, 0xe3, 0xf7, 0xfb, 0xea, 0x16, 0xfe, 0x1c, 0xea, 0xfc, 0x17,
-    0x02, 0xf9, 0xfd, 0x01, 0x0c, 0xf4, 0x1f, 0x01, 0x0a, 0xf7, 0x09, 0x1f, 0x10, 0x1b, 0xf9, 0xed,
-    0xff, 0x11, 0x1c, 0x00, 0xfd, 0x26, 0x31, 0x27, 0x13, 0xf6, 0xc7, 0xed, 0xf8, 0x05, 0x13, 0xee,
-    0xfc, 0x1d, 0x16, 0xfa, 0xe3, 0xce, 0xfd, 0xfb, 0x06, 0xee, 0x00, 0x15, 0xf9, 0x16, 0x07, 0xf1,
-    0xd2, 0xe3, 0x04, 0x09, 0x07, 0x05, 0xe2, 0xf4, 0x0a, 0x08, 0xdf, 0xdd, 0xf2, 0xfa, 0x00, 0x13,
-    0xf8, 0xf8, 0xf4, 0xea, 0xf4, 0xf7, 0xe5, 0xde, 0xea, 0xfa, 0xf4, 0x02, 0xfd, 0xf8, 0x06, 0xf3,
-    0x09, 0x13, 0x18, 0xfd, 0x0a, 0xeb, 0xe8, 0xee, 0x05, 0x0e, 0x0b, 0xfb, 0xfd, 0x05, 0x16, 0x09,
-    0x10, 0x04, 0x09, 0x08, 0xfa, 0x0a, 0x05, 0xb2, 0x08, 0xee, 0x06, 0x08, 0xf3, 0x07, 0xf7, 0x13,
-    0x1a, 0xff, 0x0b, 0x06, 0x09, 0xf8, 0x0e, 0x06, 0x03, 0xfb, 0xf7, 0x22, 0x10, 0xf0, 0xf8, 0xf4,
-    0x03, 0xee, 0xb4, 0xf4, 0x0a, 0xfa, 0x07, 0x00, 0x1d, 0x23, 0x0f, 0xe4, 0x04, 0xf0, 0xe4, 0xfa,
-    0x1a, 0x01, 0x01, 0x06, 0x0b, 0x0d, 0x0d, 0xf0, 0xf5, 0xf4, 0x10, 0x0c, 0xea, 0xfc, 0x0e, 0x12,
-    0x10, 0x08, 0x00, 0xd9, 0x0b, 0xf4, 0xf8, 0xcd, 0xd4, 0xf6, 0x22, 0x15, 0x01, 0x0b, 0xe8, 0x12,
-    0xfc, 0xe4, 0xde, 0xd7, 0x07, 0x2d, 0x0f, 0xf4, 0xf9, 0xe0, 0xfc, 0xd6, 0xf5, 0xf5, 0xdc, 0x22,
-    0x2f, 0xfa, 0x07, 0x02, 0xff, 0xf5, 0x12, 0x02, 0x0a, 0xd1, 0xcd, 0x07, 0x15, 0x06, 0xfe, 0x13,
-    0x03, 0x03, 0xf7, 0x06, 0xff, 0xbb, 0xe4, 0xff, 0x13, 0xed, 0xff, 0x0f, 0xff, 0xfa, 0xf1, 0x2e,
-    0x02, 0xec, 0xe3, 0xdd, 0xec, 0x12, 0x0a, 0x2a, 0x0b, 0x0a, 0x0f, 0xe5, 0xfa, 0xfc, 0x0f, 0x05,
-    0xf5, 0x06, 0xfe, 0x0b, 0xfc, 0x07, 0xe8, 0xf0, 0xff, 0x07, 0xf7, 0x00, 0xf9, 0x09, 0x07, 0xfc,
-    0x0d, 0x0e, 0xdb, 0xf8, 0x02, 0xf3, 0x01, 0x0b, 0xf0, 0xfc, 0x1e, 0x1e, 0xfe, 0xfa, 0xfa, 0x01,
-    0x02, 0xf8, 0x1c, 0xfd, 0x18, 0x02, 0x07, 0xfa, 0xff, 0xef, 0xe0, 0xce, 0xfd, 0xe4, 0x02, 0xf9,
-    0x07, 0x10, 0xff, 0x0f, 0xe2, 0xed, 0xe7, 0xd2, 0x0d, 0x15, 0x1c, 0x12, 0x0a, 0x14, 0x11, 0x13,
-    0x07, 0xda, 0xe2, 0xde, 0xf8, 0xfc, 0xef, 0x11, 0x13, 0x01, 0x08, 0x25, 0xec, 0xbd, 0xde, 0x09,
-    0x01, 0xf4, 0xee, 0xff, 0xff, 0x16, 0x3c, 0x1d, 0x04, 0xc1, 0xe3, 0x1f, 0xfe, 0xef, 0x24, 0x08,
-    0x14, 0x15, 0x1f, 0x01, 0xcb, 0xc8, 0x01, 0x1e, 0x02, 0xe0, 0x0b, 0x0b, 0x0c, 0x03, 0x16, 0xdf,
-    0xea, 0xf1, 0xf1, 0x24, 0xf9, 0x0b, 0x17, 0xf9, 0x10, 0xf8, 0xe7, 0xe7, 0xc8, 0xef, 0xf5, 0xed,
-    0x01, 0xf4, 0x0d, 0x0e, 0x01, 0xf6, 0xff, 0xf5, 0xf4, 0xea, 0xe7, 0xdf, 0x0b, 0xe7, 0xfa, 0xf9,
-    0xf7, 0x09, 0x0c, 0xf9, 0xfd, 0xf6, 0x08, 0xc1, 0x00, 0x3d, 0xf3, 0x22, 0x0b, 0xfc, 0x11, 0x08,
-    0x14, 0xfc, 0xe8, 0xf6, 0x08, 0x02, 0xff, 0xfa, 0x01, 0xff, 0xf7, 0xec, 0x05, 0xf9, 0x04, 0xfb,
-    0x00, 0xbe, 0xf0, 0xd5, 0xeb, 0xfb, 0xef, 0xfa, 0xf8, 0xea, 0xef, 0x3a, 0xec, 0xff, 0xf1, 0xe9,
-    0xfc, 0xef, 0xff, 0x0f, 0x07, 0xfb, 0x1c, 0xf3, 0xf0, 0x00, 0xef, 0xff, 0x0d, 0x0c, 0x04, 0x26,
-    0x1f, 0x29, 0x31, 0x1b, 0x08, 0xf9, 0x1c, 0xfc, 0xed, 0xec, 0xe2, 0xd6, 0xe7, 0xd3, 0xec, 0x14,
-    0x09, 0xf3, 0x03, 0x04, 0xfe, 0x03, 0xf5, 0xe2, 0xd6, 0xa3, 0x9c, 0x81, 0x0b, 0x04, 0xf6, 0x09,
-    0xfa, 0x05, 0x08, 0x0d, 0xfa, 0xf6, 0x9c, 0xe0, 0x07, 0xf3, 0x0c, 0x06, 0x1f, 0xf0, 0x0a, 0xf2,
-    0xf2, 0x02, 0xf9, 0x0d, 0x0c, 0x06, 0x01, 0x0d, 0x11, 0x14, 0x02, 0x09, 0xfe, 0xf6, 0x0b, 0xd5,
-    0x0d, 0xf4, 0x08, 0x13, 0x11, 0xf8, 0x03, 0x01, 0x09, 0x18, 0xfe, 0x02, 0xfe, 0xee, 0x0e, 0x13,
-    0x0b, 0x0a, 0x03, 0x0d, 0x01, 0x0c, 0x21, 0xe7, 0xfe, 0x3a, 0xfc, 0x0a, 0xff, 0x0f, 0xfd, 0xfa,
-    0xfe, 0xe7, 0xf9, 0xfa, 0xf4, 0xfb, 0x08, 0x05, 0x09, 0x06, 0x07, 0xde, 0xfe, 0x13, 0xfa, 0xf6,
-    0x05, 0x09, 0xf3, 0xed, 0xe7, 0xe8, 0x1d, 0xfc, 0xf5, 0xf5, 0x02, 0xfc, 0x0b, 0xe4, 0xfa, 0xd9,
-    0xf4, 0xfd, 0x01, 0x0e, 0xdd, 0xfc, 0xf5, 0xfc, 0x0b, 0xfe, 0xe7, 0xd8, 0xe8, 0xff, 0x1a, 0x09,
-    0x03, 0x0b, 0x02, 0x06, 0x0d, 0xe2, 0xff, 0xe8, 0x07, 0xf2, 0xe3, 0xe6, 0xdc, 0xf0, 0xe8, 0x06,
-    0x0c, 0xf0, 0xfc, 0x17, 0xfd, 0x13, 0xef, 0xf6, 0xec, 0xea, 0xfc, 0x2e, 0x07, 0x0c, 0x0e, 0x17,
-    0x18, 0xfc, 0x02, 0x07, 0x05, 0x19, 0x29, 0xe0, 0xf7, 0x0c, 0x28, 0x0d, 0x07, 0xf7, 0x0a, 0x0d,
-    0x1a, 0x09, 0x29, 0xd7, 0x09, 0x12, 0x17, 0x1f, 0x05, 0x06, 0x1f, 0x22, 0x2d, 0x0f, 0x17, 0x0e,
-    0xfd, 0x21, 0x03, 0xfc, 0x0d, 0x12, 0xfc, 0x13, 0x04, 0xfd, 0xfa, 0xe6, 0xf3, 0xfd, 0xf6, 0xf2,
-    0x05, 0xeb, 0xec, 0xf0, 0x0c, 0x13, 0x2d, 0x02, 0x0d, 0x1f, 0xe7, 0x0b, 0x08, 0xfd, 0x03, 0xb6,
-    0xf5, 0x14, 0x1e, 0x08, 0xfe, 0xff, 0xf4, 0xf6, 0x03, 0x09, 0x14, 0x15, 0xfc, 0xfe, 0x07, 0x05,
-    0x08, 0x0d, 0xec, 0xf5, 0x04, 0x03, 0x05, 0xf4, 0xf8, 0x16, 0x0e, 0x32, 0x10, 0xe2, 0xee, 0xf3,
-    0x08, 0x13, 0x04, 0xf5, 0x04, 0x15, 0x1e, 0x02, 0x0c, 0x19, 0xfe, 0x01, 0xf8, 0x07, 0xeb, 0x0a,
-    0x0f, 0x1b, 0x12, 0x12, 0xf7, 0x12, 0xff, 0x0d, 0x10, 0x03, 0xe6, 0x03, 0x0c, 0x15, 0x0d, 0x09,
-    0x03, 0xf9, 0xfb, 0x0a, 0xf5, 0x00, 0xdf, 0xde, 0x0e, 0x0b, 0x22, 0x25, 0x07, 0x0f, 0xe9, 0x03,
-    0xff, 0xf8, 0xd7, 0xd8, 0x12, 0x1d, 0x20, 0x0d, 0xfb, 0xed, 0x07, 0xf9, 0xfc, 0x03, 0xc9, 0xfd,
-    0x27, 0x33, 0x16, 0x1d, 0xf9, 0xe9, 0xef, 0xee, 0xf2, 0xd5, 0xda, 0x26, 0x18, 0x07, 0x00, 0xed,
-    0x00, 0x08, 0xfe, 0xdb, 0xd4, 0x03, 0x1c, 0x12, 0x0a, 0x0b, 0x12, 0x09, 0xf4, 0xed, 0x01, 0xf9,
-    0x10, 0x0f, 0x05, 0x04, 0x19, 0x12, 0x15, 0x2f, 0xfb, 0x12, 0xe5, 0x0a, 0x02, 0xff, 0x07, 0xfe,
-    0x02, 0x12, 0x26, 0x02, 0x0c, 0xf9, 0xfc, 0x0a, 0x03, 0xfe, 0x0d, 0x11, 0x04, 0x0b, 0xf3, 0xff,
-    0x0e, 0x47, 0xe8, 0xec, 0x01, 0x09, 0xe7, 0xf9, 0x0e, 0x12, 0xfd, 0xef, 0xff, 0xed, 0xee, 0xf3,
-    0x08, 0xfc, 0x0e, 0x0b, 0x16, 0xf5, 0x10, 0x2d, 0xf9, 0x0c, 0x15, 0xfc, 0x12, 0x17, 0xfa, 0xef,
-    0xf3, 0x06, 0xfc, 0x16, 0xf5, 0xe6, 0x21, 0x05, 0xff, 0xf8, 0x23, 0x23, 0x14, 0xf9, 0xfa, 0x02,
-    0xfb, 0x10, 0x03, 0x10, 0x00, 0x03, 0x15, 0x1d, 0x1b, 0xed, 0xf5, 0xf9, 0x0b, 0x13, 0xf4, 0xea,
-    0xe7, 0xe1, 0x02, 0x32, 0xfd, 0xd1, 0xe7, 0x0b, 0xf4, 0xd1, 0xfa, 0xeb, 0xf1, 0x08, 0x08, 0xfe,
-    0xf0, 0xed, 0x05, 0xff, 0xf6, 0x11, 0x0d, 0xfc, 0x07, 0xff, 0x03, 0x08, 0xc9, 0xfb, 0x06, 0xeb,
-    0xf7, 0xf9, 0x08, 0x09, 0x10, 0xf7, 0x01, 0x01, 0xfe, 0xe1, 0x1e, 0x02, 0xf9, 0x1e, 0x1f, 0x0c,
-    0xf3, 0xed, 0xf9, 0xfe, 0xdb, 0x00, 0xfd, 0x07, 0x0b, 0x26, 0x03, 0xea, 0xe1, 0xeb, 0xee, 0x07,
-    0xf6, 0xe5, 0xf1, 0x07, 0xf7, 0xf9, 0x09, 0x07, 0x04, 0x03, 0x0c, 0xf0, 0x08, 0x10, 0x0d, 0xfb,
-    0x05, 0x0e, 0xfe, 0xff, 0x2b, 0x21, 0x0a, 0xf3, 0xe2, 0xe1, 0xf6, 0xbd, 0xe3, 0xeb, 0x17, 0x2e,
-    0x0e, 0xeb, 0x01, 0x06, 0x27, 0x0f, 0xf0, 0xf5, 0xf9, 0x10, 0x12, 0xeb, 0x07, 0xfc, 0x1a, 0x0e,
-    0x09, 0x15, 0xff, 0xfb, 0x07, 0x02, 0xf5, 0x08, 0x0f, 0x0a, 0xed, 0xef, 0xf9, 0xea, 0x20, 0x18,
-    0xf6, 0x22, 0xe2, 0xfa, 0xf8, 0x06, 0xf9, 0xf1, 0xe3, 0xef, 0x03, 0xfa, 0x07, 0x0d, 0x05, 0x01,
-    0xec, 0xfb, 0xdb, 0x11, 0x07, 0x05, 0x09, 0xef, 0x03, 0x1a, 0x05, 0xf2, 0xe8, 0xe0, 0xfa, 0x0f,
-    0x16, 0x10, 0xfd, 0x10, 0x0b, 0x35, 0x08, 0xf1, 0x11, 0x03, 0x06, 0xe5, 0xfb, 0xfd, 0x1d, 0x08,
-    0xfe, 0x11, 0x0c, 0x08, 0xf8, 0x0d, 0xfe, 0xf7, 0x07, 0xfe, 0xf7, 0x01, 0xfd, 0xd4, 0x22, 0xfe,
-    0xf9, 0x00, 0x1b, 0x02, 0xf9, 0xf0, 0x1e, 0x1f, 0xf9, 0xad, 0x08, 0x04, 0x1d, 0x06, 0xdc, 0xf2,
-    0x16, 0xf2, 0xf3, 0xff, 0x02, 0x05, 0xff, 0x05, 0xf7, 0xfe, 0x0f, 0xdc, 0xf1, 0x13, 0xfd, 0xf5,
-    0x08, 0x06, 0xd1, 0xe4, 0xed, 0xf2, 0xfd, 0xed, 0xfc, 0x0a, 0xf1, 0xe5, 0x12, 0x20, 0x00, 0x0b,
-    0xf7, 0xfa, 0x09, 0x04, 0x07, 0x0c, 0xfc, 0xfe, 0xf9, 0x1c, 0x19, 0x21, 0x16, 0xec, 0x02, 0x06,
-    0xfb, 0x05, 0x05, 0xf4, 0xf7, 0x17, 0x31, 0xf3, 0xf9, 0xd5, 0xf0, 0x05, 0xe7, 0xed, 0xfe, 0xef,
-    0x07, 0xcc, 0xc5, 0xce, 0xbe, 0x02, 0xf9, 0xf8, 0xed, 0xf1, 0xe8, 0xf2, 0xfd, 0xc5, 0xab, 0xfc,
-    0x07, 0x16, 0x08, 0xf1, 0x0c, 0xff, 0x09, 0x2b, 0x05, 0x02, 0x0a, 0x1a, 0x11, 0x11, 0x07, 0x07,
-    0x1a, 0xfa, 0xf7, 0xfa, 0x07, 0x1b, 0x08, 0xf0, 0x10, 0x02, 0x1e, 0x1a, 0xf1, 0x09, 0x07, 0xe0,
-    0x09, 0x14, 0x14, 0x13, 0xfe, 0x01, 0x0f, 0x02, 0x0a, 0x03, 0x19, 0x2c, 0x04, 0xfc, 0x03, 0x08,
-    0x01, 0xfc, 0x01, 0x05, 0x09, 0x18, 0x0b, 0x08, 0x0b, 0x24, 0xfe, 0x0d, 0x12, 0x13, 0xfc, 0xf6,
-    0x13, 0x06, 0xf6, 0xfb, 0xf9, 0x07, 0x02, 0xfd, 0xfc, 0x08, 0xff, 0xfc, 0x07, 0xfb, 0xf6, 0xff,
-    0x0b, 0xef, 0x07, 0x13, 0x14, 0xf7, 0xf9, 0xf8, 0xf4, 0x00, 0xf4, 0x11, 0x09, 0x08, 0x16, 0xe7,
-    0x03, 0xf5, 0x03, 0x0e, 0x03, 0x10, 0xfc, 0xd6, 0xfe, 0x0d, 0xf9, 0x0e, 0x11, 0x04, 0xfb, 0xf5,
-    0xf7, 0xf6, 0x06, 0x03, 0x03, 0xf4, 0xf7, 0xe6, 0xe4, 0xe2, 0xf5, 0xfb, 0x03, 0xff, 0x01, 0xf7,
-    0xf6, 0xf2, 0xf1, 0xf6, 0xf0, 0x03, 0xf9, 0x10, 0xe5, 0x01, 0xf0, 0x2a, 0x09, 0x26, 0x2b, 0x18,
-    0x17, 0x0d, 0x0b, 0x06, 0x0d, 0xf6, 0x14, 0x06, 0xf9, 0x31, 0x3b, 0x4b, 0x3b, 0x36, 0x1b, 0x06,
-    0x0e, 0x13, 0x05, 0xdc, 0x03, 0xda, 0xe7, 0xdf, 0xeb, 0x18, 0xff, 0x09, 0x0e, 0x05, 0xea, 0x26,
-    0x02, 0xdc, 0xcc, 0xda, 0xc6, 0xf0, 0xdf, 0xf6, 0xfd, 0xfa, 0xfe, 0xde, 0xf7, 0x04, 0x00, 0x05,
-    0xff, 0xf6, 0x01, 0xf1, 0xea, 0xfb, 0xfc, 0x22, 0x03, 0x0d, 0x0e, 0x14, 0x08, 0x10, 0xf2, 0xf1,
-    0xfa, 0xf1, 0xf0, 0xf4, 0xfe, 0xf9, 0x05, 0x0a, 0x05, 0xf4, 0xff, 0xe3, 0xfb, 0xff, 0xff, 0xfb,
-    0xfb, 0x19, 0x12, 0xea, 0xe4, 0xdc, 0xf3, 0x07, 0x2e, 0x10, 0x03, 0xd5, 0xf4, 0xef, 0xf8, 0xec,
-    0x06, 0x04, 0x06, 0x00, 0x0f, 0x0f, 0x09, 0x1d, 0x04, 0xfe, 0xe9, 0x24, 0x18, 0xe0, 0xf7, 0xfe,
-    0x08, 0xd0, 0xec, 0x08, 0x06, 0xff, 0xff, 0x12, 0x03, 0x14, 0x1c, 0xfd, 0xe8, 0xec, 0xf7, 0xd4,
-    0x0a, 0x2c, 0x1e, 0x03, 0x02, 0x0c, 0x09, 0xe4, 0xff, 0x06, 0x01, 0xd6, 0x00, 0x08, 0x0e, 0x05,
-    0x07, 0xff, 0xec, 0xee, 0x05, 0x12, 0xf7, 0x2c, 0xff, 0xf9, 0x0e, 0xee, 0xee, 0xff, 0x0b, 0x0b,
-    0x01, 0x08, 0x20, 0x00, 0x09, 0x00, 0xff, 0xf2, 0xee, 0x11, 0x04, 0xfa, 0xff, 0x23, 0xfd, 0xfa,
-    0x03, 0x22, 0x06, 0xf0, 0x0a, 0xfe, 0xfb, 0x13, 0xf1, 0x03, 0x17, 0xdd, 0xfb, 0x37, 0x18, 0x16,
-    0x12, 0xff, 0x0a, 0xed, 0x08, 0xf8, 0xf5, 0x2c, 0x08, 0xfe, 0x19, 0xe2, 0x12, 0xfa, 0x00, 0xfc,
-    0x0b, 0x0a, 0x25, 0xf8, 0x02, 0x09, 0xff, 0xfc, 0xfc, 0x0b, 0x0d, 0xfa, 0x02, 0x02, 0xff, 0xfa,
-    0xf0, 0x00, 0xfb, 0xfb, 0x05, 0x04, 0x00, 0xec, 0xf2, 0xf4, 0x19, 0x1c, 0x00, 0xfc, 0x0a, 0x07,
-    0x16, 0xe4, 0x03, 0xe9, 0xf4, 0xed, 0xf1, 0x0d, 0x03, 0xfb, 0x0c, 0x14, 0xf0, 0xd7, 0x0a, 0x20,
-    0x0c, 0x02, 0xe7, 0x10, 0x03, 0xfa, 0x0c, 0x04, 0xea, 0xf4, 0x08, 0x06, 0x19, 0x1c, 0xf9, 0xe5,
-    0xfd, 0x1f, 0xfc, 0xe5, 0x05, 0x28, 0xde, 0x11, 0x30, 0x12, 0xe2, 0x2a, 0x00, 0x0b, 0xc6, 0xeb,
-    0x29, 0x03, 0xea, 0xf8, 0xf6, 0xde, 0xe7, 0xfa, 0x0c, 0xea, 0xec, 0x20, 0x25, 0x0a, 0xf8, 0x0f,
-    0x0e, 0xf1, 0x07, 0xf1, 0xfa, 0xeb, 0x10, 0x06, 0xf8, 0x09, 0x09, 0x00, 0x15, 0x06, 0x11, 0xcf,
-    0xfb, 0x10, 0x17, 0x09, 0x0c, 0x06, 0xf1, 0x0a, 0xef, 0x12, 0xf3, 0x05, 0xff, 0x07, 0xf4, 0xfb,
-    0xe7, 0x10, 0xf5, 0xf6, 0xfd, 0x2b, 0x07, 0x15, 0x07, 0x0b, 0xed, 0xd9, 0xfd, 0x03, 0x10, 0xe9,
-    0x16, 0xf8, 0xe1, 0x01, 0xf5, 0x05, 0xfb, 0x00, 0x06, 0x0b, 0x15, 0xe2, 0x03, 0x0d, 0x09, 0xfd,
-    0xfe, 0xfe, 0xf3, 0x08, 0x03, 0xf5, 0xff, 0xff, 0xf9, 0x00, 0xf2, 0x1a, 0xf8, 0xeb, 0xee, 0xf5,
-    0x01, 0xf7, 0x04, 0x12, 0xfb, 0x05, 0xfb, 0xde, 0xf1, 0xe8, 0xf1, 0xf8, 0xee, 0xea, 0xeb, 0xf0,
-    0xf8, 0xfa, 0x00, 0x21, 0xf6, 0xf7, 0xf4, 0xec, 0xf8, 0xda, 0x01, 0x14, 0x15, 0x07, 0x19, 0x08,
-    0x08, 0xca, 0xe9, 0xf0, 0x14, 0x18, 0x07, 0x03, 0x03, 0x1c, 0x0f, 0x10, 0x0d, 0x08, 0x06, 0xfb,
-    0x06, 0x23, 0xfe, 0xf6, 0x0c, 0x0d, 0x18, 0x0a, 0x08, 0x15, 0x15, 0x07, 0x16, 0x0f, 0xfa, 0x0b,
-    0x05, 0x17, 0xfb, 0x1c, 0x07, 0x15, 0x24, 0x13, 0x03, 0xf4, 0x19, 0xf3, 0x0e, 0x09, 0xf2, 0x39,
-    0x04, 0x1b, 0x16, 0x11, 0x0a, 0x0e, 0x02, 0xfa, 0x07, 0x03, 0x0f, 0xff, 0x0d, 0x0d, 0x22, 0x24,
-    0xf3, 0x03, 0x03, 0x0a, 0x11, 0x21, 0x21, 0x2d, 0xf4, 0x04, 0xeb, 0xfc, 0x07, 0xfc, 0xf9, 0xf4,
-    0x10, 0xf5, 0x36, 0xfa, 0xfa, 0xf6, 0xfe, 0x05, 0x10, 0x08, 0xee, 0xef, 0x03, 0xf2, 0x0b, 0xf5,
-    0x0b, 0x0d, 0x05, 0x20, 0xf7, 0xf9, 0x06, 0x11, 0x1c, 0x16, 0x0b, 0xec, 0x0e, 0xfb, 0x07, 0x0e,
-    0x1b, 0x01, 0x0d, 0xfc, 0x0f, 0xfe, 0x12, 0xf2, 0x10, 0xf9, 0xf2, 0x01, 0x11, 0xfb, 0xee, 0x15,
-    0x07, 0x03, 0x01, 0x22, 0xf3, 0x1b, 0x17, 0x1e, 0x22, 0x09, 0x10, 0x11, 0x11, 0xfd, 0xef, 0x10,
-    0xf8, 0xf2, 0x07, 0x20, 0x07, 0xf5, 0x03, 0xe4, 0xff, 0xfb, 0x07, 0xf0, 0x06, 0xdf, 0xee, 0x11,
-    0x09, 0x0c, 0xf8, 0x0f, 0x1b, 0x0f, 0xf3, 0xfe, 0x00, 0xe7, 0x0d, 0x21, 0x14, 0xf8, 0xff, 0xf8,
-    0x0b, 0x0e, 0x04, 0x0b, 0xfc, 0x0d, 0x04, 0x0f, 0x06, 0x13, 0xec, 0xeb, 0xe2, 0xf4, 0xf8, 0xf4,
-    0xfd, 0xeb, 0xfe, 0x07, 0xff, 0xee, 0xfa, 0xe4, 0xe5, 0xf8, 0xee, 0xf8, 0xff, 0x00, 0xf6, 0xf1,
-    0xff, 0xec, 0x0f, 0xe4, 0xf8, 0x05, 0xfa, 0x07, 0x02, 0xe0, 0x0f, 0x01, 0x00, 0xfd, 0x11, 0x1d,
-    0x1c, 0x16, 0x12, 0xf6, 0x09, 0x08, 0xf8, 0x0b, 0x06, 0xf6, 0x10, 0x18, 0x02, 0x13, 0x09, 0x05,
-    0xfa, 0xfa, 0xe3, 0xda, 0xf7, 0x00, 0xec, 0xff, 0x07, 0x0a, 0x1a, 0x2f, 0xfc, 0xd8, 0xdc, 0xdc,
-    0x01, 0x03, 0x12, 0xff, 0x03, 0xf2, 0x0d, 0x0d, 0x09, 0xf6, 0xfd, 0xe4, 0xeb, 0xe0, 0x19, 0x16,
-    0x1f, 0x0c, 0x0d, 0x0b, 0x0a, 0x28, 0x18, 0xff, 0x0b, 0xec, 0xeb, 0x0f, 0x1a, 0x1b, 0x17, 0xfc,
-    0x0a, 0x27, 0x2d, 0x10, 0x05, 0x04, 0xe3, 0xec, 0x01, 0x0d, 0x01, 0xc5, 0x00, 0x24, 0x18, 0xff,
-    0xfa, 0xe0, 0xf5, 0x10, 0x17, 0x11, 0xeb, 0xf6, 0xf7, 0xfd, 0xe9, 0xe6, 0xec, 0x03, 0x0e, 0x10,
-    0xfa, 0xf6, 0xe4, 0xcc, 0xf6, 0xce, 0xef, 0x03, 0x11, 0x01, 0x04, 0x04, 0x16, 0x19, 0x1a, 0xf6,
-    0xf8, 0xe9, 0xe3, 0xf4, 0xfe, 0x18, 0x13, 0xf3, 0xed, 0xfa, 0x17, 0x00, 0x00, 0x08, 0xed, 0xf5,
-    0x06, 0xf2, 0x14, 0xf1, 0x08, 0x06, 0x02, 0x07, 0x05, 0x23, 0x14, 0x0d, 0xff, 0x1e, 0xfe, 0x15,
-    0xdc, 0x16, 0x27, 0xf6, 0xfd, 0x08, 0x04, 0xfb, 0xfd, 0xfb, 0x15, 0x0b, 0x0c, 0x10, 0x0c, 0xfa,
-    0x07, 0xf1, 0x03, 0x1a, 0x10, 0x0b, 0xfa, 0x07, 0x16, 0x1d, 0x0c, 0xf9, 0x14, 0x05, 0x07, 0x17,
-    0x19, 0x08, 0x05, 0x1f, 0x1a, 0x14, 0x10, 0x13, 0x05, 0x05, 0x13, 0x09, 0x02, 0x02, 0xef, 0xe5,
-    0x00, 0xe9, 0x00, 0x13, 0x08, 0xd2, 0x08, 0xfd, 0xeb, 0xe5, 0xd5, 0xe7, 0xe4, 0xf4, 0xd5, 0xcb,
-    0x08, 0x07, 0x0b, 0xf1, 0x03, 0xfc, 0x2b, 0x1c, 0xfb, 0xf2, 0xca, 0x30, 0x01, 0xf2, 0xf5, 0xf7,
-    0xfe, 0x10, 0x0f, 0x05, 0x1f, 0xec, 0xd8, 0x01, 0x09, 0xfb, 0x0a, 0x06, 0xfb, 0x03, 0x03, 0x28,
-    0x12, 0xdb, 0xdf, 0xcb, 0x07, 0x04, 0x00, 0x03, 0x02, 0xff, 0x24, 0x05, 0xf8, 0xd2, 0xea, 0x0d,
-    0x00, 0x28, 0x1e, 0x0e, 0x12, 0x0b, 0x0a, 0xfa, 0xf1, 0x03, 0xfc, 0xeb, 0x00, 0xf8, 0xfd, 0x0e,
-    0xf4, 0x05, 0xed, 0xd9, 0xe4, 0xfb, 0x05, 0x47, 0x09, 0x0d, 0xf2, 0xef, 0x05, 0x01, 0xef, 0x04,
-    0xe7, 0x0f, 0x19, 0x06, 0xf6, 0xf8, 0x0e, 0x03, 0x00, 0xf8, 0xed, 0xf3, 0xf5, 0x04, 0xf8, 0xf8,
-    0xf2, 0xfc, 0xfd, 0xf9, 0xf0, 0xf2, 0x12, 0xf1, 0xe0, 0x10, 0x09, 0x10, 0xfb, 0x1c, 0xed, 0x05,
-    0x01, 0xfc, 0xf9, 0xe3, 0xf8, 0x10, 0x16, 0xf2, 0xff, 0xf4, 0x04, 0x0c, 0xf3, 0x00, 0xee, 0xf3,
-    0x08, 0x27, 0x23, 0x09, 0x0b, 0x11, 0x01, 0xe2, 0xd9, 0xf9, 0xef, 0x01, 0x14, 0x1d, 0x35, 0x03,
-    0x06, 0xeb, 0xe1, 0xeb, 0xfb, 0x20, 0x22, 0x1b, 0x0b, 0x02, 0xf4, 0xf6, 0x08, 0xf7, 0xed, 0x05,
-    0x01, 0x10, 0x0a, 0x02, 0x15, 0xeb, 0xd6, 0xcf, 0xf3, 0x14, 0xf2, 0x0c, 0xf7, 0x1d, 0x07, 0x11,
-    0x07, 0xf3, 0xff, 0xe8, 0x06, 0x1a, 0x17, 0x11, 0x01, 0x04, 0xf8, 0xe6, 0xfd, 0x10, 0x15, 0x0c,
-    0x07, 0x1f, 0x02, 0x05, 0xf6, 0xd7, 0xe3, 0xf2, 0xfb, 0xf7, 0x18, 0x0b, 0x08, 0xfe, 0xf2, 0xfe,
-    0x0d, 0xfb, 0xff, 0x1d, 0x11, 0x08, 0xf5, 0xea, 0x0b, 0xfc, 0xf1, 0x16, 0xf7, 0x15, 0x0c, 0xfd,
-    0x0d, 0xfd, 0xee, 0x01, 0xfb, 0xf8, 0xf2, 0xfc, 0xfe, 0x0b, 0x11, 0xf0, 0x09, 0xf5, 0x07, 0x0a,
-    0x01, 0x44, 0xff, 0xf5, 0x1d, 0x02, 0xf6, 0x07, 0xff, 0x11, 0xfb, 0x12, 0x0a, 0x23, 0x15, 0xfe,
-    0xf8, 0xf5, 0xff, 0xf8, 0x00, 0x05, 0x03, 0x10, 0x0c, 0x10, 0x05, 0x0b, 0x00, 0xfc, 0x18, 0xfd,
-    0xfb, 0x08, 0xfc, 0xd9, 0xf6, 0x0e, 0x0d, 0xf0, 0xe4, 0x0c, 0xee, 0xfd, 0xf9, 0x08, 0xfd, 0xf3,
-    0x05, 0x18, 0xf7, 0xeb, 0xe2, 0xf3, 0x0c, 0x00, 0xf7, 0xf3, 0x01, 0x04, 0x08, 0xb9, 0xcc, 0xf4,
-    0x1d, 0x0e, 0x09, 0xf1, 0xff, 0xfd, 0xf1, 0x0d, 0xfa, 0xdd, 0xf4, 0x29, 0x2b, 0x24, 0x0a, 0x12,
-    0xf4, 0xfa, 0xe2, 0xe9, 0xf7, 0x00, 0x01, 0x2c, 0x1f, 0xfe, 0xeb, 0xeb, 0xea, 0xda, 0xec, 0xdb,
-    0x01, 0x18, 0x1c, 0x09, 0xf7, 0xee, 0xed, 0xfc, 0xe7, 0x03, 0xf9, 0xe2, 0x0a, 0xfa, 0x0d, 0xf4,
-    0x1a, 0x33, 0x0d, 0x01, 0xde, 0xd6, 0xe5, 0xe7, 0xfd, 0xef, 0xf7, 0x16, 0x08, 0x08, 0x15, 0xf8,
-    0x18, 0xe5, 0xf5, 0xfa, 0xfd, 0xfd, 0xf1, 0xfb, 0xfd, 0xff, 0x01, 0xf1, 0xf2, 0xf3, 0xfb, 0x04,
-    0x01, 0x0a, 0x00, 0x0d, 0x16, 0x2b, 0x1f, 0x25, 0x0e, 0xf6, 0x09, 0x22, 0xec, 0x2b, 0x2a, 0x15,
-    0xfd, 0x08, 0xf4, 0x05, 0xfa, 0x0c, 0x18, 0x13, 0xfc, 0x0a, 0x26, 0x09, 0xe5, 0xfb, 0xfa, 0x0d,
-    0x0e, 0x1d, 0x0d, 0x30, 0xfa, 0x1a, 0x17, 0xf6, 0x14, 0x17, 0x07, 0x13, 0x0f, 0xfe, 0xdd, 0xde,
-    0xf8, 0xf2, 0xe8, 0xf7, 0x05, 0x1f, 0x03, 0xf7, 0xf8, 0xed, 0xd5, 0xed, 0x00, 0xf2, 0xe7, 0xe1,
-    0xfe, 0x09, 0x07, 0xed, 0xea, 0xf3, 0xf2, 0xf0, 0x07, 0x0d, 0xf1, 0xfa, 0x09, 0xef, 0xdb, 0xea,
-    0xf6, 0x08, 0x18, 0x00, 0xfb, 0xef, 0x13, 0x06, 0xea, 0xe2, 0xf2, 0xf4, 0x09, 0xf9, 0xfb, 0x02,
-    0xf6, 0x04, 0x01, 0xec, 0xef, 0x09, 0xf4, 0x07, 0xee, 0x05, 0xf3, 0x00, 0x0a, 0xf2, 0xfd, 0x10,
-    0x11, 0x0a, 0xf8, 0xee, 0xe7, 0xf8, 0x17, 0xc2, 0x0b, 0xee, 0xfc, 0xe9, 0xfe, 0xee, 0xf9, 0xe3,
-    0xfd, 0xf5, 0xf5, 0xfb, 0xfc, 0x04, 0xf4, 0xf7, 0xfc, 0x0d, 0x0a, 0x0b, 0xfd, 0xfc, 0x06, 0xf5,
-    0xf4, 0x09, 0xfe, 0xf7, 0x0d, 0x28, 0xf4, 0x0a, 0x00, 0x0b, 0xfd, 0x27, 0xfb, 0xee, 0xfd, 0xf9,
-    0x01, 0x0d, 0xf8, 0x12, 0x15, 0x07, 0xfb, 0xf0, 0xef, 0xfc, 0xf7, 0xea, 0xfe, 0x22, 0x13, 0x1d,
-    0x30, 0xfa, 0xf9, 0x2f, 0x05, 0xf7, 0xdb, 0x0c, 0xfd, 0x13, 0x09, 0x1d, 0x08, 0x0f, 0xea, 0x25,
-    0x09, 0xf4, 0xef, 0xf9, 0xe9, 0xec, 0x2d, 0x1d, 0x06, 0xfa, 0xfb, 0xac, 0x03, 0xfd, 0xf1, 0xf3,
-    0x07, 0xf7, 0x0c, 0x35, 0x03, 0xeb, 0x06, 0xde, 0x0c, 0xee, 0xf8, 0x04, 0xe4, 0xec, 0x26, 0xe1,
-    0x08, 0xf6, 0x1c, 0xf0, 0xf7, 0x05, 0x0d, 0x02, 0xe8, 0xda, 0xf3, 0x00, 0xfa, 0xfe, 0x11, 0xfd,
-    0xfb, 0x05, 0x01, 0x03, 0xf3, 0x08, 0xf0, 0x0b, 0x04, 0x12, 0xfa, 0xe7, 0x02, 0xeb, 0xe8, 0x23,
-    0x0a, 0x02, 0x0d, 0xe8, 0xf5, 0xef, 0xf1, 0xf0, 0x0d, 0x0b, 0xf7, 0xb9, 0xfb, 0xfa, 0xfd, 0x1a,
-    0xf5, 0x04, 0xe4, 0x07, 0x07, 0x0c, 0x04, 0xfe, 0x0c, 0xfd, 0xf4, 0x1a, 0x0b, 0x0a, 0x0b, 0x0c,
-    0xf5, 0xef, 0x0f, 0xfd, 0x04, 0x04, 0x00, 0x14, 0xfe, 0x0b, 0xda, 0x04, 0xfe, 0xe5, 0x07, 0xfc,
-    0xfe, 0xed, 0xf9, 0x09, 0x0e, 0xf1, 0xf6, 0xf3, 0xf2, 0xd0, 0x14, 0x21, 0x10, 0x0b, 0x22, 0x01,
-    0x04, 0x0d, 0xff, 0x30, 0xf5, 0x07, 0x0f, 0x27, 0xfb, 0x0c, 0xe7, 0xf4, 0x05, 0xf7, 0x0a, 0x03,
-    0xf5, 0x08, 0x0e, 0x09, 0xf5, 0xfa, 0xf3, 0xee, 0x01, 0xfe, 0xfd, 0xe9, 0x0d, 0xe5, 0x09, 0x03,
-    0x0a, 0x18, 0xf6, 0xea, 0xe4, 0x03, 0xef, 0xea, 0x05, 0xf2, 0xf7, 0x12, 0xfa, 0x0d, 0xe8, 0xd7,
-    0x05, 0x07, 0x0d, 0xeb, 0x08, 0x06, 0x00, 0x07, 0xfb, 0xfc, 0xf6, 0x08, 0x07, 0x01, 0xff, 0x08,
-    0x04, 0x0a, 0x12, 0x06, 0x0a, 0xf7, 0xfe, 0xf7, 0xff, 0x07, 0x1f, 0x14, 0x05, 0x10, 0x16, 0x12,
-    0x13, 0x3d, 0x2c, 0x17, 0x01, 0x08, 0xe5, 0xdd, 0x04, 0x0a, 0xfa, 0x08, 0x11, 0x0d, 0x21, 0x06,
-    0x20, 0xf7, 0x08, 0xf9, 0xf4, 0x0a, 0x05, 0xf6, 0x06, 0x00, 0x03, 0xdb, 0x0a, 0xf7, 0x08, 0x0b,
-    0x07, 0xf7, 0x03, 0x11, 0x15, 0x18, 0x15, 0x0c, 0xf3, 0x0f, 0x04, 0xbd, 0xf3, 0x0a, 0xe2, 0x22,
-    0x16, 0x1a, 0x15, 0x04, 0x04, 0x1b, 0x18, 0x26, 0xfa, 0x04, 0x0f, 0x10, 0x0c, 0x0b, 0x0a, 0x17,
-    0x16, 0xf9, 0x2f, 0x09, 0x0d, 0x05, 0x2c, 0x26, 0xed, 0xe3, 0xf6, 0x06, 0xfb, 0x00, 0xfe, 0x19,
-    0xf5, 0x29, 0x27, 0x1c, 0xf9, 0xcf, 0xf6, 0xe7, 0x01, 0x04, 0xf3, 0x14, 0xf9, 0x13, 0x08, 0x0a,
-    0x09, 0xde, 0xda, 0xf1, 0xf9, 0xee, 0xee, 0xf6, 0xf3, 0x04, 0x04, 0x15, 0xd9, 0xc5, 0xed, 0xf8,
-    0x0c, 0xec, 0xeb, 0x22, 0xf8, 0x10, 0x0c, 0xfc, 0x04, 0xef, 0x0d, 0xfa, 0xfe, 0xe6, 0x06, 0x1a,
-    0xf8, 0x0f, 0x05, 0x11, 0x0d, 0xff, 0x05, 0xee, 0xfc, 0xfb, 0xf4, 0x06, 0xf9, 0xf1, 0x09, 0x09,
-    0x0b, 0xf3, 0xe5, 0xf5, 0xf6, 0xe5, 0xf7, 0xee, 0xf8, 0xf1, 0x09, 0x1b, 0x1a, 0x1f, 0x09, 0xfa,
-    0x27, 0x03, 0x31, 0x00, 0x08, 0x0d, 0xfa, 0x08, 0x00, 0xff, 0xea, 0xed, 0x00, 0xf5, 0x05, 0xf9,
-    0x07, 0x42, 0x17, 0x00, 0xdb, 0xc0, 0xef, 0x05, 0x23, 0xfa, 0xef, 0xff, 0x0a, 0x0b, 0x1f, 0x12,
-    0xe7, 0xd2, 0xf5, 0x25, 0x0b, 0x0c, 0xf2, 0x09, 0x16, 0x13, 0x23, 0x05, 0xfa, 0xe6, 0x03, 0x0e,
-    0xf2, 0xec, 0xe5, 0x1f, 0xfd, 0xf0, 0x0c, 0x1e, 0xec, 0xf6, 0x19, 0x13, 0x0e, 0x03, 0x09, 0x03,
-    0x0b, 0x01, 0x1e, 0x12, 0xf1, 0xee, 0x0e, 0xf7, 0x00, 0x0f, 0xfa, 0x02, 0x0d, 0x02, 0xf0, 0xfc,
-    0xf5, 0xef, 0xf0, 0x04, 0xfc, 0xf8, 0xf1, 0xf3, 0x0c, 0xf4, 0x12, 0xe0, 0x08, 0xe2, 0xfa, 0xfa,
-    0xf4, 0x0b, 0x16, 0xfd, 0x0c, 0x24, 0x24, 0x11, 0x11, 0xf0, 0x07, 0x00, 0x0f, 0xf9, 0x26, 0x13,
-    0xf9, 0x1e, 0x21, 0x0b, 0xfe, 0x04, 0x0a, 0xfb, 0x0e, 0xf6, 0x02, 0x10, 0x0d, 0xe4, 0xd6, 0xf4,
-    0xff, 0x04, 0x10, 0x04, 0x06, 0x0c, 0x0f, 0x05, 0x0d, 0xf3, 0xea, 0xde, 0xfa, 0xef, 0x03, 0xf8,
-    0x1f, 0xf5, 0x13, 0x00, 0xff, 0xfa, 0xfc, 0x02, 0xeb, 0xfe, 0xfc, 0x0d, 0x03, 0xfa, 0xf6, 0x04,
-    0x08, 0x03, 0x15, 0x13, 0x14, 0x03, 0x08, 0x01, 0xe9, 0xd4, 0xf1, 0x1e, 0x03, 0x18, 0xff, 0x0d,
-    0x04, 0x0a, 0xee, 0xef, 0xe3, 0xf2, 0x0c, 0x08, 0x09, 0xed, 0xe6, 0xef, 0x07, 0x1f, 0x2f, 0x14,
-    0xf7, 0xfb, 0x15, 0x2c, 0x05, 0xf0, 0xff, 0x27, 0x3e, 0x2f, 0x19, 0xeb, 0xf1, 0xf0, 0x1d, 0xf5,
-    0xf4, 0x29, 0x31, 0x2c, 0x29, 0x0f, 0x01, 0xe5, 0xea, 0xeb, 0xf7, 0xcc, 0x04, 0x0b, 0xf2, 0xf6,
-    0xf8, 0x07, 0xfd, 0xfc, 0xf8, 0xf4, 0x00, 0x20, 0xfc, 0xe2, 0xc7, 0xdf, 0xe8, 0x04, 0x07, 0x01,
-    0xf8, 0x07, 0xfc, 0xfa, 0x08, 0xf6, 0xfc, 0x06, 0xdc, 0xfa, 0xfe, 0xf1, 0x0b, 0xe0, 0x0a, 0x2c,
-    0xf4, 0x06, 0xff, 0xf7, 0x02, 0x02, 0x07, 0x03, 0xf7, 0x07, 0x00, 0x30, 0xf9, 0xfa, 0xfe, 0x16,
-    0xf6, 0xf9, 0xed, 0xec, 0xfb, 0xfa, 0xe9, 0xdd, 0x09, 0x09, 0x14, 0x10, 0x04, 0x14, 0xfb, 0xf7,
-    0xf4, 0xd4, 0x0a, 0xfd, 0xf3, 0x04, 0xf9, 0xfe, 0x11, 0x05, 0xfc, 0xf1, 0xfe, 0x06, 0xf7, 0x03,
-    0xfd, 0xee, 0x01, 0xf6, 0xee, 0xeb, 0xef, 0xcc, 0xe3, 0xf0, 0x16, 0x2c, 0x01, 0x00, 0x19, 0x03,
-    0x10, 0xfb, 0xfb, 0xfe, 0x06, 0x13, 0x14, 0x0d, 0xf7, 0xf7, 0xfc, 0x0e, 0x19, 0xf8, 0xfb, 0x0a,
-    0x19, 0x06, 0xff, 0x04, 0x00, 0x1a, 0xf7, 0x08, 0x06, 0xf2, 0x03, 0x19, 0x1b, 0x07, 0x11, 0xfd,
-    0xff, 0x30, 0x06, 0xea, 0xf7, 0xfe, 0x07, 0x15, 0x06, 0x29, 0x13, 0xe2, 0xf9, 0x23, 0x1b, 0xed,
-    0x16, 0xfd, 0xfc, 0x10, 0xea, 0x28, 0x2a, 0x19, 0x05, 0xff, 0x24, 0xeb, 0x04, 0x15, 0x04, 0x0f,
-    0xe0, 0xe2, 0xff, 0xf9, 0xf5, 0x1e, 0x00, 0xff, 0xec, 0xf3, 0x04, 0x09, 0x0b, 0xeb, 0xd7, 0xfd,
-    0xff, 0x16, 0xf5, 0x04, 0x04, 0xfb, 0xfc, 0x08, 0x09, 0xf2, 0xcd, 0x04, 0xf9, 0x00, 0xff, 0x00,
-    0x01, 0x03, 0x03, 0xe4, 0x01, 0xf0, 0xc4, 0x0d, 0xfc, 0x19, 0xfa, 0xd8, 0x21, 0x1c, 0x17, 0x0e,
-    0xf9, 0xc1, 0xa9, 0xfe, 0x0b, 0x05, 0x0a, 0xfd, 0xf0, 0xf9, 0xf2, 0xf2, 0x0b, 0xf7, 0x02, 0xf6,
-    0xfd, 0x3a, 0xf6, 0x2c, 0x1c, 0x1b, 0x23, 0x24, 0x21, 0x27, 0x11, 0x07, 0x0b, 0xf5, 0x09, 0x12,
-    0x15, 0x11, 0x17, 0xfa, 0x07, 0xf0, 0x0a, 0x12, 0x07, 0xf5, 0x19, 0xdd, 0xe9, 0xe6, 0xd8, 0xc9,
-    0xe3, 0xed, 0xe7, 0xdd, 0xf4, 0xf1, 0xf0, 0xf1, 0xe4, 0xec, 0xfb, 0xfd, 0x09, 0x10, 0xdd, 0xf4,
-    0x0b, 0xf3, 0x05, 0x04, 0x1b, 0x1b, 0x14, 0x0a, 0x15, 0xf7, 0xfc, 0xe4, 0xfa, 0xe1, 0xf9, 0x1a,
-    0x0e, 0x12, 0x09, 0xeb, 0xf1, 0xf9, 0x13, 0x36, 0x00, 0xf7, 0xfb, 0xf6, 0xe2, 0xf7, 0x0c, 0x0a,
-    0x0e, 0x12, 0x17, 0x25, 0x04, 0xfd, 0xf6, 0xeb, 0x01, 0xe5, 0xf9, 0xfe, 0x06, 0x00, 0x0b, 0x02,
-    0xf4, 0x17, 0x0c, 0xfa, 0x11, 0xf6, 0x16, 0xfd, 0xfe, 0xf3, 0x02, 0x29, 0xf9, 0xe7, 0x0d, 0x07,
-    0x00, 0xf8, 0xf3, 0xfa, 0xf9, 0xf4, 0x02, 0x05, 0x06, 0xcb, 0xfd, 0xf9, 0xfa, 0xfa, 0xfb, 0xf8,
-    0x08, 0x0a, 0xd8, 0x0a, 0x0d, 0x04, 0x08, 0x0a, 0xee, 0xf4, 0x10, 0xe5, 0xf7, 0x12, 0x02, 0x03,
-    0x00, 0xec, 0x03, 0x03, 0x02, 0x16, 0xf2, 0x0e, 0x1c, 0x03, 0xf7, 0x1e, 0x08, 0x0b, 0x17, 0xf1,
-    0xfe, 0x17, 0xf7, 0x0d, 0x08, 0x1c, 0x0e, 0x07, 0x07, 0x20, 0x15, 0x15, 0x00, 0x0d, 0x05, 0x03,
-    0xf3, 0xf8, 0xf5, 0xf0, 0x00, 0xff, 0x03, 0xf6, 0x0d, 0x10, 0xf1, 0xe9, 0xe0, 0xf9, 0x1c, 0xee,
-    0xf7, 0xff, 0x09, 0xeb, 0xf0, 0xdd, 0xef, 0xfb, 0x05, 0x17, 0x08, 0x09, 0xfe, 0xf3, 0xc7, 0xc1,
-    0xcd, 0xfc, 0x17, 0x31, 0xfb, 0xff, 0x03, 0x0f, 0x0a, 0xbf, 0xcd, 0xff, 0x06, 0x2e, 0x05, 0x14,
-    0xf8, 0xfd, 0xff, 0x08, 0xf4, 0xc9, 0xe0, 0xfb, 0x1c, 0x17, 0x08, 0xe8, 0xf7, 0xf3, 0x05, 0xe3,
-    0xfe, 0xe8, 0x11, 0x16, 0x06, 0x09, 0xf7, 0xf4, 0xe6, 0xf6, 0xf9, 0x36, 0x0a, 0xfd, 0xfc, 0x04,
-    0xf0, 0x05, 0xfd, 0xed, 0x05, 0x17, 0x07, 0x46, 0x08, 0xfa, 0xfd, 0x00, 0xe2, 0x09, 0x01, 0x00,
-    0xef, 0xfb, 0xfd, 0x07, 0x00, 0x03, 0xff, 0xf9, 0xf3, 0x04, 0x15, 0x17, 0xf4, 0x05, 0xf7, 0xff,
-    0xf5, 0xd8, 0xdc, 0xf2, 0x0a, 0x0c, 0x04, 0xf9, 0xf7, 0xf6, 0xe2, 0xc9, 0x00, 0xef, 0x28, 0x37,
-    0xfb, 0xfb, 0xfc, 0xdd, 0xeb, 0xfb, 0x06, 0xb1, 0xf8, 0x1f, 0x12, 0x07, 0x05, 0x14, 0x13, 0x21,
-    0x16, 0x20, 0x00, 0xef, 0x0c, 0x2e, 0x06, 0x00, 0x02, 0x1b, 0x0f, 0x0f, 0xfe, 0x0d, 0xf8, 0x43,
-    0xfc, 0xe3, 0xdf, 0xf9, 0x09, 0x15, 0x1d, 0xfc, 0x12, 0x0b, 0xeb, 0xb6, 0xf4, 0xfa, 0xfe, 0xeb,
-    0xe6, 0xed, 0xfa, 0x0f, 0xf8, 0x11, 0xd4, 0xe8, 0xfc, 0x0d, 0x03, 0x18, 0x03, 0xe4, 0x12, 0xec,
-    0xdd, 0xf2, 0xf6, 0x09, 0x0d, 0x0b, 0x0e, 0x05, 0xeb, 0x1c, 0x04, 0xf6, 0xee, 0xfa, 0x04, 0x03,
-    0xf4, 0xf5, 0x04, 0x06, 0x15, 0x0f, 0x0d, 0xff, 0x07, 0x06, 0x05, 0xe9, 0x04, 0xfb, 0x0b, 0x0e,
-    0x03, 0xfa, 0xe9, 0xfc, 0x0a, 0x03, 0x09, 0x22, 0x01, 0xf1, 0xe7, 0xff, 0xe4, 0xea, 0xea, 0x06,
-    0xfa, 0x0b, 0xce, 0xfb, 0xf4, 0x06, 0xf8, 0x07, 0x01, 0x0d, 0x0b, 0x26, 0xf4, 0xf7, 0xfb, 0xf6,
-    0x06, 0x26, 0xdb, 0xfc, 0x16, 0x07, 0xfe, 0x29, 0x07, 0xff, 0xf9, 0x1a, 0x04, 0x18, 0x14, 0x0a,
-    0x08, 0x13, 0xfb, 0x13, 0x20, 0x03, 0x0e, 0x01, 0xfe, 0xd5, 0x0a, 0x04, 0xff, 0x13, 0x21, 0x0d,
-    0xf3, 0xf1, 0xfb, 0xf2, 0xfd, 0xf3, 0x14, 0x14, 0x02, 0x16, 0x09, 0x08, 0xee, 0x08, 0x10, 0x04,
-    0xff, 0xf8, 0x0b, 0x0b, 0xfb, 0x0a, 0x0b, 0xd4, 0xe4, 0xdc, 0x0c, 0xf7, 0xf7, 0x0a, 0xdd, 0xf7,
-    0x07, 0xf7, 0x0b, 0xfa, 0xdd, 0xfc, 0x10, 0xd8, 0x0d, 0x0b, 0xf8, 0xf4, 0x07, 0xe8, 0xd8, 0xf2,
-    0xdb, 0xe7, 0xfc, 0xdf, 0x06, 0xda, 0x0f, 0x44, 0x2e, 0xf0, 0xb3, 0xd0, 0xf6, 0xee, 0x03, 0x03,
-    0x0a, 0xe0, 0xf4, 0x0c, 0xe4, 0x04, 0xe0, 0xd9, 0xdd, 0xe2, 0xe6, 0x0d, 0xfe, 0x0b, 0xf7, 0xd8,
-    0x06, 0xdc, 0xf5, 0xe4, 0xf5, 0xeb, 0x06, 0xf0, 0xf7, 0xdb, 0xe3, 0xf2, 0xf9, 0xfd, 0xf0, 0xcd,
-    0x2b, 0x1e, 0xe4, 0x06, 0xfa, 0x0b, 0xfb, 0xf1, 0x0a, 0x0d, 0x0f, 0x10, 0xff, 0xe5, 0xfc, 0xfe,
-    0xfe, 0xfe, 0x0c, 0x04, 0x05, 0x19, 0x0c, 0x0f, 0xfc, 0xcf, 0x03, 0x03, 0x09, 0x11, 0xf3, 0x00,
-    0x19, 0x27, 0x06, 0x0c, 0x07, 0x15, 0xf6, 0x07, 0x11, 0x21, 0x14, 0x02, 0xfa, 0xfa, 0x11, 0x33,
-    0x1b, 0x19, 0x11, 0xee, 0xff, 0xd1, 0xea, 0xf3, 0xd5, 0xeb, 0xf2, 0xfd, 0xfa, 0x0f, 0x0d, 0x38,
-    0x00, 0xc2, 0xd5, 0xf2, 0xea, 0xf0, 0xec, 0xe6, 0x0e, 0x11, 0x1c, 0x06, 0x00, 0xf3, 0xf7, 0x06,
-    0xf7, 0xfd, 0x09, 0xfc, 0x0c, 0x07, 0xff, 0xdf, 0x0c, 0x05, 0x0d, 0xee, 0xfe, 0xf5, 0xfd, 0x17,
-    0xfa, 0x0d, 0xf7, 0xf3, 0x05, 0xf7, 0xf9, 0xf9, 0xe0, 0x05, 0x0d, 0x17, 0xf8, 0xf7, 0x07, 0x10,
-    0xfe, 0xe4, 0x01, 0xf5, 0xf0, 0xf9, 0xf4, 0xfa, 0x06, 0xfe, 0xee, 0xfd, 0xf5, 0x0a, 0xf8, 0x16,
-    0xfe, 0xfa, 0xf9, 0x0c, 0x12, 0x20, 0x11, 0xef, 0x07, 0xdf, 0xd9, 0x1e, 0x15, 0x13, 0xf0, 0xf9,
-    0xfd, 0x09, 0xfb, 0x0b, 0x0d, 0x07, 0x02, 0x03, 0x04, 0xf6, 0x0b, 0xf1, 0xf7, 0x15, 0xf8, 0x0d,
-    0x0e, 0x07, 0x18, 0x12, 0x0f, 0xf1, 0xfb, 0x05, 0x02, 0x05, 0x03, 0x09, 0x03, 0xee, 0x08, 0x03,
-    0xfe, 0xea, 0x11, 0x03, 0x0a, 0x1c, 0x06, 0xe7, 0xfb, 0x00, 0x12, 0x0d, 0x08, 0xfd, 0x00, 0xf7,
-    0xf3, 0x04, 0x15, 0xf8, 0xfa, 0x11, 0x14, 0x14, 0xf9, 0xf0, 0x10, 0xef, 0xff, 0x16, 0x30, 0x2d,
-    0x02, 0x02, 0x0f, 0x01, 0xff, 0x1f, 0x26, 0x09, 0x0a, 0x18, 0x18, 0x09, 0x03, 0x0f, 0x07, 0xfa,
-    0x0d, 0x14, 0x12, 0x12, 0xfa, 0x0c, 0x0d, 0xc6, 0xfd, 0xf6, 0x04, 0xfe, 0x1f, 0x28, 0xfd, 0xe4,
-    0xf9, 0x07, 0xec, 0xdf, 0xf3, 0xe6, 0x0c, 0x0a, 0xf3, 0xed, 0xe9, 0x09, 0x06, 0xfe, 0xf4, 0x0e,
-    0x0b, 0xf7, 0x09, 0xe4, 0xf4, 0xe2, 0xef, 0xf5, 0xf9, 0xff, 0xf5, 0x05, 0xf8, 0x01, 0xfa, 0xf5,
-    0x00, 0xe5, 0xf3, 0x04, 0xea, 0xfc, 0x19, 0x06, 0x0d, 0x0f, 0x11, 0x0f, 0xed, 0x18, 0xe5, 0x01,
-    0xd6, 0xdf, 0xe8, 0x04, 0x04, 0xf8, 0xff, 0x06, 0xfe, 0xf7, 0xf5, 0x19, 0x04, 0xf4, 0x01, 0xfa,
-    0x02, 0x08, 0xf1, 0xf1, 0xfa, 0xfa, 0xd5, 0xdd, 0xe2, 0x0e, 0x16, 0x0b, 0xfb, 0xf5, 0xf2, 0x01,
-    0x13, 0xc9, 0xeb, 0xca, 0xf2, 0x1d, 0x08, 0x10, 0xf7, 0x21, 0x07, 0x10, 0xfb, 0xdf, 0xda, 0x07,
-    0x29, 0x14, 0xea, 0xe0, 0x06, 0x21, 0x0e, 0xcf, 0xd0, 0xd2, 0xf1, 0x0c, 0x1a, 0x1b, 0xf9, 0x9f,
-    0x0d, 0xef, 0xe5, 0xc9, 0xf8, 0x05, 0x14, 0xff, 0xfd, 0xfe, 0x1b, 0xdf, 0x0c, 0xf6, 0xf3, 0xe3,
-    0xf9, 0x19, 0xff, 0x04, 0xe9, 0xf7, 0xf6, 0xf9, 0x07, 0xfe, 0x0c, 0x17, 0xf2, 0x0e, 0xf8, 0x09,
-    0xfb, 0x04, 0xfd, 0xb9, 0xf3, 0x13, 0xf6, 0x16, 0x0a, 0xe5, 0xfb, 0xf1, 0xef, 0xe7, 0x14, 0x10,
-    0x0b, 0x34, 0x10, 0x18, 0x0b, 0xf0, 0x09, 0xf4, 0x05, 0xf5, 0x0c, 0x0b, 0xf8, 0xfe, 0xee, 0x01,
-    0xda, 0xf1, 0x25, 0x05, 0xfe, 0xf6, 0x17, 0x24, 0x0a, 0xe5, 0x0f, 0xf1, 0xfb, 0xf9, 0x02, 0x07,
-    0xca, 0x09, 0x34, 0xf7, 0x00, 0xf3, 0x0e, 0x0b, 0x0a, 0x0d, 0xf9, 0x1f, 0xff, 0x05, 0xff, 0x01,
-    0xf4, 0xe8, 0xdb, 0xdf, 0xea, 0xeb, 0xfd, 0x06, 0x05, 0xfd, 0x0e, 0x15, 0xf3, 0xf4, 0xdc, 0xf7,
-    0x05, 0x09, 0x0c, 0x00, 0xfe, 0xfd, 0x0f, 0xea, 0x07, 0x0e, 0x03, 0xf4, 0xf3, 0xe8, 0xdd, 0xec,
-    0xfb, 0x07, 0x16, 0x10, 0x02, 0xf0, 0x1e, 0x0e, 0x09, 0xe3, 0x0c, 0xef, 0x04, 0x09, 0x09, 0xe7,
-    0xf3, 0x0e, 0x07, 0x05, 0x00, 0x05, 0x01, 0x0d, 0x08, 0x0a, 0xfe, 0xe9, 0xf8, 0x02, 0x02, 0x0a,
-    0x10, 0xec, 0x09, 0x12, 0x0e, 0xea, 0xfd, 0xf0, 0xf9, 0xde, 0xfe, 0x0a, 0xff, 0x15, 0x03, 0x0e,
-    0x06, 0x03, 0x06, 0x02, 0x0b, 0xea, 0x0c, 0x25, 0x04, 0x0b, 0x17, 0x01, 0x06, 0x0d, 0x06, 0x0a,
-    0xff, 0xf4, 0x08, 0xfe, 0x1a, 0x15, 0x1f, 0xff, 0x13, 0x08, 0xfa, 0x06, 0xff, 0xff, 0xef, 0xf9,
-    0xf2, 0xf9, 0x0c, 0x15, 0x1d, 0x20, 0xea, 0x43, 0xfb, 0x0b, 0x17, 0x09, 0x0e, 0x05, 0xf3, 0x09,
-    0xf3, 0xfb, 0x0e, 0x00, 0xae, 0xe9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0xe4, 0x1b, 0x00, 0x00, 0x36, 0x15, 0x00, 0x00, 0xf4, 0xf5, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff,
-    0x8e, 0x10, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xca, 0xf2, 0xff, 0xff, 0xc4, 0x05, 0x00, 0x00,
-    0x51, 0xf4, 0xff, 0xff, 0x31, 0x13, 0x00, 0x00, 0x52, 0xfb, 0xff, 0xff, 0xf9, 0x0c, 0x00, 0x00,
-    0x32, 0x07, 0x00, 0x00, 0xfb, 0xfc, 0xff, 0xff, 0x76, 0xff, 0xff, 0xff, 0x88, 0x16, 0x00, 0x00,
-    0xf6, 0x13, 0x00, 0x00, 0xd9, 0x07, 0x00, 0x00, 0x41, 0xfd, 0xff, 0xff, 0xca, 0x15, 0x00, 0x00,
-    0xc8, 0xfb, 0xff, 0xff, 0x39, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0xff, 0xff, 0xa1, 0x09, 0x00, 0x00,
-    0x39, 0xfb, 0xff, 0xff, 0xb5, 0xf8, 0xff, 0xff, 0xfa, 0x0b, 0x00, 0x00, 0x46, 0xfe, 0xff, 0xff,
-    0xdb, 0x03, 0x00, 0x00, 0xdb, 0x07, 0x00, 0x00, 0xbe, 0x0e, 0x00, 0x00, 0x88, 0x04, 0x00, 0x00,
-    0x9a, 0xe8, 0xff, 0xff, 0xcc, 0xfc, 0xff, 0xff, 0x8c, 0x0d, 0x00, 0x00, 0xb3, 0x08, 0x00, 0x00,
-    0xad, 0xf0, 0xff, 0xff, 0xa7, 0x16, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00,
-    0x56, 0x03, 0x00, 0x00, 0x80, 0x11, 0x00, 0x00, 0x09, 0x0d, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
-    0x0a, 0x06, 0x00, 0x00, 0x35, 0xf6, 0xff, 0xff, 0x09, 0xfb, 0xff, 0xff, 0xc0, 0x11, 0x00, 0x00,
-    0x43, 0x19, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x00, 0x6b, 0xf8, 0xff, 0xff, 0xd9, 0xf0, 0xff, 0xff,
-    0x87, 0x04, 0x00, 0x00, 0x80, 0x0d, 0x00, 0x00, 0x3b, 0x0b, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00,
-    0xcb, 0xfe, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xaa, 0xf9, 0xff, 0xff, 0xc5, 0x0a, 0x00, 0x00,
-    0x48, 0xef, 0xff, 0xff, 0xc6, 0x0e, 0x00, 0x00, 0xc3, 0x13, 0x00, 0x00, 0xf5, 0xfe, 0xff, 0xff,
-    0xba, 0xea, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xba, 0x19, 0xf5, 0xbe,
-    0x33, 0x2c, 0xf7, 0x33, 0x1e, 0x18, 0x19, 0xf7, 0x13, 0xb6, 0x1d, 0x03, 0x09, 0xb5, 0x13, 0x02,
-    0xfe, 0xd6, 0xf0, 0xae, 0xe7, 0x12, 0x18, 0x28, 0x16, 0xee, 0x22, 0x2e, 0x29, 0x29, 0x16, 0x1b,
-    0xff, 0x37, 0x04, 0x26, 0xc6, 0xf6, 0x17, 0x05, 0xe0, 0x0e, 0xf1, 0xd5, 0x16, 0xe4, 0xee, 0x25,
-    0x1b, 0xbd, 0xeb, 0xe8, 0xf1, 0x18, 0x0f, 0xf8, 0xff, 0xee, 0x09, 0x09, 0x12, 0xda, 0xdf, 0x04,
-    0xea, 0x33, 0xf4, 0xff, 0x0e, 0x1c, 0xf6, 0x15, 0xfd, 0xf5, 0xd8, 0xca, 0xf9, 0xce, 0xf9, 0xf6,
-    0xd4, 0x0b, 0x34, 0xf4, 0xe5, 0x1d, 0x0c, 0x15, 0xd1, 0x21, 0x1c, 0x35, 0xf9, 0x05, 0x22, 0x28,
-    0x2e, 0xa6, 0x08, 0xd4, 0xc6, 0xd7, 0xe2, 0xdc, 0x12, 0x0a, 0x0d, 0xc7, 0xc5, 0xf1, 0xdb, 0x09,
-    0x1e, 0x01, 0xe7, 0xf9, 0x01, 0x0f, 0xbf, 0xd1, 0x1e, 0x0d, 0xf0, 0x12, 0x30, 0x06, 0x20, 0x0a,
-    0xee, 0xf0, 0xe7, 0x13, 0xea, 0xb4, 0xdc, 0x25, 0x2c, 0x2c, 0xf3, 0x0b, 0x03, 0x3b, 0x12, 0xf3,
-    0x0d, 0x09, 0xe2, 0x1e, 0xf5, 0xe9, 0xa7, 0x0a, 0xfd, 0xf5, 0x03, 0xfb, 0x1a, 0xeb, 0xfb, 0x0a,
-    0x1b, 0x13, 0xe9, 0xe9, 0xde, 0xfb, 0xfb, 0x0e, 0x02, 0xe9, 0xd1, 0x31, 0x1a, 0x13, 0x0e, 0x08,
-    0x23, 0x12, 0xf6, 0xf0, 0xe3, 0xef, 0x17, 0x10, 0xed, 0xf1, 0xfb, 0x0e, 0x1e, 0x24, 0x0a, 0xe4,
-    0x01, 0xe6, 0x54, 0x00, 0x05, 0x03, 0x0b, 0xf2, 0x08, 0x03, 0xe8, 0xe3, 0x2a, 0xda, 0xdb, 0x05,
-    0xf3, 0x14, 0x2b, 0x03, 0xf1, 0xdb, 0xd3, 0xd6, 0xcb, 0xee, 0x0d, 0xfc, 0x07, 0x10, 0xe9, 0xcf,
-    0x12, 0x06, 0xfc, 0x1c, 0x0e, 0xd6, 0x08, 0x0c, 0xfc, 0xee, 0x0f, 0x22, 0x01, 0x45, 0x01, 0xe3,
-    0xee, 0xf3, 0xb3, 0x23, 0x24, 0xf0, 0xff, 0x12, 0x12, 0x1b, 0xc2, 0x21, 0x30, 0xfe, 0xe3, 0x1c,
-    0xf4, 0x02, 0x0d, 0x0e, 0x07, 0x15, 0xe2, 0x03, 0xf9, 0xe6, 0x46, 0x33, 0x06, 0xd6, 0x15, 0x2e,
-    0x0c, 0x22, 0xd4, 0xf6, 0xe3, 0x23, 0x2b, 0x09, 0xf9, 0x15, 0xfc, 0x24, 0xec, 0xd5, 0x23, 0x02,
-    0x09, 0x0b, 0xd9, 0x1a, 0x2f, 0x02, 0xce, 0xe6, 0x09, 0x1c, 0xf1, 0xd7, 0x09, 0xfe, 0x17, 0xf0,
-    0xf6, 0x19, 0x14, 0x1b, 0x31, 0x12, 0x13, 0x06, 0x03, 0xf5, 0xc8, 0xf6, 0xee, 0x1d, 0xef, 0x01,
-    0x03, 0x16, 0xca, 0x1f, 0xf1, 0x24, 0x34, 0x9d, 0xfd, 0xa7, 0x1d, 0xfd, 0x06, 0xcc, 0x16, 0x09,
-    0xc7, 0xf3, 0x21, 0x33, 0x31, 0x29, 0x1b, 0x0a, 0x00, 0x28, 0x2e, 0xfd, 0x01, 0x55, 0x2e, 0xec,
-    0x0f, 0x29, 0xe5, 0x11, 0xb5, 0x01, 0x04, 0xe1, 0xdf, 0x33, 0x06, 0xe6, 0x10, 0xdc, 0x1e, 0xf2,
-    0xdc, 0xe5, 0xee, 0xfc, 0xf1, 0x1a, 0x10, 0x25, 0x19, 0xdc, 0x38, 0xfd, 0x20, 0x2c, 0xe9, 0x24,
-    0x19, 0x16, 0x03, 0x1c, 0xfe, 0xd8, 0xe7, 0x43, 0x0a, 0xeb, 0xe7, 0x1b, 0xf3, 0x00, 0x11, 0x18,
-    0xfe, 0x07, 0xe0, 0x13, 0xed, 0xf2, 0x91, 0x00, 0xf0, 0x1e, 0x39, 0xec, 0xfc, 0xf9, 0x10, 0x32,
-    0x1d, 0x27, 0xec, 0xc4, 0xec, 0x0d, 0x09, 0x22, 0x0d, 0xd0, 0xe5, 0x2a, 0xeb, 0xfd, 0xf1, 0xea,
-    0x28, 0xf5, 0xae, 0x22, 0xdd, 0xd3, 0xe2, 0x21, 0xf4, 0xe7, 0x41, 0x15, 0xe8, 0x38, 0x0b, 0xf3,
-    0xdb, 0xfb, 0x0c, 0x1d, 0xde, 0xfa, 0x1b, 0x17, 0x17, 0xe5, 0xfd, 0xff, 0xf3, 0xf9, 0xd5, 0xd1,
-    0xfa, 0x02, 0x27, 0xd5, 0xdd, 0x08, 0x28, 0x46, 0x2f, 0xec, 0xef, 0x42, 0xd5, 0xdb, 0xfc, 0x09,
-    0x2d, 0x22, 0xf8, 0x1e, 0x04, 0x09, 0x20, 0x06, 0xf6, 0x2b, 0x0c, 0xe7, 0x06, 0xd7, 0xfc, 0xf8,
-    0x11, 0x40, 0x21, 0xf8, 0xf6, 0x36, 0xec, 0xb1, 0xff, 0x0f, 0xb6, 0x05, 0x0d, 0x07, 0xf5, 0x12,
-    0xfb, 0xef, 0xee, 0x27, 0xe4, 0xdf, 0x0f, 0xe7, 0x17, 0x3c, 0xd1, 0x06, 0x01, 0x24, 0x01, 0xf5,
-    0x07, 0x0d, 0xef, 0x1e, 0x0f, 0x36, 0xc0, 0xf0, 0xf7, 0x1d, 0x1c, 0xd7, 0x25, 0x0b, 0xe8, 0x28,
-    0x10, 0xf4, 0x28, 0xef, 0xec, 0x1d, 0x27, 0x13, 0xf7, 0xf6, 0xe7, 0x07, 0x17, 0x0e, 0xe3, 0x02,
-    0x10, 0x08, 0xcb, 0xf1, 0xe5, 0x2a, 0xf3, 0x08, 0x08, 0x15, 0xb9, 0x1d, 0x18, 0xd1, 0x03, 0x2b,
-    0x15, 0xee, 0xf6, 0x33, 0x12, 0x07, 0x2f, 0xad, 0xe8, 0xe3, 0xf5, 0xf6, 0xf6, 0xbe, 0xf0, 0xfd,
-    0xdc, 0x13, 0x10, 0x11, 0x33, 0x69, 0x18, 0x17, 0xf4, 0x14, 0xf3, 0xf1, 0xe7, 0x35, 0xe0, 0x3d,
-    0x19, 0xf0, 0xcd, 0x12, 0x05, 0xdc, 0x04, 0xfc, 0x18, 0x1b, 0xfe, 0x18, 0x0f, 0x00, 0xfd, 0xbd,
-    0xed, 0xed, 0x1b, 0x20, 0xf3, 0x15, 0x03, 0x40, 0x15, 0x0c, 0x4b, 0xf8, 0x31, 0x0d, 0xf4, 0xea,
-    0xe1, 0x31, 0x3d, 0x0e, 0x0b, 0x28, 0xb3, 0x12, 0x38, 0x18, 0x2d, 0x0c, 0x05, 0x12, 0x22, 0x26,
-    0x09, 0xdd, 0xe2, 0xe4, 0xe6, 0xbf, 0xfb, 0xed, 0xe8, 0xee, 0x0d, 0x25, 0xef, 0xce, 0x20, 0xe0,
-    0x0c, 0x26, 0x2a, 0xfb, 0xfa, 0x0c, 0xd9, 0xe4, 0x05, 0x02, 0x07, 0xd8, 0xd8, 0x0c, 0xfb, 0xfc,
-    0x24, 0x19, 0x2d, 0x09, 0x0b, 0xcd, 0x35, 0xf1, 0xe9, 0xca, 0xcf, 0xf6, 0xf3, 0xf0, 0x21, 0xe9,
-    0xea, 0xf4, 0x27, 0xe5, 0x0a, 0xe9, 0xc1, 0xef, 0x18, 0xde, 0x25, 0x00, 0xfa, 0xfa, 0x17, 0x15,
-    0x13, 0x2c, 0x0d, 0x01, 0xcf, 0xf2, 0x14, 0xf6, 0xf1, 0x28, 0xec, 0x0b, 0x0d, 0xe0, 0x61, 0xfe,
-    0xd2, 0x04, 0x13, 0x6b, 0x45, 0x18, 0xc5, 0xea, 0x05, 0xe2, 0x15, 0x12, 0xf7, 0x1c, 0x20, 0xf4,
-    0xee, 0x05, 0x1f, 0xdc, 0x2c, 0xeb, 0xd6, 0xe7, 0xfd, 0xe5, 0xfc, 0xfd, 0x18, 0x0e, 0x14, 0xe3,
-    0x1e, 0xf5, 0xad, 0x12, 0x06, 0xea, 0x2c, 0xf6, 0x18, 0x3f, 0xf4, 0xb1, 0x17, 0x02, 0xfa, 0xf3,
-    0x26, 0x02, 0x14, 0x20, 0x54, 0xf7, 0xa6, 0xf4, 0xea, 0x14, 0x16, 0xf3, 0x23, 0x1d, 0xc3, 0x02,
-    0x01, 0xf8, 0x3a, 0xd3, 0xdf, 0x07, 0x16, 0xfc, 0xfb, 0xe1, 0x06, 0x1f, 0x05, 0x03, 0xd8, 0x19,
-    0x2a, 0x06, 0xd1, 0x23, 0xb7, 0x0e, 0xf3, 0x19, 0xcf, 0xf3, 0x1f, 0x1d, 0x07, 0xda, 0xd8, 0x03,
-    0x28, 0x28, 0x01, 0x0d, 0xfe, 0x14, 0x18, 0x05, 0x37, 0x14, 0xf0, 0xf3, 0x13, 0xdd, 0xd4, 0x27,
-    0xd8, 0x03, 0x01, 0xfb, 0xe1, 0x33, 0xdf, 0xfa, 0xde, 0xee, 0x0b, 0xe4, 0x91, 0xcd, 0x39, 0xfc,
-    0x0f, 0xdd, 0x36, 0xf2, 0xf8, 0x04, 0x18, 0x11, 0x13, 0xf0, 0x51, 0xcb, 0xdb, 0x02, 0xa2, 0x06,
-    0x10, 0xe4, 0x98, 0xf4, 0x0c, 0x0d, 0xf8, 0xc3, 0x1c, 0x0a, 0xd4, 0x05, 0xd9, 0xff, 0x3b, 0xfd,
-    0x17, 0x17, 0xea, 0xf6, 0x30, 0xcc, 0x07, 0x1e, 0x0c, 0x12, 0x2d, 0xb5, 0xfe, 0x2c, 0x10, 0x19,
-    0xf6, 0xf1, 0x01, 0xfe, 0xe6, 0xf1, 0xe0, 0xe9, 0x53, 0x0e, 0xde, 0xfd, 0x22, 0xd9, 0x2b, 0xfb,
-    0xd0, 0x14, 0x0a, 0x05, 0xc5, 0x21, 0xf8, 0x12, 0xff, 0xf9, 0xe3, 0x04, 0x24, 0x20, 0x02, 0x20,
-    0x12, 0xba, 0xc7, 0x0c, 0xde, 0x0e, 0xe5, 0xac, 0x10, 0x0a, 0x34, 0xf1, 0xdc, 0xff, 0xff, 0xf3,
-    0xdd, 0xff, 0x0c, 0x00, 0xfe, 0x01, 0xdc, 0xd3, 0x01, 0x32, 0x10, 0xfe, 0x01, 0x21, 0xfb, 0x2d,
-    0x31, 0x0a, 0xd5, 0x02, 0xfc, 0xd8, 0xeb, 0xe3, 0xe5, 0x0f, 0x05, 0xc5, 0xb9, 0xfd, 0x0d, 0x00,
-    0x03, 0xec, 0x40, 0xe2, 0x0f, 0x23, 0x21, 0x01, 0x21, 0x23, 0x1d, 0x09, 0xf0, 0x25, 0xee, 0x13,
-    0x06, 0xdc, 0xf3, 0xfe, 0x19, 0x23, 0x02, 0xed, 0x19, 0xf7, 0xf8, 0x1d, 0x15, 0x0d, 0x06, 0xfe,
-    0xff, 0xf2, 0x2d, 0x0d, 0xfc, 0xff, 0xf8, 0x15, 0x0c, 0x03, 0xeb, 0x3c, 0x16, 0x02, 0x02, 0xd5,
-    0xea, 0x1f, 0x12, 0x1f, 0x27, 0xfd, 0x4a, 0x15, 0xe9, 0x12, 0xc5, 0xf3, 0xf8, 0x50, 0xdb, 0x0f,
-    0x38, 0x2c, 0xfa, 0xdc, 0x33, 0x0a, 0x03, 0x02, 0xee, 0x19, 0x1e, 0x01, 0xff, 0x0a, 0x20, 0x18,
-    0xf1, 0x2c, 0x3b, 0xdc, 0x19, 0xfa, 0x26, 0x30, 0xfb, 0xfe, 0xc6, 0x0c, 0x09, 0x11, 0x1d, 0xf3,
-    0xd3, 0x0f, 0x10, 0xba, 0x12, 0x09, 0xf3, 0xba, 0x03, 0x03, 0x25, 0xe6, 0x18, 0xde, 0x08, 0x2f,
-    0x01, 0xf2, 0x3a, 0x03, 0xf0, 0x25, 0xde, 0xe2, 0x0a, 0x1d, 0x0e, 0x2b, 0x17, 0xe4, 0xec, 0xfd,
-    0xf2, 0xe6, 0x31, 0xd6, 0xe6, 0x06, 0xc8, 0x14, 0x14, 0xfc, 0xd3, 0xfe, 0xaa, 0x07, 0xe6, 0x1d,
-    0x0d, 0x0a, 0xeb, 0x45, 0xf1, 0xdb, 0xf6, 0x13, 0x10, 0xf1, 0xf8, 0x1a, 0xea, 0xd9, 0x17, 0x19,
-    0x06, 0x10, 0x87, 0xdc, 0x20, 0xc7, 0x22, 0x04, 0xfc, 0x20, 0xe4, 0xb3, 0xf6, 0xd8, 0x10, 0xe7,
-    0x10, 0x0c, 0xf4, 0x14, 0x39, 0x28, 0xb9, 0x2f, 0x0f, 0x31, 0x1a, 0xff, 0x4a, 0x10, 0xe7, 0x29,
-    0x29, 0xeb, 0x00, 0xd3, 0xd5, 0xf1, 0x23, 0x03, 0x23, 0xd3, 0x12, 0xf1, 0xf2, 0xb8, 0xff, 0x07,
-    0x0b, 0x1f, 0x06, 0xdd, 0xd9, 0x9c, 0xd0, 0x1b, 0xeb, 0xfe, 0xfb, 0x13, 0x11, 0xda, 0x17, 0x0c,
-    0x31, 0x18, 0xe0, 0x13, 0x23, 0x1f, 0x0c, 0x3e, 0xf4, 0xfe, 0xfe, 0xf5, 0x0e, 0xee, 0x2f, 0x12,
-    0x0c, 0xcd, 0xd7, 0xd0, 0x02, 0x0c, 0xd3, 0x21, 0x04, 0xfd, 0x37, 0x10, 0x3d, 0xe2, 0x0c, 0x29,
-    0x23, 0xea, 0xdc, 0xfd, 0xf1, 0xff, 0x2a, 0x14, 0x08, 0xfe, 0x28, 0x06, 0xf9, 0xbd, 0xe4, 0xf3,
-    0xde, 0x2e, 0xe0, 0x00, 0xe4, 0xc0, 0xdc, 0x1e, 0xfd, 0x22, 0x5d, 0x11, 0x0b, 0x02, 0xf6, 0xe3,
-    0x22, 0xf7, 0xfc, 0xe4, 0xff, 0x2a, 0x18, 0xd3, 0x16, 0xe2, 0x20, 0x0a, 0xf3, 0xb0, 0xfe, 0xf3,
-    0x10, 0xf9, 0x01, 0xce, 0xf1, 0x23, 0xf2, 0x23, 0xf0, 0x0a, 0x08, 0x16, 0x2a, 0xd5, 0xf6, 0x21,
-    0xfb, 0xf1, 0x26, 0x2b, 0x2a, 0xed, 0x36, 0x14, 0xfa, 0xdb, 0x1f, 0xf8, 0xe3, 0xde, 0xf2, 0xf9,
-    0xff, 0x23, 0x1b, 0x1d, 0x01, 0x0d, 0xf9, 0xe8, 0x0a, 0xf3, 0x07, 0x0f, 0x0e, 0xe1, 0x05, 0xf9,
-    0xd1, 0x0e, 0x23, 0xd7, 0xfd, 0x10, 0xf2, 0xe3, 0x06, 0x33, 0x27, 0x15, 0xf6, 0x01, 0xee, 0x40,
-    0x2d, 0x17, 0x18, 0xfd, 0xeb, 0xd9, 0xd6, 0xec, 0xda, 0x1a, 0xfd, 0xe1, 0x05, 0xca, 0xf1, 0xf6,
-    0x0a, 0x07, 0x22, 0xe8, 0x37, 0x12, 0xfe, 0x1f, 0x1e, 0xfc, 0x14, 0x1f, 0xb8, 0x06, 0x05, 0x1e,
-    0x1e, 0xf9, 0x08, 0xf8, 0x12, 0xd5, 0xf2, 0x1c, 0x14, 0xe9, 0xf6, 0x07, 0x17, 0xc2, 0xf6, 0xe7,
-    0xdf, 0xd5, 0xc5, 0xf8, 0xee, 0xf8, 0xe9, 0xb4, 0xf3, 0xdc, 0xf2, 0xf0, 0x16, 0xf3, 0xe9, 0xd7,
-    0x08, 0x25, 0x44, 0x24, 0xf9, 0x08, 0xae, 0xf3, 0xc8, 0xee, 0x13, 0xdc, 0x19, 0x25, 0xf6, 0x04,
-    0x18, 0x16, 0x17, 0xe8, 0xdd, 0x41, 0x0f, 0xf2, 0x2a, 0x16, 0x1e, 0x00, 0xd2, 0xf2, 0x16, 0x09,
-    0x10, 0xcf, 0xd2, 0x10, 0xbf, 0xe7, 0x0c, 0x0f, 0x18, 0xf1, 0x24, 0x1b, 0xe2, 0xe2, 0x06, 0xe6,
-    0x32, 0xd5, 0xb6, 0x1c, 0x3a, 0x2b, 0x36, 0xfd, 0xea, 0xf3, 0x0e, 0x08, 0xff, 0xee, 0x0c, 0x4f,
-    0xfc, 0xeb, 0xcf, 0x0d, 0x02, 0x23, 0x49, 0x2b, 0xf9, 0x09, 0xcd, 0x06, 0xd6, 0x3b, 0xfd, 0x1f,
-    0xd2, 0xdd, 0x34, 0x0d, 0xc5, 0x18, 0x2b, 0x12, 0x06, 0x01, 0xf4, 0x09, 0xf8, 0x04, 0x00, 0xfd,
-    0xde, 0xf9, 0x0d, 0xe4, 0x0d, 0x1a, 0x18, 0xdc, 0x0d, 0xda, 0xf3, 0xe8, 0xed, 0x08, 0xff, 0x00,
-    0xed, 0x0a, 0x29, 0xf6, 0xd5, 0x23, 0xe7, 0x30, 0xec, 0xe2, 0xfa, 0x58, 0xfa, 0x00, 0xe3, 0xe1,
-    0xff, 0x0f, 0x00, 0x0a, 0x1e, 0x0a, 0x19, 0x3b, 0x0f, 0xe6, 0xde, 0xe2, 0xe1, 0x4a, 0xfb, 0x36,
-    0x3c, 0x12, 0x07, 0x15, 0x23, 0xe8, 0x00, 0x16, 0x10, 0x31, 0x17, 0xe8, 0x26, 0x0a, 0x1a, 0x0a,
-    0xf0, 0x26, 0x1e, 0xce, 0x09, 0x0e, 0x2f, 0x2a, 0x21, 0x09, 0x03, 0x14, 0xc8, 0xde, 0x17, 0xde,
-    0x1e, 0xd6, 0x20, 0x31, 0x22, 0x0f, 0x1e, 0xd4, 0xdb, 0xe8, 0xf1, 0xde, 0x0b, 0xe0, 0xf8, 0x2b,
-    0xe4, 0xe8, 0x2f, 0xda, 0xfd, 0x0e, 0x22, 0x04, 0x0d, 0xe1, 0x23, 0x0d, 0x02, 0x28, 0xdd, 0x27,
-    0xf0, 0x00, 0x08, 0x34, 0x33, 0xd8, 0x00, 0x32, 0xe3, 0x15, 0x38, 0x16, 0x05, 0x3e, 0xd6, 0xe1,
-    0xcb, 0xd0, 0xda, 0xf3, 0x33, 0x08, 0x01, 0x17, 0x26, 0xff, 0x1b, 0xff, 0x13, 0xfa, 0x15, 0xe5,
-    0x23, 0x13, 0xfc, 0xef, 0x44, 0x0e, 0xdc, 0xde, 0xdf, 0xf5, 0x19, 0xc5, 0x0c, 0xf8, 0xdb, 0x0a,
-    0xeb, 0x3e, 0x08, 0xff, 0xc2, 0x04, 0x20, 0xfe, 0x04, 0x0a, 0x1b, 0x19, 0x0c, 0xe4, 0xbf, 0xe6,
-    0xd7, 0xfc, 0x0d, 0x3c, 0xda, 0xf9, 0xfe, 0x16, 0xf6, 0xde, 0x21, 0xf0, 0x30, 0x0b, 0x24, 0xf6,
-    0x3a, 0xfe, 0x05, 0x16, 0x1d, 0x00, 0x03, 0xc7, 0x0a, 0xf2, 0xd1, 0xef, 0x00, 0xf6, 0x17, 0x26,
-    0x06, 0xfe, 0xf1, 0x12, 0xf0, 0xf5, 0xf6, 0xef, 0x09, 0x1b, 0xd4, 0xdf, 0x01, 0x2e, 0x06, 0xe2,
-    0xe8, 0x0a, 0xfc, 0x2e, 0x14, 0x15, 0xc5, 0xf9, 0x07, 0x04, 0x24, 0xb6, 0x19, 0x16, 0x0b, 0x0a,
-    0xf7, 0xfb, 0xfb, 0xee, 0xe2, 0x1e, 0x03, 0x0d, 0x0c, 0x04, 0xde, 0x0e, 0x1d, 0x1b, 0x11, 0x00,
-    0xf6, 0xe0, 0xd1, 0x06, 0xf1, 0x20, 0x05, 0xf1, 0x18, 0x16, 0xfa, 0x16, 0x1a, 0xee, 0x29, 0xf6,
-    0xfa, 0x01, 0x3d, 0xe9, 0x0f, 0xda, 0xe5, 0x0e, 0x0a, 0x0f, 0x0e, 0x42, 0xea, 0x06, 0x0b, 0x30,
-    0xff, 0xbb, 0xf0, 0xf7, 0xab, 0xdc, 0xcf, 0xe5, 0xfc, 0x19, 0x1b, 0x08, 0xe3, 0xbf, 0x02, 0xe4,
-    0x0b, 0x0c, 0x19, 0x20, 0x05, 0x1b, 0xfb, 0x34, 0x0f, 0xec, 0x05, 0xfd, 0xfa, 0x32, 0x15, 0x25,
-    0x13, 0x15, 0xfa, 0x09, 0x0b, 0x15, 0xe5, 0xe6, 0xe4, 0xd7, 0xe1, 0xe4, 0xdc, 0xef, 0x16, 0xd1,
-    0xd6, 0xf4, 0x02, 0xef, 0xd7, 0xfc, 0xcc, 0xb8, 0xec, 0x02, 0x15, 0x1b, 0x03, 0xe8, 0x03, 0x01,
-    0xe3, 0x1e, 0x16, 0x04, 0xea, 0xe7, 0xff, 0x01, 0xcf, 0x09, 0xe3, 0xcc, 0x0e, 0x21, 0xbe, 0x16,
-    0x16, 0x13, 0x2c, 0xd8, 0x4d, 0x0a, 0xfd, 0x1f, 0xfd, 0x17, 0x22, 0x1f, 0xd3, 0x09, 0x16, 0x1a,
-    0x22, 0xd9, 0xe6, 0x0d, 0x05, 0xff, 0x28, 0x18, 0x21, 0xfb, 0xcd, 0x1b, 0x19, 0x10, 0x23, 0x44,
-    0x08, 0x03, 0x25, 0x06, 0xe8, 0xe1, 0xaf, 0x17, 0xf4, 0x14, 0xeb, 0x19, 0x26, 0x15, 0x0e, 0xc7,
-    0x1f, 0xfd, 0x02, 0x11, 0x32, 0xfc, 0x5d, 0x05, 0x07, 0xec, 0xf5, 0x1d, 0xf8, 0xf8, 0x28, 0x32,
-    0x2b, 0x34, 0xd5, 0xff, 0x31, 0xf8, 0x00, 0x11, 0x0f, 0x19, 0xfd, 0x12, 0x30, 0xed, 0x2f, 0xfd,
-    0x0d, 0x10, 0x06, 0xfd, 0xd3, 0xc4, 0x2c, 0x14, 0x0c, 0xe2, 0x31, 0xfa, 0x12, 0x05, 0x10, 0xd9,
-    0xc7, 0xf3, 0x18, 0xa3, 0x01, 0x14, 0x00, 0xc3, 0xf7, 0xeb, 0xf6, 0x2d, 0xf8, 0x04, 0x21, 0x17,
-    0xe9, 0xde, 0x18, 0x12, 0x1d, 0xfe, 0x2d, 0xf6, 0xe4, 0x0c, 0x0a, 0x1d, 0x2c, 0x1e, 0x0f, 0xd5,
-    0x23, 0xfc, 0x0a, 0xe4, 0xf8, 0x07, 0xf0, 0x0c, 0xe8, 0x06, 0x0b, 0x02, 0x0a, 0x09, 0x19, 0x19,
-    0x07, 0x04, 0x04, 0x0f, 0x00, 0xdb, 0x29, 0x3a, 0x23, 0xec, 0x2c, 0xf2, 0xd2, 0x06, 0x45, 0x1a,
-    0x0e, 0x0d, 0xdb, 0x16, 0x12, 0xf9, 0x3a, 0x14, 0x13, 0xf3, 0xfa, 0xbd, 0x0a, 0x0f, 0xe7, 0xef,
-    0xee, 0xde, 0x28, 0x14, 0x2a, 0x01, 0xef, 0x0c, 0x1e, 0xfc, 0x0d, 0xca, 0x21, 0x50, 0xc8, 0xf0,
-    0xf3, 0x18, 0x09, 0xdc, 0xbd, 0x19, 0x15, 0x09, 0x0d, 0x29, 0x0d, 0xf0, 0x0a, 0x0f, 0x18, 0x19,
-    0x03, 0xf5, 0xfa, 0xe6, 0xd4, 0x07, 0x18, 0xe3, 0x04, 0xfb, 0xf9, 0x19, 0x11, 0xe0, 0xf6, 0x0f,
-    0xe7, 0xe9, 0x20, 0xf7, 0x01, 0xdc, 0xbd, 0xfe, 0x02, 0x44, 0x14, 0x0f, 0x1a, 0x1e, 0x10, 0x27,
-    0x25, 0x13, 0xce, 0x10, 0xdc, 0xd6, 0xf0, 0xdc, 0x00, 0xfa, 0x21, 0xc8, 0xe4, 0xe3, 0x1c, 0x03,
-    0x03, 0x00, 0x1f, 0xfd, 0x36, 0x05, 0xf6, 0xfe, 0xff, 0x2a, 0x15, 0x1a, 0xf1, 0x0d, 0xf9, 0xf7,
-    0x20, 0xef, 0xe8, 0x12, 0x29, 0x10, 0x17, 0x0b, 0x10, 0xfd, 0xde, 0x17, 0x30, 0x12, 0xdf, 0x0a,
-    0xd7, 0xf5, 0x0b, 0x17, 0xe6, 0xb6, 0x12, 0x29, 0x32, 0xed, 0xe9, 0x06, 0xe1, 0x24, 0x19, 0x06,
-    0x15, 0x1f, 0x00, 0x29, 0xb7, 0x2c, 0xe5, 0x08, 0x02, 0x27, 0xbc, 0x20, 0x0b, 0x1c, 0xfa, 0x04,
-    0x04, 0xc0, 0x08, 0x09, 0xe5, 0x07, 0xea, 0xeb, 0xff, 0xfc, 0xdc, 0x07, 0xec, 0x30, 0x2f, 0x01,
-    0xe1, 0x08, 0xe8, 0x20, 0x20, 0xed, 0xf9, 0xe6, 0x1e, 0xf2, 0xcf, 0x22, 0x05, 0xe6, 0x0b, 0x0e,
-    0xe1, 0xfb, 0xf3, 0xfb, 0xf4, 0x04, 0x21, 0xd9, 0xe9, 0xf7, 0xe7, 0xf5, 0x29, 0x2a, 0xdc, 0xe9,
-    0xf8, 0x21, 0x34, 0x09, 0x03, 0xf6, 0xcd, 0xf4, 0xfa, 0x18, 0x23, 0xfb, 0x07, 0x41, 0xe7, 0x0c,
-    0x1a, 0xf0, 0xf0, 0xe3, 0x06, 0xfb, 0x08, 0x19, 0xf0, 0x12, 0x16, 0x1a, 0x0a, 0x37, 0xf1, 0xe3,
-    0xe7, 0xb7, 0xbb, 0x26, 0x18, 0x26, 0x14, 0xf4, 0x35, 0x10, 0xdc, 0x22, 0x21, 0xec, 0x25, 0x04,
-    0xe2, 0xec, 0x29, 0xf0, 0x10, 0xe4, 0xea, 0x07, 0x03, 0x0c, 0xf0, 0xe2, 0x05, 0xd2, 0x0d, 0x13,
-    0x20, 0x1b, 0x19, 0x0c, 0xe9, 0xfe, 0xbf, 0x0b, 0xf0, 0x09, 0xf3, 0xf3, 0x01, 0x07, 0xc3, 0xd6,
-    0xf8, 0xfb, 0x17, 0xec, 0xfa, 0xf2, 0x04, 0x0f, 0x16, 0xee, 0x1e, 0x31, 0xed, 0x2e, 0x17, 0x01,
-    0x1c, 0x0c, 0x26, 0x1f, 0x21, 0x08, 0x05, 0x0a, 0x04, 0x06, 0xb4, 0x04, 0x1c, 0x1d, 0x00, 0x22,
-    0xfc, 0xe2, 0xef, 0x10, 0x2a, 0x1a, 0x18, 0x27, 0xe8, 0x01, 0xe6, 0x05, 0x00, 0xa3, 0xfb, 0xe5,
-    0x18, 0x29, 0xd7, 0x03, 0x34, 0x2a, 0xf3, 0x3a, 0x0f, 0xf4, 0xf2, 0x33, 0xec, 0x16, 0xcb, 0x2b,
-    0x3e, 0x05, 0xc9, 0xed, 0xec, 0xbf, 0x2b, 0x00, 0x2c, 0x1e, 0x1a, 0xef, 0x10, 0xc5, 0x0e, 0x19,
-    0x01, 0x2a, 0x0e, 0x00, 0xc8, 0xd3, 0x04, 0x24, 0x0a, 0xfc, 0x13, 0x07, 0xf5, 0xec, 0x18, 0xff,
-    0xfd, 0x02, 0x0f, 0xbb, 0x16, 0xf8, 0x15, 0xd6, 0x17, 0xc5, 0x1a, 0x0f, 0xfe, 0xe0, 0x0f, 0x00,
-    0x09, 0x07, 0x2a, 0x0f, 0xf1, 0xe8, 0x26, 0x1f, 0xf5, 0x1f, 0x91, 0x1c, 0x0f, 0xed, 0xd1, 0xd3,
-    0x02, 0x07, 0x05, 0x0b, 0x12, 0x08, 0xeb, 0x14, 0xfc, 0xfa, 0x14, 0xdc, 0xe0, 0xfd, 0x0a, 0x17,
-    0xd3, 0xb7, 0x2b, 0x01, 0x2b, 0x00, 0x1e, 0xb9, 0x20, 0xe9, 0xdd, 0x05, 0x0d, 0x15, 0x03, 0x15,
-    0x25, 0x1e, 0x01, 0xe6, 0x23, 0x1a, 0x1c, 0x0d, 0xfb, 0x12, 0x0d, 0xa5, 0x21, 0xe9, 0xec, 0xf6,
-    0x18, 0x1f, 0xf2, 0xfb, 0xf6, 0x0d, 0x0e, 0x49, 0x14, 0xed, 0xf3, 0x10, 0xee, 0x11, 0xe9, 0xd9,
-    0x14, 0xef, 0xf3, 0x2a, 0x91, 0x00, 0x06, 0xe5, 0x11, 0x1b, 0x14, 0xd9, 0x3a, 0xf0, 0x20, 0x0d,
-    0x06, 0xee, 0x14, 0xe1, 0x04, 0x12, 0xfd, 0xcf, 0x18, 0xe2, 0xde, 0xf3, 0x16, 0x2a, 0x06, 0xf8,
-    0x16, 0xfb, 0xf1, 0xfa, 0x34, 0xfd, 0xf6, 0x05, 0xf1, 0x14, 0x03, 0xb3, 0xfd, 0x1f, 0x1c, 0xfe,
-    0x28, 0x06, 0xef, 0x01, 0xe3, 0xf5, 0xde, 0xe2, 0x07, 0x03, 0x14, 0x2c, 0x24, 0xe5, 0x48, 0xef,
-    0xec, 0xe2, 0xf3, 0x38, 0xd6, 0x0a, 0x20, 0xdf, 0x21, 0x03, 0xef, 0x09, 0x28, 0xff, 0x00, 0xf1,
-    0xf6, 0xf3, 0xe8, 0x28, 0x1b, 0x1c, 0xe0, 0xe9, 0x0d, 0x21, 0xfd, 0x00, 0xc0, 0x35, 0xd0, 0xd3,
-    0x2d, 0xe4, 0xf8, 0x01, 0xde, 0x1c, 0xf7, 0x04, 0x07, 0xc7, 0x2a, 0xcb, 0x16, 0xc9, 0x23, 0x19,
-    0xf5, 0xdd, 0x11, 0xce, 0xde, 0x16, 0x41, 0x1b, 0x0b, 0xe7, 0xe8, 0xf2, 0xeb, 0x19, 0x4b, 0x3e,
-    0xfa, 0x0c, 0x1a, 0x18, 0x37, 0xf9, 0x2b, 0x03, 0xe5, 0xd8, 0xff, 0x2a, 0x2b, 0xf2, 0xe5, 0xf4,
-    0x19, 0xf6, 0x1e, 0xd3, 0x29, 0x0e, 0x0c, 0xd6, 0x1b, 0xd6, 0xe8, 0x09, 0x11, 0xef, 0xfe, 0x2d,
-    0xea, 0x05, 0x17, 0xf5, 0xf0, 0xc2, 0xec, 0x23, 0x1d, 0x42, 0xdb, 0x08, 0x01, 0x45, 0xf7, 0xd6,
-    0x12, 0x07, 0xc6, 0x31, 0xfa, 0xe4, 0xef, 0xea, 0x2a, 0xf1, 0x3c, 0xda, 0xdc, 0x03, 0x03, 0x0e,
-    0x1e, 0xf5, 0x05, 0xc7, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x0a, 0xf8, 0x14, 0x2e, 0x25, 0xe5, 0x03,
-    0x1b, 0x08, 0x00, 0xe3, 0x06, 0xf5, 0x0f, 0x1b, 0xda, 0x0e, 0xdb, 0x13, 0x07, 0x49, 0x2d, 0xc2,
-    0x3a, 0x09, 0xf6, 0x25, 0xfb, 0xfa, 0xe0, 0xd9, 0xf1, 0x08, 0xda, 0xf6, 0xfd, 0x06, 0xf0, 0xce,
-    0xde, 0xfa, 0x13, 0x13, 0x0a, 0xfb, 0xe5, 0xee, 0x20, 0x23, 0x0c, 0x9d, 0x11, 0xf3, 0x1a, 0x38,
-    0x16, 0x09, 0xd8, 0xf5, 0x1d, 0x11, 0xfb, 0x23, 0x13, 0x11, 0xf0, 0x0c, 0xf8, 0xed, 0xef, 0x04,
-    0x0c, 0x0c, 0xcf, 0x0c, 0xcb, 0xda, 0xc8, 0xcf, 0xd5, 0x1a, 0xf3, 0x2d, 0xd0, 0x1f, 0x17, 0xc4,
-    0xef, 0x29, 0x1e, 0xe4, 0x16, 0x56, 0x1a, 0xda, 0xff, 0x0b, 0x1c, 0xdb, 0x36, 0x07, 0xbb, 0x08,
-    0x2f, 0xfe, 0x0b, 0xe4, 0xee, 0x01, 0x3d, 0x0c, 0xef, 0xe1, 0x1b, 0xeb, 0x1b, 0xeb, 0xca, 0xe7,
-    0x15, 0xce, 0x1e, 0x39, 0xce, 0xfe, 0x1c, 0xf5, 0xd6, 0xd9, 0xfd, 0xd8, 0x3a, 0x2c, 0xd5, 0x30,
-    0x22, 0xf6, 0xf1, 0xf2, 0xe8, 0x3b, 0xe8, 0x21, 0x2a, 0xfb, 0x02, 0xd1, 0xdd, 0x0b, 0x18, 0xfc,
-    0xf3, 0x36, 0xfb, 0xfe, 0x2c, 0xfb, 0x1e, 0x37, 0xf0, 0xf0, 0x11, 0xab, 0xef, 0x46, 0x10, 0xfe,
-    0xd8, 0xfd, 0xfa, 0xe9, 0xea, 0xf9, 0x28, 0xff, 0x31, 0x09, 0xf6, 0x07, 0xee, 0xfd, 0x49, 0x03,
-    0xec, 0xff, 0x02, 0x14, 0x01, 0xfd, 0xed, 0x07, 0xf0, 0x08, 0xfc, 0x20, 0x24, 0xee, 0x10, 0x09,
-    0xe5, 0xb9, 0x13, 0x05, 0xf3, 0x0f, 0xdf, 0xc1, 0x00, 0x17, 0x22, 0x16, 0x3a, 0x00, 0x1f, 0xe0,
-    0x31, 0x05, 0xc3, 0x11, 0x36, 0x12, 0xd9, 0xd0, 0xff, 0x1c, 0xf3, 0xca, 0xe9, 0x1c, 0xd7, 0x22,
-    0x0d, 0xf4, 0x12, 0xf9, 0x0c, 0xf6, 0xe8, 0x08, 0x10, 0x1e, 0x32, 0x40, 0x1b, 0xed, 0xd4, 0xdb,
-    0xe4, 0x19, 0x1a, 0xea, 0xa9, 0x12, 0x17, 0xfe, 0x04, 0xd3, 0x03, 0x02, 0x20, 0xdd, 0x10, 0x2c,
-    0x40, 0xd7, 0xd2, 0x0e, 0xeb, 0xd4, 0xec, 0xc6, 0xdb, 0x19, 0xe1, 0xd9, 0x09, 0xfb, 0x10, 0xe0,
-    0xf3, 0xa9, 0x15, 0x13, 0x2c, 0x07, 0xee, 0xc9, 0xe5, 0xe4, 0x0e, 0x3c, 0x10, 0x15, 0x1d, 0x0a,
-    0x17, 0xf1, 0x10, 0xf6, 0xfe, 0x0b, 0x3b, 0x08, 0x0b, 0xf7, 0xd0, 0xdc, 0x0a, 0x09, 0xde, 0x01,
-    0xdc, 0x0f, 0xde, 0x14, 0x43, 0xf5, 0x20, 0x21, 0x03, 0x03, 0xf8, 0x1d, 0x11, 0x09, 0x0d, 0xef,
-    0x07, 0x19, 0x15, 0x15, 0x29, 0x1a, 0x26, 0xfa, 0xe7, 0x24, 0xb5, 0x02, 0x0e, 0x10, 0xe1, 0xf5,
-    0x1c, 0x16, 0xdc, 0x32, 0x13, 0x82, 0x19, 0x35, 0x05, 0x0f, 0xe3, 0x08, 0xe6, 0xf7, 0x1a, 0xe9,
-    0xdb, 0xe2, 0x12, 0x34, 0x2b, 0x24, 0x0a, 0x20, 0xfc, 0x11, 0xe4, 0x2d, 0xee, 0x3d, 0x1b, 0x1d,
-    0x18, 0x14, 0x02, 0xf9, 0xec, 0x0d, 0x00, 0xf5, 0xfb, 0xf3, 0xd5, 0xfa, 0x26, 0xee, 0x09, 0x00,
-    0xfb, 0x2f, 0x0b, 0xec, 0xd6, 0xd3, 0xde, 0xe5, 0xd3, 0x23, 0x50, 0xf6, 0x37, 0xed, 0xfe, 0xfc,
-    0x22, 0xe4, 0x08, 0xfa, 0xe4, 0x4d, 0x11, 0x08, 0xf0, 0x01, 0x0d, 0x30, 0x12, 0xfa, 0xd5, 0xe1,
-    0x04, 0x38, 0x1e, 0xf5, 0x41, 0x12, 0xf8, 0x1f, 0xbc, 0x0f, 0xe0, 0x6b, 0x02, 0x06, 0xbf, 0xe5,
-    0x3a, 0xef, 0xf0, 0x0f, 0xf0, 0xf2, 0x13, 0x0d, 0x09, 0x08, 0x03, 0x04, 0xe2, 0xe3, 0x37, 0xec,
-    0xe3, 0x1b, 0xe8, 0x1f, 0xe4, 0x0a, 0xf2, 0x0d, 0x1a, 0x0c, 0x40, 0xf1, 0xd3, 0xe1, 0x16, 0x17,
-    0xfc, 0x2c, 0xf4, 0xf5, 0x21, 0xec, 0x09, 0xec, 0x11, 0xf0, 0x11, 0x06, 0x06, 0x2c, 0xfa, 0x22,
-    0x28, 0x08, 0x01, 0x05, 0xdf, 0xfb, 0x1b, 0xe2, 0x2e, 0xeb, 0x1e, 0xbf, 0xf3, 0x15, 0x08, 0xfd,
-    0xda, 0xed, 0x2a, 0xfe, 0xf9, 0x28, 0xf4, 0x12, 0xef, 0x15, 0x1a, 0xed, 0x05, 0x35, 0xf4, 0x13,
-    0x0e, 0xb4, 0xe8, 0xd9, 0x15, 0x0b, 0x17, 0xcf, 0x22, 0x19, 0xc2, 0x09, 0x22, 0x01, 0xf3, 0x05,
-    0xd0, 0x0e, 0x14, 0xd1, 0x20, 0x27, 0xf1, 0x24, 0x01, 0x06, 0x0d, 0x13, 0x06, 0xfe, 0xf2, 0xf2,
-    0x26, 0x1d, 0xfe, 0x0f, 0x00, 0x03, 0xe0, 0xf9, 0x12, 0xe0, 0xfb, 0xf8, 0xd4, 0x1d, 0x23, 0xf5,
-    0x18, 0xe2, 0x06, 0x2b, 0x14, 0x0d, 0xea, 0x04, 0xf5, 0x1f, 0x1a, 0xef, 0x10, 0x2b, 0x19, 0xff,
-    0xfa, 0xfa, 0x18, 0x18, 0x39, 0x05, 0x19, 0x33, 0x3e, 0xf1, 0xe2, 0xef, 0x0c, 0xd8, 0x06, 0x19,
-    0xd1, 0x2a, 0xf4, 0xfa, 0x32, 0xeb, 0xe7, 0x3a, 0x12, 0x12, 0xf1, 0x43, 0x0e, 0x24, 0x35, 0xe2,
-    0x1c, 0xe0, 0x97, 0x06, 0xf8, 0xf2, 0x1b, 0xf7, 0x0d, 0xfc, 0x3f, 0x3e, 0xfd, 0xf3, 0x7f, 0x08,
-    0xc0, 0x00, 0xc2, 0x3f, 0x38, 0x1f, 0xee, 0xf9, 0x2a, 0xc3, 0xf4, 0xea, 0x12, 0x13, 0xe3, 0x17,
-    0x03, 0x14, 0xf3, 0x09, 0x12, 0xd9, 0xef, 0x3d, 0xf4, 0xf8, 0x2b, 0xf2, 0xe3, 0x09, 0x37, 0x05,
-    0x15, 0x04, 0x00, 0xcc, 0x35, 0xee, 0x1d, 0xf9, 0x05, 0x02, 0x1d, 0xa6, 0x12, 0x21, 0x24, 0x1e,
-    0xf7, 0x1f, 0x08, 0xfe, 0x03, 0xe5, 0x28, 0x1f, 0x31, 0x0c, 0xc8, 0x19, 0xee, 0x07, 0x08, 0xd7,
-    0xd2, 0xfa, 0xe3, 0x30, 0xf4, 0x10, 0xf3, 0x13, 0xfa, 0x35, 0xfb, 0x18, 0x21, 0x04, 0x1b, 0x0f,
-    0xf4, 0xc8, 0x3e, 0xdd, 0x0e, 0x1b, 0x05, 0xc9, 0x17, 0xe5, 0xf9, 0x06, 0x30, 0xec, 0x17, 0xfa,
-    0x20, 0xfb, 0xfe, 0xbd, 0x05, 0xf7, 0x16, 0xef, 0xde, 0x0f, 0xee, 0xf0, 0xf8, 0x01, 0x2c, 0x0a,
-    0x05, 0xdc, 0x1b, 0x06, 0x2d, 0xb7, 0x04, 0x27, 0xe0, 0xec, 0x2f, 0x57, 0x2d, 0x04, 0x2a, 0x15,
-    0x32, 0xff, 0xd6, 0x26, 0xd2, 0xf7, 0x1e, 0x1e, 0xd0, 0x0b, 0xd7, 0x1c, 0x0c, 0xda, 0x21, 0xe1,
-    0xc0, 0x09, 0x2f, 0x0c, 0xed, 0xeb, 0x16, 0x34, 0x28, 0xb7, 0x6e, 0x0c, 0x0d, 0xcd, 0xc5, 0x05,
-    0xeb, 0x3d, 0x27, 0xe0, 0xd5, 0x10, 0xd0, 0x0e, 0x1f, 0xe9, 0xf1, 0x11, 0xe3, 0x3c, 0x16, 0x24,
-    0xde, 0xff, 0xc9, 0xe3, 0x0b, 0x00, 0x24, 0xa2, 0x20, 0x29, 0x39, 0xd5, 0xe5, 0xdb, 0x28, 0xf7,
-    0xd5, 0x04, 0xed, 0xe5, 0x33, 0x36, 0xf6, 0x0d, 0xf5, 0xef, 0x4a, 0xcb, 0xf8, 0x05, 0xd1, 0xf2,
-    0xec, 0x21, 0x9d, 0xf1, 0x36, 0x1d, 0xde, 0x22, 0xd7, 0x0d, 0xcb, 0x0e, 0x2c, 0xbd, 0xf0, 0xf0,
-    0xd1, 0xc1, 0x14, 0x18, 0xd3, 0x35, 0x00, 0xf4, 0x0a, 0x0d, 0xf1, 0x3a, 0xf7, 0xe6, 0xd5, 0xf1,
-    0xc9, 0x25, 0x06, 0x1d, 0x20, 0x25, 0xeb, 0xfd, 0xe1, 0xf1, 0x32, 0x16, 0x2b, 0x3e, 0xd2, 0xda,
-    0x17, 0x2a, 0x04, 0xe0, 0x13, 0xed, 0xe2, 0xeb, 0x11, 0x04, 0x3c, 0xec, 0xe8, 0x0b, 0xeb, 0xbf,
-    0x14, 0xcb, 0xe8, 0x05, 0xf3, 0x1e, 0x30, 0x55, 0x26, 0x28, 0x0a, 0xf0, 0xd9, 0xf0, 0xfe, 0xfe,
-    0x13, 0x35, 0x10, 0x19, 0xfb, 0xad, 0x1d, 0xfc, 0xff, 0xec, 0x01, 0xd2, 0xfd, 0x23, 0xf3, 0xd7,
-    0xcb, 0xe8, 0x25, 0xfc, 0xe3, 0x21, 0xcf, 0xd5, 0x3b, 0x06, 0x32, 0x2e, 0x02, 0x11, 0x0b, 0x04,
-    0xb2, 0xfe, 0x2d, 0x20, 0xe5, 0xff, 0xec, 0x24, 0x03, 0x07, 0xee, 0xee, 0x28, 0x07, 0xf6, 0x1d,
-    0xd7, 0xbf, 0xd2, 0xea, 0xf5, 0x26, 0xf0, 0xdc, 0x1f, 0x2f, 0xe4, 0x11, 0xd9, 0x17, 0xfd, 0xe0,
-    0x4a, 0x09, 0xf7, 0x40, 0xf7, 0xdd, 0x3a, 0xee, 0x14, 0xff, 0xf7, 0xe6, 0x1d, 0xce, 0x0c, 0x0e,
-    0xff, 0xdc, 0xd4, 0xd9, 0x00, 0x1d, 0xf9, 0x27, 0x10, 0xee, 0x2e, 0x12, 0xff, 0xff, 0xf4, 0x1d,
-    0x04, 0x0c, 0x02, 0x08, 0xf8, 0x1f, 0x3c, 0xf1, 0xfb, 0xfd, 0xe9, 0x01, 0xf9, 0xd8, 0xfe, 0x00,
-    0x32, 0xf6, 0xd9, 0x1c, 0xf9, 0x1b, 0xff, 0x9f, 0x0d, 0x0b, 0xf2, 0x11, 0x59, 0xce, 0xf9, 0x0f,
-    0x19, 0xfc, 0xfb, 0x22, 0x01, 0x29, 0x0d, 0x1d, 0xe3, 0x29, 0x1c, 0x4f, 0x1d, 0xde, 0x1a, 0xf6,
-    0x04, 0x21, 0x0e, 0xfc, 0x20, 0x0f, 0xd5, 0xf6, 0xbb, 0x10, 0x0a, 0x3f, 0x01, 0x4a, 0xb1, 0xd3,
-    0x1e, 0xf0, 0x15, 0xfe, 0x46, 0xf8, 0xc3, 0xda, 0x24, 0xf1, 0xdf, 0x12, 0x07, 0xfd, 0x0e, 0xca,
-    0xdd, 0x2f, 0x40, 0x15, 0x13, 0x2a, 0xf5, 0x50, 0x08, 0x0c, 0xfd, 0xfd, 0x25, 0x09, 0x0a, 0xfb,
-    0xdf, 0xd0, 0x25, 0xc1, 0x20, 0x1d, 0x05, 0xbb, 0x0e, 0x12, 0xe8, 0x37, 0xbe, 0x14, 0x19, 0x0d,
-    0x0c, 0x06, 0x14, 0x20, 0x25, 0xfb, 0xef, 0x10, 0x24, 0xda, 0xc4, 0x51, 0x3e, 0xd4, 0x08, 0xdd,
-    0xe8, 0xde, 0xde, 0x3a, 0x2c, 0x0f, 0x1a, 0x20, 0xe9, 0xd7, 0xf7, 0x2e, 0xe5, 0xe8, 0xf8, 0xd7,
-    0x9f, 0xfd, 0x1c, 0x38, 0x1a, 0xe8, 0x32, 0xda, 0x28, 0xee, 0x6b, 0xfc, 0x24, 0x15, 0x09, 0xe5,
-    0x08, 0xfb, 0x0c, 0xf4, 0x1f, 0x1e, 0xdb, 0xfe, 0xf3, 0x20, 0x2a, 0x9b, 0x24, 0xed, 0xe5, 0x31,
-    0x1e, 0x26, 0xed, 0xfe, 0xd3, 0xdf, 0x0f, 0x08, 0x18, 0xf7, 0x16, 0x20, 0xfe, 0xda, 0x2c, 0x04,
-    0x0c, 0x11, 0x20, 0x11, 0xd3, 0x1a, 0x1c, 0xe1, 0xf0, 0x0d, 0x21, 0xde, 0xf8, 0x01, 0xf7, 0x09,
-    0x2d, 0x05, 0x09, 0x25, 0xd3, 0x1b, 0xe4, 0xd4, 0x1a, 0xf3, 0x1e, 0x14, 0x11, 0x02, 0xe4, 0x1e,
-    0xd2, 0x11, 0xa8, 0x25, 0xbb, 0xfa, 0xee, 0xd9, 0xfd, 0x04, 0x27, 0x27, 0x19, 0x1c, 0xd2, 0xd5,
-    0xac, 0x1d, 0xf1, 0x13, 0xf6, 0xee, 0xd7, 0xfa, 0xfd, 0xe5, 0xc3, 0xfd, 0x13, 0x0d, 0x01, 0xbe,
-    0xf5, 0xe4, 0x31, 0x01, 0x4b, 0xcd, 0x0b, 0xfc, 0x0e, 0x01, 0x1b, 0x27, 0x0e, 0x06, 0x05, 0x18,
-    0x0d, 0xa0, 0xe7, 0xd4, 0xe7, 0x1c, 0x2a, 0xfd, 0x2e, 0x07, 0xb5, 0xfc, 0xf2, 0x00, 0x14, 0xed,
-    0xf6, 0xbd, 0xff, 0x26, 0xfb, 0x25, 0xf5, 0xe3, 0xdd, 0xf1, 0xff, 0x45, 0x30, 0x0c, 0xee, 0xfe,
-    0x04, 0x09, 0x07, 0x04, 0xe9, 0x0c, 0x1d, 0x20, 0xf3, 0xe7, 0xe9, 0xe2, 0xea, 0x09, 0xd0, 0x1f,
-    0x0a, 0x27, 0x06, 0xfe, 0x50, 0x05, 0x30, 0x08, 0xf7, 0x1e, 0x21, 0x25, 0x07, 0x2f, 0xfc, 0xf3,
-    0x1b, 0xfe, 0xf2, 0x0f, 0x13, 0x2f, 0x15, 0x10, 0x19, 0x2c, 0xa0, 0x2c, 0xc6, 0xfa, 0xff, 0xff,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x81, 0xfe, 0xff, 0xff,
-    0x9e, 0x04, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xb1, 0x01, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff,
-    0xc2, 0x01, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xff, 0x42, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff,
-    0xed, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x3b, 0x01, 0x00, 0x00, 0xc8, 0xff, 0xff, 0xff,
-    0xe6, 0xfc, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xff, 0x76, 0xfe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xff,
-    0x97, 0xfe, 0xff, 0xff, 0x9f, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x49, 0xff, 0xff, 0xff,
-    0x0b, 0xff, 0xff, 0xff, 0xe7, 0x02, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x49, 0xfe, 0xff, 0xff,
-    0x19, 0x02, 0x00, 0x00, 0x1d, 0xfe, 0xff, 0xff, 0x11, 0xfe, 0xff, 0xff, 0xbb, 0x03, 0x00, 0x00,
-    0x89, 0x01, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0x37, 0xfd, 0xff, 0xff,
-    0x2c, 0xfe, 0xff, 0xff, 0x0f, 0xfe, 0xff, 0xff, 0x7e, 0x01, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00,
-    0xf0, 0x03, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00, 0x2d, 0xff, 0xff, 0xff, 0x20, 0x04, 0x00, 0x00,
-    0x82, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xa2, 0x02, 0x00, 0x00, 0xac, 0xfc, 0xff, 0xff,
-    0xa1, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x38, 0x04, 0x00, 0x00, 0xc5, 0xff, 0xff, 0xff,
-    0x8f, 0xfe, 0xff, 0xff, 0x39, 0x01, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00, 0x5f, 0xfe, 0xff, 0xff,
-    0xf7, 0x01, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, 0xf5, 0xfb, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff,
-    0x52, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0xd2, 0xfb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-    0x80, 0x02, 0x00, 0x00, 0x07, 0x03, 0xf3, 0xf6, 0xca, 0x16, 0xf5, 0xf1, 0x04, 0xdb, 0x1e, 0xae,
-    0x37, 0x20, 0x0c, 0xfe, 0xed, 0x19, 0x2c, 0x17, 0x11, 0x10, 0x23, 0xfd, 0xca, 0x1f, 0x17, 0xed,
-    0x00, 0xec, 0xd8, 0xe3, 0x21, 0xeb, 0xcc, 0xf3, 0x09, 0x03, 0xe9, 0x17, 0xec, 0xc3, 0xc5, 0x0b,
-    0x64, 0xf4, 0x43, 0xf7, 0xd6, 0xff, 0x02, 0xe3, 0xad, 0x07, 0x13, 0x06, 0x08, 0xf5, 0x1d, 0xce,
-    0x03, 0x15, 0xc5, 0xfb, 0x05, 0x20, 0xf3, 0xf7, 0xd8, 0x30, 0xe9, 0x02, 0xe4, 0x1e, 0xff, 0xfa,
-    0x18, 0xcf, 0x07, 0xc6, 0x01, 0x01, 0x30, 0x15, 0xee, 0xe2, 0x21, 0xca, 0x06, 0x19, 0xdd, 0xfc,
-    0xeb, 0xfb, 0x06, 0x25, 0x19, 0xcf, 0x18, 0x0a, 0xef, 0x2a, 0x31, 0x16, 0xeb, 0xaa, 0xf4, 0xed,
-    0x2e, 0x19, 0xde, 0xc7, 0x28, 0x3e, 0x18, 0x08, 0x28, 0x1d, 0x30, 0xf5, 0xad, 0x24, 0xc4, 0xfd,
-    0x11, 0xc1, 0xae, 0xcb, 0x2b, 0xd7, 0xd1, 0xed, 0xfe, 0x26, 0xe0, 0x2b, 0xf2, 0x23, 0xe7, 0xfc,
-    0xa8, 0x02, 0x0a, 0xff, 0x05, 0xe1, 0xb5, 0x03, 0x07, 0xed, 0x07, 0x4a, 0x1a, 0x3e, 0x17, 0xf6,
-    0x05, 0x22, 0xfd, 0xdf, 0x1e, 0xf8, 0xbe, 0x07, 0xe8, 0xfc, 0x04, 0x25, 0xe8, 0x29, 0xe1, 0x10,
-    0x44, 0x0f, 0xf3, 0x26, 0x2a, 0xc8, 0x17, 0xfe, 0xbb, 0x17, 0xc5, 0x8a, 0xb9, 0x20, 0x20, 0xab,
-    0xd5, 0xf5, 0xc6, 0x1f, 0xf9, 0x00, 0xec, 0x19, 0x11, 0x91, 0xe2, 0x05, 0xf5, 0xb8, 0x11, 0x32,
-    0xd0, 0xa9, 0xf7, 0xf6, 0x0e, 0x1c, 0x08, 0xc3, 0x0a, 0x13, 0x18, 0x1d, 0xef, 0xf4, 0x05, 0xe2,
-    0x0e, 0x1b, 0xd4, 0x1b, 0xe9, 0xfe, 0x18, 0xfa, 0x16, 0xb9, 0x25, 0xdc, 0xf5, 0x00, 0xbb, 0x0a,
-    0xd0, 0x09, 0xdc, 0x28, 0xe9, 0x25, 0xfb, 0x00, 0x01, 0x1a, 0xed, 0xb0, 0x02, 0x0a, 0xf1, 0x28,
-    0x32, 0xea, 0x34, 0x0a, 0x23, 0xf1, 0x1e, 0xe1, 0xf8, 0xca, 0x29, 0x22, 0x1c, 0x10, 0xd1, 0xdb,
-    0x08, 0xd4, 0xe7, 0xd2, 0x2a, 0xb9, 0x1d, 0x0c, 0x02, 0xd7, 0xbd, 0xac, 0x16, 0xd9, 0xcc, 0xfb,
-    0xf1, 0xeb, 0x1d, 0xf2, 0x06, 0xe9, 0x10, 0xed, 0xf7, 0x28, 0xf1, 0xe0, 0xe0, 0x40, 0x15, 0x1c,
-    0xdf, 0xf3, 0xba, 0x16, 0x31, 0x0c, 0xc1, 0xe2, 0x07, 0xee, 0xdd, 0xe0, 0x07, 0xb6, 0x1b, 0x2c,
-    0xdd, 0xc6, 0xda, 0x0f, 0xc4, 0x9d, 0x11, 0x97, 0x2d, 0xfc, 0x0e, 0xa8, 0xf2, 0x10, 0x2c, 0x17,
-    0xd4, 0xfb, 0xff, 0x0c, 0xf1, 0xec, 0xbf, 0x30, 0xe6, 0x1a, 0xc1, 0xb0, 0xf8, 0xdc, 0xfe, 0xed,
-    0x1a, 0xf9, 0x31, 0xf7, 0xc5, 0x2a, 0xfc, 0xb1, 0xfa, 0x27, 0xef, 0x05, 0x07, 0xe8, 0x29, 0x08,
-    0xf4, 0x00, 0xef, 0xed, 0xc4, 0xd1, 0x01, 0x11, 0x26, 0x00, 0x5a, 0x67, 0x28, 0xcf, 0xda, 0xed,
-    0x3b, 0x12, 0x3e, 0xea, 0x1f, 0x2a, 0xf8, 0xf1, 0xf1, 0xf8, 0x1b, 0xe9, 0x19, 0x01, 0xe1, 0x1a,
-    0x17, 0x45, 0x21, 0xec, 0xb2, 0x12, 0x16, 0x25, 0x19, 0xe1, 0x06, 0xf8, 0xb5, 0xad, 0xe4, 0x0f,
-    0x0f, 0x83, 0xd3, 0xf1, 0xe6, 0xe8, 0x0a, 0xdc, 0xd5, 0xd2, 0xc6, 0xb0, 0x1d, 0x20, 0xea, 0x19,
-    0xc2, 0x0c, 0x27, 0xd8, 0x20, 0xf8, 0x05, 0xc2, 0x2d, 0xeb, 0x20, 0x27, 0x10, 0x2d, 0x26, 0xc7,
-    0x2d, 0x0b, 0xff, 0xc3, 0x11, 0x38, 0xd0, 0x17, 0x17, 0x1d, 0xad, 0x25, 0x04, 0x1f, 0xfe, 0x20,
-    0xe5, 0x31, 0xb4, 0xf3, 0x06, 0xf1, 0x0a, 0x27, 0x29, 0xe6, 0xcf, 0xf5, 0x12, 0x22, 0x07, 0xe5,
-    0x81, 0xea, 0xf0, 0xf7, 0xe5, 0xfb, 0x0f, 0xfe, 0x06, 0x1a, 0xea, 0x15, 0x12, 0x35, 0xf0, 0x8f,
-    0x0b, 0xc2, 0x1c, 0x18, 0xec, 0x1c, 0xdd, 0x18, 0x03, 0xf0, 0xe0, 0xb8, 0x19, 0xf0, 0x0d, 0x21,
-    0x4b, 0x1c, 0xcb, 0x17, 0xc0, 0xf8, 0x0f, 0x1f, 0xf3, 0xf8, 0xef, 0xe9, 0x1c, 0xbf, 0xc1, 0x05,
-    0x15, 0xc7, 0x12, 0x0d, 0xff, 0xe5, 0xba, 0xca, 0xc0, 0xf9, 0xe1, 0x17, 0xe7, 0xfe, 0x3b, 0x26,
-    0x0b, 0xf8, 0xf6, 0xc8, 0x13, 0x0c, 0x19, 0x1c, 0x1a, 0xc1, 0xe8, 0x18, 0x1c, 0xc2, 0x1e, 0x0d,
-    0xcb, 0x09, 0x20, 0x09, 0xf0, 0xc5, 0x14, 0x03, 0xf4, 0x20, 0xdd, 0xec, 0xba, 0x14, 0x08, 0x0c,
-    0xb9, 0x0a, 0xed, 0x10, 0xd4, 0xe9, 0x03, 0x17, 0xe5, 0x10, 0x25, 0xe4, 0x1f, 0x0b, 0xf2, 0xbb,
-    0x1b, 0x0e, 0xce, 0x13, 0x0b, 0x19, 0x07, 0xde, 0x0f, 0x0e, 0x5b, 0xf1, 0x11, 0xb4, 0xb8, 0x0c,
-    0x1a, 0x26, 0xf9, 0x31, 0xfe, 0x08, 0x06, 0x18, 0x07, 0xdf, 0xe3, 0xdb, 0xc1, 0x05, 0x21, 0x0e,
-    0xee, 0xdb, 0xbd, 0xe0, 0xdd, 0x06, 0x0f, 0x0c, 0xd2, 0xc0, 0xcb, 0x11, 0x33, 0x06, 0xe5, 0x13,
-    0xa1, 0xea, 0x4e, 0x0d, 0x5e, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x73, 0xfe, 0xff, 0xff, 0xaa, 0xfe, 0xff, 0xff, 0x59, 0x00, 0x00, 0x00, 0xa5, 0xff, 0xff, 0xff,
-    0xf7, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0xab, 0xff, 0xff, 0xff,
-    0xc4, 0x00, 0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0x92, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0xf0, 0xf6, 0xff, 0xff,
-    0xf4, 0xf6, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e,
-    0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-    0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00,
-    0xac, 0x01, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00,
-    0xdc, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x0d, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0xf7, 0xff, 0xff,
-    0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x4b, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x9a, 0xff, 0xff, 0xff, 0xcd, 0xcc, 0xcc, 0x3d, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x14, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff,
-    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0xcd, 0xcc, 0xcc, 0x3d, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-    0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0xf8, 0xff, 0xff,
-    0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0xf4, 0x06, 0x00, 0x00,
-    0x5c, 0x06, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00,
-    0x7c, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00,
-    0x54, 0x02, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00,
-    0xd4, 0xf8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b,
-    0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74,
-    0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x6a, 0xf9, 0xff, 0xff,
+    0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x08, 0x46, 0x00, 0x00, 0x28, 0x3c, 0x00, 0x00, 0x10, 0x3c, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0xf8, 0x3b, 0x00, 0x00, 0xf0, 0x3b, 0x00, 0x00, 0xd8, 0x3b, 0x00, 0x00, 0xa0, 0x3b, 0x00, 0x00,
+    0x10, 0x39, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xf0, 0x27, 0x00, 0x00, 0xe0, 0x26, 0x00, 0x00,
+    0xd0, 0x02, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00,
+    0xb0, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+    0x78, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x94, 0x01, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x4f, 0x66, 0x66, 0x6c, 0x69, 0x6e, 0x65, 0x4d, 0x65, 0x6d, 0x6f, 0x72,
+    0x79, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x48, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x9c, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xe4, 0x3a, 0x00, 0x00, 0xf4, 0x3a, 0x00, 0x00,
+    0xcc, 0x44, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0xc4, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f,
+    0x31, 0x32, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49,
+    0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f,
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x12, 0x00, 0x00, 0x00, 0xec, 0x39, 0x00, 0x00,
+    0xe4, 0x39, 0x00, 0x00, 0xcc, 0x39, 0x00, 0x00, 0x94, 0x39, 0x00, 0x00, 0x04, 0x37, 0x00, 0x00,
+    0xf4, 0x35, 0x00, 0x00, 0xe4, 0x25, 0x00, 0x00, 0xd4, 0x24, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
+    0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+    0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x06, 0xc5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x32, 0x2e, 0x31, 0x35, 0x2e, 0x30, 0x00, 0x00, 0x6a, 0xc5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd0, 0xbd, 0xff, 0xff, 0xd4, 0xbd, 0xff, 0xff, 0xd8, 0xbd, 0xff, 0xff,
+    0xdc, 0xbd, 0xff, 0xff, 0xe0, 0xbd, 0xff, 0xff, 0xe4, 0xbd, 0xff, 0xff, 0xe8, 0xbd, 0xff, 0xff,
+    0xa2, 0xc5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x03, 0xf4, 0x02, 0xff,
+    0x08, 0xf4, 0xe6, 0xf2, 0xfd, 0xf2, 0xf5, 0x09, 0xf9, 0xe4, 0xfc, 0x04, 0xfc, 0x05, 0x15, 0x06,
+    0xe8, 0xfa, 0xfc, 0x28, 0x09, 0xf2, 0xec, 0xec, 0x06, 0xf5, 0x01, 0xfd, 0xfc, 0x14, 0xfa, 0x10,
+    0x11, 0x25, 0x04, 0xfd, 0x0b, 0xe6, 0x22, 0x11, 0x00, 0xfe, 0x21, 0x1d, 0x01, 0xf9, 0x00, 0x12,
+    0xff, 0xec, 0xfa, 0xfc, 0x0a, 0x19, 0x0d, 0xfb, 0xf6, 0xdb, 0xe4, 0x0f, 0x07, 0x09, 0x00, 0x13,
+    0xf4, 0x06, 0x0d, 0x0a, 0x0b, 0xf0, 0x19, 0xff, 0xef, 0x0a, 0x05, 0x00, 0xf9, 0xf7, 0xf6, 0xe2,
+    0x08, 0x0a, 0xfb, 0x0a, 0x07, 0x10, 0x12, 0x13, 0xeb, 0xf2, 0xbc, 0xdc, 0xfa, 0x0c, 0xef, 0xfc,
+    0x0d, 0x01, 0x17, 0xfa, 0xd6, 0xeb, 0xb5, 0xd7, 0xfc, 0xf1, 0xfc, 0xf6, 0x05, 0x1d, 0x1a, 0xfc,
+    0xe5, 0xad, 0xc0, 0x00, 0xf7, 0x10, 0xff, 0x0d, 0x09, 0x13, 0x0e, 0xe7, 0xa0, 0xa8, 0x0f, 0x0d,
+    0xf7, 0xe8, 0x1e, 0x11, 0x18, 0x24, 0x04, 0xa2, 0xa8, 0x02, 0xeb, 0xf7, 0xf4, 0xfa, 0x03, 0x06,
+    0x0e, 0xff, 0x0f, 0xe0, 0x05, 0x01, 0x00, 0xf3, 0xef, 0xdc, 0xfe, 0xee, 0xe6, 0xe1, 0x06, 0xe9,
+    0xe3, 0xf0, 0x06, 0x1b, 0xec, 0x28, 0xfd, 0xfc, 0x09, 0xfc, 0xee, 0xe1, 0xf0, 0xfe, 0x12, 0xf1,
+    0x06, 0x0b, 0x0c, 0xeb, 0x1c, 0x19, 0xfb, 0xf4, 0x16, 0x1d, 0x25, 0xfb, 0xfd, 0xde, 0x1e, 0xf1,
+    0xe0, 0xd2, 0xe0, 0x06, 0x0e, 0x18, 0x12, 0x1b, 0x0c, 0x0e, 0x0f, 0x02, 0xf5, 0xff, 0xf8, 0x06,
+    0xee, 0xee, 0xfc, 0x19, 0x09, 0x17, 0xf4, 0xd6, 0xeb, 0xf7, 0x06, 0xde, 0x02, 0x0a, 0xf9, 0xf2,
+    0xfe, 0xfd, 0xe5, 0x0a, 0x09, 0x00, 0x0b, 0x01, 0xfd, 0xf9, 0xf0, 0xfa, 0x0c, 0xf8, 0xe9, 0x0c,
+    0x10, 0x09, 0xfd, 0xf9, 0x18, 0x21, 0xd7, 0x1f, 0x0d, 0x0f, 0x10, 0x1d, 0x0b, 0x0f, 0x0f, 0x0e,
+    0x21, 0x28, 0x20, 0x23, 0xfd, 0x05, 0x06, 0x0a, 0x24, 0x0e, 0x30, 0xf5, 0xf4, 0x1c, 0xea, 0xfb,
+    0xf3, 0x10, 0xfc, 0x00, 0xf7, 0x04, 0x0a, 0x07, 0xf2, 0x22, 0x0d, 0x06, 0x08, 0x08, 0x03, 0xf0,
+    0xf3, 0xfa, 0x05, 0x26, 0x01, 0xec, 0x0b, 0xf3, 0xf2, 0x21, 0xd4, 0xe1, 0xe1, 0xf0, 0x0c, 0xf4,
+    0xdf, 0xff, 0xf9, 0xf9, 0xdd, 0xd8, 0xf4, 0xfc, 0xf2, 0x03, 0xfc, 0xfb, 0xf8, 0x08, 0x0b, 0x07,
+    0xec, 0xf3, 0xff, 0x10, 0x09, 0xf7, 0xec, 0x00, 0xf9, 0x26, 0x1c, 0x2e, 0xf4, 0xff, 0xfa, 0xf6,
+    0xf4, 0x0e, 0x07, 0x03, 0xfc, 0xec, 0x11, 0x1a, 0x0b, 0x00, 0xda, 0xfd, 0x0e, 0x1b, 0x0a, 0x00,
+    0xef, 0xf4, 0xf6, 0xd3, 0x0d, 0xf4, 0xf2, 0x02, 0x1f, 0x17, 0x0e, 0x02, 0x0f, 0x10, 0xef, 0xf7,
+    0xf6, 0xda, 0x03, 0x02, 0x13, 0x04, 0xf5, 0x03, 0x20, 0xf5, 0x0b, 0x07, 0x01, 0xe6, 0x08, 0xf3,
+    0xe6, 0x16, 0x18, 0x06, 0xfe, 0xfa, 0x11, 0x2a, 0xf6, 0xf0, 0xff, 0xf1, 0xf0, 0x18, 0x1c, 0xef,
+    0x0f, 0xf7, 0x27, 0x41, 0xf9, 0x37, 0x07, 0xff, 0x14, 0xf9, 0xfb, 0xfa, 0x2d, 0x0c, 0x19, 0x00,
+    0x0b, 0xfb, 0x1d, 0x09, 0xde, 0xf1, 0xff, 0xf7, 0x13, 0x23, 0x2b, 0x00, 0x06, 0x01, 0xff, 0x07,
+    0xf5, 0x0c, 0x02, 0x1a, 0x0c, 0xfc, 0x0b, 0xfb, 0x05, 0xfd, 0x03, 0xff, 0x04, 0x17, 0x02, 0x1c,
+    0xf5, 0x0e, 0x0b, 0xda, 0x05, 0xf5, 0x12, 0x06, 0x0c, 0x02, 0xff, 0xf9, 0x0e, 0x10, 0x15, 0xe1,
+    0x0a, 0xdb, 0xfc, 0x13, 0x07, 0xfd, 0x08, 0xe9, 0xed, 0xfd, 0xfa, 0xe8, 0xfb, 0xd1, 0xe9, 0xfe,
+    0x22, 0x1b, 0x16, 0x22, 0xfc, 0xfc, 0xec, 0x0f, 0xfa, 0xfa, 0xd1, 0xe9, 0x09, 0x08, 0x02, 0x0a,
+    0x1a, 0xfb, 0xed, 0xde, 0xf4, 0x11, 0x03, 0xf6, 0xf2, 0x08, 0x07, 0x21, 0x22, 0x11, 0xed, 0xc9,
+    0xf9, 0x17, 0xfe, 0x08, 0x06, 0xf2, 0x09, 0x1b, 0x17, 0xee, 0xe6, 0xeb, 0x0b, 0x09, 0xd8, 0xeb,
+    0x06, 0x12, 0x05, 0x0e, 0x18, 0xfd, 0xe9, 0xde, 0xfa, 0xd9, 0xfa, 0x06, 0xf8, 0xef, 0xf9, 0x0c,
+    0x1d, 0xf3, 0xcf, 0xd3, 0x01, 0xdf, 0xe5, 0xf1, 0xee, 0xee, 0x03, 0x14, 0x19, 0xf1, 0xf9, 0xed,
+    0xf5, 0x18, 0xf1, 0xd9, 0x01, 0x15, 0x02, 0x17, 0x0b, 0x09, 0xe6, 0xfa, 0x01, 0xf7, 0x04, 0x03,
+    0x08, 0x08, 0xfb, 0xf6, 0x00, 0x09, 0xf4, 0xf9, 0x09, 0x15, 0x03, 0x12, 0xf1, 0xea, 0xf8, 0x16,
+    0x07, 0xf1, 0xf2, 0xd1, 0x10, 0x06, 0xf7, 0xf1, 0xfc, 0xfd, 0xf6, 0x03, 0x00, 0xef, 0xd1, 0xc0,
+    0x0d, 0x09, 0x03, 0xe2, 0xee, 0xdf, 0xec, 0x06, 0x1c, 0xee, 0xca, 0xfa, 0x03, 0x05, 0xf6, 0x07,
+    0xec, 0xef, 0xe5, 0x2b, 0xf4, 0xf5, 0x06, 0x21, 0x0c, 0x0f, 0x0d, 0xfa, 0xea, 0xe3, 0x13, 0x0f,
+    0xe5, 0xec, 0x02, 0xda, 0xfc, 0xee, 0x0a, 0x1a, 0xfe, 0x0b, 0x1f, 0x0b, 0x0f, 0x00, 0x02, 0xfc,
+    0x04, 0xf3, 0x21, 0x04, 0x0a, 0x00, 0x10, 0x10, 0xef, 0x18, 0x0c, 0xd2, 0x05, 0x04, 0x1a, 0x02,
+    0xee, 0x11, 0x03, 0x15, 0x03, 0x0f, 0x0c, 0x24, 0x01, 0xfb, 0x22, 0x17, 0xdf, 0x08, 0x03, 0x09,
+    0x00, 0xef, 0xf1, 0xb7, 0xf5, 0xee, 0x06, 0x16, 0x0a, 0x0d, 0xe9, 0xf1, 0xf1, 0xe3, 0xe9, 0xdf,
+    0x06, 0xd5, 0xf4, 0x0a, 0x05, 0x08, 0xfe, 0x02, 0xfd, 0xf7, 0xc4, 0x03, 0xf3, 0xf3, 0x0c, 0xfe,
+    0x1b, 0xfc, 0x12, 0x21, 0xf4, 0xfa, 0x0c, 0xf9, 0xfc, 0x02, 0x05, 0x0d, 0x21, 0x1f, 0x11, 0x06,
+    0x0d, 0x02, 0x0c, 0xf0, 0xf4, 0x04, 0x13, 0x28, 0x12, 0x21, 0x1a, 0xff, 0xfb, 0x01, 0xf6, 0xec,
+    0xed, 0x03, 0x20, 0x22, 0x12, 0x2d, 0xeb, 0xcf, 0xbe, 0xe9, 0xe7, 0xe5, 0xf8, 0xf9, 0x1b, 0x19,
+    0x1d, 0x02, 0xd1, 0xf2, 0xfe, 0x05, 0x0b, 0xd8, 0x00, 0x1d, 0x09, 0x0a, 0xf3, 0xf0, 0xf3, 0x08,
+    0xfe, 0xf4, 0x10, 0x0a, 0x07, 0x07, 0x14, 0x06, 0xf1, 0x07, 0xf2, 0xd8, 0x0b, 0x00, 0x16, 0x22,
+    0x0b, 0xf3, 0xee, 0x00, 0x09, 0x0c, 0xf7, 0xf0, 0xf7, 0x03, 0x14, 0xfc, 0x02, 0xed, 0x05, 0x01,
+    0xec, 0xe5, 0xfd, 0x0b, 0x01, 0xf5, 0xf3, 0x19, 0x0a, 0xd6, 0xf3, 0xeb, 0xfe, 0x02, 0x03, 0x14,
+    0x07, 0xf8, 0x20, 0x02, 0xfa, 0x03, 0x16, 0x18, 0x18, 0x0b, 0x0d, 0x00, 0x1c, 0x16, 0x06, 0x09,
+    0xfe, 0x44, 0xee, 0xfe, 0xf8, 0x1c, 0xee, 0xff, 0x01, 0xfd, 0xf6, 0xf4, 0x08, 0xfd, 0xfd, 0x05,
+    0x03, 0x04, 0x05, 0xec, 0x00, 0xf2, 0xfc, 0xf8, 0x0a, 0x08, 0xd9, 0xed, 0xf7, 0xe5, 0xe6, 0xe1,
+    0xf9, 0x05, 0x13, 0x05, 0x0e, 0xff, 0x11, 0x1a, 0x12, 0x0f, 0x20, 0x1c, 0x1a, 0x01, 0x21, 0x11,
+    0xf5, 0x12, 0x27, 0x1e, 0x24, 0x0b, 0x06, 0xfc, 0xf3, 0xf4, 0xfc, 0x04, 0xf7, 0x17, 0xf5, 0x09,
+    0xf3, 0xd3, 0xd5, 0xe7, 0xff, 0xf4, 0xf2, 0x04, 0xf3, 0xe7, 0xde, 0xd5, 0xec, 0x0c, 0x18, 0x1e,
+    0x0c, 0x0c, 0x00, 0x01, 0xfa, 0xed, 0xe3, 0xf1, 0xfe, 0x13, 0x01, 0x0b, 0x09, 0x12, 0xf2, 0x18,
+    0xfa, 0xde, 0xe4, 0xe7, 0xd7, 0xf9, 0xdf, 0xff, 0xff, 0x01, 0x01, 0x21, 0xf8, 0x25, 0x25, 0x0f,
+    0x0a, 0xf0, 0xf6, 0x0b, 0x08, 0x1a, 0xf3, 0xf2, 0xfe, 0x13, 0x1a, 0x18, 0x10, 0x1c, 0x17, 0x02,
+    0xed, 0x09, 0x02, 0x0d, 0x0d, 0x0f, 0xfb, 0xf3, 0xec, 0xed, 0x06, 0xfc, 0x00, 0xff, 0xee, 0x1c,
+    0x0a, 0xf4, 0xe6, 0xfc, 0x22, 0xfb, 0xf8, 0x14, 0xf6, 0x2d, 0xde, 0x06, 0xf6, 0x06, 0x0c, 0x01,
+    0xf4, 0x02, 0x0d, 0xf1, 0x04, 0x12, 0xf6, 0x04, 0x09, 0x09, 0xe6, 0xee, 0x0c, 0x12, 0x09, 0xf4,
+    0xf0, 0x10, 0x06, 0x1b, 0x05, 0x00, 0x0b, 0x0a, 0x0b, 0xfd, 0xe5, 0xf1, 0xfa, 0x0b, 0x0b, 0xe8,
+    0x00, 0xf3, 0x08, 0x0c, 0x12, 0xfe, 0xe9, 0xf7, 0x17, 0x11, 0xf1, 0x0b, 0xfe, 0xef, 0x1f, 0x16,
+    0x06, 0xf0, 0xf9, 0x01, 0x07, 0xf8, 0xf1, 0x37, 0xf6, 0x01, 0x0d, 0x0e, 0x0e, 0xf4, 0x07, 0x11,
+    0x09, 0x19, 0xfd, 0x09, 0x07, 0x07, 0x12, 0x1b, 0x03, 0x12, 0x22, 0x12, 0x10, 0x1d, 0x37, 0x23,
+    0xf9, 0x23, 0x22, 0xe4, 0xe0, 0x0b, 0x10, 0x13, 0x0d, 0xeb, 0xe7, 0xfb, 0x0d, 0x37, 0x01, 0xde,
+    0xf8, 0x01, 0xff, 0xf3, 0xe4, 0xdf, 0xe6, 0xee, 0x0b, 0x15, 0xfb, 0xe0, 0xf6, 0x07, 0xea, 0xf7,
+    0xe7, 0xea, 0xe4, 0xe1, 0x08, 0xe7, 0xf2, 0xe7, 0xf1, 0xf2, 0x0a, 0xfd, 0xf9, 0x10, 0x14, 0xd5,
+    0x04, 0xee, 0xf1, 0xbf, 0x0f, 0x1f, 0xd2, 0x29, 0xde, 0xd0, 0xe0, 0xfb, 0xf6, 0x0c, 0x0f, 0xff,
+    0xf9, 0xf6, 0x0e, 0xfb, 0x0c, 0x03, 0xf8, 0xf7, 0xfe, 0xfc, 0x00, 0x01, 0xfd, 0xfa, 0x11, 0x00,
+    0xf5, 0xf9, 0xd7, 0xfa, 0x1a, 0x25, 0xfb, 0x15, 0x1f, 0x04, 0x00, 0x1c, 0x17, 0xfa, 0x0b, 0xfa,
+    0xf5, 0x12, 0x0a, 0xf5, 0x06, 0x0b, 0x18, 0x11, 0x0b, 0xf5, 0x10, 0x31, 0x07, 0xd5, 0xf1, 0xf9,
+    0xfa, 0x10, 0x10, 0x05, 0xec, 0x02, 0xf4, 0x22, 0x0c, 0xdf, 0xed, 0x1b, 0x21, 0x14, 0xfb, 0xfc,
+    0x02, 0xf6, 0x0e, 0x18, 0x0c, 0x37, 0x3c, 0x36, 0x1c, 0x03, 0xe8, 0xf4, 0x07, 0x00, 0xf0, 0x0a,
+    0x05, 0x28, 0x1f, 0x0a, 0x0f, 0xf5, 0xd7, 0xf6, 0xf1, 0x03, 0xfb, 0xef, 0x00, 0xfc, 0x05, 0x0d,
+    0x08, 0xf1, 0xda, 0xeb, 0xe6, 0xd4, 0xdf, 0x21, 0xf4, 0xf0, 0x1b, 0x1a, 0x07, 0xfb, 0xfa, 0xf8,
+    0xde, 0xe2, 0xec, 0x22, 0x0b, 0x02, 0xfe, 0x14, 0x0b, 0x09, 0x08, 0xf0, 0xf6, 0xef, 0xf0, 0xdb,
+    0x01, 0xf8, 0xf5, 0x1b, 0x1e, 0x02, 0xf2, 0x05, 0x0a, 0x13, 0xf4, 0xf9, 0x0b, 0x03, 0xf7, 0xfb,
+    0xef, 0x05, 0x17, 0x00, 0x09, 0x08, 0x05, 0xf7, 0xfb, 0x23, 0x0d, 0x15, 0x0a, 0x21, 0x2d, 0x12,
+    0x02, 0x17, 0x09, 0xfa, 0x20, 0x00, 0xfc, 0xff, 0x12, 0x0e, 0x12, 0x1a, 0x09, 0x03, 0x08, 0xfd,
+    0x0c, 0xcf, 0xf0, 0x0c, 0xe8, 0xe8, 0xe9, 0xf8, 0x0e, 0x1b, 0xfb, 0x17, 0x02, 0xef, 0x02, 0xed,
+    0xc9, 0xbc, 0xe4, 0x0c, 0xfa, 0xfd, 0x0f, 0x2a, 0x01, 0xd1, 0xeb, 0xfe, 0xf7, 0x03, 0x0b, 0x0a,
+    0xfc, 0xfd, 0x0e, 0x14, 0x00, 0x2d, 0x20, 0xfe, 0xf7, 0xf4, 0xfe, 0xeb, 0xe7, 0xfb, 0x08, 0xe0,
+    0xf6, 0xe3, 0xf2, 0xe6, 0xea, 0x02, 0x0a, 0xf1, 0xf7, 0xf3, 0xf3, 0xee, 0x00, 0xda, 0x05, 0x0e,
+    0xfd, 0xfe, 0xf4, 0xdd, 0xef, 0xfd, 0x12, 0x0b, 0xff, 0xeb, 0xf4, 0x04, 0xf6, 0xe9, 0xe5, 0x07,
+    0x04, 0x0f, 0x27, 0xf7, 0xff, 0x1c, 0x00, 0x16, 0xfe, 0x02, 0xf6, 0x09, 0x08, 0xfd, 0xe7, 0xe3,
+    0xfe, 0x19, 0x06, 0xda, 0xf0, 0x0e, 0x0f, 0xf9, 0x0b, 0xf4, 0x2d, 0x0a, 0xf8, 0x0d, 0xfd, 0x05,
+    0xfa, 0x03, 0x1b, 0x25, 0x0a, 0x09, 0xf7, 0x03, 0x04, 0x02, 0xfe, 0x04, 0xff, 0x0d, 0xf4, 0xf4,
+    0xf7, 0xe8, 0xce, 0x16, 0x09, 0xf8, 0x1c, 0x0b, 0x00, 0x07, 0x0a, 0xfa, 0xf9, 0xef, 0xe3, 0x30,
+    0x0f, 0xf1, 0xf7, 0x00, 0xff, 0xf9, 0x03, 0x0f, 0x11, 0xee, 0xeb, 0xee, 0xfe, 0xee, 0xe8, 0xfd,
+    0xf4, 0xfb, 0xfe, 0x05, 0x1b, 0xfb, 0xe2, 0xcb, 0xf6, 0xf7, 0x00, 0xf3, 0xf3, 0x03, 0x00, 0x15,
+    0x2d, 0x11, 0x03, 0xed, 0xf5, 0x0c, 0xfd, 0xf3, 0xf7, 0x09, 0x1b, 0x22, 0x0f, 0x06, 0x18, 0x24,
+    0x02, 0x03, 0xe3, 0x02, 0xf4, 0x24, 0x19, 0x18, 0x03, 0x0a, 0xf3, 0x08, 0xf7, 0xdc, 0xe0, 0xdc,
+    0x05, 0x34, 0x05, 0x09, 0xf5, 0x02, 0xee, 0xdd, 0xfb, 0xe7, 0xd6, 0xf0, 0x07, 0x16, 0x14, 0x0e,
+    0x0a, 0x13, 0xea, 0x0a, 0xfe, 0xcc, 0xe5, 0x06, 0x07, 0x10, 0xf3, 0xfa, 0xf2, 0x0f, 0xf3, 0xda,
+    0x03, 0xcb, 0xc5, 0xfa, 0xfe, 0xef, 0x01, 0xf2, 0x0d, 0x04, 0x00, 0xf3, 0x0a, 0xf9, 0x0b, 0x00,
+    0x14, 0xff, 0x02, 0x1c, 0x0b, 0xf7, 0x08, 0xff, 0xff, 0xef, 0xfa, 0x21, 0x26, 0x11, 0xe9, 0xd4,
+    0xda, 0x08, 0x0c, 0x0a, 0xf8, 0xd5, 0x0e, 0x1f, 0x1a, 0x0e, 0xf2, 0xd6, 0x06, 0x16, 0x1c, 0x16,
+    0x06, 0xdc, 0xf6, 0x33, 0x15, 0xe4, 0xc2, 0xe9, 0x09, 0x01, 0xfb, 0xfa, 0xf6, 0xf8, 0xfe, 0x37,
+    0x32, 0xe7, 0xc2, 0xe6, 0xe1, 0xf6, 0x05, 0x09, 0x03, 0xeb, 0x07, 0x06, 0x10, 0x18, 0xf2, 0xfb,
+    0xf8, 0xfc, 0xff, 0x2d, 0x07, 0xfd, 0x17, 0x03, 0x01, 0x04, 0xf7, 0x03, 0xf1, 0xf8, 0xff, 0x00,
+    0x02, 0x10, 0x08, 0x06, 0xfa, 0xfb, 0xf6, 0x0e, 0xf5, 0xfd, 0x00, 0x1b, 0x03, 0x01, 0x0b, 0x06,
+    0x0d, 0xf4, 0x12, 0xf6, 0xf9, 0x0e, 0x02, 0x15, 0x0a, 0xeb, 0xfc, 0xf3, 0x07, 0x04, 0x0d, 0x03,
+    0xfe, 0x0c, 0x0e, 0xf6, 0xf4, 0x0c, 0x14, 0x1a, 0xf0, 0x0e, 0x05, 0xfc, 0x0f, 0xfb, 0xe4, 0x1e,
+    0xfc, 0x00, 0x02, 0xe1, 0x16, 0x04, 0xf6, 0xe1, 0xef, 0x19, 0xe9, 0x0c, 0x06, 0x0d, 0xfc, 0xff,
+    0x02, 0xfa, 0xf4, 0xf7, 0x0c, 0x02, 0x0b, 0x07, 0x08, 0xf7, 0x14, 0xfa, 0x08, 0x12, 0x18, 0x10,
+    0x17, 0x0c, 0x22, 0xf8, 0xfa, 0xe7, 0xff, 0x07, 0xf4, 0x08, 0xec, 0xe9, 0xf3, 0xfc, 0x09, 0x04,
+    0xfb, 0x17, 0x18, 0x07, 0xff, 0xfc, 0xe9, 0xee, 0xf6, 0xfb, 0xf4, 0x13, 0x07, 0x07, 0x1f, 0xfc,
+    0x0e, 0x00, 0x06, 0x15, 0xfa, 0xf9, 0xf2, 0xe6, 0x09, 0x21, 0x20, 0x06, 0xf4, 0x13, 0x0a, 0xfc,
+    0xf6, 0xff, 0x02, 0x0f, 0x06, 0x0d, 0x0f, 0xdf, 0xe6, 0x12, 0x04, 0xfc, 0x03, 0xe2, 0xe4, 0xf3,
+    0xf8, 0x0b, 0x05, 0xf8, 0xe4, 0xf7, 0x04, 0x00, 0xf6, 0xf9, 0x24, 0xfa, 0x0c, 0xf7, 0x19, 0xe9,
+    0xee, 0x0e, 0x0e, 0x0a, 0x02, 0x24, 0xf5, 0x16, 0x08, 0x0d, 0xf9, 0x01, 0x11, 0x05, 0x1c, 0x09,
+    0xff, 0x0d, 0x03, 0x03, 0x01, 0x0c, 0x0a, 0x02, 0x19, 0x0a, 0x0d, 0x0e, 0x04, 0x08, 0x0b, 0x39,
+    0xfb, 0xee, 0xd3, 0xf2, 0xfa, 0xc2, 0xf2, 0xed, 0x12, 0x12, 0x07, 0xfe, 0xf6, 0xfb, 0x08, 0x09,
+    0x00, 0x09, 0xf7, 0xe5, 0xfc, 0xfe, 0xf6, 0x02, 0xf8, 0x1a, 0x36, 0x1e, 0xfc, 0x14, 0x01, 0xf8,
+    0xfd, 0xf7, 0x01, 0x28, 0x11, 0x0e, 0x0f, 0xf9, 0x05, 0xf6, 0x07, 0x0c, 0xfe, 0x05, 0xfe, 0xe1,
+    0x0c, 0x0a, 0x30, 0xf0, 0xea, 0x15, 0x0d, 0x14, 0x1c, 0x24, 0x22, 0xd4, 0x04, 0x31, 0x2d, 0x0f,
+    0xfc, 0x06, 0xfd, 0xe7, 0xe8, 0x03, 0x27, 0x12, 0xf9, 0xfa, 0x1a, 0x1a, 0x07, 0xfc, 0xf3, 0xfb,
+    0xfd, 0x01, 0x13, 0x11, 0xf6, 0x0c, 0x0c, 0x29, 0x04, 0x13, 0xd1, 0xf7, 0x06, 0x03, 0x0e, 0xfd,
+    0xfa, 0x0f, 0xfe, 0xe7, 0x02, 0xef, 0xe8, 0xf9, 0xf2, 0x0d, 0x28, 0xff, 0x05, 0x01, 0xf4, 0xec,
+    0xf1, 0x0a, 0xfc, 0xe8, 0xd1, 0x05, 0x1a, 0x08, 0xf9, 0x1e, 0xf0, 0xff, 0x0d, 0x04, 0xeb, 0xea,
+    0xdd, 0xf8, 0x1c, 0x1d, 0x05, 0xf5, 0x06, 0xfc, 0xfe, 0xf6, 0xf2, 0x05, 0x02, 0x06, 0x07, 0x00,
+    0xff, 0xfc, 0xe1, 0xf0, 0xf0, 0x02, 0x05, 0xec, 0x19, 0x04, 0xfc, 0xf5, 0xf7, 0x06, 0xf1, 0x09,
+    0xfe, 0xff, 0x0a, 0xf2, 0x02, 0xff, 0xff, 0xfa, 0xf7, 0x0a, 0x0e, 0x06, 0xc8, 0xd8, 0xdf, 0xfc,
+    0x0b, 0x00, 0x0e, 0x08, 0xff, 0x03, 0x10, 0x04, 0x09, 0x0e, 0xf5, 0xea, 0x02, 0x0b, 0xf7, 0x10,
+    0x03, 0x37, 0xf9, 0x0d, 0x11, 0x15, 0x1e, 0x12, 0x03, 0xf9, 0xf5, 0x1b, 0x09, 0xfe, 0x15, 0x13,
+    0x10, 0x19, 0x06, 0x34, 0x07, 0x13, 0x05, 0x1f, 0x00, 0xdb, 0x04, 0xff, 0xec, 0xf1, 0xeb, 0xf5,
+    0xf8, 0xf9, 0x20, 0xfd, 0xfb, 0xf0, 0xf6, 0xfa, 0xfb, 0xef, 0x10, 0xe6, 0xe1, 0x01, 0x1c, 0x09,
+    0xf8, 0xea, 0xfa, 0x03, 0x10, 0x01, 0x04, 0xe9, 0xf6, 0x0d, 0x14, 0x00, 0xfc, 0x10, 0x06, 0x01,
+    0x1e, 0xfa, 0xee, 0x1f, 0xf0, 0xf5, 0x00, 0xf7, 0x0b, 0x0f, 0xf8, 0x06, 0xf1, 0x16, 0xf9, 0x1d,
+    0x12, 0x04, 0xf9, 0x0f, 0xf4, 0x0e, 0xea, 0xe6, 0x0a, 0x18, 0x0a, 0xf6, 0xfd, 0xfa, 0xed, 0xca,
+    0xf3, 0x05, 0x0e, 0xf8, 0xf9, 0x06, 0x09, 0xf5, 0xf0, 0xf9, 0xfd, 0x00, 0xfb, 0x0a, 0x01, 0xfc,
+    0xf5, 0xf7, 0xe4, 0xef, 0x08, 0xff, 0x02, 0xff, 0xf7, 0x05, 0x10, 0xf7, 0xf4, 0x06, 0x0a, 0x0b,
+    0xfa, 0x09, 0xee, 0xf8, 0xf2, 0x05, 0x0d, 0x08, 0xfd, 0xff, 0xf4, 0xfe, 0xfb, 0xf8, 0xf8, 0x01,
+    0x09, 0xf7, 0x0c, 0x0b, 0x02, 0xfb, 0xfd, 0x0e, 0x03, 0xfb, 0x07, 0xf2, 0xff, 0x08, 0x14, 0x06,
+    0x0e, 0x24, 0xfa, 0x0e, 0xfd, 0x00, 0x02, 0xff, 0xfa, 0x23, 0x06, 0x0d, 0x02, 0x10, 0x0a, 0xff,
+    0x10, 0x0f, 0x0a, 0x36, 0xfe, 0x03, 0x18, 0x1f, 0x2e, 0x1e, 0x17, 0x09, 0x0f, 0x09, 0x03, 0xe2,
+    0x04, 0xbe, 0x98, 0xca, 0xe5, 0xfb, 0xf5, 0xfd, 0xf7, 0xe9, 0xeb, 0xea, 0x09, 0xc1, 0xbe, 0xaf,
+    0xbb, 0xd3, 0xdc, 0xdd, 0xf4, 0xfa, 0xf0, 0xd4, 0xf7, 0x12, 0x1e, 0x05, 0xff, 0xf5, 0xf5, 0xfd,
+    0xf0, 0xe3, 0x08, 0xf8, 0x08, 0x18, 0x16, 0x21, 0x13, 0x0e, 0x07, 0xf6, 0xf7, 0x03, 0xe9, 0xec,
+    0x0b, 0x08, 0x02, 0x09, 0xf2, 0x0f, 0x17, 0x0a, 0x00, 0xf3, 0xf9, 0x04, 0x0b, 0x06, 0x00, 0x00,
+    0x05, 0xff, 0x0e, 0xe0, 0x00, 0xfb, 0xff, 0xfc, 0x01, 0x07, 0xe3, 0xdb, 0xeb, 0xf0, 0xf9, 0x03,
+    0xff, 0x00, 0x06, 0x1a, 0x13, 0x21, 0x17, 0x17, 0x22, 0x06, 0xf3, 0x16, 0x15, 0x0f, 0x03, 0xf2,
+    0x07, 0x0c, 0x08, 0x08, 0x07, 0x1f, 0x0e, 0x00, 0x1e, 0x18, 0x15, 0x17, 0x05, 0x16, 0x00, 0x17,
+    0x2a, 0xf3, 0x0b, 0x01, 0x00, 0x03, 0x1a, 0x30, 0x05, 0x1a, 0x1f, 0xdc, 0xe6, 0xe4, 0x0b, 0xe8,
+    0xfd, 0xe8, 0xd7, 0x05, 0xf8, 0x0b, 0xf3, 0xf7, 0x04, 0x06, 0x02, 0xfa, 0xf9, 0xeb, 0x0d, 0x0d,
+    0x00, 0xf0, 0xf2, 0x08, 0x16, 0x0b, 0xf9, 0xfb, 0xee, 0x04, 0x0a, 0xf5, 0x08, 0x03, 0xea, 0x06,
+    0x0d, 0x02, 0xf5, 0xf9, 0x0e, 0x01, 0x1a, 0x12, 0xfe, 0x06, 0x04, 0xf8, 0xfc, 0xf1, 0xfb, 0xf9,
+    0x0b, 0xfa, 0xe8, 0x00, 0x08, 0xee, 0x02, 0x09, 0x0c, 0x06, 0x07, 0xf7, 0xf4, 0xff, 0xea, 0x0f,
+    0x00, 0xfd, 0x0d, 0xf4, 0xed, 0x10, 0xe8, 0xf8, 0xfb, 0xf9, 0x0e, 0xff, 0xff, 0xfb, 0xfb, 0xf7,
+    0x01, 0x0b, 0xf0, 0xee, 0xfc, 0x06, 0xfd, 0xfd, 0x0b, 0xff, 0xe7, 0x02, 0xf5, 0xfb, 0xff, 0xf9,
+    0xf6, 0xec, 0xff, 0xe6, 0xd9, 0x0c, 0xdc, 0x00, 0xf7, 0xec, 0x04, 0x15, 0x03, 0xfd, 0x02, 0xe1,
+    0xee, 0x12, 0xf7, 0xf2, 0xe3, 0xec, 0x01, 0x0a, 0xea, 0xf7, 0xfe, 0xfe, 0xfb, 0x0f, 0x1e, 0xff,
+    0xfd, 0xe2, 0xbc, 0xe0, 0xe1, 0x0a, 0xfd, 0x17, 0x08, 0xf4, 0x10, 0x0d, 0x01, 0x14, 0x02, 0xf9,
+    0xff, 0x0f, 0x1a, 0xd4, 0xf3, 0x07, 0x06, 0x1c, 0x09, 0x02, 0x26, 0x06, 0x01, 0xf2, 0xe7, 0xdd,
+    0x08, 0xf0, 0xe1, 0x01, 0x1c, 0x2e, 0x13, 0x06, 0xeb, 0xe7, 0xe0, 0xad, 0xfe, 0xfb, 0xdd, 0xfa,
+    0x00, 0x17, 0x04, 0x1d, 0x0e, 0x05, 0xee, 0x03, 0xff, 0xf6, 0x0e, 0x0a, 0xd7, 0xf9, 0xfd, 0xfe,
+    0x1a, 0x09, 0x09, 0x08, 0x03, 0xf2, 0x0a, 0xfb, 0x09, 0x13, 0x03, 0x05, 0x0f, 0x1c, 0x11, 0x1e,
+    0xfe, 0x07, 0x07, 0x19, 0xf8, 0x0f, 0x01, 0x17, 0x0c, 0xe9, 0x0c, 0xf9, 0xfd, 0xf5, 0x03, 0x0d,
+    0x09, 0x02, 0xfe, 0x05, 0x0b, 0xfd, 0xfb, 0x00, 0xf7, 0x10, 0x08, 0xf1, 0x14, 0x07, 0x1b, 0x19,
+    0x0d, 0x10, 0x21, 0xf1, 0x01, 0xfa, 0xf3, 0xfd, 0xf8, 0x13, 0x13, 0x12, 0x0c, 0x10, 0xee, 0x19,
+    0xf3, 0xec, 0xe7, 0xd4, 0xd2, 0xef, 0x10, 0x05, 0x05, 0xf7, 0xe0, 0x17, 0xff, 0xf6, 0xaf, 0xce,
+    0xe8, 0x21, 0x09, 0xf8, 0xf5, 0xe0, 0xe1, 0xe8, 0xfa, 0x09, 0xe0, 0xf6, 0x15, 0x0e, 0x04, 0x0e,
+    0x13, 0x03, 0xd4, 0xd5, 0x09, 0x1b, 0xf4, 0xef, 0xf9, 0x06, 0x0e, 0x14, 0x09, 0xff, 0x09, 0x35,
+    0x09, 0xec, 0xf5, 0xf7, 0xeb, 0xfa, 0xf8, 0x08, 0x17, 0x0c, 0x1e, 0x1c, 0x0a, 0x1f, 0xf9, 0x01,
+    0x05, 0x19, 0x15, 0xff, 0xeb, 0x06, 0x15, 0x04, 0x02, 0x03, 0x04, 0xf7, 0x00, 0x1d, 0xfc, 0x0a,
+    0x04, 0x16, 0x03, 0xfe, 0x00, 0xe6, 0xfa, 0xf9, 0x04, 0x0d, 0x0b, 0x13, 0x0d, 0x1f, 0x0b, 0xdf,
+    0x07, 0x0b, 0xff, 0x0e, 0x08, 0x1e, 0x03, 0x1a, 0x05, 0xfc, 0x07, 0xfe, 0xfe, 0xfa, 0xf4, 0x0a,
+    0xf4, 0xfd, 0xfb, 0xea, 0xf7, 0x04, 0xf9, 0x05, 0x0a, 0x36, 0x16, 0x18, 0x19, 0x1a, 0x08, 0xfa,
+    0x02, 0x09, 0x01, 0x2d, 0x07, 0x28, 0x17, 0xf4, 0x1b, 0x07, 0xf4, 0xf8, 0xe7, 0x10, 0x07, 0x0e,
+    0xf3, 0x01, 0xe0, 0xe3, 0xcf, 0xd9, 0xe6, 0xeb, 0xff, 0xf6, 0xfa, 0xfa, 0xf9, 0xc1, 0xe3, 0xfe,
+    0x0a, 0xfb, 0x11, 0x08, 0x09, 0xf0, 0x0c, 0xf6, 0x04, 0x0d, 0x11, 0x07, 0x00, 0xf5, 0x12, 0xf5,
+    0x02, 0x08, 0xf4, 0xfa, 0x0d, 0x0f, 0x0a, 0xf3, 0x02, 0xf5, 0x02, 0xff, 0xfb, 0x01, 0x12, 0xf2,
+    0xf8, 0x00, 0xe6, 0x0b, 0xfe, 0xfd, 0xe1, 0xfe, 0x14, 0x14, 0x12, 0x27, 0xfe, 0xe1, 0xfe, 0x09,
+    0x0b, 0xd6, 0xd7, 0xe9, 0x09, 0x0d, 0x28, 0x3f, 0xf4, 0xfd, 0xef, 0xf2, 0x0b, 0x0d, 0x07, 0x08,
+    0x02, 0xfa, 0xfe, 0x0d, 0x04, 0xe0, 0xf5, 0x05, 0x18, 0x3f, 0x2b, 0x1e, 0x12, 0x03, 0xde, 0x9d,
+    0x0d, 0x03, 0xfe, 0x0a, 0x02, 0x0d, 0x25, 0x0f, 0xe9, 0xe2, 0xdd, 0xf5, 0xf8, 0xfe, 0x04, 0xf9,
+    0x03, 0x01, 0xfc, 0xfc, 0x01, 0x01, 0x09, 0xfa, 0x03, 0xe3, 0xf4, 0x05, 0xf5, 0xfc, 0xeb, 0xeb,
+    0xe3, 0xe7, 0xf7, 0x0c, 0xfb, 0xed, 0xfd, 0xe2, 0xef, 0xff, 0xf3, 0xfe, 0x0c, 0x1d, 0x11, 0xe9,
+    0xfe, 0xd6, 0xf5, 0xfc, 0x1c, 0x04, 0x03, 0x14, 0x2c, 0x15, 0x13, 0x0f, 0x0b, 0x1d, 0xed, 0x16,
+    0x17, 0x03, 0xfb, 0x1a, 0xee, 0xe4, 0xd4, 0xeb, 0x08, 0x0c, 0x00, 0x10, 0x15, 0x15, 0xfd, 0xe6,
+    0xf6, 0xf5, 0xef, 0xdc, 0xff, 0xf5, 0xea, 0x0b, 0x24, 0x18, 0x03, 0x0e, 0xf7, 0x30, 0x0c, 0x14,
+    0xf5, 0x0e, 0x0b, 0xe7, 0xf9, 0x0e, 0xfb, 0xfb, 0x0b, 0x1b, 0x14, 0x0e, 0x0c, 0xff, 0x03, 0xe6,
+    0xfd, 0x0b, 0xfe, 0xfe, 0x17, 0x0d, 0x01, 0xd4, 0x07, 0x09, 0xe4, 0x08, 0x02, 0x18, 0x08, 0x19,
+    0x0e, 0x04, 0xe4, 0x19, 0x0d, 0x00, 0x00, 0xf2, 0xf9, 0x04, 0x0a, 0x14, 0xfc, 0xd8, 0xc8, 0xf8,
+    0x02, 0x31, 0xde, 0xf4, 0x11, 0xfc, 0x0e, 0x02, 0xfa, 0xb9, 0xb4, 0xf6, 0xff, 0x03, 0xfe, 0xf5,
+    0xf2, 0x04, 0x08, 0x02, 0xfe, 0x02, 0x02, 0xfb, 0x0e, 0x0b, 0x24, 0x0d, 0x03, 0x00, 0x04, 0x12,
+    0x14, 0x10, 0x19, 0x23, 0x0e, 0x04, 0x1b, 0x1c, 0x0c, 0x14, 0x1d, 0x0b, 0x0a, 0x01, 0xee, 0xf2,
+    0x0f, 0x05, 0xf7, 0x09, 0x1d, 0x14, 0x01, 0x06, 0x35, 0x18, 0xfc, 0xf9, 0x08, 0xf9, 0x05, 0x01,
+    0xf7, 0xf7, 0x17, 0x1d, 0x27, 0xef, 0x0d, 0x32, 0x0a, 0x27, 0x0e, 0xee, 0xe9, 0xe7, 0xe4, 0xf2,
+    0xec, 0xf6, 0x19, 0xf2, 0xf9, 0x09, 0xfb, 0x15, 0xfb, 0xec, 0xe7, 0x00, 0x0b, 0x04, 0xfd, 0x01,
+    0x00, 0xfd, 0xeb, 0x19, 0x19, 0xe8, 0x03, 0x0e, 0x02, 0x06, 0x22, 0xfe, 0x09, 0xda, 0x02, 0x07,
+    0xf6, 0xff, 0xfb, 0x05, 0xf6, 0x0d, 0x0a, 0xf8, 0xf7, 0x18, 0xf8, 0xe9, 0xdb, 0xc0, 0xdb, 0x07,
+    0x0d, 0x0f, 0xfd, 0x1f, 0xfd, 0x06, 0x01, 0x03, 0xf8, 0xdb, 0xee, 0xff, 0xf6, 0x00, 0xf8, 0x0e,
+    0xff, 0x15, 0xad, 0xf5, 0x0c, 0x08, 0x0e, 0xef, 0x0d, 0xfe, 0x05, 0xfa, 0xf3, 0xfe, 0x08, 0x0b,
+    0xed, 0xff, 0xfc, 0x27, 0xfc, 0xff, 0xf7, 0x05, 0xf7, 0x05, 0x14, 0x06, 0xf6, 0xe2, 0xfe, 0x1f,
+    0x1d, 0x36, 0x0b, 0x0e, 0xe7, 0xf0, 0xed, 0xee, 0xe9, 0xe5, 0xf2, 0x03, 0x10, 0x2f, 0x3b, 0xf9,
+    0xeb, 0xdc, 0xef, 0xeb, 0x10, 0xf4, 0xdf, 0xed, 0xfe, 0x25, 0x21, 0x18, 0xfd, 0xe6, 0xfc, 0x0e,
+    0xf2, 0xcf, 0xd6, 0xfc, 0x11, 0x1e, 0x2a, 0x18, 0x04, 0xf4, 0xfe, 0x0f, 0x06, 0xf8, 0xef, 0x02,
+    0x10, 0x04, 0xf1, 0xd3, 0x04, 0xf9, 0x06, 0x09, 0xf6, 0x01, 0x07, 0x15, 0x0a, 0xfd, 0xef, 0x0f,
+    0x0b, 0x1c, 0x0e, 0xf4, 0x0c, 0xfc, 0xfd, 0x0b, 0xe6, 0xf5, 0xfe, 0x31, 0x08, 0x10, 0x06, 0xfe,
+    0x02, 0xfd, 0xff, 0x0f, 0x06, 0xff, 0xfb, 0xbb, 0xf6, 0xf2, 0x02, 0xf9, 0xfb, 0x09, 0x0a, 0xfc,
+    0xf6, 0xf3, 0x0c, 0xf4, 0xf4, 0xfa, 0x03, 0x03, 0x04, 0xf8, 0x07, 0x03, 0xfe, 0xf4, 0xf0, 0xdb,
+    0x07, 0xf2, 0x06, 0xf5, 0x0f, 0x0a, 0x01, 0xf1, 0x02, 0xe9, 0x1e, 0xfc, 0x03, 0xf7, 0xf4, 0xf8,
+    0xfb, 0x05, 0xf5, 0x11, 0x06, 0x05, 0x0b, 0x09, 0x07, 0xe1, 0xe9, 0x19, 0xf3, 0x05, 0x04, 0x06,
+    0x18, 0x12, 0x02, 0x1c, 0xf7, 0xf7, 0xf6, 0xff, 0x11, 0x0d, 0x03, 0xfa, 0x0f, 0xf5, 0xf8, 0xee,
+    0x14, 0x00, 0xe5, 0x11, 0x0d, 0xef, 0x0e, 0x07, 0x0a, 0x18, 0x0b, 0x08, 0x07, 0xde, 0x00, 0x03,
+    0xf0, 0x12, 0x11, 0xf6, 0x11, 0xfb, 0x0c, 0x28, 0xf7, 0xf9, 0x0b, 0x07, 0x10, 0x25, 0x0f, 0x01,
+    0xfe, 0xfa, 0xd6, 0xde, 0xfc, 0xd1, 0xdc, 0xf2, 0xf2, 0x01, 0x20, 0x04, 0xfe, 0xfb, 0xdb, 0xf7,
+    0x0c, 0xd5, 0xe0, 0xfd, 0xdf, 0xfa, 0x0e, 0x0d, 0x03, 0xff, 0xf6, 0x05, 0xf6, 0xe3, 0xef, 0xeb,
+    0xe9, 0x0e, 0x00, 0xf8, 0xe6, 0xe2, 0xf8, 0x0c, 0xfc, 0x0c, 0xea, 0xf4, 0xe9, 0xee, 0xe5, 0xe5,
+    0xf4, 0x08, 0xfc, 0xfa, 0xf4, 0xfc, 0x04, 0x07, 0x1c, 0xfc, 0x17, 0x18, 0x1f, 0x1e, 0xe4, 0xe4,
+    0x03, 0xff, 0x04, 0xdb, 0x0a, 0xf5, 0x01, 0x06, 0xf5, 0x01, 0xc7, 0x0d, 0xf5, 0x03, 0xfe, 0x04,
+    0xfc, 0xf8, 0xf8, 0x16, 0x04, 0xea, 0x02, 0x0d, 0x0e, 0xee, 0x21, 0x07, 0xe4, 0xf5, 0xf5, 0x11,
+    0x20, 0x1b, 0x0a, 0xf8, 0xfc, 0xe3, 0x11, 0x18, 0xee, 0xde, 0xf9, 0x1d, 0x0f, 0x15, 0x01, 0x17,
+    0x0c, 0xec, 0x12, 0x05, 0x03, 0xf1, 0xfc, 0x10, 0x1e, 0x0e, 0x08, 0xd9, 0xfa, 0x0e, 0x0b, 0xfc,
+    0x04, 0xfa, 0xff, 0xfe, 0x09, 0x00, 0x1a, 0xce, 0x02, 0x02, 0x0a, 0xef, 0x03, 0x07, 0x0d, 0x11,
+    0x1b, 0x0c, 0xf4, 0xe0, 0xfe, 0xf5, 0x0f, 0x00, 0x06, 0x02, 0x06, 0xfe, 0xf9, 0xf2, 0xf6, 0x1f,
+    0xfe, 0xd0, 0xea, 0x0c, 0x0a, 0x1a, 0xf5, 0xff, 0xef, 0x08, 0x13, 0x1f, 0x0b, 0xd8, 0xe4, 0x0b,
+    0x08, 0x0a, 0xec, 0xeb, 0xeb, 0x05, 0xdb, 0x2c, 0xf5, 0xfb, 0x0d, 0x19, 0x11, 0xea, 0xc2, 0xe9,
+    0xe4, 0xeb, 0xf6, 0x0e, 0x05, 0xcc, 0xe2, 0xee, 0xe5, 0xf4, 0xe8, 0xdf, 0x00, 0xf3, 0xf7, 0xf2,
+    0xfd, 0xdb, 0x09, 0x1e, 0xfa, 0x04, 0xce, 0xd0, 0xf0, 0x02, 0xec, 0xf4, 0xfd, 0x04, 0xfb, 0xfe,
+    0xfa, 0x00, 0x14, 0xfc, 0xfd, 0xfe, 0x0a, 0x09, 0x11, 0x2f, 0x0f, 0x17, 0x07, 0x15, 0x03, 0xf0,
+    0xf7, 0xfd, 0x0f, 0x10, 0x10, 0x1d, 0x05, 0x02, 0x00, 0x10, 0x01, 0xf5, 0x08, 0x03, 0x0c, 0x0c,
+    0xf6, 0xf9, 0xff, 0xf2, 0x0e, 0xf9, 0x0b, 0xf5, 0xf6, 0x06, 0x09, 0xf9, 0x0b, 0x15, 0x02, 0xff,
+    0x0a, 0x0a, 0x0d, 0x03, 0xf9, 0xff, 0x1b, 0xd5, 0x07, 0x0c, 0xfd, 0x08, 0x0a, 0x11, 0xfa, 0x07,
+    0xfe, 0x17, 0x17, 0xf8, 0x04, 0xff, 0x01, 0x07, 0x0a, 0xf1, 0x0d, 0x18, 0x23, 0x1d, 0x06, 0x03,
+    0xf9, 0xdd, 0x01, 0x21, 0x1d, 0x01, 0x1b, 0x12, 0x16, 0x14, 0x29, 0xff, 0x02, 0xf5, 0x01, 0x11,
+    0x00, 0x09, 0x09, 0xf1, 0xef, 0xf5, 0xd8, 0xf6, 0x04, 0xe3, 0xf9, 0xf2, 0xe1, 0x06, 0xf7, 0xef,
+    0xcb, 0xd8, 0xc4, 0xec, 0x0a, 0x00, 0xda, 0xdd, 0xf9, 0xe4, 0xfe, 0xf0, 0xff, 0xf2, 0xc6, 0xdd,
+    0xf5, 0x03, 0xf1, 0xe6, 0x07, 0xfe, 0x13, 0x03, 0x03, 0xf1, 0xd1, 0x09, 0xf7, 0xfd, 0x02, 0xfc,
+    0xf8, 0xf7, 0x15, 0xe0, 0x03, 0x18, 0x02, 0x00, 0x06, 0xef, 0x33, 0x1b, 0x25, 0x19, 0x1e, 0x01,
+    0x0a, 0x0e, 0x1d, 0xf0, 0x17, 0x0e, 0xf7, 0xf3, 0x02, 0x10, 0x0c, 0x0d, 0x18, 0x1b, 0x0a, 0x0e,
+    0x0a, 0xe0, 0xef, 0xe5, 0xea, 0xf5, 0xf0, 0xe6, 0x06, 0xfc, 0xfb, 0x25, 0xf3, 0x25, 0x08, 0x08,
+    0x09, 0xf6, 0xf2, 0xf3, 0xfa, 0xf7, 0xeb, 0xe6, 0x0b, 0x2e, 0x04, 0xff, 0xf0, 0xe5, 0xe8, 0xf7,
+    0x08, 0x0b, 0xf0, 0xe0, 0x06, 0xea, 0xe7, 0xea, 0xf1, 0xf6, 0xf1, 0xfa, 0xfd, 0x01, 0xfc, 0xec,
+    0x08, 0xda, 0xda, 0x0f, 0x00, 0xf6, 0xf2, 0xfb, 0x07, 0x00, 0xf6, 0xcf, 0x02, 0x0e, 0x03, 0x07,
+    0x01, 0x09, 0xf5, 0xe5, 0xcf, 0xbd, 0xb3, 0xa9, 0xf9, 0x0d, 0xfa, 0x12, 0x04, 0xee, 0x07, 0x00,
+    0xf3, 0x04, 0xeb, 0x0c, 0xfa, 0xfd, 0x0e, 0xef, 0x0a, 0x0c, 0x01, 0x33, 0x19, 0x07, 0x2d, 0x11,
+    0x00, 0x0c, 0x06, 0x08, 0x01, 0xff, 0x06, 0xf8, 0x12, 0x1b, 0xf9, 0x01, 0xfc, 0xfe, 0xfb, 0x07,
+    0xec, 0x0d, 0x06, 0x01, 0xfa, 0x00, 0xfb, 0x0d, 0x0c, 0x05, 0xf6, 0x07, 0x03, 0xf6, 0x03, 0xf1,
+    0x0e, 0x05, 0x09, 0xef, 0x0a, 0x01, 0x19, 0xef, 0x06, 0xff, 0xf7, 0xf2, 0x05, 0x0a, 0x05, 0x05,
+    0x11, 0x0e, 0xf5, 0xfc, 0xf5, 0xfc, 0xec, 0xfc, 0xfe, 0x13, 0x2d, 0x25, 0x0b, 0xd3, 0xd5, 0xed,
+    0xfe, 0x23, 0x08, 0xd9, 0x12, 0x0d, 0x13, 0x2d, 0xfc, 0x03, 0xf5, 0x17, 0x25, 0x10, 0xe6, 0xd2,
+    0xf7, 0x13, 0x08, 0x22, 0xfd, 0xf9, 0x13, 0x1b, 0xf8, 0xf3, 0xd7, 0xe7, 0x05, 0xfb, 0xf1, 0xcd,
+    0xfc, 0xfa, 0x09, 0x0c, 0xf8, 0xee, 0xeb, 0xf0, 0xfa, 0x01, 0x13, 0x06, 0xf6, 0x0b, 0xf2, 0xf7,
+    0xf4, 0xed, 0x07, 0x1d, 0x15, 0x22, 0x1c, 0x12, 0x01, 0xfd, 0xf1, 0xfe, 0xf5, 0x1b, 0x0c, 0x05,
+    0x0d, 0x05, 0x26, 0x1c, 0x0a, 0x0a, 0x0c, 0xff, 0x00, 0x00, 0xe5, 0xff, 0xfc, 0xf3, 0x07, 0x3d,
+    0xf8, 0xff, 0x18, 0xe9, 0xf7, 0xf9, 0xf6, 0x02, 0xe6, 0xeb, 0x10, 0x08, 0x0a, 0x0b, 0x02, 0xff,
+    0x0d, 0x0c, 0xfc, 0xf3, 0x02, 0x17, 0xf4, 0xf9, 0x05, 0x10, 0x14, 0x1b, 0xe9, 0xe4, 0xf1, 0xf3,
+    0x0d, 0x0f, 0x11, 0x0e, 0xff, 0xed, 0x18, 0x11, 0x07, 0xd6, 0xd8, 0x0d, 0xff, 0x06, 0x00, 0x03,
+    0xef, 0x0a, 0x27, 0xfe, 0x0c, 0xe1, 0xcc, 0x10, 0xf2, 0xf6, 0xf8, 0x04, 0x0c, 0xff, 0x0d, 0x08,
+    0x13, 0x07, 0x10, 0xf9, 0x06, 0x17, 0x24, 0xee, 0x06, 0x11, 0xe7, 0xe8, 0x06, 0x1d, 0x07, 0xdb,
+    0xe9, 0x15, 0x15, 0xeb, 0x0a, 0xf1, 0x0b, 0x05, 0xfa, 0x03, 0x09, 0x10, 0xf1, 0xd2, 0xfa, 0x17,
+    0xf7, 0xf3, 0x08, 0x05, 0xf3, 0x0b, 0x18, 0xf7, 0x08, 0xdc, 0xfe, 0xfc, 0xf4, 0x0c, 0x04, 0x10,
+    0xef, 0x08, 0x04, 0x00, 0x03, 0x0b, 0xff, 0x0d, 0xf6, 0x14, 0x0c, 0xf1, 0xee, 0x17, 0x08, 0x07,
+    0x14, 0xf4, 0x0a, 0xfe, 0x07, 0x15, 0x14, 0x1a, 0x01, 0xed, 0x0b, 0x07, 0x1a, 0x19, 0x09, 0x1e,
+    0xfe, 0xe0, 0xfb, 0xee, 0xe5, 0x07, 0x04, 0xe3, 0xde, 0x01, 0x1f, 0xfb, 0xf9, 0xf6, 0x08, 0x02,
+    0x03, 0xf9, 0xf3, 0x0b, 0x00, 0xfc, 0xfa, 0xfa, 0xf2, 0x08, 0xfb, 0x05, 0x15, 0x02, 0x06, 0xfc,
+    0x0f, 0x07, 0x2f, 0x02, 0xf9, 0x0f, 0x08, 0xe6, 0xdf, 0x0f, 0xfe, 0x0e, 0x1e, 0xfb, 0x0a, 0x0e,
+    0xf5, 0xf6, 0xef, 0xda, 0xe7, 0xff, 0x0a, 0xe9, 0xed, 0xeb, 0xd9, 0x05, 0x07, 0xe8, 0x13, 0xfe,
+    0x02, 0xfb, 0xfa, 0x1c, 0xfa, 0x0a, 0xf6, 0xe1, 0xfb, 0xf3, 0x1d, 0x18, 0xec, 0xf8, 0x04, 0x14,
+    0x1e, 0x09, 0x02, 0x0a, 0xff, 0x17, 0xfc, 0x0c, 0x05, 0xf9, 0x11, 0x14, 0x17, 0x13, 0x12, 0x04,
+    0xfa, 0xf4, 0x02, 0x2c, 0x07, 0xf3, 0x15, 0x0c, 0x20, 0x15, 0x1e, 0x22, 0xf3, 0xf2, 0xf9, 0x24,
+    0x03, 0xed, 0xef, 0x03, 0xe8, 0x03, 0x18, 0xf6, 0xf4, 0xf1, 0xf4, 0x08, 0xf9, 0xff, 0x07, 0xe9,
+    0xf2, 0x07, 0xfa, 0x0f, 0x04, 0xff, 0xf0, 0x05, 0xfe, 0x0b, 0x0d, 0x0e, 0x10, 0x06, 0x0d, 0x04,
+    0xfb, 0xe2, 0x0d, 0xee, 0x09, 0x0a, 0x18, 0xf5, 0xfa, 0x13, 0xff, 0x08, 0x02, 0xfb, 0xfe, 0xfa,
+    0xff, 0xfd, 0x07, 0x11, 0x08, 0x0c, 0x0b, 0xf8, 0xf5, 0xd1, 0xc0, 0xa4, 0xe0, 0xef, 0x0d, 0xfc,
+    0x01, 0x10, 0xfd, 0xfd, 0x0b, 0x18, 0xd3, 0xb9, 0x01, 0xfd, 0x06, 0x00, 0x11, 0xff, 0x19, 0xf9,
+    0xfd, 0xde, 0xb7, 0xc7, 0x1c, 0x2b, 0x0f, 0xdb, 0xd8, 0xda, 0xf2, 0x37, 0xf6, 0xfb, 0xbe, 0x07,
+    0x1d, 0x1b, 0x0c, 0xf1, 0xfd, 0xe8, 0x14, 0x01, 0xfe, 0xdc, 0xd3, 0x02, 0x1f, 0x1a, 0x1c, 0x06,
+    0xe4, 0x18, 0x0b, 0x2a, 0x08, 0xec, 0x0c, 0x21, 0x1f, 0xfb, 0xff, 0xf5, 0xff, 0x00, 0x1c, 0x15,
+    0x05, 0xdf, 0x02, 0x29, 0xf1, 0xf2, 0xef, 0xff, 0xf0, 0xf9, 0xff, 0x0d, 0x03, 0xf4, 0x1b, 0x01,
+    0xec, 0xed, 0xdf, 0xf8, 0xfe, 0x02, 0xff, 0xf1, 0xf6, 0x09, 0x04, 0x06, 0xf3, 0x00, 0xfd, 0xea,
+    0xf7, 0xf8, 0x0b, 0x04, 0xfd, 0x0d, 0x05, 0x02, 0x1f, 0x00, 0xef, 0xe6, 0xe7, 0xf2, 0xd9, 0x06,
+    0x0b, 0x0a, 0x08, 0x13, 0x02, 0xfc, 0x04, 0x1a, 0xf0, 0x1a, 0x09, 0xfb, 0x01, 0xfa, 0xf7, 0x0a,
+    0x01, 0x06, 0x02, 0x1d, 0xf9, 0xeb, 0xfb, 0x08, 0x06, 0x2d, 0x10, 0x09, 0x0b, 0x03, 0xe3, 0xf7,
+    0xfb, 0xea, 0x16, 0xfe, 0x1c, 0xea, 0xfc, 0x17, 0x02, 0xf9, 0xfd, 0x01, 0x0c, 0xf4, 0x1f, 0x01,
+    0x0a, 0xf7, 0x09, 0x1f, 0x10, 0x1b, 0xf9, 0xed, 0xff, 0x11, 0x1c, 0x00, 0xfd, 0x26, 0x31, 0x27,
+    0x13, 0xf6, 0xc7, 0xed, 0xf8, 0x05, 0x13, 0xee, 0xfc, 0x1d, 0x16, 0xfa, 0xe3, 0xce, 0xfd, 0xfb,
+    0x06, 0xee, 0x00, 0x15, 0xf9, 0x16, 0x07, 0xf1, 0xd2, 0xe3, 0x04, 0x09, 0x07, 0x05, 0xe2, 0xf4,
+    0x0a, 0x08, 0xdf, 0xdd, 0xf2, 0xfa, 0x00, 0x13, 0xf8, 0xf8, 0xf4, 0xea, 0xf4, 0xf7, 0xe5, 0xde,
+    0xea, 0xfa, 0xf4, 0x02, 0xfd, 0xf8, 0x06, 0xf3, 0x09, 0x13, 0x18, 0xfd, 0x0a, 0xeb, 0xe8, 0xee,
+    0x05, 0x0e, 0x0b, 0xfb, 0xfd, 0x05, 0x16, 0x09, 0x10, 0x04, 0x09, 0x08, 0xfa, 0x0a, 0x05, 0xb2,
+    0x08, 0xee, 0x06, 0x08, 0xf3, 0x07, 0xf7, 0x13, 0x1a, 0xff, 0x0b, 0x06, 0x09, 0xf8, 0x0e, 0x06,
+    0x03, 0xfb, 0xf7, 0x22, 0x10, 0xf0, 0xf8, 0xf4, 0x03, 0xee, 0xb4, 0xf4, 0x0a, 0xfa, 0x07, 0x00,
+    0x1d, 0x23, 0x0f, 0xe4, 0x04, 0xf0, 0xe4, 0xfa, 0x1a, 0x01, 0x01, 0x06, 0x0b, 0x0d, 0x0d, 0xf0,
+    0xf5, 0xf4, 0x10, 0x0c, 0xea, 0xfc, 0x0e, 0x12, 0x10, 0x08, 0x00, 0xd9, 0x0b, 0xf4, 0xf8, 0xcd,
+    0xd4, 0xf6, 0x22, 0x15, 0x01, 0x0b, 0xe8, 0x12, 0xfc, 0xe4, 0xde, 0xd7, 0x07, 0x2d, 0x0f, 0xf4,
+    0xf9, 0xe0, 0xfc, 0xd6, 0xf5, 0xf5, 0xdc, 0x22, 0x2f, 0xfa, 0x07, 0x02, 0xff, 0xf5, 0x12, 0x02,
+    0x0a, 0xd1, 0xcd, 0x07, 0x15, 0x06, 0xfe, 0x13, 0x03, 0x03, 0xf7, 0x06, 0xff, 0xbb, 0xe4, 0xff,
+    0x13, 0xed, 0xff, 0x0f, 0xff, 0xfa, 0xf1, 0x2e, 0x02, 0xec, 0xe3, 0xdd, 0xec, 0x12, 0x0a, 0x2a,
+    0x0b, 0x0a, 0x0f, 0xe5, 0xfa, 0xfc, 0x0f, 0x05, 0xf5, 0x06, 0xfe, 0x0b, 0xfc, 0x07, 0xe8, 0xf0,
+    0xff, 0x07, 0xf7, 0x00, 0xf9, 0x09, 0x07, 0xfc, 0x0d, 0x0e, 0xdb, 0xf8, 0x02, 0xf3, 0x01, 0x0b,
+    0xf0, 0xfc, 0x1e, 0x1e, 0xfe, 0xfa, 0xfa, 0x01, 0x02, 0xf8, 0x1c, 0xfd, 0x18, 0x02, 0x07, 0xfa,
+    0xff, 0xef, 0xe0, 0xce, 0xfd, 0xe4, 0x02, 0xf9, 0x07, 0x10, 0xff, 0x0f, 0xe2, 0xed, 0xe7, 0xd2,
+    0x0d, 0x15, 0x1c, 0x12, 0x0a, 0x14, 0x11, 0x13, 0x07, 0xda, 0xe2, 0xde, 0xf8, 0xfc, 0xef, 0x11,
+    0x13, 0x01, 0x08, 0x25, 0xec, 0xbd, 0xde, 0x09, 0x01, 0xf4, 0xee, 0xff, 0xff, 0x16, 0x3c, 0x1d,
+    0x04, 0xc1, 0xe3, 0x1f, 0xfe, 0xef, 0x24, 0x08, 0x14, 0x15, 0x1f, 0x01, 0xcb, 0xc8, 0x01, 0x1e,
+    0x02, 0xe0, 0x0b, 0x0b, 0x0c, 0x03, 0x16, 0xdf, 0xea, 0xf1, 0xf1, 0x24, 0xf9, 0x0b, 0x17, 0xf9,
+    0x10, 0xf8, 0xe7, 0xe7, 0xc8, 0xef, 0xf5, 0xed, 0x01, 0xf4, 0x0d, 0x0e, 0x01, 0xf6, 0xff, 0xf5,
+    0xf4, 0xea, 0xe7, 0xdf, 0x0b, 0xe7, 0xfa, 0xf9, 0xf7, 0x09, 0x0c, 0xf9, 0xfd, 0xf6, 0x08, 0xc1,
+    0x00, 0x3d, 0xf3, 0x22, 0x0b, 0xfc, 0x11, 0x08, 0x14, 0xfc, 0xe8, 0xf6, 0x08, 0x02, 0xff, 0xfa,
+    0x01, 0xff, 0xf7, 0xec, 0x05, 0xf9, 0x04, 0xfb, 0x00, 0xbe, 0xf0, 0xd5, 0xeb, 0xfb, 0xef, 0xfa,
+    0xf8, 0xea, 0xef, 0x3a, 0xec, 0xff, 0xf1, 0xe9, 0xfc, 0xef, 0xff, 0x0f, 0x07, 0xfb, 0x1c, 0xf3,
+    0xf0, 0x00, 0xef, 0xff, 0x0d, 0x0c, 0x04, 0x26, 0x1f, 0x29, 0x31, 0x1b, 0x08, 0xf9, 0x1c, 0xfc,
+    0xed, 0xec, 0xe2, 0xd6, 0xe7, 0xd3, 0xec, 0x14, 0x09, 0xf3, 0x03, 0x04, 0xfe, 0x03, 0xf5, 0xe2,
+    0xd6, 0xa3, 0x9c, 0x81, 0x0b, 0x04, 0xf6, 0x09, 0xfa, 0x05, 0x08, 0x0d, 0xfa, 0xf6, 0x9c, 0xe0,
+    0x07, 0xf3, 0x0c, 0x06, 0x1f, 0xf0, 0x0a, 0xf2, 0xf2, 0x02, 0xf9, 0x0d, 0x0c, 0x06, 0x01, 0x0d,
+    0x11, 0x14, 0x02, 0x09, 0xfe, 0xf6, 0x0b, 0xd5, 0x0d, 0xf4, 0x08, 0x13, 0x11, 0xf8, 0x03, 0x01,
+    0x09, 0x18, 0xfe, 0x02, 0xfe, 0xee, 0x0e, 0x13, 0x0b, 0x0a, 0x03, 0x0d, 0x01, 0x0c, 0x21, 0xe7,
+    0xfe, 0x3a, 0xfc, 0x0a, 0xff, 0x0f, 0xfd, 0xfa, 0xfe, 0xe7, 0xf9, 0xfa, 0xf4, 0xfb, 0x08, 0x05,
+    0x09, 0x06, 0x07, 0xde, 0xfe, 0x13, 0xfa, 0xf6, 0x05, 0x09, 0xf3, 0xed, 0xe7, 0xe8, 0x1d, 0xfc,
+    0xf5, 0xf5, 0x02, 0xfc, 0x0b, 0xe4, 0xfa, 0xd9, 0xf4, 0xfd, 0x01, 0x0e, 0xdd, 0xfc, 0xf5, 0xfc,
+    0x0b, 0xfe, 0xe7, 0xd8, 0xe8, 0xff, 0x1a, 0x09, 0x03, 0x0b, 0x02, 0x06, 0x0d, 0xe2, 0xff, 0xe8,
+    0x07, 0xf2, 0xe3, 0xe6, 0xdc, 0xf0, 0xe8, 0x06, 0x0c, 0xf0, 0xfc, 0x17, 0xfd, 0x13, 0xef, 0xf6,
+    0xec, 0xea, 0xfc, 0x2e, 0x07, 0x0c, 0x0e, 0x17, 0x18, 0xfc, 0x02, 0x07, 0x05, 0x19, 0x29, 0xe0,
+    0xf7, 0x0c, 0x28, 0x0d, 0x07, 0xf7, 0x0a, 0x0d, 0x1a, 0x09, 0x29, 0xd7, 0x09, 0x12, 0x17, 0x1f,
+    0x05, 0x06, 0x1f, 0x22, 0x2d, 0x0f, 0x17, 0x0e, 0xfd, 0x21, 0x03, 0xfc, 0x0d, 0x12, 0xfc, 0x13,
+    0x04, 0xfd, 0xfa, 0xe6, 0xf3, 0xfd, 0xf6, 0xf2, 0x05, 0xeb, 0xec, 0xf0, 0x0c, 0x13, 0x2d, 0x02,
+    0x0d, 0x1f, 0xe7, 0x0b, 0x08, 0xfd, 0x03, 0xb6, 0xf5, 0x14, 0x1e, 0x08, 0xfe, 0xff, 0xf4, 0xf6,
+    0x03, 0x09, 0x14, 0x15, 0xfc, 0xfe, 0x07, 0x05, 0x08, 0x0d, 0xec, 0xf5, 0x04, 0x03, 0x05, 0xf4,
+    0xf8, 0x16, 0x0e, 0x32, 0x10, 0xe2, 0xee, 0xf3, 0x08, 0x13, 0x04, 0xf5, 0x04, 0x15, 0x1e, 0x02,
+    0x0c, 0x19, 0xfe, 0x01, 0xf8, 0x07, 0xeb, 0x0a, 0x0f, 0x1b, 0x12, 0x12, 0xf7, 0x12, 0xff, 0x0d,
+    0x10, 0x03, 0xe6, 0x03, 0x0c, 0x15, 0x0d, 0x09, 0x03, 0xf9, 0xfb, 0x0a, 0xf5, 0x00, 0xdf, 0xde,
+    0x0e, 0x0b, 0x22, 0x25, 0x07, 0x0f, 0xe9, 0x03, 0xff, 0xf8, 0xd7, 0xd8, 0x12, 0x1d, 0x20, 0x0d,
+    0xfb, 0xed, 0x07, 0xf9, 0xfc, 0x03, 0xc9, 0xfd, 0x27, 0x33, 0x16, 0x1d, 0xf9, 0xe9, 0xef, 0xee,
+    0xf2, 0xd5, 0xda, 0x26, 0x18, 0x07, 0x00, 0xed, 0x00, 0x08, 0xfe, 0xdb, 0xd4, 0x03, 0x1c, 0x12,
+    0x0a, 0x0b, 0x12, 0x09, 0xf4, 0xed, 0x01, 0xf9, 0x10, 0x0f, 0x05, 0x04, 0x19, 0x12, 0x15, 0x2f,
+    0xfb, 0x12, 0xe5, 0x0a, 0x02, 0xff, 0x07, 0xfe, 0x02, 0x12, 0x26, 0x02, 0x0c, 0xf9, 0xfc, 0x0a,
+    0x03, 0xfe, 0x0d, 0x11, 0x04, 0x0b, 0xf3, 0xff, 0x0e, 0x47, 0xe8, 0xec, 0x01, 0x09, 0xe7, 0xf9,
+    0x0e, 0x12, 0xfd, 0xef, 0xff, 0xed, 0xee, 0xf3, 0x08, 0xfc, 0x0e, 0x0b, 0x16, 0xf5, 0x10, 0x2d,
+    0xf9, 0x0c, 0x15, 0xfc, 0x12, 0x17, 0xfa, 0xef, 0xf3, 0x06, 0xfc, 0x16, 0xf5, 0xe6, 0x21, 0x05,
+    0xff, 0xf8, 0x23, 0x23, 0x14, 0xf9, 0xfa, 0x02, 0xfb, 0x10, 0x03, 0x10, 0x00, 0x03, 0x15, 0x1d,
+    0x1b, 0xed, 0xf5, 0xf9, 0x0b, 0x13, 0xf4, 0xea, 0xe7, 0xe1, 0x02, 0x32, 0xfd, 0xd1, 0xe7, 0x0b,
+    0xf4, 0xd1, 0xfa, 0xeb, 0xf1, 0x08, 0x08, 0xfe, 0xf0, 0xed, 0x05, 0xff, 0xf6, 0x11, 0x0d, 0xfc,
+    0x07, 0xff, 0x03, 0x08, 0xc9, 0xfb, 0x06, 0xeb, 0xf7, 0xf9, 0x08, 0x09, 0x10, 0xf7, 0x01, 0x01,
+    0xfe, 0xe1, 0x1e, 0x02, 0xf9, 0x1e, 0x1f, 0x0c, 0xf3, 0xed, 0xf9, 0xfe, 0xdb, 0x00, 0xfd, 0x07,
+    0x0b, 0x26, 0x03, 0xea, 0xe1, 0xeb, 0xee, 0x07, 0xf6, 0xe5, 0xf1, 0x07, 0xf7, 0xf9, 0x09, 0x07,
+    0x04, 0x03, 0x0c, 0xf0, 0x08, 0x10, 0x0d, 0xfb, 0x05, 0x0e, 0xfe, 0xff, 0x2b, 0x21, 0x0a, 0xf3,
+    0xe2, 0xe1, 0xf6, 0xbd, 0xe3, 0xeb, 0x17, 0x2e, 0x0e, 0xeb, 0x01, 0x06, 0x27, 0x0f, 0xf0, 0xf5,
+    0xf9, 0x10, 0x12, 0xeb, 0x07, 0xfc, 0x1a, 0x0e, 0x09, 0x15, 0xff, 0xfb, 0x07, 0x02, 0xf5, 0x08,
+    0x0f, 0x0a, 0xed, 0xef, 0xf9, 0xea, 0x20, 0x18, 0xf6, 0x22, 0xe2, 0xfa, 0xf8, 0x06, 0xf9, 0xf1,
+    0xe3, 0xef, 0x03, 0xfa, 0x07, 0x0d, 0x05, 0x01, 0xec, 0xfb, 0xdb, 0x11, 0x07, 0x05, 0x09, 0xef,
+    0x03, 0x1a, 0x05, 0xf2, 0xe8, 0xe0, 0xfa, 0x0f, 0x16, 0x10, 0xfd, 0x10, 0x0b, 0x35, 0x08, 0xf1,
+    0x11, 0x03, 0x06, 0xe5, 0xfb, 0xfd, 0x1d, 0x08, 0xfe, 0x11, 0x0c, 0x08, 0xf8, 0x0d, 0xfe, 0xf7,
+    0x07, 0xfe, 0xf7, 0x01, 0xfd, 0xd4, 0x22, 0xfe, 0xf9, 0x00, 0x1b, 0x02, 0xf9, 0xf0, 0x1e, 0x1f,
+    0xf9, 0xad, 0x08, 0x04, 0x1d, 0x06, 0xdc, 0xf2, 0x16, 0xf2, 0xf3, 0xff, 0x02, 0x05, 0xff, 0x05,
+    0xf7, 0xfe, 0x0f, 0xdc, 0xf1, 0x13, 0xfd, 0xf5, 0x08, 0x06, 0xd1, 0xe4, 0xed, 0xf2, 0xfd, 0xed,
+    0xfc, 0x0a, 0xf1, 0xe5, 0x12, 0x20, 0x00, 0x0b, 0xf7, 0xfa, 0x09, 0x04, 0x07, 0x0c, 0xfc, 0xfe,
+    0xf9, 0x1c, 0x19, 0x21, 0x16, 0xec, 0x02, 0x06, 0xfb, 0x05, 0x05, 0xf4, 0xf7, 0x17, 0x31, 0xf3,
+    0xf9, 0xd5, 0xf0, 0x05, 0xe7, 0xed, 0xfe, 0xef, 0x07, 0xcc, 0xc5, 0xce, 0xbe, 0x02, 0xf9, 0xf8,
+    0xed, 0xf1, 0xe8, 0xf2, 0xfd, 0xc5, 0xab, 0xfc, 0x07, 0x16, 0x08, 0xf1, 0x0c, 0xff, 0x09, 0x2b,
+    0x05, 0x02, 0x0a, 0x1a, 0x11, 0x11, 0x07, 0x07, 0x1a, 0xfa, 0xf7, 0xfa, 0x07, 0x1b, 0x08, 0xf0,
+    0x10, 0x02, 0x1e, 0x1a, 0xf1, 0x09, 0x07, 0xe0, 0x09, 0x14, 0x14, 0x13, 0xfe, 0x01, 0x0f, 0x02,
+    0x0a, 0x03, 0x19, 0x2c, 0x04, 0xfc, 0x03, 0x08, 0x01, 0xfc, 0x01, 0x05, 0x09, 0x18, 0x0b, 0x08,
+    0x0b, 0x24, 0xfe, 0x0d, 0x12, 0x13, 0xfc, 0xf6, 0x13, 0x06, 0xf6, 0xfb, 0xf9, 0x07, 0x02, 0xfd,
+    0xfc, 0x08, 0xff, 0xfc, 0x07, 0xfb, 0xf6, 0xff, 0x0b, 0xef, 0x07, 0x13, 0x14, 0xf7, 0xf9, 0xf8,
+    0xf4, 0x00, 0xf4, 0x11, 0x09, 0x08, 0x16, 0xe7, 0x03, 0xf5, 0x03, 0x0e, 0x03, 0x10, 0xfc, 0xd6,
+    0xfe, 0x0d, 0xf9, 0x0e, 0x11, 0x04, 0xfb, 0xf5, 0xf7, 0xf6, 0x06, 0x03, 0x03, 0xf4, 0xf7, 0xe6,
+    0xe4, 0xe2, 0xf5, 0xfb, 0x03, 0xff, 0x01, 0xf7, 0xf6, 0xf2, 0xf1, 0xf6, 0xf0, 0x03, 0xf9, 0x10,
+    0xe5, 0x01, 0xf0, 0x2a, 0x09, 0x26, 0x2b, 0x18, 0x17, 0x0d, 0x0b, 0x06, 0x0d, 0xf6, 0x14, 0x06,
+    0xf9, 0x31, 0x3b, 0x4b, 0x3b, 0x36, 0x1b, 0x06, 0x0e, 0x13, 0x05, 0xdc, 0x03, 0xda, 0xe7, 0xdf,
+    0xeb, 0x18, 0xff, 0x09, 0x0e, 0x05, 0xea, 0x26, 0x02, 0xdc, 0xcc, 0xda, 0xc6, 0xf0, 0xdf, 0xf6,
+    0xfd, 0xfa, 0xfe, 0xde, 0xf7, 0x04, 0x00, 0x05, 0xff, 0xf6, 0x01, 0xf1, 0xea, 0xfb, 0xfc, 0x22,
+    0x03, 0x0d, 0x0e, 0x14, 0x08, 0x10, 0xf2, 0xf1, 0xfa, 0xf1, 0xf0, 0xf4, 0xfe, 0xf9, 0x05, 0x0a,
+    0x05, 0xf4, 0xff, 0xe3, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0x19, 0x12, 0xea, 0xe4, 0xdc, 0xf3, 0x07,
+    0x2e, 0x10, 0x03, 0xd5, 0xf4, 0xef, 0xf8, 0xec, 0x06, 0x04, 0x06, 0x00, 0x0f, 0x0f, 0x09, 0x1d,
+    0x04, 0xfe, 0xe9, 0x24, 0x18, 0xe0, 0xf7, 0xfe, 0x08, 0xd0, 0xec, 0x08, 0x06, 0xff, 0xff, 0x12,
+    0x03, 0x14, 0x1c, 0xfd, 0xe8, 0xec, 0xf7, 0xd4, 0x0a, 0x2c, 0x1e, 0x03, 0x02, 0x0c, 0x09, 0xe4,
+    0xff, 0x06, 0x01, 0xd6, 0x00, 0x08, 0x0e, 0x05, 0x07, 0xff, 0xec, 0xee, 0x05, 0x12, 0xf7, 0x2c,
+    0xff, 0xf9, 0x0e, 0xee, 0xee, 0xff, 0x0b, 0x0b, 0x01, 0x08, 0x20, 0x00, 0x09, 0x00, 0xff, 0xf2,
+    0xee, 0x11, 0x04, 0xfa, 0xff, 0x23, 0xfd, 0xfa, 0x03, 0x22, 0x06, 0xf0, 0x0a, 0xfe, 0xfb, 0x13,
+    0xf1, 0x03, 0x17, 0xdd, 0xfb, 0x37, 0x18, 0x16, 0x12, 0xff, 0x0a, 0xed, 0x08, 0xf8, 0xf5, 0x2c,
+    0x08, 0xfe, 0x19, 0xe2, 0x12, 0xfa, 0x00, 0xfc, 0x0b, 0x0a, 0x25, 0xf8, 0x02, 0x09, 0xff, 0xfc,
+    0xfc, 0x0b, 0x0d, 0xfa, 0x02, 0x02, 0xff, 0xfa, 0xf0, 0x00, 0xfb, 0xfb, 0x05, 0x04, 0x00, 0xec,
+    0xf2, 0xf4, 0x19, 0x1c, 0x00, 0xfc, 0x0a, 0x07, 0x16, 0xe4, 0x03, 0xe9, 0xf4, 0xed, 0xf1, 0x0d,
+    0x03, 0xfb, 0x0c, 0x14, 0xf0, 0xd7, 0x0a, 0x20, 0x0c, 0x02, 0xe7, 0x10, 0x03, 0xfa, 0x0c, 0x04,
+    0xea, 0xf4, 0x08, 0x06, 0x19, 0x1c, 0xf9, 0xe5, 0xfd, 0x1f, 0xfc, 0xe5, 0x05, 0x28, 0xde, 0x11,
+    0x30, 0x12, 0xe2, 0x2a, 0x00, 0x0b, 0xc6, 0xeb, 0x29, 0x03, 0xea, 0xf8, 0xf6, 0xde, 0xe7, 0xfa,
+    0x0c, 0xea, 0xec, 0x20, 0x25, 0x0a, 0xf8, 0x0f, 0x0e, 0xf1, 0x07, 0xf1, 0xfa, 0xeb, 0x10, 0x06,
+    0xf8, 0x09, 0x09, 0x00, 0x15, 0x06, 0x11, 0xcf, 0xfb, 0x10, 0x17, 0x09, 0x0c, 0x06, 0xf1, 0x0a,
+    0xef, 0x12, 0xf3, 0x05, 0xff, 0x07, 0xf4, 0xfb, 0xe7, 0x10, 0xf5, 0xf6, 0xfd, 0x2b, 0x07, 0x15,
+    0x07, 0x0b, 0xed, 0xd9, 0xfd, 0x03, 0x10, 0xe9, 0x16, 0xf8, 0xe1, 0x01, 0xf5, 0x05, 0xfb, 0x00,
+    0x06, 0x0b, 0x15, 0xe2, 0x03, 0x0d, 0x09, 0xfd, 0xfe, 0xfe, 0xf3, 0x08, 0x03, 0xf5, 0xff, 0xff,
+    0xf9, 0x00, 0xf2, 0x1a, 0xf8, 0xeb, 0xee, 0xf5, 0x01, 0xf7, 0x04, 0x12, 0xfb, 0x05, 0xfb, 0xde,
+    0xf1, 0xe8, 0xf1, 0xf8, 0xee, 0xea, 0xeb, 0xf0, 0xf8, 0xfa, 0x00, 0x21, 0xf6, 0xf7, 0xf4, 0xec,
+    0xf8, 0xda, 0x01, 0x14, 0x15, 0x07, 0x19, 0x08, 0x08, 0xca, 0xe9, 0xf0, 0x14, 0x18, 0x07, 0x03,
+    0x03, 0x1c, 0x0f, 0x10, 0x0d, 0x08, 0x06, 0xfb, 0x06, 0x23, 0xfe, 0xf6, 0x0c, 0x0d, 0x18, 0x0a,
+    0x08, 0x15, 0x15, 0x07, 0x16, 0x0f, 0xfa, 0x0b, 0x05, 0x17, 0xfb, 0x1c, 0x07, 0x15, 0x24, 0x13,
+    0x03, 0xf4, 0x19, 0xf3, 0x0e, 0x09, 0xf2, 0x39, 0x04, 0x1b, 0x16, 0x11, 0x0a, 0x0e, 0x02, 0xfa,
+    0x07, 0x03, 0x0f, 0xff, 0x0d, 0x0d, 0x22, 0x24, 0xf3, 0x03, 0x03, 0x0a, 0x11, 0x21, 0x21, 0x2d,
+    0xf4, 0x04, 0xeb, 0xfc, 0x07, 0xfc, 0xf9, 0xf4, 0x10, 0xf5, 0x36, 0xfa, 0xfa, 0xf6, 0xfe, 0x05,
+    0x10, 0x08, 0xee, 0xef, 0x03, 0xf2, 0x0b, 0xf5, 0x0b, 0x0d, 0x05, 0x20, 0xf7, 0xf9, 0x06, 0x11,
+    0x1c, 0x16, 0x0b, 0xec, 0x0e, 0xfb, 0x07, 0x0e, 0x1b, 0x01, 0x0d, 0xfc, 0x0f, 0xfe, 0x12, 0xf2,
+    0x10, 0xf9, 0xf2, 0x01, 0x11, 0xfb, 0xee, 0x15, 0x07, 0x03, 0x01, 0x22, 0xf3, 0x1b, 0x17, 0x1e,
+    0x22, 0x09, 0x10, 0x11, 0x11, 0xfd, 0xef, 0x10, 0xf8, 0xf2, 0x07, 0x20, 0x07, 0xf5, 0x03, 0xe4,
+    0xff, 0xfb, 0x07, 0xf0, 0x06, 0xdf, 0xee, 0x11, 0x09, 0x0c, 0xf8, 0x0f, 0x1b, 0x0f, 0xf3, 0xfe,
+    0x00, 0xe7, 0x0d, 0x21, 0x14, 0xf8, 0xff, 0xf8, 0x0b, 0x0e, 0x04, 0x0b, 0xfc, 0x0d, 0x04, 0x0f,
+    0x06, 0x13, 0xec, 0xeb, 0xe2, 0xf4, 0xf8, 0xf4, 0xfd, 0xeb, 0xfe, 0x07, 0xff, 0xee, 0xfa, 0xe4,
+    0xe5, 0xf8, 0xee, 0xf8, 0xff, 0x00, 0xf6, 0xf1, 0xff, 0xec, 0x0f, 0xe4, 0xf8, 0x05, 0xfa, 0x07,
+    0x02, 0xe0, 0x0f, 0x01, 0x00, 0xfd, 0x11, 0x1d, 0x1c, 0x16, 0x12, 0xf6, 0x09, 0x08, 0xf8, 0x0b,
+    0x06, 0xf6, 0x10, 0x18, 0x02, 0x13, 0x09, 0x05, 0xfa, 0xfa, 0xe3, 0xda, 0xf7, 0x00, 0xec, 0xff,
+    0x07, 0x0a, 0x1a, 0x2f, 0xfc, 0xd8, 0xdc, 0xdc, 0x01, 0x03, 0x12, 0xff, 0x03, 0xf2, 0x0d, 0x0d,
+    0x09, 0xf6, 0xfd, 0xe4, 0xeb, 0xe0, 0x19, 0x16, 0x1f, 0x0c, 0x0d, 0x0b, 0x0a, 0x28, 0x18, 0xff,
+    0x0b, 0xec, 0xeb, 0x0f, 0x1a, 0x1b, 0x17, 0xfc, 0x0a, 0x27, 0x2d, 0x10, 0x05, 0x04, 0xe3, 0xec,
+    0x01, 0x0d, 0x01, 0xc5, 0x00, 0x24, 0x18, 0xff, 0xfa, 0xe0, 0xf5, 0x10, 0x17, 0x11, 0xeb, 0xf6,
+    0xf7, 0xfd, 0xe9, 0xe6, 0xec, 0x03, 0x0e, 0x10, 0xfa, 0xf6, 0xe4, 0xcc, 0xf6, 0xce, 0xef, 0x03,
+    0x11, 0x01, 0x04, 0x04, 0x16, 0x19, 0x1a, 0xf6, 0xf8, 0xe9, 0xe3, 0xf4, 0xfe, 0x18, 0x13, 0xf3,
+    0xed, 0xfa, 0x17, 0x00, 0x00, 0x08, 0xed, 0xf5, 0x06, 0xf2, 0x14, 0xf1, 0x08, 0x06, 0x02, 0x07,
+    0x05, 0x23, 0x14, 0x0d, 0xff, 0x1e, 0xfe, 0x15, 0xdc, 0x16, 0x27, 0xf6, 0xfd, 0x08, 0x04, 0xfb,
+    0xfd, 0xfb, 0x15, 0x0b, 0x0c, 0x10, 0x0c, 0xfa, 0x07, 0xf1, 0x03, 0x1a, 0x10, 0x0b, 0xfa, 0x07,
+    0x16, 0x1d, 0x0c, 0xf9, 0x14, 0x05, 0x07, 0x17, 0x19, 0x08, 0x05, 0x1f, 0x1a, 0x14, 0x10, 0x13,
+    0x05, 0x05, 0x13, 0x09, 0x02, 0x02, 0xef, 0xe5, 0x00, 0xe9, 0x00, 0x13, 0x08, 0xd2, 0x08, 0xfd,
+    0xeb, 0xe5, 0xd5, 0xe7, 0xe4, 0xf4, 0xd5, 0xcb, 0x08, 0x07, 0x0b, 0xf1, 0x03, 0xfc, 0x2b, 0x1c,
+    0xfb, 0xf2, 0xca, 0x30, 0x01, 0xf2, 0xf5, 0xf7, 0xfe, 0x10, 0x0f, 0x05, 0x1f, 0xec, 0xd8, 0x01,
+    0x09, 0xfb, 0x0a, 0x06, 0xfb, 0x03, 0x03, 0x28, 0x12, 0xdb, 0xdf, 0xcb, 0x07, 0x04, 0x00, 0x03,
+    0x02, 0xff, 0x24, 0x05, 0xf8, 0xd2, 0xea, 0x0d, 0x00, 0x28, 0x1e, 0x0e, 0x12, 0x0b, 0x0a, 0xfa,
+    0xf1, 0x03, 0xfc, 0xeb, 0x00, 0xf8, 0xfd, 0x0e, 0xf4, 0x05, 0xed, 0xd9, 0xe4, 0xfb, 0x05, 0x47,
+    0x09, 0x0d, 0xf2, 0xef, 0x05, 0x01, 0xef, 0x04, 0xe7, 0x0f, 0x19, 0x06, 0xf6, 0xf8, 0x0e, 0x03,
+    0x00, 0xf8, 0xed, 0xf3, 0xf5, 0x04, 0xf8, 0xf8, 0xf2, 0xfc, 0xfd, 0xf9, 0xf0, 0xf2, 0x12, 0xf1,
+    0xe0, 0x10, 0x09, 0x10, 0xfb, 0x1c, 0xed, 0x05, 0x01, 0xfc, 0xf9, 0xe3, 0xf8, 0x10, 0x16, 0xf2,
+    0xff, 0xf4, 0x04, 0x0c, 0xf3, 0x00, 0xee, 0xf3, 0x08, 0x27, 0x23, 0x09, 0x0b, 0x11, 0x01, 0xe2,
+    0xd9, 0xf9, 0xef, 0x01, 0x14, 0x1d, 0x35, 0x03, 0x06, 0xeb, 0xe1, 0xeb, 0xfb, 0x20, 0x22, 0x1b,
+    0x0b, 0x02, 0xf4, 0xf6, 0x08, 0xf7, 0xed, 0x05, 0x01, 0x10, 0x0a, 0x02, 0x15, 0xeb, 0xd6, 0xcf,
+    0xf3, 0x14, 0xf2, 0x0c, 0xf7, 0x1d, 0x07, 0x11, 0x07, 0xf3, 0xff, 0xe8, 0x06, 0x1a, 0x17, 0x11,
+    0x01, 0x04, 0xf8, 0xe6, 0xfd, 0x10, 0x15, 0x0c, 0x07, 0x1f, 0x02, 0x05, 0xf6, 0xd7, 0xe3, 0xf2,
+    0xfb, 0xf7, 0x18, 0x0b, 0x08, 0xfe, 0xf2, 0xfe, 0x0d, 0xfb, 0xff, 0x1d, 0x11, 0x08, 0xf5, 0xea,
+    0x0b, 0xfc, 0xf1, 0x16, 0xf7, 0x15, 0x0c, 0xfd, 0x0d, 0xfd, 0xee, 0x01, 0xfb, 0xf8, 0xf2, 0xfc,
+    0xfe, 0x0b, 0x11, 0xf0, 0x09, 0xf5, 0x07, 0x0a, 0x01, 0x44, 0xff, 0xf5, 0x1d, 0x02, 0xf6, 0x07,
+    0xff, 0x11, 0xfb, 0x12, 0x0a, 0x23, 0x15, 0xfe, 0xf8, 0xf5, 0xff, 0xf8, 0x00, 0x05, 0x03, 0x10,
+    0x0c, 0x10, 0x05, 0x0b, 0x00, 0xfc, 0x18, 0xfd, 0xfb, 0x08, 0xfc, 0xd9, 0xf6, 0x0e, 0x0d, 0xf0,
+    0xe4, 0x0c, 0xee, 0xfd, 0xf9, 0x08, 0xfd, 0xf3, 0x05, 0x18, 0xf7, 0xeb, 0xe2, 0xf3, 0x0c, 0x00,
+    0xf7, 0xf3, 0x01, 0x04, 0x08, 0xb9, 0xcc, 0xf4, 0x1d, 0x0e, 0x09, 0xf1, 0xff, 0xfd, 0xf1, 0x0d,
+    0xfa, 0xdd, 0xf4, 0x29, 0x2b, 0x24, 0x0a, 0x12, 0xf4, 0xfa, 0xe2, 0xe9, 0xf7, 0x00, 0x01, 0x2c,
+    0x1f, 0xfe, 0xeb, 0xeb, 0xea, 0xda, 0xec, 0xdb, 0x01, 0x18, 0x1c, 0x09, 0xf7, 0xee, 0xed, 0xfc,
+    0xe7, 0x03, 0xf9, 0xe2, 0x0a, 0xfa, 0x0d, 0xf4, 0x1a, 0x33, 0x0d, 0x01, 0xde, 0xd6, 0xe5, 0xe7,
+    0xfd, 0xef, 0xf7, 0x16, 0x08, 0x08, 0x15, 0xf8, 0x18, 0xe5, 0xf5, 0xfa, 0xfd, 0xfd, 0xf1, 0xfb,
+    0xfd, 0xff, 0x01, 0xf1, 0xf2, 0xf3, 0xfb, 0x04, 0x01, 0x0a, 0x00, 0x0d, 0x16, 0x2b, 0x1f, 0x25,
+    0x0e, 0xf6, 0x09, 0x22, 0xec, 0x2b, 0x2a, 0x15, 0xfd, 0x08, 0xf4, 0x05, 0xfa, 0x0c, 0x18, 0x13,
+    0xfc, 0x0a, 0x26, 0x09, 0xe5, 0xfb, 0xfa, 0x0d, 0x0e, 0x1d, 0x0d, 0x30, 0xfa, 0x1a, 0x17, 0xf6,
+    0x14, 0x17, 0x07, 0x13, 0x0f, 0xfe, 0xdd, 0xde, 0xf8, 0xf2, 0xe8, 0xf7, 0x05, 0x1f, 0x03, 0xf7,
+    0xf8, 0xed, 0xd5, 0xed, 0x00, 0xf2, 0xe7, 0xe1, 0xfe, 0x09, 0x07, 0xed, 0xea, 0xf3, 0xf2, 0xf0,
+    0x07, 0x0d, 0xf1, 0xfa, 0x09, 0xef, 0xdb, 0xea, 0xf6, 0x08, 0x18, 0x00, 0xfb, 0xef, 0x13, 0x06,
+    0xea, 0xe2, 0xf2, 0xf4, 0x09, 0xf9, 0xfb, 0x02, 0xf6, 0x04, 0x01, 0xec, 0xef, 0x09, 0xf4, 0x07,
+    0xee, 0x05, 0xf3, 0x00, 0x0a, 0xf2, 0xfd, 0x10, 0x11, 0x0a, 0xf8, 0xee, 0xe7, 0xf8, 0x17, 0xc2,
+    0x0b, 0xee, 0xfc, 0xe9, 0xfe, 0xee, 0xf9, 0xe3, 0xfd, 0xf5, 0xf5, 0xfb, 0xfc, 0x04, 0xf4, 0xf7,
+    0xfc, 0x0d, 0x0a, 0x0b, 0xfd, 0xfc, 0x06, 0xf5, 0xf4, 0x09, 0xfe, 0xf7, 0x0d, 0x28, 0xf4, 0x0a,
+    0x00, 0x0b, 0xfd, 0x27, 0xfb, 0xee, 0xfd, 0xf9, 0x01, 0x0d, 0xf8, 0x12, 0x15, 0x07, 0xfb, 0xf0,
+    0xef, 0xfc, 0xf7, 0xea, 0xfe, 0x22, 0x13, 0x1d, 0x30, 0xfa, 0xf9, 0x2f, 0x05, 0xf7, 0xdb, 0x0c,
+    0xfd, 0x13, 0x09, 0x1d, 0x08, 0x0f, 0xea, 0x25, 0x09, 0xf4, 0xef, 0xf9, 0xe9, 0xec, 0x2d, 0x1d,
+    0x06, 0xfa, 0xfb, 0xac, 0x03, 0xfd, 0xf1, 0xf3, 0x07, 0xf7, 0x0c, 0x35, 0x03, 0xeb, 0x06, 0xde,
+    0x0c, 0xee, 0xf8, 0x04, 0xe4, 0xec, 0x26, 0xe1, 0x08, 0xf6, 0x1c, 0xf0, 0xf7, 0x05, 0x0d, 0x02,
+    0xe8, 0xda, 0xf3, 0x00, 0xfa, 0xfe, 0x11, 0xfd, 0xfb, 0x05, 0x01, 0x03, 0xf3, 0x08, 0xf0, 0x0b,
+    0x04, 0x12, 0xfa, 0xe7, 0x02, 0xeb, 0xe8, 0x23, 0x0a, 0x02, 0x0d, 0xe8, 0xf5, 0xef, 0xf1, 0xf0,
+    0x0d, 0x0b, 0xf7, 0xb9, 0xfb, 0xfa, 0xfd, 0x1a, 0xf5, 0x04, 0xe4, 0x07, 0x07, 0x0c, 0x04, 0xfe,
+    0x0c, 0xfd, 0xf4, 0x1a, 0x0b, 0x0a, 0x0b, 0x0c, 0xf5, 0xef, 0x0f, 0xfd, 0x04, 0x04, 0x00, 0x14,
+    0xfe, 0x0b, 0xda, 0x04, 0xfe, 0xe5, 0x07, 0xfc, 0xfe, 0xed, 0xf9, 0x09, 0x0e, 0xf1, 0xf6, 0xf3,
+    0xf2, 0xd0, 0x14, 0x21, 0x10, 0x0b, 0x22, 0x01, 0x04, 0x0d, 0xff, 0x30, 0xf5, 0x07, 0x0f, 0x27,
+    0xfb, 0x0c, 0xe7, 0xf4, 0x05, 0xf7, 0x0a, 0x03, 0xf5, 0x08, 0x0e, 0x09, 0xf5, 0xfa, 0xf3, 0xee,
+    0x01, 0xfe, 0xfd, 0xe9, 0x0d, 0xe5, 0x09, 0x03, 0x0a, 0x18, 0xf6, 0xea, 0xe4, 0x03, 0xef, 0xea,
+    0x05, 0xf2, 0xf7, 0x12, 0xfa, 0x0d, 0xe8, 0xd7, 0x05, 0x07, 0x0d, 0xeb, 0x08, 0x06, 0x00, 0x07,
+    0xfb, 0xfc, 0xf6, 0x08, 0x07, 0x01, 0xff, 0x08, 0x04, 0x0a, 0x12, 0x06, 0x0a, 0xf7, 0xfe, 0xf7,
+    0xff, 0x07, 0x1f, 0x14, 0x05, 0x10, 0x16, 0x12, 0x13, 0x3d, 0x2c, 0x17, 0x01, 0x08, 0xe5, 0xdd,
+    0x04, 0x0a, 0xfa, 0x08, 0x11, 0x0d, 0x21, 0x06, 0x20, 0xf7, 0x08, 0xf9, 0xf4, 0x0a, 0x05, 0xf6,
+    0x06, 0x00, 0x03, 0xdb, 0x0a, 0xf7, 0x08, 0x0b, 0x07, 0xf7, 0x03, 0x11, 0x15, 0x18, 0x15, 0x0c,
+    0xf3, 0x0f, 0x04, 0xbd, 0xf3, 0x0a, 0xe2, 0x22, 0x16, 0x1a, 0x15, 0x04, 0x04, 0x1b, 0x18, 0x26,
+    0xfa, 0x04, 0x0f, 0x10, 0x0c, 0x0b, 0x0a, 0x17, 0x16, 0xf9, 0x2f, 0x09, 0x0d, 0x05, 0x2c, 0x26,
+    0xed, 0xe3, 0xf6, 0x06, 0xfb, 0x00, 0xfe, 0x19, 0xf5, 0x29, 0x27, 0x1c, 0xf9, 0xcf, 0xf6, 0xe7,
+    0x01, 0x04, 0xf3, 0x14, 0xf9, 0x13, 0x08, 0x0a, 0x09, 0xde, 0xda, 0xf1, 0xf9, 0xee, 0xee, 0xf6,
+    0xf3, 0x04, 0x04, 0x15, 0xd9, 0xc5, 0xed, 0xf8, 0x0c, 0xec, 0xeb, 0x22, 0xf8, 0x10, 0x0c, 0xfc,
+    0x04, 0xef, 0x0d, 0xfa, 0xfe, 0xe6, 0x06, 0x1a, 0xf8, 0x0f, 0x05, 0x11, 0x0d, 0xff, 0x05, 0xee,
+    0xfc, 0xfb, 0xf4, 0x06, 0xf9, 0xf1, 0x09, 0x09, 0x0b, 0xf3, 0xe5, 0xf5, 0xf6, 0xe5, 0xf7, 0xee,
+    0xf8, 0xf1, 0x09, 0x1b, 0x1a, 0x1f, 0x09, 0xfa, 0x27, 0x03, 0x31, 0x00, 0x08, 0x0d, 0xfa, 0x08,
+    0x00, 0xff, 0xea, 0xed, 0x00, 0xf5, 0x05, 0xf9, 0x07, 0x42, 0x17, 0x00, 0xdb, 0xc0, 0xef, 0x05,
+    0x23, 0xfa, 0xef, 0xff, 0x0a, 0x0b, 0x1f, 0x12, 0xe7, 0xd2, 0xf5, 0x25, 0x0b, 0x0c, 0xf2, 0x09,
+    0x16, 0x13, 0x23, 0x05, 0xfa, 0xe6, 0x03, 0x0e, 0xf2, 0xec, 0xe5, 0x1f, 0xfd, 0xf0, 0x0c, 0x1e,
+    0xec, 0xf6, 0x19, 0x13, 0x0e, 0x03, 0x09, 0x03, 0x0b, 0x01, 0x1e, 0x12, 0xf1, 0xee, 0x0e, 0xf7,
+    0x00, 0x0f, 0xfa, 0x02, 0x0d, 0x02, 0xf0, 0xfc, 0xf5, 0xef, 0xf0, 0x04, 0xfc, 0xf8, 0xf1, 0xf3,
+    0x0c, 0xf4, 0x12, 0xe0, 0x08, 0xe2, 0xfa, 0xfa, 0xf4, 0x0b, 0x16, 0xfd, 0x0c, 0x24, 0x24, 0x11,
+    0x11, 0xf0, 0x07, 0x00, 0x0f, 0xf9, 0x26, 0x13, 0xf9, 0x1e, 0x21, 0x0b, 0xfe, 0x04, 0x0a, 0xfb,
+    0x0e, 0xf6, 0x02, 0x10, 0x0d, 0xe4, 0xd6, 0xf4, 0xff, 0x04, 0x10, 0x04, 0x06, 0x0c, 0x0f, 0x05,
+    0x0d, 0xf3, 0xea, 0xde, 0xfa, 0xef, 0x03, 0xf8, 0x1f, 0xf5, 0x13, 0x00, 0xff, 0xfa, 0xfc, 0x02,
+    0xeb, 0xfe, 0xfc, 0x0d, 0x03, 0xfa, 0xf6, 0x04, 0x08, 0x03, 0x15, 0x13, 0x14, 0x03, 0x08, 0x01,
+    0xe9, 0xd4, 0xf1, 0x1e, 0x03, 0x18, 0xff, 0x0d, 0x04, 0x0a, 0xee, 0xef, 0xe3, 0xf2, 0x0c, 0x08,
+    0x09, 0xed, 0xe6, 0xef, 0x07, 0x1f, 0x2f, 0x14, 0xf7, 0xfb, 0x15, 0x2c, 0x05, 0xf0, 0xff, 0x27,
+    0x3e, 0x2f, 0x19, 0xeb, 0xf1, 0xf0, 0x1d, 0xf5, 0xf4, 0x29, 0x31, 0x2c, 0x29, 0x0f, 0x01, 0xe5,
+    0xea, 0xeb, 0xf7, 0xcc, 0x04, 0x0b, 0xf2, 0xf6, 0xf8, 0x07, 0xfd, 0xfc, 0xf8, 0xf4, 0x00, 0x20,
+    0xfc, 0xe2, 0xc7, 0xdf, 0xe8, 0x04, 0x07, 0x01, 0xf8, 0x07, 0xfc, 0xfa, 0x08, 0xf6, 0xfc, 0x06,
+    0xdc, 0xfa, 0xfe, 0xf1, 0x0b, 0xe0, 0x0a, 0x2c, 0xf4, 0x06, 0xff, 0xf7, 0x02, 0x02, 0x07, 0x03,
+    0xf7, 0x07, 0x00, 0x30, 0xf9, 0xfa, 0xfe, 0x16, 0xf6, 0xf9, 0xed, 0xec, 0xfb, 0xfa, 0xe9, 0xdd,
+    0x09, 0x09, 0x14, 0x10, 0x04, 0x14, 0xfb, 0xf7, 0xf4, 0xd4, 0x0a, 0xfd, 0xf3, 0x04, 0xf9, 0xfe,
+    0x11, 0x05, 0xfc, 0xf1, 0xfe, 0x06, 0xf7, 0x03, 0xfd, 0xee, 0x01, 0xf6, 0xee, 0xeb, 0xef, 0xcc,
+    0xe3, 0xf0, 0x16, 0x2c, 0x01, 0x00, 0x19, 0x03, 0x10, 0xfb, 0xfb, 0xfe, 0x06, 0x13, 0x14, 0x0d,
+    0xf7, 0xf7, 0xfc, 0x0e, 0x19, 0xf8, 0xfb, 0x0a, 0x19, 0x06, 0xff, 0x04, 0x00, 0x1a, 0xf7, 0x08,
+    0x06, 0xf2, 0x03, 0x19, 0x1b, 0x07, 0x11, 0xfd, 0xff, 0x30, 0x06, 0xea, 0xf7, 0xfe, 0x07, 0x15,
+    0x06, 0x29, 0x13, 0xe2, 0xf9, 0x23, 0x1b, 0xed, 0x16, 0xfd, 0xfc, 0x10, 0xea, 0x28, 0x2a, 0x19,
+    0x05, 0xff, 0x24, 0xeb, 0x04, 0x15, 0x04, 0x0f, 0xe0, 0xe2, 0xff, 0xf9, 0xf5, 0x1e, 0x00, 0xff,
+    0xec, 0xf3, 0x04, 0x09, 0x0b, 0xeb, 0xd7, 0xfd, 0xff, 0x16, 0xf5, 0x04, 0x04, 0xfb, 0xfc, 0x08,
+    0x09, 0xf2, 0xcd, 0x04, 0xf9, 0x00, 0xff, 0x00, 0x01, 0x03, 0x03, 0xe4, 0x01, 0xf0, 0xc4, 0x0d,
+    0xfc, 0x19, 0xfa, 0xd8, 0x21, 0x1c, 0x17, 0x0e, 0xf9, 0xc1, 0xa9, 0xfe, 0x0b, 0x05, 0x0a, 0xfd,
+    0xf0, 0xf9, 0xf2, 0xf2, 0x0b, 0xf7, 0x02, 0xf6, 0xfd, 0x3a, 0xf6, 0x2c, 0x1c, 0x1b, 0x23, 0x24,
+    0x21, 0x27, 0x11, 0x07, 0x0b, 0xf5, 0x09, 0x12, 0x15, 0x11, 0x17, 0xfa, 0x07, 0xf0, 0x0a, 0x12,
+    0x07, 0xf5, 0x19, 0xdd, 0xe9, 0xe6, 0xd8, 0xc9, 0xe3, 0xed, 0xe7, 0xdd, 0xf4, 0xf1, 0xf0, 0xf1,
+    0xe4, 0xec, 0xfb, 0xfd, 0x09, 0x10, 0xdd, 0xf4, 0x0b, 0xf3, 0x05, 0x04, 0x1b, 0x1b, 0x14, 0x0a,
+    0x15, 0xf7, 0xfc, 0xe4, 0xfa, 0xe1, 0xf9, 0x1a, 0x0e, 0x12, 0x09, 0xeb, 0xf1, 0xf9, 0x13, 0x36,
+    0x00, 0xf7, 0xfb, 0xf6, 0xe2, 0xf7, 0x0c, 0x0a, 0x0e, 0x12, 0x17, 0x25, 0x04, 0xfd, 0xf6, 0xeb,
+    0x01, 0xe5, 0xf9, 0xfe, 0x06, 0x00, 0x0b, 0x02, 0xf4, 0x17, 0x0c, 0xfa, 0x11, 0xf6, 0x16, 0xfd,
+    0xfe, 0xf3, 0x02, 0x29, 0xf9, 0xe7, 0x0d, 0x07, 0x00, 0xf8, 0xf3, 0xfa, 0xf9, 0xf4, 0x02, 0x05,
+    0x06, 0xcb, 0xfd, 0xf9, 0xfa, 0xfa, 0xfb, 0xf8, 0x08, 0x0a, 0xd8, 0x0a, 0x0d, 0x04, 0x08, 0x0a,
+    0xee, 0xf4, 0x10, 0xe5, 0xf7, 0x12, 0x02, 0x03, 0x00, 0xec, 0x03, 0x03, 0x02, 0x16, 0xf2, 0x0e,
+    0x1c, 0x03, 0xf7, 0x1e, 0x08, 0x0b, 0x17, 0xf1, 0xfe, 0x17, 0xf7, 0x0d, 0x08, 0x1c, 0x0e, 0x07,
+    0x07, 0x20, 0x15, 0x15, 0x00, 0x0d, 0x05, 0x03, 0xf3, 0xf8, 0xf5, 0xf0, 0x00, 0xff, 0x03, 0xf6,
+    0x0d, 0x10, 0xf1, 0xe9, 0xe0, 0xf9, 0x1c, 0xee, 0xf7, 0xff, 0x09, 0xeb, 0xf0, 0xdd, 0xef, 0xfb,
+    0x05, 0x17, 0x08, 0x09, 0xfe, 0xf3, 0xc7, 0xc1, 0xcd, 0xfc, 0x17, 0x31, 0xfb, 0xff, 0x03, 0x0f,
+    0x0a, 0xbf, 0xcd, 0xff, 0x06, 0x2e, 0x05, 0x14, 0xf8, 0xfd, 0xff, 0x08, 0xf4, 0xc9, 0xe0, 0xfb,
+    0x1c, 0x17, 0x08, 0xe8, 0xf7, 0xf3, 0x05, 0xe3, 0xfe, 0xe8, 0x11, 0x16, 0x06, 0x09, 0xf7, 0xf4,
+    0xe6, 0xf6, 0xf9, 0x36, 0x0a, 0xfd, 0xfc, 0x04, 0xf0, 0x05, 0xfd, 0xed, 0x05, 0x17, 0x07, 0x46,
+    0x08, 0xfa, 0xfd, 0x00, 0xe2, 0x09, 0x01, 0x00, 0xef, 0xfb, 0xfd, 0x07, 0x00, 0x03, 0xff, 0xf9,
+    0xf3, 0x04, 0x15, 0x17, 0xf4, 0x05, 0xf7, 0xff, 0xf5, 0xd8, 0xdc, 0xf2, 0x0a, 0x0c, 0x04, 0xf9,
+    0xf7, 0xf6, 0xe2, 0xc9, 0x00, 0xef, 0x28, 0x37, 0xfb, 0xfb, 0xfc, 0xdd, 0xeb, 0xfb, 0x06, 0xb1,
+    0xf8, 0x1f, 0x12, 0x07, 0x05, 0x14, 0x13, 0x21, 0x16, 0x20, 0x00, 0xef, 0x0c, 0x2e, 0x06, 0x00,
+    0x02, 0x1b, 0x0f, 0x0f, 0xfe, 0x0d, 0xf8, 0x43, 0xfc, 0xe3, 0xdf, 0xf9, 0x09, 0x15, 0x1d, 0xfc,
+    0x12, 0x0b, 0xeb, 0xb6, 0xf4, 0xfa, 0xfe, 0xeb, 0xe6, 0xed, 0xfa, 0x0f, 0xf8, 0x11, 0xd4, 0xe8,
+    0xfc, 0x0d, 0x03, 0x18, 0x03, 0xe4, 0x12, 0xec, 0xdd, 0xf2, 0xf6, 0x09, 0x0d, 0x0b, 0x0e, 0x05,
+    0xeb, 0x1c, 0x04, 0xf6, 0xee, 0xfa, 0x04, 0x03, 0xf4, 0xf5, 0x04, 0x06, 0x15, 0x0f, 0x0d, 0xff,
+    0x07, 0x06, 0x05, 0xe9, 0x04, 0xfb, 0x0b, 0x0e, 0x03, 0xfa, 0xe9, 0xfc, 0x0a, 0x03, 0x09, 0x22,
+    0x01, 0xf1, 0xe7, 0xff, 0xe4, 0xea, 0xea, 0x06, 0xfa, 0x0b, 0xce, 0xfb, 0xf4, 0x06, 0xf8, 0x07,
+    0x01, 0x0d, 0x0b, 0x26, 0xf4, 0xf7, 0xfb, 0xf6, 0x06, 0x26, 0xdb, 0xfc, 0x16, 0x07, 0xfe, 0x29,
+    0x07, 0xff, 0xf9, 0x1a, 0x04, 0x18, 0x14, 0x0a, 0x08, 0x13, 0xfb, 0x13, 0x20, 0x03, 0x0e, 0x01,
+    0xfe, 0xd5, 0x0a, 0x04, 0xff, 0x13, 0x21, 0x0d, 0xf3, 0xf1, 0xfb, 0xf2, 0xfd, 0xf3, 0x14, 0x14,
+    0x02, 0x16, 0x09, 0x08, 0xee, 0x08, 0x10, 0x04, 0xff, 0xf8, 0x0b, 0x0b, 0xfb, 0x0a, 0x0b, 0xd4,
+    0xe4, 0xdc, 0x0c, 0xf7, 0xf7, 0x0a, 0xdd, 0xf7, 0x07, 0xf7, 0x0b, 0xfa, 0xdd, 0xfc, 0x10, 0xd8,
+    0x0d, 0x0b, 0xf8, 0xf4, 0x07, 0xe8, 0xd8, 0xf2, 0xdb, 0xe7, 0xfc, 0xdf, 0x06, 0xda, 0x0f, 0x44,
+    0x2e, 0xf0, 0xb3, 0xd0, 0xf6, 0xee, 0x03, 0x03, 0x0a, 0xe0, 0xf4, 0x0c, 0xe4, 0x04, 0xe0, 0xd9,
+    0xdd, 0xe2, 0xe6, 0x0d, 0xfe, 0x0b, 0xf7, 0xd8, 0x06, 0xdc, 0xf5, 0xe4, 0xf5, 0xeb, 0x06, 0xf0,
+    0xf7, 0xdb, 0xe3, 0xf2, 0xf9, 0xfd, 0xf0, 0xcd, 0x2b, 0x1e, 0xe4, 0x06, 0xfa, 0x0b, 0xfb, 0xf1,
+    0x0a, 0x0d, 0x0f, 0x10, 0xff, 0xe5, 0xfc, 0xfe, 0xfe, 0xfe, 0x0c, 0x04, 0x05, 0x19, 0x0c, 0x0f,
+    0xfc, 0xcf, 0x03, 0x03, 0x09, 0x11, 0xf3, 0x00, 0x19, 0x27, 0x06, 0x0c, 0x07, 0x15, 0xf6, 0x07,
+    0x11, 0x21, 0x14, 0x02, 0xfa, 0xfa, 0x11, 0x33, 0x1b, 0x19, 0x11, 0xee, 0xff, 0xd1, 0xea, 0xf3,
+    0xd5, 0xeb, 0xf2, 0xfd, 0xfa, 0x0f, 0x0d, 0x38, 0x00, 0xc2, 0xd5, 0xf2, 0xea, 0xf0, 0xec, 0xe6,
+    0x0e, 0x11, 0x1c, 0x06, 0x00, 0xf3, 0xf7, 0x06, 0xf7, 0xfd, 0x09, 0xfc, 0x0c, 0x07, 0xff, 0xdf,
+    0x0c, 0x05, 0x0d, 0xee, 0xfe, 0xf5, 0xfd, 0x17, 0xfa, 0x0d, 0xf7, 0xf3, 0x05, 0xf7, 0xf9, 0xf9,
+    0xe0, 0x05, 0x0d, 0x17, 0xf8, 0xf7, 0x07, 0x10, 0xfe, 0xe4, 0x01, 0xf5, 0xf0, 0xf9, 0xf4, 0xfa,
+    0x06, 0xfe, 0xee, 0xfd, 0xf5, 0x0a, 0xf8, 0x16, 0xfe, 0xfa, 0xf9, 0x0c, 0x12, 0x20, 0x11, 0xef,
+    0x07, 0xdf, 0xd9, 0x1e, 0x15, 0x13, 0xf0, 0xf9, 0xfd, 0x09, 0xfb, 0x0b, 0x0d, 0x07, 0x02, 0x03,
+    0x04, 0xf6, 0x0b, 0xf1, 0xf7, 0x15, 0xf8, 0x0d, 0x0e, 0x07, 0x18, 0x12, 0x0f, 0xf1, 0xfb, 0x05,
+    0x02, 0x05, 0x03, 0x09, 0x03, 0xee, 0x08, 0x03, 0xfe, 0xea, 0x11, 0x03, 0x0a, 0x1c, 0x06, 0xe7,
+    0xfb, 0x00, 0x12, 0x0d, 0x08, 0xfd, 0x00, 0xf7, 0xf3, 0x04, 0x15, 0xf8, 0xfa, 0x11, 0x14, 0x14,
+    0xf9, 0xf0, 0x10, 0xef, 0xff, 0x16, 0x30, 0x2d, 0x02, 0x02, 0x0f, 0x01, 0xff, 0x1f, 0x26, 0x09,
+    0x0a, 0x18, 0x18, 0x09, 0x03, 0x0f, 0x07, 0xfa, 0x0d, 0x14, 0x12, 0x12, 0xfa, 0x0c, 0x0d, 0xc6,
+    0xfd, 0xf6, 0x04, 0xfe, 0x1f, 0x28, 0xfd, 0xe4, 0xf9, 0x07, 0xec, 0xdf, 0xf3, 0xe6, 0x0c, 0x0a,
+    0xf3, 0xed, 0xe9, 0x09, 0x06, 0xfe, 0xf4, 0x0e, 0x0b, 0xf7, 0x09, 0xe4, 0xf4, 0xe2, 0xef, 0xf5,
+    0xf9, 0xff, 0xf5, 0x05, 0xf8, 0x01, 0xfa, 0xf5, 0x00, 0xe5, 0xf3, 0x04, 0xea, 0xfc, 0x19, 0x06,
+    0x0d, 0x0f, 0x11, 0x0f, 0xed, 0x18, 0xe5, 0x01, 0xd6, 0xdf, 0xe8, 0x04, 0x04, 0xf8, 0xff, 0x06,
+    0xfe, 0xf7, 0xf5, 0x19, 0x04, 0xf4, 0x01, 0xfa, 0x02, 0x08, 0xf1, 0xf1, 0xfa, 0xfa, 0xd5, 0xdd,
+    0xe2, 0x0e, 0x16, 0x0b, 0xfb, 0xf5, 0xf2, 0x01, 0x13, 0xc9, 0xeb, 0xca, 0xf2, 0x1d, 0x08, 0x10,
+    0xf7, 0x21, 0x07, 0x10, 0xfb, 0xdf, 0xda, 0x07, 0x29, 0x14, 0xea, 0xe0, 0x06, 0x21, 0x0e, 0xcf,
+    0xd0, 0xd2, 0xf1, 0x0c, 0x1a, 0x1b, 0xf9, 0x9f, 0x0d, 0xef, 0xe5, 0xc9, 0xf8, 0x05, 0x14, 0xff,
+    0xfd, 0xfe, 0x1b, 0xdf, 0x0c, 0xf6, 0xf3, 0xe3, 0xf9, 0x19, 0xff, 0x04, 0xe9, 0xf7, 0xf6, 0xf9,
+    0x07, 0xfe, 0x0c, 0x17, 0xf2, 0x0e, 0xf8, 0x09, 0xfb, 0x04, 0xfd, 0xb9, 0xf3, 0x13, 0xf6, 0x16,
+    0x0a, 0xe5, 0xfb, 0xf1, 0xef, 0xe7, 0x14, 0x10, 0x0b, 0x34, 0x10, 0x18, 0x0b, 0xf0, 0x09, 0xf4,
+    0x05, 0xf5, 0x0c, 0x0b, 0xf8, 0xfe, 0xee, 0x01, 0xda, 0xf1, 0x25, 0x05, 0xfe, 0xf6, 0x17, 0x24,
+    0x0a, 0xe5, 0x0f, 0xf1, 0xfb, 0xf9, 0x02, 0x07, 0xca, 0x09, 0x34, 0xf7, 0x00, 0xf3, 0x0e, 0x0b,
+    0x0a, 0x0d, 0xf9, 0x1f, 0xff, 0x05, 0xff, 0x01, 0xf4, 0xe8, 0xdb, 0xdf, 0xea, 0xeb, 0xfd, 0x06,
+    0x05, 0xfd, 0x0e, 0x15, 0xf3, 0xf4, 0xdc, 0xf7, 0x05, 0x09, 0x0c, 0x00, 0xfe, 0xfd, 0x0f, 0xea,
+    0x07, 0x0e, 0x03, 0xf4, 0xf3, 0xe8, 0xdd, 0xec, 0xfb, 0x07, 0x16, 0x10, 0x02, 0xf0, 0x1e, 0x0e,
+    0x09, 0xe3, 0x0c, 0xef, 0x04, 0x09, 0x09, 0xe7, 0xf3, 0x0e, 0x07, 0x05, 0x00, 0x05, 0x01, 0x0d,
+    0x08, 0x0a, 0xfe, 0xe9, 0xf8, 0x02, 0x02, 0x0a, 0x10, 0xec, 0x09, 0x12, 0x0e, 0xea, 0xfd, 0xf0,
+    0xf9, 0xde, 0xfe, 0x0a, 0xff, 0x15, 0x03, 0x0e, 0x06, 0x03, 0x06, 0x02, 0x0b, 0xea, 0x0c, 0x25,
+    0x04, 0x0b, 0x17, 0x01, 0x06, 0x0d, 0x06, 0x0a, 0xff, 0xf4, 0x08, 0xfe, 0x1a, 0x15, 0x1f, 0xff,
+    0x13, 0x08, 0xfa, 0x06, 0xff, 0xff, 0xef, 0xf9, 0xf2, 0xf9, 0x0c, 0x15, 0x1d, 0x20, 0xea, 0x43,
+    0xfb, 0x0b, 0x17, 0x09, 0x0e, 0x05, 0xf3, 0x09, 0xf3, 0xfb, 0x0e, 0x00, 0xae, 0xe9, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0x00, 0x36, 0x15, 0x00, 0x00,
+    0xf4, 0xf5, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0x8e, 0x10, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+    0xca, 0xf2, 0xff, 0xff, 0xc4, 0x05, 0x00, 0x00, 0x51, 0xf4, 0xff, 0xff, 0x31, 0x13, 0x00, 0x00,
+    0x52, 0xfb, 0xff, 0xff, 0xf9, 0x0c, 0x00, 0x00, 0x32, 0x07, 0x00, 0x00, 0xfb, 0xfc, 0xff, 0xff,
+    0x76, 0xff, 0xff, 0xff, 0x88, 0x16, 0x00, 0x00, 0xf6, 0x13, 0x00, 0x00, 0xd9, 0x07, 0x00, 0x00,
+    0x41, 0xfd, 0xff, 0xff, 0xca, 0x15, 0x00, 0x00, 0xc8, 0xfb, 0xff, 0xff, 0x39, 0x00, 0x00, 0x00,
+    0x0d, 0xf6, 0xff, 0xff, 0xa1, 0x09, 0x00, 0x00, 0x39, 0xfb, 0xff, 0xff, 0xb5, 0xf8, 0xff, 0xff,
+    0xfa, 0x0b, 0x00, 0x00, 0x46, 0xfe, 0xff, 0xff, 0xdb, 0x03, 0x00, 0x00, 0xdb, 0x07, 0x00, 0x00,
+    0xbe, 0x0e, 0x00, 0x00, 0x88, 0x04, 0x00, 0x00, 0x9a, 0xe8, 0xff, 0xff, 0xcc, 0xfc, 0xff, 0xff,
+    0x8c, 0x0d, 0x00, 0x00, 0xb3, 0x08, 0x00, 0x00, 0xad, 0xf0, 0xff, 0xff, 0xa7, 0x16, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x80, 0x11, 0x00, 0x00,
+    0x09, 0x0d, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x0a, 0x06, 0x00, 0x00, 0x35, 0xf6, 0xff, 0xff,
+    0x09, 0xfb, 0xff, 0xff, 0xc0, 0x11, 0x00, 0x00, 0x43, 0x19, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x00,
+    0x6b, 0xf8, 0xff, 0xff, 0xd9, 0xf0, 0xff, 0xff, 0x87, 0x04, 0x00, 0x00, 0x80, 0x0d, 0x00, 0x00,
+    0x3b, 0x0b, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0xcb, 0xfe, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff,
+    0xaa, 0xf9, 0xff, 0xff, 0xc5, 0x0a, 0x00, 0x00, 0x48, 0xef, 0xff, 0xff, 0xc6, 0x0e, 0x00, 0x00,
+    0xc3, 0x13, 0x00, 0x00, 0xf5, 0xfe, 0xff, 0xff, 0xba, 0xea, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0xba, 0x19, 0xf5, 0xbe, 0x33, 0x2c, 0xf7, 0x33, 0x1e, 0x18, 0x19, 0xf7,
+    0x13, 0xb6, 0x1d, 0x03, 0x09, 0xb5, 0x13, 0x02, 0xfe, 0xd6, 0xf0, 0xae, 0xe7, 0x12, 0x18, 0x28,
+    0x16, 0xee, 0x22, 0x2e, 0x29, 0x29, 0x16, 0x1b, 0xff, 0x37, 0x04, 0x26, 0xc6, 0xf6, 0x17, 0x05,
+    0xe0, 0x0e, 0xf1, 0xd5, 0x16, 0xe4, 0xee, 0x25, 0x1b, 0xbd, 0xeb, 0xe8, 0xf1, 0x18, 0x0f, 0xf8,
+    0xff, 0xee, 0x09, 0x09, 0x12, 0xda, 0xdf, 0x04, 0xea, 0x33, 0xf4, 0xff, 0x0e, 0x1c, 0xf6, 0x15,
+    0xfd, 0xf5, 0xd8, 0xca, 0xf9, 0xce, 0xf9, 0xf6, 0xd4, 0x0b, 0x34, 0xf4, 0xe5, 0x1d, 0x0c, 0x15,
+    0xd1, 0x21, 0x1c, 0x35, 0xf9, 0x05, 0x22, 0x28, 0x2e, 0xa6, 0x08, 0xd4, 0xc6, 0xd7, 0xe2, 0xdc,
+    0x12, 0x0a, 0x0d, 0xc7, 0xc5, 0xf1, 0xdb, 0x09, 0x1e, 0x01, 0xe7, 0xf9, 0x01, 0x0f, 0xbf, 0xd1,
+    0x1e, 0x0d, 0xf0, 0x12, 0x30, 0x06, 0x20, 0x0a, 0xee, 0xf0, 0xe7, 0x13, 0xea, 0xb4, 0xdc, 0x25,
+    0x2c, 0x2c, 0xf3, 0x0b, 0x03, 0x3b, 0x12, 0xf3, 0x0d, 0x09, 0xe2, 0x1e, 0xf5, 0xe9, 0xa7, 0x0a,
+    0xfd, 0xf5, 0x03, 0xfb, 0x1a, 0xeb, 0xfb, 0x0a, 0x1b, 0x13, 0xe9, 0xe9, 0xde, 0xfb, 0xfb, 0x0e,
+    0x02, 0xe9, 0xd1, 0x31, 0x1a, 0x13, 0x0e, 0x08, 0x23, 0x12, 0xf6, 0xf0, 0xe3, 0xef, 0x17, 0x10,
+    0xed, 0xf1, 0xfb, 0x0e, 0x1e, 0x24, 0x0a, 0xe4, 0x01, 0xe6, 0x54, 0x00, 0x05, 0x03, 0x0b, 0xf2,
+    0x08, 0x03, 0xe8, 0xe3, 0x2a, 0xda, 0xdb, 0x05, 0xf3, 0x14, 0x2b, 0x03, 0xf1, 0xdb, 0xd3, 0xd6,
+    0xcb, 0xee, 0x0d, 0xfc, 0x07, 0x10, 0xe9, 0xcf, 0x12, 0x06, 0xfc, 0x1c, 0x0e, 0xd6, 0x08, 0x0c,
+    0xfc, 0xee, 0x0f, 0x22, 0x01, 0x45, 0x01, 0xe3, 0xee, 0xf3, 0xb3, 0x23, 0x24, 0xf0, 0xff, 0x12,
+    0x12, 0x1b, 0xc2, 0x21, 0x30, 0xfe, 0xe3, 0x1c, 0xf4, 0x02, 0x0d, 0x0e, 0x07, 0x15, 0xe2, 0x03,
+    0xf9, 0xe6, 0x46, 0x33, 0x06, 0xd6, 0x15, 0x2e, 0x0c, 0x22, 0xd4, 0xf6, 0xe3, 0x23, 0x2b, 0x09,
+    0xf9, 0x15, 0xfc, 0x24, 0xec, 0xd5, 0x23, 0x02, 0x09, 0x0b, 0xd9, 0x1a, 0x2f, 0x02, 0xce, 0xe6,
+    0x09, 0x1c, 0xf1, 0xd7, 0x09, 0xfe, 0x17, 0xf0, 0xf6, 0x19, 0x14, 0x1b, 0x31, 0x12, 0x13, 0x06,
+    0x03, 0xf5, 0xc8, 0xf6, 0xee, 0x1d, 0xef, 0x01, 0x03, 0x16, 0xca, 0x1f, 0xf1, 0x24, 0x34, 0x9d,
+    0xfd, 0xa7, 0x1d, 0xfd, 0x06, 0xcc, 0x16, 0x09, 0xc7, 0xf3, 0x21, 0x33, 0x31, 0x29, 0x1b, 0x0a,
+    0x00, 0x28, 0x2e, 0xfd, 0x01, 0x55, 0x2e, 0xec, 0x0f, 0x29, 0xe5, 0x11, 0xb5, 0x01, 0x04, 0xe1,
+    0xdf, 0x33, 0x06, 0xe6, 0x10, 0xdc, 0x1e, 0xf2, 0xdc, 0xe5, 0xee, 0xfc, 0xf1, 0x1a, 0x10, 0x25,
+    0x19, 0xdc, 0x38, 0xfd, 0x20, 0x2c, 0xe9, 0x24, 0x19, 0x16, 0x03, 0x1c, 0xfe, 0xd8, 0xe7, 0x43,
+    0x0a, 0xeb, 0xe7, 0x1b, 0xf3, 0x00, 0x11, 0x18, 0xfe, 0x07, 0xe0, 0x13, 0xed, 0xf2, 0x91, 0x00,
+    0xf0, 0x1e, 0x39, 0xec, 0xfc, 0xf9, 0x10, 0x32, 0x1d, 0x27, 0xec, 0xc4, 0xec, 0x0d, 0x09, 0x22,
+    0x0d, 0xd0, 0xe5, 0x2a, 0xeb, 0xfd, 0xf1, 0xea, 0x28, 0xf5, 0xae, 0x22, 0xdd, 0xd3, 0xe2, 0x21,
+    0xf4, 0xe7, 0x41, 0x15, 0xe8, 0x38, 0x0b, 0xf3, 0xdb, 0xfb, 0x0c, 0x1d, 0xde, 0xfa, 0x1b, 0x17,
+    0x17, 0xe5, 0xfd, 0xff, 0xf3, 0xf9, 0xd5, 0xd1, 0xfa, 0x02, 0x27, 0xd5, 0xdd, 0x08, 0x28, 0x46,
+    0x2f, 0xec, 0xef, 0x42, 0xd5, 0xdb, 0xfc, 0x09, 0x2d, 0x22, 0xf8, 0x1e, 0x04, 0x09, 0x20, 0x06,
+    0xf6, 0x2b, 0x0c, 0xe7, 0x06, 0xd7, 0xfc, 0xf8, 0x11, 0x40, 0x21, 0xf8, 0xf6, 0x36, 0xec, 0xb1,
+    0xff, 0x0f, 0xb6, 0x05, 0x0d, 0x07, 0xf5, 0x12, 0xfb, 0xef, 0xee, 0x27, 0xe4, 0xdf, 0x0f, 0xe7,
+    0x17, 0x3c, 0xd1, 0x06, 0x01, 0x24, 0x01, 0xf5, 0x07, 0x0d, 0xef, 0x1e, 0x0f, 0x36, 0xc0, 0xf0,
+    0xf7, 0x1d, 0x1c, 0xd7, 0x25, 0x0b, 0xe8, 0x28, 0x10, 0xf4, 0x28, 0xef, 0xec, 0x1d, 0x27, 0x13,
+    0xf7, 0xf6, 0xe7, 0x07, 0x17, 0x0e, 0xe3, 0x02, 0x10, 0x08, 0xcb, 0xf1, 0xe5, 0x2a, 0xf3, 0x08,
+    0x08, 0x15, 0xb9, 0x1d, 0x18, 0xd1, 0x03, 0x2b, 0x15, 0xee, 0xf6, 0x33, 0x12, 0x07, 0x2f, 0xad,
+    0xe8, 0xe3, 0xf5, 0xf6, 0xf6, 0xbe, 0xf0, 0xfd, 0xdc, 0x13, 0x10, 0x11, 0x33, 0x69, 0x18, 0x17,
+    0xf4, 0x14, 0xf3, 0xf1, 0xe7, 0x35, 0xe0, 0x3d, 0x19, 0xf0, 0xcd, 0x12, 0x05, 0xdc, 0x04, 0xfc,
+    0x18, 0x1b, 0xfe, 0x18, 0x0f, 0x00, 0xfd, 0xbd, 0xed, 0xed, 0x1b, 0x20, 0xf3, 0x15, 0x03, 0x40,
+    0x15, 0x0c, 0x4b, 0xf8, 0x31, 0x0d, 0xf4, 0xea, 0xe1, 0x31, 0x3d, 0x0e, 0x0b, 0x28, 0xb3, 0x12,
+    0x38, 0x18, 0x2d, 0x0c, 0x05, 0x12, 0x22, 0x26, 0x09, 0xdd, 0xe2, 0xe4, 0xe6, 0xbf, 0xfb, 0xed,
+    0xe8, 0xee, 0x0d, 0x25, 0xef, 0xce, 0x20, 0xe0, 0x0c, 0x26, 0x2a, 0xfb, 0xfa, 0x0c, 0xd9, 0xe4,
+    0x05, 0x02, 0x07, 0xd8, 0xd8, 0x0c, 0xfb, 0xfc, 0x24, 0x19, 0x2d, 0x09, 0x0b, 0xcd, 0x35, 0xf1,
+    0xe9, 0xca, 0xcf, 0xf6, 0xf3, 0xf0, 0x21, 0xe9, 0xea, 0xf4, 0x27, 0xe5, 0x0a, 0xe9, 0xc1, 0xef,
+    0x18, 0xde, 0x25, 0x00, 0xfa, 0xfa, 0x17, 0x15, 0x13, 0x2c, 0x0d, 0x01, 0xcf, 0xf2, 0x14, 0xf6,
+    0xf1, 0x28, 0xec, 0x0b, 0x0d, 0xe0, 0x61, 0xfe, 0xd2, 0x04, 0x13, 0x6b, 0x45, 0x18, 0xc5, 0xea,
+    0x05, 0xe2, 0x15, 0x12, 0xf7, 0x1c, 0x20, 0xf4, 0xee, 0x05, 0x1f, 0xdc, 0x2c, 0xeb, 0xd6, 0xe7,
+    0xfd, 0xe5, 0xfc, 0xfd, 0x18, 0x0e, 0x14, 0xe3, 0x1e, 0xf5, 0xad, 0x12, 0x06, 0xea, 0x2c, 0xf6,
+    0x18, 0x3f, 0xf4, 0xb1, 0x17, 0x02, 0xfa, 0xf3, 0x26, 0x02, 0x14, 0x20, 0x54, 0xf7, 0xa6, 0xf4,
+    0xea, 0x14, 0x16, 0xf3, 0x23, 0x1d, 0xc3, 0x02, 0x01, 0xf8, 0x3a, 0xd3, 0xdf, 0x07, 0x16, 0xfc,
+    0xfb, 0xe1, 0x06, 0x1f, 0x05, 0x03, 0xd8, 0x19, 0x2a, 0x06, 0xd1, 0x23, 0xb7, 0x0e, 0xf3, 0x19,
+    0xcf, 0xf3, 0x1f, 0x1d, 0x07, 0xda, 0xd8, 0x03, 0x28, 0x28, 0x01, 0x0d, 0xfe, 0x14, 0x18, 0x05,
+    0x37, 0x14, 0xf0, 0xf3, 0x13, 0xdd, 0xd4, 0x27, 0xd8, 0x03, 0x01, 0xfb, 0xe1, 0x33, 0xdf, 0xfa,
+    0xde, 0xee, 0x0b, 0xe4, 0x91, 0xcd, 0x39, 0xfc, 0x0f, 0xdd, 0x36, 0xf2, 0xf8, 0x04, 0x18, 0x11,
+    0x13, 0xf0, 0x51, 0xcb, 0xdb, 0x02, 0xa2, 0x06, 0x10, 0xe4, 0x98, 0xf4, 0x0c, 0x0d, 0xf8, 0xc3,
+    0x1c, 0x0a, 0xd4, 0x05, 0xd9, 0xff, 0x3b, 0xfd, 0x17, 0x17, 0xea, 0xf6, 0x30, 0xcc, 0x07, 0x1e,
+    0x0c, 0x12, 0x2d, 0xb5, 0xfe, 0x2c, 0x10, 0x19, 0xf6, 0xf1, 0x01, 0xfe, 0xe6, 0xf1, 0xe0, 0xe9,
+    0x53, 0x0e, 0xde, 0xfd, 0x22, 0xd9, 0x2b, 0xfb, 0xd0, 0x14, 0x0a, 0x05, 0xc5, 0x21, 0xf8, 0x12,
+    0xff, 0xf9, 0xe3, 0x04, 0x24, 0x20, 0x02, 0x20, 0x12, 0xba, 0xc7, 0x0c, 0xde, 0x0e, 0xe5, 0xac,
+    0x10, 0x0a, 0x34, 0xf1, 0xdc, 0xff, 0xff, 0xf3, 0xdd, 0xff, 0x0c, 0x00, 0xfe, 0x01, 0xdc, 0xd3,
+    0x01, 0x32, 0x10, 0xfe, 0x01, 0x21, 0xfb, 0x2d, 0x31, 0x0a, 0xd5, 0x02, 0xfc, 0xd8, 0xeb, 0xe3,
+    0xe5, 0x0f, 0x05, 0xc5, 0xb9, 0xfd, 0x0d, 0x00, 0x03, 0xec, 0x40, 0xe2, 0x0f, 0x23, 0x21, 0x01,
+    0x21, 0x23, 0x1d, 0x09, 0xf0, 0x25, 0xee, 0x13, 0x06, 0xdc, 0xf3, 0xfe, 0x19, 0x23, 0x02, 0xed,
+    0x19, 0xf7, 0xf8, 0x1d, 0x15, 0x0d, 0x06, 0xfe, 0xff, 0xf2, 0x2d, 0x0d, 0xfc, 0xff, 0xf8, 0x15,
+    0x0c, 0x03, 0xeb, 0x3c, 0x16, 0x02, 0x02, 0xd5, 0xea, 0x1f, 0x12, 0x1f, 0x27, 0xfd, 0x4a, 0x15,
+    0xe9, 0x12, 0xc5, 0xf3, 0xf8, 0x50, 0xdb, 0x0f, 0x38, 0x2c, 0xfa, 0xdc, 0x33, 0x0a, 0x03, 0x02,
+    0xee, 0x19, 0x1e, 0x01, 0xff, 0x0a, 0x20, 0x18, 0xf1, 0x2c, 0x3b, 0xdc, 0x19, 0xfa, 0x26, 0x30,
+    0xfb, 0xfe, 0xc6, 0x0c, 0x09, 0x11, 0x1d, 0xf3, 0xd3, 0x0f, 0x10, 0xba, 0x12, 0x09, 0xf3, 0xba,
+    0x03, 0x03, 0x25, 0xe6, 0x18, 0xde, 0x08, 0x2f, 0x01, 0xf2, 0x3a, 0x03, 0xf0, 0x25, 0xde, 0xe2,
+    0x0a, 0x1d, 0x0e, 0x2b, 0x17, 0xe4, 0xec, 0xfd, 0xf2, 0xe6, 0x31, 0xd6, 0xe6, 0x06, 0xc8, 0x14,
+    0x14, 0xfc, 0xd3, 0xfe, 0xaa, 0x07, 0xe6, 0x1d, 0x0d, 0x0a, 0xeb, 0x45, 0xf1, 0xdb, 0xf6, 0x13,
+    0x10, 0xf1, 0xf8, 0x1a, 0xea, 0xd9, 0x17, 0x19, 0x06, 0x10, 0x87, 0xdc, 0x20, 0xc7, 0x22, 0x04,
+    0xfc, 0x20, 0xe4, 0xb3, 0xf6, 0xd8, 0x10, 0xe7, 0x10, 0x0c, 0xf4, 0x14, 0x39, 0x28, 0xb9, 0x2f,
+    0x0f, 0x31, 0x1a, 0xff, 0x4a, 0x10, 0xe7, 0x29, 0x29, 0xeb, 0x00, 0xd3, 0xd5, 0xf1, 0x23, 0x03,
+    0x23, 0xd3, 0x12, 0xf1, 0xf2, 0xb8, 0xff, 0x07, 0x0b, 0x1f, 0x06, 0xdd, 0xd9, 0x9c, 0xd0, 0x1b,
+    0xeb, 0xfe, 0xfb, 0x13, 0x11, 0xda, 0x17, 0x0c, 0x31, 0x18, 0xe0, 0x13, 0x23, 0x1f, 0x0c, 0x3e,
+    0xf4, 0xfe, 0xfe, 0xf5, 0x0e, 0xee, 0x2f, 0x12, 0x0c, 0xcd, 0xd7, 0xd0, 0x02, 0x0c, 0xd3, 0x21,
+    0x04, 0xfd, 0x37, 0x10, 0x3d, 0xe2, 0x0c, 0x29, 0x23, 0xea, 0xdc, 0xfd, 0xf1, 0xff, 0x2a, 0x14,
+    0x08, 0xfe, 0x28, 0x06, 0xf9, 0xbd, 0xe4, 0xf3, 0xde, 0x2e, 0xe0, 0x00, 0xe4, 0xc0, 0xdc, 0x1e,
+    0xfd, 0x22, 0x5d, 0x11, 0x0b, 0x02, 0xf6, 0xe3, 0x22, 0xf7, 0xfc, 0xe4, 0xff, 0x2a, 0x18, 0xd3,
+    0x16, 0xe2, 0x20, 0x0a, 0xf3, 0xb0, 0xfe, 0xf3, 0x10, 0xf9, 0x01, 0xce, 0xf1, 0x23, 0xf2, 0x23,
+    0xf0, 0x0a, 0x08, 0x16, 0x2a, 0xd5, 0xf6, 0x21, 0xfb, 0xf1, 0x26, 0x2b, 0x2a, 0xed, 0x36, 0x14,
+    0xfa, 0xdb, 0x1f, 0xf8, 0xe3, 0xde, 0xf2, 0xf9, 0xff, 0x23, 0x1b, 0x1d, 0x01, 0x0d, 0xf9, 0xe8,
+    0x0a, 0xf3, 0x07, 0x0f, 0x0e, 0xe1, 0x05, 0xf9, 0xd1, 0x0e, 0x23, 0xd7, 0xfd, 0x10, 0xf2, 0xe3,
+    0x06, 0x33, 0x27, 0x15, 0xf6, 0x01, 0xee, 0x40, 0x2d, 0x17, 0x18, 0xfd, 0xeb, 0xd9, 0xd6, 0xec,
+    0xda, 0x1a, 0xfd, 0xe1, 0x05, 0xca, 0xf1, 0xf6, 0x0a, 0x07, 0x22, 0xe8, 0x37, 0x12, 0xfe, 0x1f,
+    0x1e, 0xfc, 0x14, 0x1f, 0xb8, 0x06, 0x05, 0x1e, 0x1e, 0xf9, 0x08, 0xf8, 0x12, 0xd5, 0xf2, 0x1c,
+    0x14, 0xe9, 0xf6, 0x07, 0x17, 0xc2, 0xf6, 0xe7, 0xdf, 0xd5, 0xc5, 0xf8, 0xee, 0xf8, 0xe9, 0xb4,
+    0xf3, 0xdc, 0xf2, 0xf0, 0x16, 0xf3, 0xe9, 0xd7, 0x08, 0x25, 0x44, 0x24, 0xf9, 0x08, 0xae, 0xf3,
+    0xc8, 0xee, 0x13, 0xdc, 0x19, 0x25, 0xf6, 0x04, 0x18, 0x16, 0x17, 0xe8, 0xdd, 0x41, 0x0f, 0xf2,
+    0x2a, 0x16, 0x1e, 0x00, 0xd2, 0xf2, 0x16, 0x09, 0x10, 0xcf, 0xd2, 0x10, 0xbf, 0xe7, 0x0c, 0x0f,
+    0x18, 0xf1, 0x24, 0x1b, 0xe2, 0xe2, 0x06, 0xe6, 0x32, 0xd5, 0xb6, 0x1c, 0x3a, 0x2b, 0x36, 0xfd,
+    0xea, 0xf3, 0x0e, 0x08, 0xff, 0xee, 0x0c, 0x4f, 0xfc, 0xeb, 0xcf, 0x0d, 0x02, 0x23, 0x49, 0x2b,
+    0xf9, 0x09, 0xcd, 0x06, 0xd6, 0x3b, 0xfd, 0x1f, 0xd2, 0xdd, 0x34, 0x0d, 0xc5, 0x18, 0x2b, 0x12,
+    0x06, 0x01, 0xf4, 0x09, 0xf8, 0x04, 0x00, 0xfd, 0xde, 0xf9, 0x0d, 0xe4, 0x0d, 0x1a, 0x18, 0xdc,
+    0x0d, 0xda, 0xf3, 0xe8, 0xed, 0x08, 0xff, 0x00, 0xed, 0x0a, 0x29, 0xf6, 0xd5, 0x23, 0xe7, 0x30,
+    0xec, 0xe2, 0xfa, 0x58, 0xfa, 0x00, 0xe3, 0xe1, 0xff, 0x0f, 0x00, 0x0a, 0x1e, 0x0a, 0x19, 0x3b,
+    0x0f, 0xe6, 0xde, 0xe2, 0xe1, 0x4a, 0xfb, 0x36, 0x3c, 0x12, 0x07, 0x15, 0x23, 0xe8, 0x00, 0x16,
+    0x10, 0x31, 0x17, 0xe8, 0x26, 0x0a, 0x1a, 0x0a, 0xf0, 0x26, 0x1e, 0xce, 0x09, 0x0e, 0x2f, 0x2a,
+    0x21, 0x09, 0x03, 0x14, 0xc8, 0xde, 0x17, 0xde, 0x1e, 0xd6, 0x20, 0x31, 0x22, 0x0f, 0x1e, 0xd4,
+    0xdb, 0xe8, 0xf1, 0xde, 0x0b, 0xe0, 0xf8, 0x2b, 0xe4, 0xe8, 0x2f, 0xda, 0xfd, 0x0e, 0x22, 0x04,
+    0x0d, 0xe1, 0x23, 0x0d, 0x02, 0x28, 0xdd, 0x27, 0xf0, 0x00, 0x08, 0x34, 0x33, 0xd8, 0x00, 0x32,
+    0xe3, 0x15, 0x38, 0x16, 0x05, 0x3e, 0xd6, 0xe1, 0xcb, 0xd0, 0xda, 0xf3, 0x33, 0x08, 0x01, 0x17,
+    0x26, 0xff, 0x1b, 0xff, 0x13, 0xfa, 0x15, 0xe5, 0x23, 0x13, 0xfc, 0xef, 0x44, 0x0e, 0xdc, 0xde,
+    0xdf, 0xf5, 0x19, 0xc5, 0x0c, 0xf8, 0xdb, 0x0a, 0xeb, 0x3e, 0x08, 0xff, 0xc2, 0x04, 0x20, 0xfe,
+    0x04, 0x0a, 0x1b, 0x19, 0x0c, 0xe4, 0xbf, 0xe6, 0xd7, 0xfc, 0x0d, 0x3c, 0xda, 0xf9, 0xfe, 0x16,
+    0xf6, 0xde, 0x21, 0xf0, 0x30, 0x0b, 0x24, 0xf6, 0x3a, 0xfe, 0x05, 0x16, 0x1d, 0x00, 0x03, 0xc7,
+    0x0a, 0xf2, 0xd1, 0xef, 0x00, 0xf6, 0x17, 0x26, 0x06, 0xfe, 0xf1, 0x12, 0xf0, 0xf5, 0xf6, 0xef,
+    0x09, 0x1b, 0xd4, 0xdf, 0x01, 0x2e, 0x06, 0xe2, 0xe8, 0x0a, 0xfc, 0x2e, 0x14, 0x15, 0xc5, 0xf9,
+    0x07, 0x04, 0x24, 0xb6, 0x19, 0x16, 0x0b, 0x0a, 0xf7, 0xfb, 0xfb, 0xee, 0xe2, 0x1e, 0x03, 0x0d,
+    0x0c, 0x04, 0xde, 0x0e, 0x1d, 0x1b, 0x11, 0x00, 0xf6, 0xe0, 0xd1, 0x06, 0xf1, 0x20, 0x05, 0xf1,
+    0x18, 0x16, 0xfa, 0x16, 0x1a, 0xee, 0x29, 0xf6, 0xfa, 0x01, 0x3d, 0xe9, 0x0f, 0xda, 0xe5, 0x0e,
+    0x0a, 0x0f, 0x0e, 0x42, 0xea, 0x06, 0x0b, 0x30, 0xff, 0xbb, 0xf0, 0xf7, 0xab, 0xdc, 0xcf, 0xe5,
+    0xfc, 0x19, 0x1b, 0x08, 0xe3, 0xbf, 0x02, 0xe4, 0x0b, 0x0c, 0x19, 0x20, 0x05, 0x1b, 0xfb, 0x34,
+    0x0f, 0xec, 0x05, 0xfd, 0xfa, 0x32, 0x15, 0x25, 0x13, 0x15, 0xfa, 0x09, 0x0b, 0x15, 0xe5, 0xe6,
+    0xe4, 0xd7, 0xe1, 0xe4, 0xdc, 0xef, 0x16, 0xd1, 0xd6, 0xf4, 0x02, 0xef, 0xd7, 0xfc, 0xcc, 0xb8,
+    0xec, 0x02, 0x15, 0x1b, 0x03, 0xe8, 0x03, 0x01, 0xe3, 0x1e, 0x16, 0x04, 0xea, 0xe7, 0xff, 0x01,
+    0xcf, 0x09, 0xe3, 0xcc, 0x0e, 0x21, 0xbe, 0x16, 0x16, 0x13, 0x2c, 0xd8, 0x4d, 0x0a, 0xfd, 0x1f,
+    0xfd, 0x17, 0x22, 0x1f, 0xd3, 0x09, 0x16, 0x1a, 0x22, 0xd9, 0xe6, 0x0d, 0x05, 0xff, 0x28, 0x18,
+    0x21, 0xfb, 0xcd, 0x1b, 0x19, 0x10, 0x23, 0x44, 0x08, 0x03, 0x25, 0x06, 0xe8, 0xe1, 0xaf, 0x17,
+    0xf4, 0x14, 0xeb, 0x19, 0x26, 0x15, 0x0e, 0xc7, 0x1f, 0xfd, 0x02, 0x11, 0x32, 0xfc, 0x5d, 0x05,
+    0x07, 0xec, 0xf5, 0x1d, 0xf8, 0xf8, 0x28, 0x32, 0x2b, 0x34, 0xd5, 0xff, 0x31, 0xf8, 0x00, 0x11,
+    0x0f, 0x19, 0xfd, 0x12, 0x30, 0xed, 0x2f, 0xfd, 0x0d, 0x10, 0x06, 0xfd, 0xd3, 0xc4, 0x2c, 0x14,
+    0x0c, 0xe2, 0x31, 0xfa, 0x12, 0x05, 0x10, 0xd9, 0xc7, 0xf3, 0x18, 0xa3, 0x01, 0x14, 0x00, 0xc3,
+    0xf7, 0xeb, 0xf6, 0x2d, 0xf8, 0x04, 0x21, 0x17, 0xe9, 0xde, 0x18, 0x12, 0x1d, 0xfe, 0x2d, 0xf6,
+    0xe4, 0x0c, 0x0a, 0x1d, 0x2c, 0x1e, 0x0f, 0xd5, 0x23, 0xfc, 0x0a, 0xe4, 0xf8, 0x07, 0xf0, 0x0c,
+    0xe8, 0x06, 0x0b, 0x02, 0x0a, 0x09, 0x19, 0x19, 0x07, 0x04, 0x04, 0x0f, 0x00, 0xdb, 0x29, 0x3a,
+    0x23, 0xec, 0x2c, 0xf2, 0xd2, 0x06, 0x45, 0x1a, 0x0e, 0x0d, 0xdb, 0x16, 0x12, 0xf9, 0x3a, 0x14,
+    0x13, 0xf3, 0xfa, 0xbd, 0x0a, 0x0f, 0xe7, 0xef, 0xee, 0xde, 0x28, 0x14, 0x2a, 0x01, 0xef, 0x0c,
+    0x1e, 0xfc, 0x0d, 0xca, 0x21, 0x50, 0xc8, 0xf0, 0xf3, 0x18, 0x09, 0xdc, 0xbd, 0x19, 0x15, 0x09,
+    0x0d, 0x29, 0x0d, 0xf0, 0x0a, 0x0f, 0x18, 0x19, 0x03, 0xf5, 0xfa, 0xe6, 0xd4, 0x07, 0x18, 0xe3,
+    0x04, 0xfb, 0xf9, 0x19, 0x11, 0xe0, 0xf6, 0x0f, 0xe7, 0xe9, 0x20, 0xf7, 0x01, 0xdc, 0xbd, 0xfe,
+    0x02, 0x44, 0x14, 0x0f, 0x1a, 0x1e, 0x10, 0x27, 0x25, 0x13, 0xce, 0x10, 0xdc, 0xd6, 0xf0, 0xdc,
+    0x00, 0xfa, 0x21, 0xc8, 0xe4, 0xe3, 0x1c, 0x03, 0x03, 0x00, 0x1f, 0xfd, 0x36, 0x05, 0xf6, 0xfe,
+    0xff, 0x2a, 0x15, 0x1a, 0xf1, 0x0d, 0xf9, 0xf7, 0x20, 0xef, 0xe8, 0x12, 0x29, 0x10, 0x17, 0x0b,
+    0x10, 0xfd, 0xde, 0x17, 0x30, 0x12, 0xdf, 0x0a, 0xd7, 0xf5, 0x0b, 0x17, 0xe6, 0xb6, 0x12, 0x29,
+    0x32, 0xed, 0xe9, 0x06, 0xe1, 0x24, 0x19, 0x06, 0x15, 0x1f, 0x00, 0x29, 0xb7, 0x2c, 0xe5, 0x08,
+    0x02, 0x27, 0xbc, 0x20, 0x0b, 0x1c, 0xfa, 0x04, 0x04, 0xc0, 0x08, 0x09, 0xe5, 0x07, 0xea, 0xeb,
+    0xff, 0xfc, 0xdc, 0x07, 0xec, 0x30, 0x2f, 0x01, 0xe1, 0x08, 0xe8, 0x20, 0x20, 0xed, 0xf9, 0xe6,
+    0x1e, 0xf2, 0xcf, 0x22, 0x05, 0xe6, 0x0b, 0x0e, 0xe1, 0xfb, 0xf3, 0xfb, 0xf4, 0x04, 0x21, 0xd9,
+    0xe9, 0xf7, 0xe7, 0xf5, 0x29, 0x2a, 0xdc, 0xe9, 0xf8, 0x21, 0x34, 0x09, 0x03, 0xf6, 0xcd, 0xf4,
+    0xfa, 0x18, 0x23, 0xfb, 0x07, 0x41, 0xe7, 0x0c, 0x1a, 0xf0, 0xf0, 0xe3, 0x06, 0xfb, 0x08, 0x19,
+    0xf0, 0x12, 0x16, 0x1a, 0x0a, 0x37, 0xf1, 0xe3, 0xe7, 0xb7, 0xbb, 0x26, 0x18, 0x26, 0x14, 0xf4,
+    0x35, 0x10, 0xdc, 0x22, 0x21, 0xec, 0x25, 0x04, 0xe2, 0xec, 0x29, 0xf0, 0x10, 0xe4, 0xea, 0x07,
+    0x03, 0x0c, 0xf0, 0xe2, 0x05, 0xd2, 0x0d, 0x13, 0x20, 0x1b, 0x19, 0x0c, 0xe9, 0xfe, 0xbf, 0x0b,
+    0xf0, 0x09, 0xf3, 0xf3, 0x01, 0x07, 0xc3, 0xd6, 0xf8, 0xfb, 0x17, 0xec, 0xfa, 0xf2, 0x04, 0x0f,
+    0x16, 0xee, 0x1e, 0x31, 0xed, 0x2e, 0x17, 0x01, 0x1c, 0x0c, 0x26, 0x1f, 0x21, 0x08, 0x05, 0x0a,
+    0x04, 0x06, 0xb4, 0x04, 0x1c, 0x1d, 0x00, 0x22, 0xfc, 0xe2, 0xef, 0x10, 0x2a, 0x1a, 0x18, 0x27,
+    0xe8, 0x01, 0xe6, 0x05, 0x00, 0xa3, 0xfb, 0xe5, 0x18, 0x29, 0xd7, 0x03, 0x34, 0x2a, 0xf3, 0x3a,
+    0x0f, 0xf4, 0xf2, 0x33, 0xec, 0x16, 0xcb, 0x2b, 0x3e, 0x05, 0xc9, 0xed, 0xec, 0xbf, 0x2b, 0x00,
+    0x2c, 0x1e, 0x1a, 0xef, 0x10, 0xc5, 0x0e, 0x19, 0x01, 0x2a, 0x0e, 0x00, 0xc8, 0xd3, 0x04, 0x24,
+    0x0a, 0xfc, 0x13, 0x07, 0xf5, 0xec, 0x18, 0xff, 0xfd, 0x02, 0x0f, 0xbb, 0x16, 0xf8, 0x15, 0xd6,
+    0x17, 0xc5, 0x1a, 0x0f, 0xfe, 0xe0, 0x0f, 0x00, 0x09, 0x07, 0x2a, 0x0f, 0xf1, 0xe8, 0x26, 0x1f,
+    0xf5, 0x1f, 0x91, 0x1c, 0x0f, 0xed, 0xd1, 0xd3, 0x02, 0x07, 0x05, 0x0b, 0x12, 0x08, 0xeb, 0x14,
+    0xfc, 0xfa, 0x14, 0xdc, 0xe0, 0xfd, 0x0a, 0x17, 0xd3, 0xb7, 0x2b, 0x01, 0x2b, 0x00, 0x1e, 0xb9,
+    0x20, 0xe9, 0xdd, 0x05, 0x0d, 0x15, 0x03, 0x15, 0x25, 0x1e, 0x01, 0xe6, 0x23, 0x1a, 0x1c, 0x0d,
+    0xfb, 0x12, 0x0d, 0xa5, 0x21, 0xe9, 0xec, 0xf6, 0x18, 0x1f, 0xf2, 0xfb, 0xf6, 0x0d, 0x0e, 0x49,
+    0x14, 0xed, 0xf3, 0x10, 0xee, 0x11, 0xe9, 0xd9, 0x14, 0xef, 0xf3, 0x2a, 0x91, 0x00, 0x06, 0xe5,
+    0x11, 0x1b, 0x14, 0xd9, 0x3a, 0xf0, 0x20, 0x0d, 0x06, 0xee, 0x14, 0xe1, 0x04, 0x12, 0xfd, 0xcf,
+    0x18, 0xe2, 0xde, 0xf3, 0x16, 0x2a, 0x06, 0xf8, 0x16, 0xfb, 0xf1, 0xfa, 0x34, 0xfd, 0xf6, 0x05,
+    0xf1, 0x14, 0x03, 0xb3, 0xfd, 0x1f, 0x1c, 0xfe, 0x28, 0x06, 0xef, 0x01, 0xe3, 0xf5, 0xde, 0xe2,
+    0x07, 0x03, 0x14, 0x2c, 0x24, 0xe5, 0x48, 0xef, 0xec, 0xe2, 0xf3, 0x38, 0xd6, 0x0a, 0x20, 0xdf,
+    0x21, 0x03, 0xef, 0x09, 0x28, 0xff, 0x00, 0xf1, 0xf6, 0xf3, 0xe8, 0x28, 0x1b, 0x1c, 0xe0, 0xe9,
+    0x0d, 0x21, 0xfd, 0x00, 0xc0, 0x35, 0xd0, 0xd3, 0x2d, 0xe4, 0xf8, 0x01, 0xde, 0x1c, 0xf7, 0x04,
+    0x07, 0xc7, 0x2a, 0xcb, 0x16, 0xc9, 0x23, 0x19, 0xf5, 0xdd, 0x11, 0xce, 0xde, 0x16, 0x41, 0x1b,
+    0x0b, 0xe7, 0xe8, 0xf2, 0xeb, 0x19, 0x4b, 0x3e, 0xfa, 0x0c, 0x1a, 0x18, 0x37, 0xf9, 0x2b, 0x03,
+    0xe5, 0xd8, 0xff, 0x2a, 0x2b, 0xf2, 0xe5, 0xf4, 0x19, 0xf6, 0x1e, 0xd3, 0x29, 0x0e, 0x0c, 0xd6,
+    0x1b, 0xd6, 0xe8, 0x09, 0x11, 0xef, 0xfe, 0x2d, 0xea, 0x05, 0x17, 0xf5, 0xf0, 0xc2, 0xec, 0x23,
+    0x1d, 0x42, 0xdb, 0x08, 0x01, 0x45, 0xf7, 0xd6, 0x12, 0x07, 0xc6, 0x31, 0xfa, 0xe4, 0xef, 0xea,
+    0x2a, 0xf1, 0x3c, 0xda, 0xdc, 0x03, 0x03, 0x0e, 0x1e, 0xf5, 0x05, 0xc7, 0x03, 0x0e, 0x1c, 0x03,
+    0x0e, 0x0a, 0xf8, 0x14, 0x2e, 0x25, 0xe5, 0x03, 0x1b, 0x08, 0x00, 0xe3, 0x06, 0xf5, 0x0f, 0x1b,
+    0xda, 0x0e, 0xdb, 0x13, 0x07, 0x49, 0x2d, 0xc2, 0x3a, 0x09, 0xf6, 0x25, 0xfb, 0xfa, 0xe0, 0xd9,
+    0xf1, 0x08, 0xda, 0xf6, 0xfd, 0x06, 0xf0, 0xce, 0xde, 0xfa, 0x13, 0x13, 0x0a, 0xfb, 0xe5, 0xee,
+    0x20, 0x23, 0x0c, 0x9d, 0x11, 0xf3, 0x1a, 0x38, 0x16, 0x09, 0xd8, 0xf5, 0x1d, 0x11, 0xfb, 0x23,
+    0x13, 0x11, 0xf0, 0x0c, 0xf8, 0xed, 0xef, 0x04, 0x0c, 0x0c, 0xcf, 0x0c, 0xcb, 0xda, 0xc8, 0xcf,
+    0xd5, 0x1a, 0xf3, 0x2d, 0xd0, 0x1f, 0x17, 0xc4, 0xef, 0x29, 0x1e, 0xe4, 0x16, 0x56, 0x1a, 0xda,
+    0xff, 0x0b, 0x1c, 0xdb, 0x36, 0x07, 0xbb, 0x08, 0x2f, 0xfe, 0x0b, 0xe4, 0xee, 0x01, 0x3d, 0x0c,
+    0xef, 0xe1, 0x1b, 0xeb, 0x1b, 0xeb, 0xca, 0xe7, 0x15, 0xce, 0x1e, 0x39, 0xce, 0xfe, 0x1c, 0xf5,
+    0xd6, 0xd9, 0xfd, 0xd8, 0x3a, 0x2c, 0xd5, 0x30, 0x22, 0xf6, 0xf1, 0xf2, 0xe8, 0x3b, 0xe8, 0x21,
+    0x2a, 0xfb, 0x02, 0xd1, 0xdd, 0x0b, 0x18, 0xfc, 0xf3, 0x36, 0xfb, 0xfe, 0x2c, 0xfb, 0x1e, 0x37,
+    0xf0, 0xf0, 0x11, 0xab, 0xef, 0x46, 0x10, 0xfe, 0xd8, 0xfd, 0xfa, 0xe9, 0xea, 0xf9, 0x28, 0xff,
+    0x31, 0x09, 0xf6, 0x07, 0xee, 0xfd, 0x49, 0x03, 0xec, 0xff, 0x02, 0x14, 0x01, 0xfd, 0xed, 0x07,
+    0xf0, 0x08, 0xfc, 0x20, 0x24, 0xee, 0x10, 0x09, 0xe5, 0xb9, 0x13, 0x05, 0xf3, 0x0f, 0xdf, 0xc1,
+    0x00, 0x17, 0x22, 0x16, 0x3a, 0x00, 0x1f, 0xe0, 0x31, 0x05, 0xc3, 0x11, 0x36, 0x12, 0xd9, 0xd0,
+    0xff, 0x1c, 0xf3, 0xca, 0xe9, 0x1c, 0xd7, 0x22, 0x0d, 0xf4, 0x12, 0xf9, 0x0c, 0xf6, 0xe8, 0x08,
+    0x10, 0x1e, 0x32, 0x40, 0x1b, 0xed, 0xd4, 0xdb, 0xe4, 0x19, 0x1a, 0xea, 0xa9, 0x12, 0x17, 0xfe,
+    0x04, 0xd3, 0x03, 0x02, 0x20, 0xdd, 0x10, 0x2c, 0x40, 0xd7, 0xd2, 0x0e, 0xeb, 0xd4, 0xec, 0xc6,
+    0xdb, 0x19, 0xe1, 0xd9, 0x09, 0xfb, 0x10, 0xe0, 0xf3, 0xa9, 0x15, 0x13, 0x2c, 0x07, 0xee, 0xc9,
+    0xe5, 0xe4, 0x0e, 0x3c, 0x10, 0x15, 0x1d, 0x0a, 0x17, 0xf1, 0x10, 0xf6, 0xfe, 0x0b, 0x3b, 0x08,
+    0x0b, 0xf7, 0xd0, 0xdc, 0x0a, 0x09, 0xde, 0x01, 0xdc, 0x0f, 0xde, 0x14, 0x43, 0xf5, 0x20, 0x21,
+    0x03, 0x03, 0xf8, 0x1d, 0x11, 0x09, 0x0d, 0xef, 0x07, 0x19, 0x15, 0x15, 0x29, 0x1a, 0x26, 0xfa,
+    0xe7, 0x24, 0xb5, 0x02, 0x0e, 0x10, 0xe1, 0xf5, 0x1c, 0x16, 0xdc, 0x32, 0x13, 0x82, 0x19, 0x35,
+    0x05, 0x0f, 0xe3, 0x08, 0xe6, 0xf7, 0x1a, 0xe9, 0xdb, 0xe2, 0x12, 0x34, 0x2b, 0x24, 0x0a, 0x20,
+    0xfc, 0x11, 0xe4, 0x2d, 0xee, 0x3d, 0x1b, 0x1d, 0x18, 0x14, 0x02, 0xf9, 0xec, 0x0d, 0x00, 0xf5,
+    0xfb, 0xf3, 0xd5, 0xfa, 0x26, 0xee, 0x09, 0x00, 0xfb, 0x2f, 0x0b, 0xec, 0xd6, 0xd3, 0xde, 0xe5,
+    0xd3, 0x23, 0x50, 0xf6, 0x37, 0xed, 0xfe, 0xfc, 0x22, 0xe4, 0x08, 0xfa, 0xe4, 0x4d, 0x11, 0x08,
+    0xf0, 0x01, 0x0d, 0x30, 0x12, 0xfa, 0xd5, 0xe1, 0x04, 0x38, 0x1e, 0xf5, 0x41, 0x12, 0xf8, 0x1f,
+    0xbc, 0x0f, 0xe0, 0x6b, 0x02, 0x06, 0xbf, 0xe5, 0x3a, 0xef, 0xf0, 0x0f, 0xf0, 0xf2, 0x13, 0x0d,
+    0x09, 0x08, 0x03, 0x04, 0xe2, 0xe3, 0x37, 0xec, 0xe3, 0x1b, 0xe8, 0x1f, 0xe4, 0x0a, 0xf2, 0x0d,
+    0x1a, 0x0c, 0x40, 0xf1, 0xd3, 0xe1, 0x16, 0x17, 0xfc, 0x2c, 0xf4, 0xf5, 0x21, 0xec, 0x09, 0xec,
+    0x11, 0xf0, 0x11, 0x06, 0x06, 0x2c, 0xfa, 0x22, 0x28, 0x08, 0x01, 0x05, 0xdf, 0xfb, 0x1b, 0xe2,
+    0x2e, 0xeb, 0x1e, 0xbf, 0xf3, 0x15, 0x08, 0xfd, 0xda, 0xed, 0x2a, 0xfe, 0xf9, 0x28, 0xf4, 0x12,
+    0xef, 0x15, 0x1a, 0xed, 0x05, 0x35, 0xf4, 0x13, 0x0e, 0xb4, 0xe8, 0xd9, 0x15, 0x0b, 0x17, 0xcf,
+    0x22, 0x19, 0xc2, 0x09, 0x22, 0x01, 0xf3, 0x05, 0xd0, 0x0e, 0x14, 0xd1, 0x20, 0x27, 0xf1, 0x24,
+    0x01, 0x06, 0x0d, 0x13, 0x06, 0xfe, 0xf2, 0xf2, 0x26, 0x1d, 0xfe, 0x0f, 0x00, 0x03, 0xe0, 0xf9,
+    0x12, 0xe0, 0xfb, 0xf8, 0xd4, 0x1d, 0x23, 0xf5, 0x18, 0xe2, 0x06, 0x2b, 0x14, 0x0d, 0xea, 0x04,
+    0xf5, 0x1f, 0x1a, 0xef, 0x10, 0x2b, 0x19, 0xff, 0xfa, 0xfa, 0x18, 0x18, 0x39, 0x05, 0x19, 0x33,
+    0x3e, 0xf1, 0xe2, 0xef, 0x0c, 0xd8, 0x06, 0x19, 0xd1, 0x2a, 0xf4, 0xfa, 0x32, 0xeb, 0xe7, 0x3a,
+    0x12, 0x12, 0xf1, 0x43, 0x0e, 0x24, 0x35, 0xe2, 0x1c, 0xe0, 0x97, 0x06, 0xf8, 0xf2, 0x1b, 0xf7,
+    0x0d, 0xfc, 0x3f, 0x3e, 0xfd, 0xf3, 0x7f, 0x08, 0xc0, 0x00, 0xc2, 0x3f, 0x38, 0x1f, 0xee, 0xf9,
+    0x2a, 0xc3, 0xf4, 0xea, 0x12, 0x13, 0xe3, 0x17, 0x03, 0x14, 0xf3, 0x09, 0x12, 0xd9, 0xef, 0x3d,
+    0xf4, 0xf8, 0x2b, 0xf2, 0xe3, 0x09, 0x37, 0x05, 0x15, 0x04, 0x00, 0xcc, 0x35, 0xee, 0x1d, 0xf9,
+    0x05, 0x02, 0x1d, 0xa6, 0x12, 0x21, 0x24, 0x1e, 0xf7, 0x1f, 0x08, 0xfe, 0x03, 0xe5, 0x28, 0x1f,
+    0x31, 0x0c, 0xc8, 0x19, 0xee, 0x07, 0x08, 0xd7, 0xd2, 0xfa, 0xe3, 0x30, 0xf4, 0x10, 0xf3, 0x13,
+    0xfa, 0x35, 0xfb, 0x18, 0x21, 0x04, 0x1b, 0x0f, 0xf4, 0xc8, 0x3e, 0xdd, 0x0e, 0x1b, 0x05, 0xc9,
+    0x17, 0xe5, 0xf9, 0x06, 0x30, 0xec, 0x17, 0xfa, 0x20, 0xfb, 0xfe, 0xbd, 0x05, 0xf7, 0x16, 0xef,
+    0xde, 0x0f, 0xee, 0xf0, 0xf8, 0x01, 0x2c, 0x0a, 0x05, 0xdc, 0x1b, 0x06, 0x2d, 0xb7, 0x04, 0x27,
+    0xe0, 0xec, 0x2f, 0x57, 0x2d, 0x04, 0x2a, 0x15, 0x32, 0xff, 0xd6, 0x26, 0xd2, 0xf7, 0x1e, 0x1e,
+    0xd0, 0x0b, 0xd7, 0x1c, 0x0c, 0xda, 0x21, 0xe1, 0xc0, 0x09, 0x2f, 0x0c, 0xed, 0xeb, 0x16, 0x34,
+    0x28, 0xb7, 0x6e, 0x0c, 0x0d, 0xcd, 0xc5, 0x05, 0xeb, 0x3d, 0x27, 0xe0, 0xd5, 0x10, 0xd0, 0x0e,
+    0x1f, 0xe9, 0xf1, 0x11, 0xe3, 0x3c, 0x16, 0x24, 0xde, 0xff, 0xc9, 0xe3, 0x0b, 0x00, 0x24, 0xa2,
+    0x20, 0x29, 0x39, 0xd5, 0xe5, 0xdb, 0x28, 0xf7, 0xd5, 0x04, 0xed, 0xe5, 0x33, 0x36, 0xf6, 0x0d,
+    0xf5, 0xef, 0x4a, 0xcb, 0xf8, 0x05, 0xd1, 0xf2, 0xec, 0x21, 0x9d, 0xf1, 0x36, 0x1d, 0xde, 0x22,
+    0xd7, 0x0d, 0xcb, 0x0e, 0x2c, 0xbd, 0xf0, 0xf0, 0xd1, 0xc1, 0x14, 0x18, 0xd3, 0x35, 0x00, 0xf4,
+    0x0a, 0x0d, 0xf1, 0x3a, 0xf7, 0xe6, 0xd5, 0xf1, 0xc9, 0x25, 0x06, 0x1d, 0x20, 0x25, 0xeb, 0xfd,
+    0xe1, 0xf1, 0x32, 0x16, 0x2b, 0x3e, 0xd2, 0xda, 0x17, 0x2a, 0x04, 0xe0, 0x13, 0xed, 0xe2, 0xeb,
+    0x11, 0x04, 0x3c, 0xec, 0xe8, 0x0b, 0xeb, 0xbf, 0x14, 0xcb, 0xe8, 0x05, 0xf3, 0x1e, 0x30, 0x55,
+    0x26, 0x28, 0x0a, 0xf0, 0xd9, 0xf0, 0xfe, 0xfe, 0x13, 0x35, 0x10, 0x19, 0xfb, 0xad, 0x1d, 0xfc,
+    0xff, 0xec, 0x01, 0xd2, 0xfd, 0x23, 0xf3, 0xd7, 0xcb, 0xe8, 0x25, 0xfc, 0xe3, 0x21, 0xcf, 0xd5,
+    0x3b, 0x06, 0x32, 0x2e, 0x02, 0x11, 0x0b, 0x04, 0xb2, 0xfe, 0x2d, 0x20, 0xe5, 0xff, 0xec, 0x24,
+    0x03, 0x07, 0xee, 0xee, 0x28, 0x07, 0xf6, 0x1d, 0xd7, 0xbf, 0xd2, 0xea, 0xf5, 0x26, 0xf0, 0xdc,
+    0x1f, 0x2f, 0xe4, 0x11, 0xd9, 0x17, 0xfd, 0xe0, 0x4a, 0x09, 0xf7, 0x40, 0xf7, 0xdd, 0x3a, 0xee,
+    0x14, 0xff, 0xf7, 0xe6, 0x1d, 0xce, 0x0c, 0x0e, 0xff, 0xdc, 0xd4, 0xd9, 0x00, 0x1d, 0xf9, 0x27,
+    0x10, 0xee, 0x2e, 0x12, 0xff, 0xff, 0xf4, 0x1d, 0x04, 0x0c, 0x02, 0x08, 0xf8, 0x1f, 0x3c, 0xf1,
+    0xfb, 0xfd, 0xe9, 0x01, 0xf9, 0xd8, 0xfe, 0x00, 0x32, 0xf6, 0xd9, 0x1c, 0xf9, 0x1b, 0xff, 0x9f,
+    0x0d, 0x0b, 0xf2, 0x11, 0x59, 0xce, 0xf9, 0x0f, 0x19, 0xfc, 0xfb, 0x22, 0x01, 0x29, 0x0d, 0x1d,
+    0xe3, 0x29, 0x1c, 0x4f, 0x1d, 0xde, 0x1a, 0xf6, 0x04, 0x21, 0x0e, 0xfc, 0x20, 0x0f, 0xd5, 0xf6,
+    0xbb, 0x10, 0x0a, 0x3f, 0x01, 0x4a, 0xb1, 0xd3, 0x1e, 0xf0, 0x15, 0xfe, 0x46, 0xf8, 0xc3, 0xda,
+    0x24, 0xf1, 0xdf, 0x12, 0x07, 0xfd, 0x0e, 0xca, 0xdd, 0x2f, 0x40, 0x15, 0x13, 0x2a, 0xf5, 0x50,
+    0x08, 0x0c, 0xfd, 0xfd, 0x25, 0x09, 0x0a, 0xfb, 0xdf, 0xd0, 0x25, 0xc1, 0x20, 0x1d, 0x05, 0xbb,
+    0x0e, 0x12, 0xe8, 0x37, 0xbe, 0x14, 0x19, 0x0d, 0x0c, 0x06, 0x14, 0x20, 0x25, 0xfb, 0xef, 0x10,
+    0x24, 0xda, 0xc4, 0x51, 0x3e, 0xd4, 0x08, 0xdd, 0xe8, 0xde, 0xde, 0x3a, 0x2c, 0x0f, 0x1a, 0x20,
+    0xe9, 0xd7, 0xf7, 0x2e, 0xe5, 0xe8, 0xf8, 0xd7, 0x9f, 0xfd, 0x1c, 0x38, 0x1a, 0xe8, 0x32, 0xda,
+    0x28, 0xee, 0x6b, 0xfc, 0x24, 0x15, 0x09, 0xe5, 0x08, 0xfb, 0x0c, 0xf4, 0x1f, 0x1e, 0xdb, 0xfe,
+    0xf3, 0x20, 0x2a, 0x9b, 0x24, 0xed, 0xe5, 0x31, 0x1e, 0x26, 0xed, 0xfe, 0xd3, 0xdf, 0x0f, 0x08,
+    0x18, 0xf7, 0x16, 0x20, 0xfe, 0xda, 0x2c, 0x04, 0x0c, 0x11, 0x20, 0x11, 0xd3, 0x1a, 0x1c, 0xe1,
+    0xf0, 0x0d, 0x21, 0xde, 0xf8, 0x01, 0xf7, 0x09, 0x2d, 0x05, 0x09, 0x25, 0xd3, 0x1b, 0xe4, 0xd4,
+    0x1a, 0xf3, 0x1e, 0x14, 0x11, 0x02, 0xe4, 0x1e, 0xd2, 0x11, 0xa8, 0x25, 0xbb, 0xfa, 0xee, 0xd9,
+    0xfd, 0x04, 0x27, 0x27, 0x19, 0x1c, 0xd2, 0xd5, 0xac, 0x1d, 0xf1, 0x13, 0xf6, 0xee, 0xd7, 0xfa,
+    0xfd, 0xe5, 0xc3, 0xfd, 0x13, 0x0d, 0x01, 0xbe, 0xf5, 0xe4, 0x31, 0x01, 0x4b, 0xcd, 0x0b, 0xfc,
+    0x0e, 0x01, 0x1b, 0x27, 0x0e, 0x06, 0x05, 0x18, 0x0d, 0xa0, 0xe7, 0xd4, 0xe7, 0x1c, 0x2a, 0xfd,
+    0x2e, 0x07, 0xb5, 0xfc, 0xf2, 0x00, 0x14, 0xed, 0xf6, 0xbd, 0xff, 0x26, 0xfb, 0x25, 0xf5, 0xe3,
+    0xdd, 0xf1, 0xff, 0x45, 0x30, 0x0c, 0xee, 0xfe, 0x04, 0x09, 0x07, 0x04, 0xe9, 0x0c, 0x1d, 0x20,
+    0xf3, 0xe7, 0xe9, 0xe2, 0xea, 0x09, 0xd0, 0x1f, 0x0a, 0x27, 0x06, 0xfe, 0x50, 0x05, 0x30, 0x08,
+    0xf7, 0x1e, 0x21, 0x25, 0x07, 0x2f, 0xfc, 0xf3, 0x1b, 0xfe, 0xf2, 0x0f, 0x13, 0x2f, 0x15, 0x10,
+    0x19, 0x2c, 0xa0, 0x2c, 0xc6, 0xfa, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x81, 0xfe, 0xff, 0xff, 0x9e, 0x04, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+    0xb1, 0x01, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xc2, 0x01, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+    0x0a, 0x05, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x42, 0x01, 0x00, 0x00,
+    0x40, 0x01, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xed, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00,
+    0x3b, 0x01, 0x00, 0x00, 0xc8, 0xff, 0xff, 0xff, 0xe6, 0xfc, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xff,
+    0x76, 0xfe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xff, 0x97, 0xfe, 0xff, 0xff, 0x9f, 0x01, 0x00, 0x00,
+    0x50, 0x01, 0x00, 0x00, 0x49, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xe7, 0x02, 0x00, 0x00,
+    0x0e, 0x03, 0x00, 0x00, 0x49, 0xfe, 0xff, 0xff, 0x19, 0x02, 0x00, 0x00, 0x1d, 0xfe, 0xff, 0xff,
+    0x11, 0xfe, 0xff, 0xff, 0xbb, 0x03, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff,
+    0xc3, 0xff, 0xff, 0xff, 0x37, 0xfd, 0xff, 0xff, 0x2c, 0xfe, 0xff, 0xff, 0x0f, 0xfe, 0xff, 0xff,
+    0x7e, 0x01, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00,
+    0x2d, 0xff, 0xff, 0xff, 0x20, 0x04, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00,
+    0xa2, 0x02, 0x00, 0x00, 0xac, 0xfc, 0xff, 0xff, 0xa1, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff,
+    0x38, 0x04, 0x00, 0x00, 0xc5, 0xff, 0xff, 0xff, 0x8f, 0xfe, 0xff, 0xff, 0x39, 0x01, 0x00, 0x00,
+    0x2c, 0x02, 0x00, 0x00, 0x5f, 0xfe, 0xff, 0xff, 0xf7, 0x01, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00,
+    0xf5, 0xfb, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x52, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00,
+    0xd2, 0xfb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x07, 0x03, 0xf3, 0xf6,
+    0xca, 0x16, 0xf5, 0xf1, 0x04, 0xdb, 0x1e, 0xae, 0x37, 0x20, 0x0c, 0xfe, 0xed, 0x19, 0x2c, 0x17,
+    0x11, 0x10, 0x23, 0xfd, 0xca, 0x1f, 0x17, 0xed, 0x00, 0xec, 0xd8, 0xe3, 0x21, 0xeb, 0xcc, 0xf3,
+    0x09, 0x03, 0xe9, 0x17, 0xec, 0xc3, 0xc5, 0x0b, 0x64, 0xf4, 0x43, 0xf7, 0xd6, 0xff, 0x02, 0xe3,
+    0xad, 0x07, 0x13, 0x06, 0x08, 0xf5, 0x1d, 0xce, 0x03, 0x15, 0xc5, 0xfb, 0x05, 0x20, 0xf3, 0xf7,
+    0xd8, 0x30, 0xe9, 0x02, 0xe4, 0x1e, 0xff, 0xfa, 0x18, 0xcf, 0x07, 0xc6, 0x01, 0x01, 0x30, 0x15,
+    0xee, 0xe2, 0x21, 0xca, 0x06, 0x19, 0xdd, 0xfc, 0xeb, 0xfb, 0x06, 0x25, 0x19, 0xcf, 0x18, 0x0a,
+    0xef, 0x2a, 0x31, 0x16, 0xeb, 0xaa, 0xf4, 0xed, 0x2e, 0x19, 0xde, 0xc7, 0x28, 0x3e, 0x18, 0x08,
+    0x28, 0x1d, 0x30, 0xf5, 0xad, 0x24, 0xc4, 0xfd, 0x11, 0xc1, 0xae, 0xcb, 0x2b, 0xd7, 0xd1, 0xed,
+    0xfe, 0x26, 0xe0, 0x2b, 0xf2, 0x23, 0xe7, 0xfc, 0xa8, 0x02, 0x0a, 0xff, 0x05, 0xe1, 0xb5, 0x03,
+    0x07, 0xed, 0x07, 0x4a, 0x1a, 0x3e, 0x17, 0xf6, 0x05, 0x22, 0xfd, 0xdf, 0x1e, 0xf8, 0xbe, 0x07,
+    0xe8, 0xfc, 0x04, 0x25, 0xe8, 0x29, 0xe1, 0x10, 0x44, 0x0f, 0xf3, 0x26, 0x2a, 0xc8, 0x17, 0xfe,
+    0xbb, 0x17, 0xc5, 0x8a, 0xb9, 0x20, 0x20, 0xab, 0xd5, 0xf5, 0xc6, 0x1f, 0xf9, 0x00, 0xec, 0x19,
+    0x11, 0x91, 0xe2, 0x05, 0xf5, 0xb8, 0x11, 0x32, 0xd0, 0xa9, 0xf7, 0xf6, 0x0e, 0x1c, 0x08, 0xc3,
+    0x0a, 0x13, 0x18, 0x1d, 0xef, 0xf4, 0x05, 0xe2, 0x0e, 0x1b, 0xd4, 0x1b, 0xe9, 0xfe, 0x18, 0xfa,
+    0x16, 0xb9, 0x25, 0xdc, 0xf5, 0x00, 0xbb, 0x0a, 0xd0, 0x09, 0xdc, 0x28, 0xe9, 0x25, 0xfb, 0x00,
+    0x01, 0x1a, 0xed, 0xb0, 0x02, 0x0a, 0xf1, 0x28, 0x32, 0xea, 0x34, 0x0a, 0x23, 0xf1, 0x1e, 0xe1,
+    0xf8, 0xca, 0x29, 0x22, 0x1c, 0x10, 0xd1, 0xdb, 0x08, 0xd4, 0xe7, 0xd2, 0x2a, 0xb9, 0x1d, 0x0c,
+    0x02, 0xd7, 0xbd, 0xac, 0x16, 0xd9, 0xcc, 0xfb, 0xf1, 0xeb, 0x1d, 0xf2, 0x06, 0xe9, 0x10, 0xed,
+    0xf7, 0x28, 0xf1, 0xe0, 0xe0, 0x40, 0x15, 0x1c, 0xdf, 0xf3, 0xba, 0x16, 0x31, 0x0c, 0xc1, 0xe2,
+    0x07, 0xee, 0xdd, 0xe0, 0x07, 0xb6, 0x1b, 0x2c, 0xdd, 0xc6, 0xda, 0x0f, 0xc4, 0x9d, 0x11, 0x97,
+    0x2d, 0xfc, 0x0e, 0xa8, 0xf2, 0x10, 0x2c, 0x17, 0xd4, 0xfb, 0xff, 0x0c, 0xf1, 0xec, 0xbf, 0x30,
+    0xe6, 0x1a, 0xc1, 0xb0, 0xf8, 0xdc, 0xfe, 0xed, 0x1a, 0xf9, 0x31, 0xf7, 0xc5, 0x2a, 0xfc, 0xb1,
+    0xfa, 0x27, 0xef, 0x05, 0x07, 0xe8, 0x29, 0x08, 0xf4, 0x00, 0xef, 0xed, 0xc4, 0xd1, 0x01, 0x11,
+    0x26, 0x00, 0x5a, 0x67, 0x28, 0xcf, 0xda, 0xed, 0x3b, 0x12, 0x3e, 0xea, 0x1f, 0x2a, 0xf8, 0xf1,
+    0xf1, 0xf8, 0x1b, 0xe9, 0x19, 0x01, 0xe1, 0x1a, 0x17, 0x45, 0x21, 0xec, 0xb2, 0x12, 0x16, 0x25,
+    0x19, 0xe1, 0x06, 0xf8, 0xb5, 0xad, 0xe4, 0x0f, 0x0f, 0x83, 0xd3, 0xf1, 0xe6, 0xe8, 0x0a, 0xdc,
+    0xd5, 0xd2, 0xc6, 0xb0, 0x1d, 0x20, 0xea, 0x19, 0xc2, 0x0c, 0x27, 0xd8, 0x20, 0xf8, 0x05, 0xc2,
+    0x2d, 0xeb, 0x20, 0x27, 0x10, 0x2d, 0x26, 0xc7, 0x2d, 0x0b, 0xff, 0xc3, 0x11, 0x38, 0xd0, 0x17,
+    0x17, 0x1d, 0xad, 0x25, 0x04, 0x1f, 0xfe, 0x20, 0xe5, 0x31, 0xb4, 0xf3, 0x06, 0xf1, 0x0a, 0x27,
+    0x29, 0xe6, 0xcf, 0xf5, 0x12, 0x22, 0x07, 0xe5, 0x81, 0xea, 0xf0, 0xf7, 0xe5, 0xfb, 0x0f, 0xfe,
+    0x06, 0x1a, 0xea, 0x15, 0x12, 0x35, 0xf0, 0x8f, 0x0b, 0xc2, 0x1c, 0x18, 0xec, 0x1c, 0xdd, 0x18,
+    0x03, 0xf0, 0xe0, 0xb8, 0x19, 0xf0, 0x0d, 0x21, 0x4b, 0x1c, 0xcb, 0x17, 0xc0, 0xf8, 0x0f, 0x1f,
+    0xf3, 0xf8, 0xef, 0xe9, 0x1c, 0xbf, 0xc1, 0x05, 0x15, 0xc7, 0x12, 0x0d, 0xff, 0xe5, 0xba, 0xca,
+    0xc0, 0xf9, 0xe1, 0x17, 0xe7, 0xfe, 0x3b, 0x26, 0x0b, 0xf8, 0xf6, 0xc8, 0x13, 0x0c, 0x19, 0x1c,
+    0x1a, 0xc1, 0xe8, 0x18, 0x1c, 0xc2, 0x1e, 0x0d, 0xcb, 0x09, 0x20, 0x09, 0xf0, 0xc5, 0x14, 0x03,
+    0xf4, 0x20, 0xdd, 0xec, 0xba, 0x14, 0x08, 0x0c, 0xb9, 0x0a, 0xed, 0x10, 0xd4, 0xe9, 0x03, 0x17,
+    0xe5, 0x10, 0x25, 0xe4, 0x1f, 0x0b, 0xf2, 0xbb, 0x1b, 0x0e, 0xce, 0x13, 0x0b, 0x19, 0x07, 0xde,
+    0x0f, 0x0e, 0x5b, 0xf1, 0x11, 0xb4, 0xb8, 0x0c, 0x1a, 0x26, 0xf9, 0x31, 0xfe, 0x08, 0x06, 0x18,
+    0x07, 0xdf, 0xe3, 0xdb, 0xc1, 0x05, 0x21, 0x0e, 0xee, 0xdb, 0xbd, 0xe0, 0xdd, 0x06, 0x0f, 0x0c,
+    0xd2, 0xc0, 0xcb, 0x11, 0x33, 0x06, 0xe5, 0x13, 0xa1, 0xea, 0x4e, 0x0d, 0x5e, 0xfe, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x73, 0xfe, 0xff, 0xff, 0xaa, 0xfe, 0xff, 0xff,
+    0x59, 0x00, 0x00, 0x00, 0xa5, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+    0x66, 0x00, 0x00, 0x00, 0xab, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x9e, 0xff, 0xff, 0xff,
+    0x92, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x00, 0x00, 0x00, 0xf0, 0xf6, 0xff, 0xff, 0xf4, 0xf6, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+    0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x6c, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xff, 0xff,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xb0, 0xf7, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x62, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x14, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0xff, 0xcd, 0xcc, 0xcc, 0x3d,
+    0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x92, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b,
+    0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xcd, 0xcc, 0xcc, 0x3d, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x90, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x60, 0x07, 0x00, 0x00, 0xf4, 0x06, 0x00, 0x00, 0x5c, 0x06, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00,
+    0x6c, 0x05, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x7c, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
+    0x84, 0x03, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+    0x24, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0xd4, 0xf8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
+    0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
+    0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x6a, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00,
+    0x4c, 0xf9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x4b, 0xcf, 0xe8, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38, 0x2f, 0x4d,
+    0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
+    0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38, 0x2f, 0x42, 0x69, 0x61,
+    0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x0a, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+    0xec, 0xf9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xf7, 0x1c, 0x7e, 0x3d, 0x25, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x6c, 0x65, 0x61, 0x6b, 0x79, 0x5f, 0x72, 0x65, 0x5f, 0x6c,
+    0x75, 0x5f, 0x37, 0x2f, 0x4c, 0x65, 0x61, 0x6b, 0x79, 0x52, 0x65, 0x6c, 0x75, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x92, 0xfa, 0xff, 0xff,
     0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x4c, 0xf9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4b, 0xcf, 0xe8, 0x3e, 0x3c, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x74, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xca, 0x5d, 0xee, 0x3d, 0x3c, 0x00, 0x00, 0x00,
     0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65,
-    0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65,
+    0x6e, 0x73, 0x65, 0x5f, 0x33, 0x37, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65,
     0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73,
-    0x65, 0x5f, 0x33, 0x38, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0xfa, 0xff, 0xff,
+    0x65, 0x5f, 0x33, 0x37, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x32, 0xfb, 0xff, 0xff,
     0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0xec, 0xf9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf7, 0x1c, 0x7e, 0x3d, 0x25, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x14, 0xfb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xad, 0x26, 0xd5, 0x3c, 0x25, 0x00, 0x00, 0x00,
     0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x6c, 0x65,
-    0x61, 0x6b, 0x79, 0x5f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x37, 0x2f, 0x4c, 0x65, 0x61, 0x6b,
+    0x61, 0x6b, 0x79, 0x5f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x36, 0x2f, 0x4c, 0x65, 0x61, 0x6b,
     0x79, 0x52, 0x65, 0x6c, 0x75, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x92, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x40, 0x00, 0x00, 0x00, 0xba, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
     0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
-    0x74, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xca, 0x5d, 0xee, 0x3d, 0x3c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x37, 0x2f, 0x4d,
+    0x9c, 0xfb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xc7, 0x25, 0x63, 0x3d, 0x3c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x36, 0x2f, 0x4d,
     0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
-    0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x37, 0x2f, 0x42, 0x69, 0x61,
+    0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x36, 0x2f, 0x42, 0x69, 0x61,
     0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x32, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
-    0x14, 0xfb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xad, 0x26, 0xd5, 0x3c, 0x25, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x6c, 0x65, 0x61, 0x6b, 0x79, 0x5f, 0x72, 0x65, 0x5f, 0x6c,
-    0x75, 0x5f, 0x36, 0x2f, 0x4c, 0x65, 0x61, 0x6b, 0x79, 0x52, 0x65, 0x6c, 0x75, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xba, 0xfb, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x9c, 0xfb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc7, 0x25, 0x63, 0x3d, 0x3c, 0x00, 0x00, 0x00,
-    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65,
-    0x6e, 0x73, 0x65, 0x5f, 0x33, 0x36, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65,
-    0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73,
-    0x65, 0x5f, 0x33, 0x36, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x5a, 0xfc, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x3c, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65,
-    0x6e, 0x5f, 0x31, 0x32, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x42, 0xfd, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00, 0xac, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x89, 0x5b, 0x4e, 0x3c, 0x1d, 0x00, 0x00, 0x00,
-    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65,
-    0x6e, 0x73, 0x65, 0x5f, 0x33, 0x36, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xb2, 0xfd, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x1c, 0xfd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0xb5, 0x2a, 0x4f, 0x38, 0x2d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f,
-    0x33, 0x36, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-    0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00,
-    0x94, 0xfd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x5a, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00,
+    0x3c, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b,
+    0x20, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
+    0x32, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x32, 0x2f, 0x52, 0x65, 0x73,
+    0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x42, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00,
+    0xac, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xa8, 0x5a, 0x2b, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x37, 0x2f, 0x4d,
+    0x89, 0x5b, 0x4e, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x36, 0x2f, 0x4d,
     0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x9a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00,
-    0x04, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0xac, 0x8e, 0x39,
+    0x90, 0x00, 0x00, 0x00, 0xb2, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00,
+    0x1c, 0xfd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb5, 0x2a, 0x4f, 0x38,
     0x2d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
-    0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x37, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
+    0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x36, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
     0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-    0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x79, 0xcf, 0x77, 0x3c, 0x1d, 0x00, 0x00, 0x00,
-    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65,
-    0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x5c, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00, 0x94, 0xfd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
     0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0xfb, 0x75, 0x3a, 0x2d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x5a, 0x2b, 0x3c, 0x1d, 0x00, 0x00, 0x00,
     0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65,
-    0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-    0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00,
-    0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x32,
-    0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x18, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x6c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b, 0x22, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
-    0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x66, 0x6c, 0x61, 0x74,
-    0x74, 0x65, 0x6e, 0x5f, 0x31, 0x32, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3a, 0x30, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xd8, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x62, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-    0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16
+    0x6e, 0x73, 0x65, 0x5f, 0x33, 0x37, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x9a, 0xfe, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x51, 0xac, 0x8e, 0x39, 0x2d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f,
+    0x33, 0x37, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
+    0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00,
+    0x7c, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x79, 0xcf, 0x77, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38, 0x2f, 0x4d,
+    0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5c, 0x00, 0x00, 0x00,
+    0xec, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xe4, 0xfb, 0x75, 0x3a, 0x2d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x38, 0x2f, 0x42,
+    0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
+    0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x32, 0x2f, 0x66, 0x6c,
+    0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00,
+    0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x6c, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b,
+    0x22, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6c, 0x74, 0x5f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x32, 0x5f, 0x69,
+    0x6e, 0x70, 0x75, 0x74, 0x3a, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x54, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xe4, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0xd8, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x0c, 0x00, 0x10, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16
 };
 
-const int mnist_model_int8_len = 17768;
+const int mnist_model_int8_len = 18064;
 
 #endif // MNIST_MODEL_DATA_H_
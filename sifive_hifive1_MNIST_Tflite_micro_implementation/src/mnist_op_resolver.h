@@ -0,0 +1,87 @@
+// Generated by tools/model_compiler/op_resolver_gen.py from mnist_model_int8.tflite, do not edit.
+// Ops (min..max version in the model):
+//   FULLY_CONNECTED          v4..v4  Register_FULLY_CONNECTED() / ParseFullyConnected()
+//   RESHAPE                  v1..v1  Register_RESHAPE() / ParseReshape()
+//   SOFTMAX                  v2..v2  Register_SOFTMAX() / ParseSoftmax()
+//   LEAKY_RELU               v1..v1  Register_LEAKY_RELU() / ParseLeakyRelu()
+#ifndef MNIST_OP_RESOLVER_H_
+#define MNIST_OP_RESOLVER_H_
+
+#include <stdint.h>
+
+#include "tensorflow/lite/core/api/flatbuffer_conversions.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace mnist_op_resolver_internal {
+
+constexpr uint8_t kNoSlot = 0xFF;
+// Slot in MnistOpResolver's registrations_ and in kParsers by BuiltinOperator,
+// up to the largest op the model uses.
+constexpr uint8_t kSlots[99] = {
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, 0, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, 1, kNoSlot,
+    kNoSlot, 2, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot, kNoSlot,
+    kNoSlot, kNoSlot, 3,
+};
+constexpr tflite::TfLiteBridgeBuiltinParseFunction kParsers[4] = {
+    tflite::ParseFullyConnected,
+    tflite::ParseReshape,
+    tflite::ParseSoftmax,
+    tflite::ParseLeakyRelu,
+};
+
+}  // namespace mnist_op_resolver_internal
+
+class MnistOpResolver : public tflite::MicroOpResolver {
+ public:
+  MnistOpResolver() {
+    // Register_*() is not constexpr; copy each registration once.
+    registrations_[0] = tflite::Register_FULLY_CONNECTED();
+    registrations_[0].builtin_code = tflite::BuiltinOperator_FULLY_CONNECTED;
+    registrations_[1] = tflite::Register_RESHAPE();
+    registrations_[1].builtin_code = tflite::BuiltinOperator_RESHAPE;
+    registrations_[2] = tflite::Register_SOFTMAX();
+    registrations_[2].builtin_code = tflite::BuiltinOperator_SOFTMAX;
+    registrations_[3] = tflite::Register_LEAKY_RELU();
+    registrations_[3].builtin_code = tflite::BuiltinOperator_LEAKY_RELU;
+  }
+
+  const TFLMRegistration* FindOp(tflite::BuiltinOperator op) const override {
+    const uint8_t slot = Slot(op);
+    return slot == mnist_op_resolver_internal::kNoSlot ? nullptr : &registrations_[slot];
+  }
+
+  const TFLMRegistration* FindOp(const char* op) const override {
+    (void)op;
+    return nullptr;
+  }
+
+  tflite::TfLiteBridgeBuiltinParseFunction GetOpDataParser(
+      tflite::BuiltinOperator op) const override {
+    const uint8_t slot = Slot(op);
+    return slot == mnist_op_resolver_internal::kNoSlot ? nullptr : mnist_op_resolver_internal::kParsers[slot];
+  }
+
+ private:
+  static constexpr int kOpCount = 4;
+
+  static uint8_t Slot(tflite::BuiltinOperator op) {
+    const uint32_t code = static_cast<uint32_t>(op);
+    return code < sizeof(mnist_op_resolver_internal::kSlots) ? mnist_op_resolver_internal::kSlots[code] : mnist_op_resolver_internal::kNoSlot;
+  }
+
+  TFLMRegistration registrations_[kOpCount];
+};
+
+#endif  // MNIST_OP_RESOLVER_H_
@@ -0,0 +1,137 @@
+'''
+    profile_stream.py
+    Author: Shwetank Shekhar
+
+    Decodes the binary profile frames RingMicroProfiler::StreamBinary() sends
+    after each Invoke() (make TFLM_PROFILE=3, see ring_micro_profiler.h for the
+    layout). Text on the same UART is skipped; a frame is only accepted when
+    its Fletcher-16 checks out.
+
+    python src/profile_stream.py --port /dev/ttyACM0          # live, one table per frame
+    python src/profile_stream.py --file capture.bin --last    # saved console output
+'''
+import argparse
+import struct
+import sys
+
+SYNC = b"\xA5\x5A"
+VERSION = 1
+HEADER = struct.Struct("<BH")           # version, payload length
+SUMMARY = struct.Struct("<IIHBB")       # events, ticks_per_second, dropped, n_tags, n_recent
+TAG_STATS = struct.Struct("<IIIQ")      # count, min, max, sum
+RECENT = struct.Struct("<BI")           # tag index, ticks
+NO_TAG = 255
+
+
+def fletcher16(data):
+    sum1 = sum2 = 0
+    for b in data:
+        sum1 = (sum1 + b) % 255
+        sum2 = (sum2 + sum1) % 255
+    return sum1, sum2
+
+
+def parse_payload(payload):
+    events, tps, dropped, n_tags, n_recent = SUMMARY.unpack_from(payload, 0)
+    pos = SUMMARY.size
+    tags = []
+    for _ in range(n_tags):
+        n = payload[pos]
+        name = payload[pos + 1:pos + 1 + n].decode("ascii", "replace")
+        pos += 1 + n
+        count, lo, hi, total = TAG_STATS.unpack_from(payload, pos)
+        pos += TAG_STATS.size
+        tags.append({"tag": name, "count": count, "min": lo, "max": hi, "sum": total})
+    recent = []
+    for _ in range(n_recent):
+        tag, ticks = RECENT.unpack_from(payload, pos)
+        pos += RECENT.size
+        recent.append((tags[tag]["tag"] if tag != NO_TAG else "?", ticks))
+    return {"events": events, "ticks_per_second": tps, "dropped": dropped, "tags": tags, "recent": recent}
+
+
+class FrameDecoder:
+    """Feed raw UART bytes, get back every complete frame with a valid checksum."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.bad = 0
+
+    def feed(self, data):
+        self.buf += data
+        frames = []
+        while True:
+            start = self.buf.find(SYNC)
+            if start < 0:
+                del self.buf[:-1]
+                return frames
+            del self.buf[:start]
+            if len(self.buf) < 2 + HEADER.size:
+                return frames
+            version, length = HEADER.unpack_from(self.buf, 2)
+            end = 2 + HEADER.size + length + 2
+            if version != VERSION:
+                del self.buf[:2]
+                continue
+            if len(self.buf) < end:
+                return frames
+            body = bytes(self.buf[2:end - 2])
+            if fletcher16(body) != tuple(self.buf[end - 2:end]):
+                self.bad += 1
+                del self.buf[:2]
+                continue
+            frames.append(parse_payload(body[HEADER.size:]))
+            del self.buf[:end]
+
+
+def format_frame(frame):
+    tps = frame["ticks_per_second"] or 1
+    lines = [f"events {frame['events']}  dropped {frame['dropped']}  ({tps} ticks/s)",
+             f"{'tag':<20} {'count':>7} {'min':>10} {'mean':>10} {'max':>10} {'mean us':>9}"]
+    for t in frame["tags"]:
+        mean = t["sum"] // t["count"] if t["count"] else 0
+        lines.append(f"{t['tag']:<20} {t['count']:>7} {t['min']:>10} {mean:>10} {t['max']:>10} "
+                     f"{mean * 1e6 / tps:>9.1f}")
+    return "\n".join(lines)
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Decode RingMicroProfiler frames from the HiFive1 UART.")
+    src = ap.add_mutually_exclusive_group(required=True)
+    src.add_argument("--port", help="serial port, e.g. /dev/ttyACM0 or COM3")
+    src.add_argument("--file", help="raw capture of the console output")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--last", action="store_true", help="only print the last frame (--file)")
+    ap.add_argument("--recent", action="store_true", help="also list the events still in the ring")
+    args = ap.parse_args(argv)
+
+    decoder = FrameDecoder()
+
+    def show(frame):
+        print(format_frame(frame))
+        if args.recent:
+            print("recent: " + ", ".join(f"{tag} {ticks}" for tag, ticks in frame["recent"]))
+        print()
+
+    if args.file:
+        with open(args.file, "rb") as f:
+            frames = decoder.feed(f.read())
+        for frame in frames[-1:] if args.last else frames:
+            show(frame)
+        if decoder.bad:
+            print(f"{decoder.bad} frame(s) with a bad checksum skipped", file=sys.stderr)
+        return 0 if frames else 1
+
+    import serial
+    with serial.Serial(args.port, args.baud, timeout=0.2) as ser:
+        try:
+            while True:
+                for frame in decoder.feed(ser.read(256)):
+                    show(frame)
+        except KeyboardInterrupt:
+            pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
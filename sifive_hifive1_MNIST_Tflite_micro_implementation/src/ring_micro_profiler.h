@@ -0,0 +1,227 @@
+// Fixed-size MicroProfilerInterface for the FE310's 16 KB DTIM.
+//
+// tflite::MicroProfiler keeps every event of a run (4096 tags and tick pairs,
+// ~80 KB with its per-tag table), so it cannot be left on. RingMicroProfiler
+// keeps the last kEvents events in a ring, 8 bytes each, and folds every
+// finished event into per-tag count / min / max / sum as it ends, so the
+// statistics cover all runs since Reset() no matter how many events the ring
+// has dropped. RingMicroProfiler<32, 16> takes under 700 bytes.
+//
+// Ticks come from tflite::GetCurrentTimeTicks(), i.e. core cycles with
+// riscv32_generic/micro_time.cc.
+//
+// StreamBinary() writes one little-endian frame that profile_stream.py
+// decodes on the host:
+//
+//   u8  0xA5, 0x5A          sync
+//   u8  version             kStreamVersion
+//   u16 length              payload bytes
+//   payload:
+//     u32 events            events begun since Reset() (frame sequence)
+//     u32 ticks_per_second
+//     u16 dropped           events lost: tag table full or overwritten while open
+//     u8  n_tags, n_recent
+//     n_tags   x { u8 name_len, name, u32 count, u32 min, u32 max, u64 sum }
+//     n_recent x { u8 tag, u32 ticks }   oldest first
+//   u16 fletcher16          over version, length and payload
+//
+// A 4-op model streams about 150 bytes per inference, so the frame can go out
+// over the console UART after every Invoke() in production builds. The
+// interpreter skips profiling entirely when built with
+// TF_LITE_STRIP_ERROR_STRINGS.
+
+#ifndef RING_MICRO_PROFILER_H
+#define RING_MICRO_PROFILER_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+template <int kEvents = 32, int kTags = 16>
+class RingMicroProfiler : public tflite::MicroProfilerInterface {
+ public:
+  static_assert(kEvents > 0 && kEvents <= 255, "recent events are sent with a u8 count");
+  static_assert(kTags > 0 && kTags < 255, "tag indices are sent as u8, 255 means none");
+
+  static constexpr uint8_t kStreamVersion = 1;
+  static constexpr uint8_t kMaxNameLength = 31;
+
+  // Sink for StreamBinary(), e.g. fwrite() to the console UART.
+  typedef void (*WriteFn)(const uint8_t* data, uint32_t size, void* context);
+
+  struct TagStats {
+    const char* tag;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+  };
+
+  uint32_t BeginEvent(const char* tag) override {
+    Event& event = events_[next_ % kEvents];
+    event.tag = FindOrAddTag(tag);
+    event.open = 1;
+    event.ticks = tflite::GetCurrentTimeTicks();
+    return next_++;
+  }
+
+  void EndEvent(uint32_t event_handle) override {
+    uint32_t now = tflite::GetCurrentTimeTicks();
+    Event& event = events_[event_handle % kEvents];
+    // Overwritten by kEvents newer events before it ended.
+    if (next_ - event_handle > static_cast<uint32_t>(kEvents) || !event.open) {
+      dropped_++;
+      return;
+    }
+    event.open = 0;
+    event.ticks = now - event.ticks;  // uint32_t, correct across one wrap
+    if (event.tag == kNoTag) {
+      dropped_++;
+      return;
+    }
+    TagStats& stats = tags_[event.tag];
+    if (stats.count == 0 || event.ticks < stats.min) stats.min = event.ticks;
+    if (event.ticks > stats.max) stats.max = event.ticks;
+    stats.sum += event.ticks;
+    stats.count++;
+  }
+
+  void Reset() {
+    memset(events_, 0, sizeof(events_));
+    memset(tags_, 0, sizeof(tags_));
+    next_ = 0;
+    n_tags_ = 0;
+    dropped_ = 0;
+  }
+
+  int tag_count() const { return n_tags_; }
+  const TagStats& tag_stats(int index) const { return tags_[index]; }
+  uint32_t dropped() const { return dropped_; }
+
+  // Prints count, min, mean and max ticks per tag as CSV.
+  void LogTagStatsCsv() const {
+    MicroPrintf("\"Tag\",\"Count\",\"Min\",\"Mean\",\"Max\"");
+    for (int i = 0; i < n_tags_; ++i) {
+      const TagStats& s = tags_[i];
+      uint32_t mean = s.count ? static_cast<uint32_t>(s.sum / s.count) : 0;
+      MicroPrintf("%s,%u,%u,%u,%u", s.tag, static_cast<unsigned>(s.count),
+                  static_cast<unsigned>(s.min), static_cast<unsigned>(mean),
+                  static_cast<unsigned>(s.max));
+    }
+  }
+
+  // Writes the frame described at the top of this file through write().
+  void StreamBinary(WriteFn write, void* context) const {
+    uint8_t n_recent = 0;
+    for (uint32_t h = First(); h < next_; ++h) {
+      n_recent += !events_[h % kEvents].open;
+    }
+
+    Writer out = {write, context, 0, 0};
+    uint32_t length = 4 + 4 + 2 + 1 + 1 + n_recent * 5;
+    for (int i = 0; i < n_tags_; ++i) {
+      length += 1 + NameLength(tags_[i].tag) + 4 + 4 + 4 + 8;
+    }
+
+    const uint8_t sync[2] = {0xA5, 0x5A};
+    write(sync, 2, context);
+    out.U8(kStreamVersion);
+    out.U16(static_cast<uint16_t>(length));
+    out.U32(next_);
+    out.U32(tflite::ticks_per_second());
+    out.U16(dropped_ > 0xFFFF ? 0xFFFF : static_cast<uint16_t>(dropped_));
+    out.U8(static_cast<uint8_t>(n_tags_));
+    out.U8(n_recent);
+    for (int i = 0; i < n_tags_; ++i) {
+      const TagStats& s = tags_[i];
+      uint8_t name_length = NameLength(s.tag);
+      out.U8(name_length);
+      out.Bytes(reinterpret_cast<const uint8_t*>(s.tag), name_length);
+      out.U32(s.count);
+      out.U32(s.min);
+      out.U32(s.max);
+      out.U32(static_cast<uint32_t>(s.sum));
+      out.U32(static_cast<uint32_t>(s.sum >> 32));
+    }
+    for (uint32_t h = First(); h < next_; ++h) {
+      const Event& event = events_[h % kEvents];
+      if (!event.open) {
+        out.U8(event.tag);
+        out.U32(event.ticks);
+      }
+    }
+    const uint8_t check[2] = {static_cast<uint8_t>(out.sum1), static_cast<uint8_t>(out.sum2)};
+    write(check, 2, context);
+  }
+
+ private:
+  static constexpr uint8_t kNoTag = 255;
+
+  struct Event {
+    uint32_t ticks;  // start tick while open, duration once ended
+    uint8_t tag;     // index into tags_, kNoTag when the table was full
+    uint8_t open;
+  };
+
+  // Byte sink that keeps a running Fletcher-16 of everything after the sync.
+  struct Writer {
+    WriteFn write;
+    void* context;
+    uint16_t sum1;
+    uint16_t sum2;
+
+    void Bytes(const uint8_t* data, uint32_t size) {
+      for (uint32_t i = 0; i < size; ++i) {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+      }
+      write(data, size, context);
+    }
+    void U8(uint8_t v) { Bytes(&v, 1); }
+    void U16(uint16_t v) {
+      const uint8_t b[2] = {static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8)};
+      Bytes(b, 2);
+    }
+    void U32(uint32_t v) {
+      const uint8_t b[4] = {static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8),
+                            static_cast<uint8_t>(v >> 16), static_cast<uint8_t>(v >> 24)};
+      Bytes(b, 4);
+    }
+  };
+
+  // Oldest event still in the ring.
+  uint32_t First() const {
+    return next_ > static_cast<uint32_t>(kEvents) ? next_ - kEvents : 0;
+  }
+
+  static uint8_t NameLength(const char* tag) {
+    size_t n = strlen(tag);
+    return static_cast<uint8_t>(n > kMaxNameLength ? kMaxNameLength : n);
+  }
+
+  // Tags are compared by pointer first: the interpreter passes the same
+  // registration name for every call of an op.
+  uint8_t FindOrAddTag(const char* tag) {
+    for (int i = 0; i < n_tags_; ++i) {
+      if (tags_[i].tag == tag || strcmp(tags_[i].tag, tag) == 0) {
+        return static_cast<uint8_t>(i);
+      }
+    }
+    if (n_tags_ == kTags) {
+      return kNoTag;
+    }
+    tags_[n_tags_].tag = tag;
+    return static_cast<uint8_t>(n_tags_++);
+  }
+
+  Event events_[kEvents] = {};
+  TagStats tags_[kTags] = {};
+  uint32_t next_ = 0;
+  int n_tags_ = 0;
+  uint32_t dropped_ = 0;
+};
+
+#endif  // RING_MICRO_PROFILER_H
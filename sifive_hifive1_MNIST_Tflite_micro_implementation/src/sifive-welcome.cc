@@ -1,22 +1,159 @@
 #include <stdio.h>
 #include <string.h>
 
+// 1: run the straight-line code generated by tools/model_compiler/tflm_aot.py
+// (mnist_model_aot.cc) instead of MicroInterpreter. No flatbuffer parsing, op
+// resolver or AllocateTensors at boot; the output is bit-exact. `make TFLM_AOT=1`
+// sets this and also leaves the interpreter sources out of the link.
+#ifndef TFLM_AOT
+#define TFLM_AOT 0
+#endif
+
+// 1: pass a MicroProfiler to the interpreter and print the cycles spent in
+// each op after Invoke() (`make TFLM_PROFILE=1`). Ticks come from rdcycle, see
+// tensorflow/lite/micro/riscv32_generic/micro_time.cc.
+// 2: pass an HpmMicroProfiler instead and print cycles, retired instructions,
+// I-cache misses and load-use stalls per op as CSV (`make TFLM_PROFILE=2`).
+// 3: pass a RingMicroProfiler (under 700 bytes) and stream its per-op
+// count / min / max / sum as a binary frame after every Invoke()
+// (`make TFLM_PROFILE=3`, decode with profile_stream.py).
+#ifndef TFLM_PROFILE
+#define TFLM_PROFILE 0
+#endif
+
+// 1: print the prepared interpreter state after AllocateTensors() as a C
+// header (`make TFLM_SNAPSHOT=1`); `make snapshot-header CONSOLE_LOG=<file>`
+// saves the lines between "// BEGIN MicroSnapshot" and "// END" from the
+// captured console as mnist_snapshot.h. The header is not committed: it holds
+// raw structs for the ABI it was printed on.
+// 2: restore that state at boot instead of running AllocateTensors()
+// (`make TFLM_SNAPSHOT=2`). Falls back to AllocateTensors() when the
+// snapshot does not match the build.
+#ifndef TFLM_SNAPSHOT
+#define TFLM_SNAPSHOT 0
+#endif
+
+// 1: lay tensors out at the offsets stored in the model's
+// OfflineMemoryAllocation metadata (tools/model_compiler/memory_plan.py) with
+// OfflineMemoryPlanner, which does no sorting or gap search at boot. 0: use
+// GreedyMemoryPlanner, which places the same offsets and searches only for
+// buffers the metadata leaves out. Defaults to 1, as in the Makefile.
+#ifndef TFLM_OFFLINE_PLAN
+#define TFLM_OFFLINE_PLAN 1
+#endif
+
+// 1: before the regular setup, find the smallest tensor arena for both memory
+// planners (arena_tune.h) and print it as mnist_arena_size.h on the console.
+// `make arena-tune` builds the program for the host with this set, runs it
+// and saves the header; a firmware build prints the exact RV32 sizes.
+#ifndef TFLM_ARENA_TUNE
+#define TFLM_ARENA_TUNE 0
+#endif
+
+// 1: resolve ops with MnistOpResolver (mnist_op_resolver.h, generated from the
+// model by tools/model_compiler/op_resolver_gen.py): a constant table indexed
+// by BuiltinOperator instead of MicroMutableOpResolver's Add*() calls and
+// linear search; the default, as in the Makefile. 0: keep
+// MicroMutableOpResolver<5>.
+#ifndef TFLM_STATIC_RESOLVER
+#define TFLM_STATIC_RESOLVER 1
+#endif
+
+// 1: also run the sine model from TFLM's hello_world example (sine_model_data.h)
+// next to MNIST. Each model keeps its own persistent arena; both plan their
+// tensor data in one shared non-persistent arena sized for the larger model,
+// so only the model that ran last has valid tensors (`make TFLM_MULTI_MODEL=1`).
+#ifndef TFLM_MULTI_MODEL
+#define TFLM_MULTI_MODEL 0
+#endif
+
+#if TFLM_MULTI_MODEL && TFLM_AOT
+#error "TFLM_MULTI_MODEL runs MicroInterpreter; build it without TFLM_AOT"
+#endif
+#if TFLM_MULTI_MODEL && TFLM_SNAPSHOT
+#error "Snapshots need a single-arena MicroAllocator; build TFLM_MULTI_MODEL without TFLM_SNAPSHOT"
+#endif
+#if TFLM_MULTI_MODEL && TFLM_ARENA_TUNE
+#error "TFLM_ARENA_TUNE measures both models already; build it without TFLM_MULTI_MODEL"
+#endif
+
+#if TFLM_AOT
+#include "mnist_model_aot.h"
+#include "captured_image_data.h"
+#else
 // TFLM Includes from your library structure
 #include "tensorflow/lite/micro/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
+#if TFLM_STATIC_RESOLVER
+#include "mnist_op_resolver.h"
+#else
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#endif
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/micro/micro_allocator.h" // ADD THIS INCLUDE
+#include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "hpm_micro_profiler.h"
+#include "ring_micro_profiler.h"
+#if TFLM_SNAPSHOT == 2
+#if !__has_include("mnist_snapshot.h")
+#error "TFLM_SNAPSHOT=2 needs mnist_snapshot.h: run a TFLM_SNAPSHOT=1 build on the board, save its console output and run `make snapshot-header CONSOLE_LOG=<file>`"
+#else
+#include "mnist_snapshot.h"
+#endif
+#endif
+#if TFLM_ARENA_TUNE
+#include "arena_tune.h"
+#else
+#include "mnist_arena_size.h"
+#endif
 
 // Model and Test Data Includes
 #include "mnist_model_data.h"
+#if TFLM_MULTI_MODEL || TFLM_ARENA_TUNE
+#include "sine_model_data.h"
+#endif
 #include "captured_image_data.h"
+#endif
 
 // Provide an implementation for the TFLM DebugLog function using printf.
 // This function is called by the TFLM runtime for debug logging.
 
 
+#if TFLM_AOT
+// --- Application Setup ---
+void setup() {
+    // Weights, quantization parameters and arena offsets are compiled in.
+    printf("\n TFLM AOT setup complete (arena %d bytes).\n", MNIST_MODEL_AOT_ARENA_SIZE);
+}
+
+// --- Main Inference Function ---
+void run_inference(const int8_t* image_data) {
+    memcpy(mnist_model_aot_input(), image_data, MNIST_MODEL_AOT_INPUT_SIZE);
+    mnist_model_aot_invoke();
+    const int8_t* out = mnist_model_aot_output();
+
+    printf("----------------------------------------\n");
+    printf("[DEBUG] output (quantized / dequantized):\n");
+    int8_t max_val = -128;
+    int predicted_digit = -1;
+    for (int i = 0; i < MNIST_MODEL_AOT_OUTPUT_SIZE; ++i) {
+        float deq = (out[i] - MNIST_MODEL_AOT_OUTPUT_ZERO_POINT) * MNIST_MODEL_AOT_OUTPUT_SCALE;
+        printf("  [%d] %d / %f\n", i, (int)out[i], (double)deq);
+        if (out[i] > max_val) {
+            max_val = out[i];
+            predicted_digit = i;
+        }
+    }
+
+    printf("----------------------------------------\n");
+    printf("Inference Result:\n");
+    printf("Predicted Digit: %d\n", predicted_digit);
+    printf("----------------------------------------\n\n");
+}
+
+#else
 // --- TFLM Global Variables ---
 tflite::ErrorReporter* error_reporter = nullptr;
 const tflite::Model* model = nullptr;
@@ -24,20 +161,130 @@ tflite::MicroInterpreter* interpreter = nullptr;
 TfLiteTensor* input = nullptr;
 TfLiteTensor* output = nullptr;
 
+#if TFLM_ARENA_TUNE
+// Probe arena the search runs in.
 constexpr int kTensorArenaSize = 4 * 1024;
-uint8_t tensor_arena[kTensorArenaSize];
+#else
+// Measured by `make arena-tune`; a size from a 64-bit host is an upper bound
+// for RV32, the other way round it would be too small.
+static_assert(MNIST_ARENA_POINTER_SIZE >= sizeof(void*),
+              "mnist_arena_size.h was measured with smaller pointers, run make arena-tune");
+constexpr int kTensorArenaSize =
+    TFLM_OFFLINE_PLAN ? MNIST_ARENA_SIZE_OFFLINE : MNIST_ARENA_SIZE_GREEDY;
+#endif
+#if TFLM_MULTI_MODEL
+static_assert(SINE_ARENA_POINTER_SIZE >= sizeof(void*),
+              "mnist_arena_size.h was measured with smaller pointers, run make arena-tune");
+constexpr int kMnistPersistentSize =
+    TFLM_OFFLINE_PLAN ? MNIST_ARENA_PERSISTENT_SIZE_OFFLINE : MNIST_ARENA_PERSISTENT_SIZE_GREEDY;
+constexpr int kSinePersistentSize =
+    TFLM_OFFLINE_PLAN ? SINE_ARENA_PERSISTENT_SIZE_OFFLINE : SINE_ARENA_PERSISTENT_SIZE_GREEDY;
+constexpr int kMnistNonPersistentSize = TFLM_OFFLINE_PLAN
+                                            ? MNIST_ARENA_NON_PERSISTENT_SIZE_OFFLINE
+                                            : MNIST_ARENA_NON_PERSISTENT_SIZE_GREEDY;
+constexpr int kSineNonPersistentSize = TFLM_OFFLINE_PLAN
+                                           ? SINE_ARENA_NON_PERSISTENT_SIZE_OFFLINE
+                                           : SINE_ARENA_NON_PERSISTENT_SIZE_GREEDY;
+constexpr int kSharedArenaSize = kMnistNonPersistentSize > kSineNonPersistentSize
+                                     ? kMnistNonPersistentSize
+                                     : kSineNonPersistentSize;
+// The persistent sizes are multiples of 16, so alignas(16) wastes nothing.
+alignas(16) uint8_t mnist_persistent_arena[kMnistPersistentSize];
+alignas(16) uint8_t sine_persistent_arena[kSinePersistentSize];
+alignas(16) uint8_t shared_arena[kSharedArenaSize];
+tflite::MicroInterpreter* sine_interpreter = nullptr;
+#else
+// Aligned so a snapshot sees the same arena layout in every build.
+alignas(16) uint8_t tensor_arena[kTensorArenaSize];
+#endif
+
+#if TFLM_PROFILE == 2
+HpmMicroProfiler profiler;
+#elif TFLM_PROFILE == 3
+RingMicroProfiler<32, 16> profiler;
+
+// stdout is the console UART; freedom-metal writes bytes through unchanged.
+static void WriteConsole(const uint8_t* data, uint32_t size, void* /*context*/) {
+    fwrite(data, 1, size, stdout);
+}
+#elif TFLM_PROFILE
+tflite::MicroProfiler profiler;
+#endif
+
+#if TFLM_MULTI_MODEL
+// --- Second Model ---
+// Sets the sine model up in its own persistent arena and the shared one. It
+// only uses FULLY_CONNECTED, which the MNIST resolver holds.
+static bool setup_sine(const tflite::MicroOpResolver& resolver) {
+    const tflite::Model* sine_model = tflite::GetModel(sine_model_int8_data);
+    if (sine_model->version() != TFLITE_SCHEMA_VERSION) {
+        error_reporter->Report("Sine model schema version mismatch!");
+        return false;
+    }
+    tflite::MicroAllocator* allocator =
+        tflite::MicroAllocator::Create(sine_persistent_arena, kSinePersistentSize,
+                                       shared_arena, kSharedArenaSize,
+#if TFLM_OFFLINE_PLAN
+                                       tflite::MemoryPlannerType::kOffline);
+#else
+                                       tflite::MemoryPlannerType::kGreedy);
+#endif
+    if (!allocator) {
+        error_reporter->Report("MicroAllocator::Create() failed for the sine model.");
+        return false;
+    }
+    static tflite::MicroInterpreter static_sine_interpreter(sine_model, resolver, allocator);
+    if (static_sine_interpreter.AllocateTensors() != kTfLiteOk) {
+        error_reporter->Report("AllocateTensors() failed for the sine model.");
+        return false;
+    }
+    sine_interpreter = &static_sine_interpreter;
+    return true;
+}
+
+// Runs the sine model on x. This overwrites the MNIST tensor data in
+// shared_arena; the next run_inference() writes its input again.
+void run_sine(float x) {
+    if (sine_interpreter == nullptr) {
+        error_reporter->Report("Sine model is not set up\n");
+        return;
+    }
+    TfLiteTensor* sine_input = sine_interpreter->input(0);
+    TfLiteTensor* sine_output = sine_interpreter->output(0);
+    float scaled = x / sine_input->params.scale;
+    int q = (int)(scaled + (scaled < 0 ? -0.5f : 0.5f)) + sine_input->params.zero_point;
+    sine_input->data.int8[0] = (int8_t)(q < -128 ? -128 : q > 127 ? 127 : q);
+    if (sine_interpreter->Invoke() != kTfLiteOk) {
+        error_reporter->Report("Sine Invoke failed.");
+        return;
+    }
+    float y = (sine_output->data.int8[0] - sine_output->params.zero_point) *
+              sine_output->params.scale;
+    printf("Sine model: x=%f y=%f\n", (double)x, (double)y);
+}
+#endif
 
 // --- Application Setup ---
 void setup() {
     static tflite::MicroErrorReporter micro_error_reporter;
     error_reporter = &micro_error_reporter;
 
+#if TFLM_PROFILE == 2
+    if (hpm_profile_init() != 0) {
+        error_reporter->Report("hpm_profile_init() failed; ICacheMiss and LoadUse may read 0.");
+    }
+#endif
+
     model = tflite::GetModel(mnist_model_int8_data);
     if (model->version() != TFLITE_SCHEMA_VERSION) {
         error_reporter->Report("Model schema version mismatch!");
         return;
     }
 
+#if TFLM_STATIC_RESOLVER
+    // Holds exactly the model's four kernels; nothing to register.
+    static MnistOpResolver resolver;
+#else
     // Resolver capacity increased to register additional ops used by the
     // MNIST model (FULLY_CONNECTED, SOFTMAX, RESHAPE, LEAKY_RELU).
     // Use a slightly larger capacity to leave room for future ops.
@@ -48,14 +295,56 @@ void setup() {
     resolver.AddReshape();
     // The provided model uses LeakyReLU activations; register the kernel.
     resolver.AddLeakyRelu();
+#endif
+
+#if TFLM_ARENA_TUNE
+    // The probes are gone once this returns; setup continues in the same arena.
+    ArenaBreakdown greedy{}, offline{};
+    if (!FindMinimumArena(model, resolver, tflite::MemoryPlannerType::kGreedy,
+                          tensor_arena, kTensorArenaSize, &greedy) ||
+        !FindMinimumArena(model, resolver, tflite::MemoryPlannerType::kOffline,
+                          tensor_arena, kTensorArenaSize, &offline)) {
+        error_reporter->Report("Arena search failed.");
+        return;
+    }
+    PrintArenaHeader("MNIST_ARENA", greedy, offline);
+
+    // The second model TFLM_MULTI_MODEL runs, and its split arena sizes.
+    const tflite::Model* sine_model = tflite::GetModel(sine_model_int8_data);
+    ArenaBreakdown sine_greedy{}, sine_offline{};
+    if (!FindMinimumArena(sine_model, resolver, tflite::MemoryPlannerType::kGreedy,
+                          tensor_arena, kTensorArenaSize, &sine_greedy) ||
+        !FindMinimumArena(sine_model, resolver, tflite::MemoryPlannerType::kOffline,
+                          tensor_arena, kTensorArenaSize, &sine_offline)) {
+        error_reporter->Report("Arena search failed for the sine model.");
+        return;
+    }
+    PrintArenaHeader("SINE_ARENA", sine_greedy, sine_offline);
+    const char* const names[] = {"MNIST", "sine"};
+    const ArenaBreakdown greedy_results[] = {greedy, sine_greedy};
+    const ArenaBreakdown offline_results[] = {offline, sine_offline};
+    PrintSharedArenaTotals("greedy", names, greedy_results, 2);
+    PrintSharedArenaTotals("offline", names, offline_results, 2);
+#endif
 
     // Some TFLM versions expose a MicroInterpreter constructor that takes a
     // pre-created MicroAllocator; others take the arena directly. The repo
     // contains MicroAllocator and MicroInterpreter variants; create the
     // allocator explicitly and pass it to the interpreter to avoid the model
     // double-allocation problem.
+#if TFLM_MULTI_MODEL
     tflite::MicroAllocator* allocator =
-        tflite::MicroAllocator::Create(tensor_arena, kTensorArenaSize);
+        tflite::MicroAllocator::Create(mnist_persistent_arena, kMnistPersistentSize,
+                                       shared_arena, kSharedArenaSize,
+#else
+    tflite::MicroAllocator* allocator =
+        tflite::MicroAllocator::Create(tensor_arena, kTensorArenaSize,
+#endif
+#if TFLM_OFFLINE_PLAN
+                                       tflite::MemoryPlannerType::kOffline);
+#else
+                                       tflite::MemoryPlannerType::kGreedy);
+#endif
     if (!allocator) {
         error_reporter->Report("MicroAllocator::Create() failed.");
         return;
@@ -65,21 +354,54 @@ void setup() {
     // MicroInterpreter(const Model*, const MicroOpResolver&, MicroAllocator*,
     //                 MicroResourceVariables* = nullptr,
     //                 MicroProfilerInterface* = nullptr)
-    // Pass nullptr for resource_variables and profiler (we still have
-    // `error_reporter` for model/version checks and other reporting needs).
+    // Pass nullptr for resource_variables (we still have `error_reporter` for
+    // model/version checks and other reporting needs) and for the profiler
+    // unless TFLM_PROFILE is set.
     static tflite::MicroInterpreter static_interpreter(
         model, resolver, allocator, /*resource_variables=*/nullptr,
+#if TFLM_PROFILE
+        /*profiler=*/&profiler);
+#else
         /*profiler=*/nullptr);
+#endif
     interpreter = &static_interpreter;
 
-    if (interpreter->AllocateTensors() != kTfLiteOk) {
+    uint32_t start_ticks = tflite::GetCurrentTimeTicks();
+#if TFLM_SNAPSHOT == 2
+    TfLiteStatus allocate_status =
+        interpreter->AllocateTensorsFromSnapshot(g_mnist_snapshot, mnist_model_int8_len);
+    if (allocate_status != kTfLiteOk) {
+        error_reporter->Report("Snapshot rejected, running AllocateTensors().");
+        allocate_status = interpreter->AllocateTensors();
+    }
+#else
+    TfLiteStatus allocate_status = interpreter->AllocateTensors();
+#endif
+    if (allocate_status != kTfLiteOk) {
         error_reporter->Report("AllocateTensors() failed.");
         return;
     }
+    printf("Tensors allocated in %lu ticks.\n",
+           (unsigned long)(tflite::GetCurrentTimeTicks() - start_ticks));
+#if TFLM_SNAPSHOT == 1
+    interpreter->PrintSnapshot("g_mnist_snapshot", mnist_model_int8_len);
+#endif
 
     input = interpreter->input(0);
     output = interpreter->output(0);
 
+#if TFLM_MULTI_MODEL
+    if (!setup_sine(resolver)) {
+        return;
+    }
+    printf("Arenas: persistent %d (MNIST) + %d (sine), shared non-persistent %d = %d bytes; "
+           "separate arenas would take %d bytes.\n",
+           kMnistPersistentSize, kSinePersistentSize, kSharedArenaSize,
+           kMnistPersistentSize + kSinePersistentSize + kSharedArenaSize,
+           TFLM_OFFLINE_PLAN ? MNIST_ARENA_SIZE_OFFLINE + SINE_ARENA_SIZE_OFFLINE
+                             : MNIST_ARENA_SIZE_GREEDY + SINE_ARENA_SIZE_GREEDY);
+#endif
+
     printf("\n TFLM setup complete.\n");
 }
 
@@ -98,9 +420,14 @@ void run_inference(const int8_t* image_data) {
         printf("\n");
     }
 
-    // Copy provided image into the input buffer (be careful with sizes)
+    // Read the image where it is instead of copying it into the arena. The
+    // caller's buffer has to hold exactly input->bytes; fall back to the copy
+    // when it is rejected (e.g. it lives inside the tensor arena).
     int to_copy = (int)input->bytes;
-    memcpy(input->data.int8, image_data, to_copy);
+    if (interpreter->BindInput(0, image_data, input->bytes) != kTfLiteOk) {
+        interpreter->UnbindInput(0);
+        memcpy(input->data.int8, image_data, to_copy);
+    }
 
     // Print the first few input values for verification
     {
@@ -115,6 +442,21 @@ void run_inference(const int8_t* image_data) {
         return;
     }
 
+#if TFLM_PROFILE == 2
+    // One row per op, then the total.
+    hpm_profile_dump_csv();
+#elif TFLM_PROFILE == 3
+    // Statistics accumulate over every inference; nothing is cleared.
+    fflush(stdout);
+    profiler.StreamBinary(WriteConsole, nullptr);
+    fflush(stdout);
+#elif TFLM_PROFILE
+    // One row per op tag, in core clock cycles.
+    printf("[PROFILE] %u ticks per second\n", (unsigned)tflite::ticks_per_second());
+    profiler.LogTicksPerTagCsv();
+    profiler.ClearEvents();
+#endif
+
     // Diagnostics for output tensor
     printf("----------------------------------------\n");
     printf("[DEBUG] output->bytes=%d\n", (int)output->bytes);
@@ -151,6 +493,8 @@ void run_inference(const int8_t* image_data) {
     printf("----------------------------------------\n\n");
 }
 
+#endif // TFLM_AOT
+
 extern "C" int main(void) {
     printf("Starting TFLM MNIST Example\n");
 
@@ -159,6 +503,14 @@ extern "C" int main(void) {
     printf("\n Running inference on `captured_image` (True Label: 8)...\n");
     run_inference(captured_image);
 
+#if TFLM_MULTI_MODEL
+    // Both models take turns in shared_arena; MNIST runs again after the sine
+    // model overwrote its tensor data.
+    run_sine(1.0f);
+    printf("\n Running inference on `captured_image` again...\n");
+    run_inference(captured_image);
+#endif
+
     printf("\n Inference complete. Program finished.\n");
 
     return 0;
@@ -88,8 +88,12 @@ TfLiteStatus LeakyReluEval(TfLiteContext* context, TfLiteNode* node) {
 }
 
 TFLMRegistration Register_LEAKY_RELU() {
-  return tflite::micro::RegisterOp(LeakyReluInit, LeakyReluPrepare,
-                                   LeakyReluEval);
+  TFLMRegistration r = tflite::micro::RegisterOp(
+      LeakyReluInit, LeakyReluPrepare, LeakyReluEval);
+  // Element i of the output only depends on element i of the input, so the
+  // kernel can overwrite its input.
+  r.inplace_operator = kTfLiteInplaceOpInput0Shared;
+  return r;
 }
 
 }  // namespace tflite
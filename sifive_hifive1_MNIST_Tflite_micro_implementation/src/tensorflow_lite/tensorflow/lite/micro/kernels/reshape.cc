@@ -41,7 +41,7 @@ TfLiteStatus EvalReshapeReference(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_STATUS(TfLiteTypeSizeOf(input->type, &input_bytes));
   input_bytes *= ElementCount(*input->dims);
 
-  // Do nothing for in-place reshape.
+  // Nothing to do when the output is planned in the input's buffer.
   if (input->data.raw != output->data.raw) {
     // Otherwise perform reshape with copy.
     memcpy(output->data.raw, input->data.raw, input_bytes);
@@ -52,8 +52,14 @@ TfLiteStatus EvalReshapeReference(TfLiteContext* context, TfLiteNode* node) {
 }  // namespace
 
 TFLMRegistration Register_RESHAPE() {
-  return tflite::micro::RegisterOp(nullptr, PrepareReshapeReference,
-                                   EvalReshapeReference);
+  TFLMRegistration r = tflite::micro::RegisterOp(
+      nullptr, PrepareReshapeReference, EvalReshapeReference);
+  // The output is a view of the input: MicroAllocator plans both in one
+  // buffer, so EvalReshapeReference only copies when the input was rebound
+  // (MicroInterpreter::BindInput) or the plan could not share the buffer.
+  r.inplace_operator =
+      kTfLiteInplaceOpDataUnmodified | kTfLiteInplaceOpInput0Shared;
+  return r;
 }
 
 }  // namespace tflite
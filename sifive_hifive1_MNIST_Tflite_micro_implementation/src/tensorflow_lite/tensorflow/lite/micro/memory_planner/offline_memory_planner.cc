@@ -0,0 +1,98 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/memory_planner/offline_memory_planner.h"
+
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+
+OfflineMemoryPlanner::OfflineMemoryPlanner()
+    : entries_(nullptr),
+      max_buffer_count_(0),
+      buffer_count_(0),
+      offline_size_(0),
+      online_size_(0) {}
+
+OfflineMemoryPlanner::~OfflineMemoryPlanner() {
+  // We don't own the scratch buffer, so don't deallocate anything.
+}
+
+TfLiteStatus OfflineMemoryPlanner::Init(unsigned char* scratch_buffer,
+                                        int scratch_buffer_size) {
+  entries_ = reinterpret_cast<BufferEntry*>(scratch_buffer);
+  max_buffer_count_ = scratch_buffer_size / per_buffer_size();
+  buffer_count_ = 0;
+  offline_size_ = 0;
+  online_size_ = 0;
+  return kTfLiteOk;
+}
+
+TfLiteStatus OfflineMemoryPlanner::AddBuffer(int size,
+                                             int /* first_time_used */,
+                                             int /* last_time_used */) {
+  if (buffer_count_ >= max_buffer_count_) {
+    MicroPrintf("Too many buffers (max is %d)", max_buffer_count_);
+    return kTfLiteError;
+  }
+  BufferEntry* entry = &entries_[buffer_count_++];
+  entry->offset = online_size_;
+  entry->offline = false;
+  online_size_ += size;
+  return kTfLiteOk;
+}
+
+TfLiteStatus OfflineMemoryPlanner::AddBuffer(int size, int first_time_used,
+                                             int last_time_used,
+                                             int offline_offset) {
+  if (offline_offset == kOnlinePlannedBuffer) {
+    return AddBuffer(size, first_time_used, last_time_used);
+  }
+  if (offline_offset < 0) {
+    MicroPrintf("Invalid offline offset %d", offline_offset);
+    return kTfLiteError;
+  }
+  if (buffer_count_ >= max_buffer_count_) {
+    MicroPrintf("Too many buffers (max is %d)", max_buffer_count_);
+    return kTfLiteError;
+  }
+  BufferEntry* entry = &entries_[buffer_count_++];
+  entry->offset = offline_offset;
+  entry->offline = true;
+  if (offline_offset + size > offline_size_) {
+    offline_size_ = offline_offset + size;
+  }
+  return kTfLiteOk;
+}
+
+size_t OfflineMemoryPlanner::GetMaximumMemorySize() {
+  return offline_size_ + online_size_;
+}
+
+int OfflineMemoryPlanner::GetBufferCount() { return buffer_count_; }
+
+TfLiteStatus OfflineMemoryPlanner::GetOffsetForBuffer(int buffer_index,
+                                                      int* offset) {
+  if ((buffer_index < 0) || (buffer_index >= buffer_count_)) {
+    MicroPrintf("buffer index %d is outside range 0 to %d", buffer_index,
+                buffer_count_);
+    return kTfLiteError;
+  }
+  const BufferEntry& entry = entries_[buffer_index];
+  *offset = entry.offline ? entry.offset : offline_size_ + entry.offset;
+  return kTfLiteOk;
+}
+
+}  // namespace tflite
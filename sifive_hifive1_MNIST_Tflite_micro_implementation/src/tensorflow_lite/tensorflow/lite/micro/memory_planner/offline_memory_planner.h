@@ -0,0 +1,79 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_OFFLINE_MEMORY_PLANNER_H_
+#define TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_OFFLINE_MEMORY_PLANNER_H_
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/memory_planner/micro_memory_planner.h"
+
+namespace tflite {
+
+// Memory planner for models whose tensor offsets were planned on the host and
+// stored in the "OfflineMemoryAllocation" metadata (see
+// tools/model_compiler/memory_plan.py).
+//
+// Offline planned buffers are placed at their given offset as they are added;
+// there is no sorting and no gap search, so planning is O(1) per buffer.
+// Buffers without an offline offset (kernel scratch buffers, or tensors the
+// metadata marks -1) are stacked above the highest offline planned buffer in
+// the order they are added. The planner trusts the offline plan: overlapping
+// offsets are not detected.
+class OfflineMemoryPlanner : public MicroMemoryPlanner {
+ public:
+  OfflineMemoryPlanner();
+  ~OfflineMemoryPlanner() override;
+
+  TfLiteStatus Init(unsigned char* scratch_buffer,
+                    int scratch_buffer_size) override;
+
+  TfLiteStatus AddBuffer(int size, int first_time_used,
+                         int last_time_used) override;
+  TfLiteStatus AddBuffer(int size, int first_time_used, int last_time_used,
+                         int offline_offset) override;
+
+  size_t GetMaximumMemorySize() override;
+  int GetBufferCount() override;
+  TfLiteStatus GetOffsetForBuffer(int buffer_index, int* offset) override;
+
+  // Returns False because offline plans reuse memory between tensors.
+  bool preserves_all_tensors() const override { return false; }
+
+  static constexpr int per_buffer_size() { return sizeof(BufferEntry); }
+
+ private:
+  struct BufferEntry {
+    // Arena offset of an offline planned buffer, or the offset of an online
+    // buffer above the offline planned section.
+    int offset;
+    bool offline;
+  };
+
+  // Entries live in the scratch buffer passed to Init().
+  BufferEntry* entries_;
+  int max_buffer_count_;
+  int buffer_count_;
+
+  // End of the highest offline planned buffer.
+  int offline_size_;
+  // Bytes taken by online buffers, stacked from offline_size_ up.
+  int online_size_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_OFFLINE_MEMORY_PLANNER_H_
@@ -215,6 +215,7 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
       } else {
         current->offline_offset = kOnlinePlannedBuffer;
       }
+      current->alias_index = -1;
     }
   }
   // Initialize allocation info for every scratch buffer.
@@ -226,6 +227,7 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
     current->last_used = kUninitializedLifetime;
     current->needs_allocating = true;
     current->offline_offset = kOnlinePlannedBuffer;
+    current->alias_index = -1;
   }
   return kTfLiteOk;
 }
@@ -333,6 +335,79 @@ TfLiteStatus AllocationInfoBuilder::MarkAllocationLifetimes(
   return kTfLiteOk;
 }
 
+TfLiteStatus AllocationInfoBuilder::MarkInPlaceOutputs(
+    SubgraphAllocations* allocations) {
+  if (model_->subgraphs()->size() != 1) {
+    return kTfLiteOk;
+  }
+  const SubGraph* subgraph = model_->subgraphs()->Get(0);
+  AllocationInfo* allocation_info = info_.allocation_info;
+  const uint32_t operators_size = NumSubgraphOperators(subgraph);
+
+  // Returns true if tensor_index or a tensor sharing its buffer is one of the
+  // given subgraph inputs or outputs.
+  auto in_group = [&](const flatbuffers::Vector<int32_t>* tensors, int root) {
+    for (size_t i = 0; tensors != nullptr && i < tensors->size(); ++i) {
+      const int index = tensors->Get(i);
+      const int alias = allocation_info[index].alias_index;
+      if (index == root || alias == root) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  for (uint32_t i = 0; i < operators_size; ++i) {
+    const TFLMRegistration* registration =
+        allocations[0].node_and_registrations[i].registration;
+    if (registration == nullptr ||
+        !(registration->inplace_operator & kTfLiteInplaceOpInput0Shared)) {
+      continue;
+    }
+    const auto* op = subgraph->operators()->Get(i);
+    if (op->inputs() == nullptr || op->inputs()->size() == 0 ||
+        op->outputs() == nullptr || op->outputs()->size() == 0) {
+      continue;
+    }
+    const int input_index = op->inputs()->Get(0);
+    const int output_index = op->outputs()->Get(0);
+    if (input_index < 0 || input_index == output_index ||
+        subgraph->tensors()->Get(input_index)->is_variable() ||
+        subgraph->tensors()->Get(output_index)->is_variable()) {
+      continue;
+    }
+    const int root = allocation_info[input_index].alias_index >= 0
+                         ? allocation_info[input_index].alias_index
+                         : input_index;
+    AllocationInfo* shared = &allocation_info[root];
+    AllocationInfo* output = &allocation_info[output_index];
+    if (!shared->needs_allocating || !output->needs_allocating ||
+        output->bytes > shared->bytes) {
+      continue;
+    }
+    // An offline plan made without this sharing stays as it is.
+    if (output->offline_offset != shared->offline_offset) {
+      continue;
+    }
+    // The operator's allocation scope is i + 1 in a single subgraph. An
+    // operator that writes its output over the input must be the last reader
+    // of the shared buffer, and must not clobber the subgraph's inputs or
+    // outputs.
+    if (!(registration->inplace_operator & kTfLiteInplaceOpDataUnmodified) &&
+        (shared->last_used != static_cast<int>(i) + 1 ||
+         in_group(subgraph->inputs(), root) ||
+         in_group(subgraph->outputs(), root))) {
+      continue;
+    }
+    output->needs_allocating = false;
+    output->alias_index = root;
+    shared->first_created =
+        std::min(shared->first_created, output->first_created);
+    shared->last_used = std::max(shared->last_used, output->last_used);
+  }
+  return kTfLiteOk;
+}
+
 // Get offline tensors allocation plan. See
 // micro/docs/memory_management.md for more info.
 TfLiteStatus AllocationInfoBuilder::GetOfflinePlannedOffsets(
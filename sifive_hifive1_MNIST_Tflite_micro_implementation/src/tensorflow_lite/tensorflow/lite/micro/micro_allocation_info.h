@@ -31,6 +31,9 @@ struct AllocationInfo {
   int last_used;
   int32_t offline_offset;
   bool needs_allocating;
+  // Index of the AllocationInfo whose buffer this tensor shares, or -1. Set by
+  // MarkInPlaceOutputs(); such entries are not planned themselves.
+  int alias_index;
 };
 
 // Used to hold the allocation info list and related metadata for the entire
@@ -104,6 +107,15 @@ class AllocationInfoBuilder {
       ScratchBufferHandle* scratch_buffer_handles,
       SubgraphAllocations* allocations);
 
+  // Let the first output of each in-place capable operator (see
+  // TFLMRegistration::inplace_operator) share its first input's buffer when
+  // that is safe: the input is planned, not a variable, at least as large,
+  // and no later operator reads it (unless the operator leaves the data
+  // unmodified, like RESHAPE). The input's lifetime is extended to cover the
+  // output. Offline planned offsets are kept unless they already give both
+  // tensors the same offset. Only models with a single subgraph are handled.
+  TfLiteStatus MarkInPlaceOutputs(SubgraphAllocations* allocations);
+
   // Returns the number of allocations.
   int AllocationCount() const { return info_.allocation_info_count; }
 
@@ -30,6 +30,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
 #include "tensorflow/lite/micro/memory_planner/linear_memory_planner.h"
 #include "tensorflow/lite/micro/memory_planner/micro_memory_planner.h"
+#include "tensorflow/lite/micro/memory_planner/offline_memory_planner.h"
 #include "tensorflow/lite/micro/micro_allocation_info.h"
 #include "tensorflow/lite/micro/micro_arena_constants.h"
 #include "tensorflow/lite/micro/micro_log.h"
@@ -99,6 +100,12 @@ MicroMemoryPlanner* CreateMemoryPlanner(
       memory_planner = new (memory_planner_buffer) GreedyMemoryPlanner();
       break;
     }
+    case MemoryPlannerType::kOffline: {
+      memory_planner_buffer = memory_allocator->AllocatePersistentBuffer(
+          sizeof(OfflineMemoryPlanner), alignof(OfflineMemoryPlanner));
+      memory_planner = new (memory_planner_buffer) OfflineMemoryPlanner();
+      break;
+    }
   }
   return memory_planner;
 }
@@ -141,6 +148,13 @@ TfLiteStatus CommitPlan(MicroMemoryPlanner* planner, uint8_t* starting_point,
       ++planner_index;
     }
   }
+  // Outputs computed in place point into their input's buffer.
+  for (size_t i = 0; i < allocation_info_size; ++i) {
+    const AllocationInfo* current = &allocation_info[i];
+    if (current->alias_index >= 0) {
+      *current->output_ptr = *allocation_info[current->alias_index].output_ptr;
+    }
+  }
   return kTfLiteOk;
 }
 
@@ -160,6 +174,9 @@ IPersistentBufferAllocator* CreatePersistentArenaAllocator(uint8_t* buffer_head,
   uint8_t* allocator_buffer =
       tmp.AllocatePersistentBuffer(sizeof(PersistentArenaBufferAllocator),
                                    alignof(PersistentArenaBufferAllocator));
+  if (allocator_buffer == nullptr) {
+    return nullptr;
+  }
   // Use the default copy constructor to populate internal states.
   return new (allocator_buffer) PersistentArenaBufferAllocator(tmp);
 }
@@ -174,6 +191,9 @@ INonPersistentBufferAllocator* CreateNonPersistentArenaAllocator(
       persistent_buffer_allocator->AllocatePersistentBuffer(
           sizeof(NonPersistentArenaBufferAllocator),
           alignof(NonPersistentArenaBufferAllocator));
+  if (allocator_buffer == nullptr) {
+    return nullptr;
+  }
   // Align the actually used area by the head because persistent buffer grows
   // from the head to bottom.
   uint8_t* aligned_buffer_head =
@@ -591,10 +611,16 @@ MicroAllocator* MicroAllocator::Create(uint8_t* persistent_tensor_arena,
   IPersistentBufferAllocator* persistent_buffer_allocator =
       CreatePersistentArenaAllocator(persistent_tensor_arena,
                                      persistent_arena_size);
+  if (persistent_buffer_allocator == nullptr) {
+    return nullptr;
+  }
   INonPersistentBufferAllocator* non_persistent_buffer_allocator =
       CreateNonPersistentArenaAllocator(non_persistent_tensor_arena,
                                         non_persistent_arena_size,
                                         persistent_buffer_allocator);
+  if (non_persistent_buffer_allocator == nullptr) {
+    return nullptr;
+  }
 
   // TODO(b/297821738): this should be changed to CreateMemoryPlanner if
   // possible once  it's figured out why it breaks the HifiMini Build
@@ -605,17 +631,34 @@ MicroAllocator* MicroAllocator::Create(uint8_t* persistent_tensor_arena,
     memory_planner_buffer =
         persistent_buffer_allocator->AllocatePersistentBuffer(
             sizeof(GreedyMemoryPlanner), alignof(GreedyMemoryPlanner));
-    memory_planner = new (memory_planner_buffer) GreedyMemoryPlanner();
+    if (memory_planner_buffer != nullptr) {
+      memory_planner = new (memory_planner_buffer) GreedyMemoryPlanner();
+    }
   } else if (memory_planner_type == MemoryPlannerType::kLinear) {
     memory_planner_buffer =
         persistent_buffer_allocator->AllocatePersistentBuffer(
             sizeof(LinearMemoryPlanner), alignof(LinearMemoryPlanner));
-    memory_planner = new (memory_planner_buffer) LinearMemoryPlanner();
+    if (memory_planner_buffer != nullptr) {
+      memory_planner = new (memory_planner_buffer) LinearMemoryPlanner();
+    }
+  } else if (memory_planner_type == MemoryPlannerType::kOffline) {
+    memory_planner_buffer =
+        persistent_buffer_allocator->AllocatePersistentBuffer(
+            sizeof(OfflineMemoryPlanner), alignof(OfflineMemoryPlanner));
+    if (memory_planner_buffer != nullptr) {
+      memory_planner = new (memory_planner_buffer) OfflineMemoryPlanner();
+    }
+  }
+  if (memory_planner == nullptr) {
+    return nullptr;
   }
 
   uint8_t* micro_allocator_buffer =
       persistent_buffer_allocator->AllocatePersistentBuffer(
           sizeof(MicroAllocator), alignof(MicroAllocator));
+  if (micro_allocator_buffer == nullptr) {
+    return nullptr;
+  }
   MicroAllocator* allocator = new (micro_allocator_buffer)
       MicroAllocator(persistent_buffer_allocator,
                      non_persistent_buffer_allocator, memory_planner);
@@ -638,6 +681,10 @@ SubgraphAllocations* MicroAllocator::StartModelAllocation(const Model* model) {
       persistent_buffer_allocator_->AllocatePersistentBuffer(
           sizeof(MicroBuiltinDataAllocator),
           alignof(MicroBuiltinDataAllocator));
+  if (data_allocator_buffer == nullptr) {
+    MicroPrintf("Failed to allocate memory for the builtin data allocator.");
+    return nullptr;
+  }
   builtin_data_allocator_ = new (data_allocator_buffer)
       MicroBuiltinDataAllocator(persistent_buffer_allocator_);
 
@@ -768,6 +815,91 @@ size_t MicroAllocator::used_bytes() const {
          persistent_buffer_allocator_->GetPersistentUsedBytes();
 }
 
+bool MicroAllocator::OverlapsNonPersistentMemory(const void* buffer,
+                                                 size_t bytes) const {
+  const uint8_t* start =
+      non_persistent_buffer_allocator_->GetOverlayMemoryAddress();
+  const uint8_t* end =
+      start + non_persistent_buffer_allocator_->GetNonPersistentUsedBytes() +
+      non_persistent_buffer_allocator_->GetAvailableMemory(1);
+  const uint8_t* first = static_cast<const uint8_t*>(buffer);
+  return first < end && first + bytes > start;
+}
+
+TfLiteStatus MicroAllocator::GetSnapshotLayout(MicroSnapshot* snapshot,
+                                               uint8_t** arena_start,
+                                               size_t* scratch_buffer_count) {
+  if (model_is_allocating_ || builtin_data_allocator_ == nullptr) {
+    MicroPrintf("Snapshot requested before the model allocation finished");
+    return kTfLiteError;
+  }
+  uint8_t* start = non_persistent_buffer_allocator_->GetOverlayMemoryAddress();
+  uint8_t* tail = start +
+                  non_persistent_buffer_allocator_->GetNonPersistentUsedBytes() +
+                  non_persistent_buffer_allocator_->GetAvailableMemory(1);
+  // A zero-byte allocation returns the persistent tail without moving it; it
+  // only meets the head's free space when both live in one arena.
+  if (persistent_buffer_allocator_->AllocatePersistentBuffer(0, 1) != tail) {
+    MicroPrintf("Snapshots need a single-arena MicroAllocator");
+    return kTfLiteError;
+  }
+  uint8_t* end = tail + persistent_buffer_allocator_->GetPersistentUsedBytes();
+  *arena_start = start;
+  snapshot->arena_size = end - start;
+  snapshot->image_offset = tail - start;
+  snapshot->image_size = reinterpret_cast<uint8_t*>(builtin_data_allocator_) - tail;
+  snapshot->non_persistent_size =
+      non_persistent_buffer_allocator_->GetNonPersistentUsedBytes();
+  *scratch_buffer_count = scratch_buffer_request_count_;
+  return kTfLiteOk;
+}
+
+uint8_t* MicroAllocator::RestoreModelAllocation(const MicroSnapshot& snapshot) {
+  if (model_is_allocating_ || builtin_data_allocator_ != nullptr) {
+    MicroPrintf("Snapshot restored into an arena that already holds a model");
+    return nullptr;
+  }
+  uint8_t* start = non_persistent_buffer_allocator_->GetOverlayMemoryAddress();
+  uint8_t* tail = start +
+                  non_persistent_buffer_allocator_->GetNonPersistentUsedBytes() +
+                  non_persistent_buffer_allocator_->GetAvailableMemory(1);
+  uint8_t* end = tail + persistent_buffer_allocator_->GetPersistentUsedBytes();
+  uint8_t* data_allocator_buffer =
+      AlignPointerDown(tail - sizeof(MicroBuiltinDataAllocator),
+                       alignof(MicroBuiltinDataAllocator));
+  uint8_t* image = data_allocator_buffer - snapshot.image_size;
+  if (persistent_buffer_allocator_->AllocatePersistentBuffer(0, 1) != tail ||
+      static_cast<size_t>(end - start) != snapshot.arena_size ||
+      image < start + snapshot.non_persistent_size ||
+      static_cast<size_t>(image - start) != snapshot.image_offset ||
+      (snapshot.arena_address != 0 &&
+       reinterpret_cast<uintptr_t>(start) != snapshot.arena_address)) {
+    MicroPrintf("Arena layout does not match the snapshot");
+    return nullptr;
+  }
+
+  // Same allocations, in the same order, as StartModelAllocation() and the
+  // rest of AllocateTensors() made when the snapshot was printed.
+  builtin_data_allocator_ = new (
+      persistent_buffer_allocator_->AllocatePersistentBuffer(
+          sizeof(MicroBuiltinDataAllocator),
+          alignof(MicroBuiltinDataAllocator)))
+      MicroBuiltinDataAllocator(persistent_buffer_allocator_);
+  persistent_buffer_allocator_->AllocatePersistentBuffer(snapshot.image_size,
+                                                         1);
+
+  max_head_buffer_usage_ = snapshot.non_persistent_size;
+  if (non_persistent_buffer_allocator_->ReserveNonPersistentOverlayMemory(
+          max_head_buffer_usage_, MicroArenaBufferAlignment()) != kTfLiteOk) {
+    return nullptr;
+  }
+  return image;
+}
+
+const TfLiteIntArray* MicroAllocator::GetZeroLengthIntArray() {
+  return &kZeroLengthIntArray;
+}
+
 TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
     const Model* model, SubgraphAllocations* subgraph_allocations) {
   TFLITE_DCHECK(subgraph_allocations != nullptr);
@@ -1155,6 +1287,11 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
       GetScratchBufferRequests();
   TF_LITE_ENSURE_STATUS(builder.MarkAllocationLifetimes(
       0, scratch_buffer_requests, scratch_buffer_handles, allocations));
+  // The linear planner keeps every tensor for inspection, so nothing may be
+  // overwritten in place.
+  if (!memory_planner_->preserves_all_tensors()) {
+    TF_LITE_ENSURE_STATUS(builder.MarkInPlaceOutputs(allocations));
+  }
   int allocation_info_count = builder.AllocationCount();
   AllocationInfo* allocation_info = builder.Finish();
 
@@ -23,6 +23,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/flatbuffer_utils.h"
 #include "tensorflow/lite/micro/memory_planner/micro_memory_planner.h"
 #include "tensorflow/lite/micro/micro_common.h"
+#include "tensorflow/lite/micro/micro_snapshot.h"
 #include "tensorflow/lite/micro/tflite_bridge/flatbuffer_conversions_bridge.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
@@ -77,6 +78,9 @@ struct ScratchBufferRequest {
 enum class MemoryPlannerType {
   kGreedy,
   kLinear,
+  // Takes the tensor offsets from the model's OfflineMemoryAllocation
+  // metadata without searching; see OfflineMemoryPlanner.
+  kOffline,
 };
 
 struct NodeAndRegistration {
@@ -151,10 +155,17 @@ class MicroAllocator {
   static MicroAllocator* Create(SingleArenaBufferAllocator* memory_allocator,
                                 MicroMemoryPlanner* memory_planner);
 
-  // Creates a MicroAllocator instance using the provided
-  // SingleArenaBufferAllocator instance and the MemoryPlanner. This allocator
-  // instance will use the SingleArenaBufferAllocator instance to manage
-  // allocations internally.
+  // Creates a MicroAllocator instance that keeps its persistent allocations
+  // (eval tensors, nodes, op data, the allocator and planner themselves) in
+  // `persistent_tensor_arena` and plans tensor data and scratch buffers in
+  // `non_persistent_tensor_arena`.
+  //
+  // Interpreters that run one at a time can share one non-persistent arena,
+  // each with its own persistent arena: size the shared one for the largest
+  // model. Invoking one interpreter overwrites the tensor data of the others,
+  // so fill an interpreter's inputs right before its Invoke() and read its
+  // outputs before the next interpreter runs. Returns nullptr when the
+  // persistent arena cannot hold the allocator.
   static MicroAllocator* Create(
       uint8_t* persistent_tensor_arena, size_t persistent_arena_size,
       uint8_t* non_persistent_tensor_arena, size_t non_persistent_arena_size,
@@ -244,8 +255,9 @@ class MicroAllocator {
   // This method only requests a buffer with a given size to be used after a
   // model has finished allocation via FinishModelAllocation(). All requested
   // buffers will be accessible by the out-param in that method.
-  TfLiteStatus RequestScratchBufferInArena(size_t bytes, int subgraph_idx,
-                                           int* buffer_idx);
+  virtual TfLiteStatus RequestScratchBufferInArena(size_t bytes,
+                                                   int subgraph_idx,
+                                                   int* buffer_idx);
 
   // Finish allocating a specific NodeAndRegistration prepare block (kernel
   // entry for a model) with a given node ID. This call ensures that any scratch
@@ -257,6 +269,30 @@ class MicroAllocator {
   // `FinishModelAllocation`. Otherwise, it will return 0.
   size_t used_bytes() const;
 
+  // Returns true if [buffer, buffer + bytes) overlaps arena memory that the
+  // memory plan or temp allocations may write during Invoke(): the planned
+  // non-persistent section and the free space above it.
+  bool OverlapsNonPersistentMemory(const void* buffer, size_t bytes) const;
+
+  // Fills the arena_size, image_offset, image_size and non_persistent_size
+  // fields of `snapshot` for MicroInterpreter::PrintSnapshot(), and the
+  // number of scratch buffer handles. The image is the persistent memory
+  // allocated for the model below the builtin data allocator
+  // StartModelAllocation() places first. Only single-arena allocators with a
+  // finished model allocation are supported.
+  TfLiteStatus GetSnapshotLayout(MicroSnapshot* snapshot, uint8_t** arena_start,
+                                 size_t* scratch_buffer_count);
+
+  // Counterpart of StartModelAllocation() + FinishModelAllocation() for
+  // MicroInterpreter::AllocateTensorsFromSnapshot(): places the builtin data
+  // allocator, claims snapshot.image_size bytes right below it and reserves
+  // the planned head. Returns where the image goes, or nullptr (without
+  // allocating anything) when the arena layout differs from the snapshot's.
+  uint8_t* RestoreModelAllocation(const MicroSnapshot& snapshot);
+
+  // Dims shared by all scalar tensors.
+  static const TfLiteIntArray* GetZeroLengthIntArray();
+
   TfLiteBridgeBuiltinDataAllocator* GetBuiltinDataAllocator();
 
  protected:
@@ -28,6 +28,10 @@ struct TFLMRegistration {
   void (*reset)(TfLiteContext* context, void* buffer);
   int32_t builtin_code;
   const char* custom_name;
+  // TfLiteInPlaceOp bits: which inputs the kernel can safely run on in place
+  // with its first output. MicroAllocator then plans the output in the
+  // input's buffer when no later op still reads the input.
+  uint64_t inplace_operator;
 };
 
 struct TFLMInferenceRegistration {
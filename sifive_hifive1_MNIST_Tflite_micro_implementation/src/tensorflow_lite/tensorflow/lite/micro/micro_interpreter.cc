@@ -17,6 +17,7 @@ limitations under the License.
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
 #include "tensorflow/lite/c/c_api_types.h"
@@ -28,6 +29,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/micro/micro_snapshot.h"
 #include "tensorflow/lite/micro/tflite_bridge/flatbuffer_conversions_bridge.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/schema/schema_utils.h"
@@ -41,6 +43,126 @@ MemoryPlannerType FlagToMemoryPlannerType(bool preserve_all_tensors) {
     return MemoryPlannerType::kGreedy;
   }
 }
+
+// Where the pointers in a snapshot image may point.
+struct SnapshotRanges {
+  uintptr_t arena_start;
+  uintptr_t arena_end;
+  uintptr_t model;
+  uintptr_t model_end;
+  uintptr_t zero_length_array;
+};
+
+// Sets `kind` and the offset to store in place of `value`, read from a
+// pointer field of a snapshot image. Returns false when the pointer leads
+// anywhere but the arena, the model or the shared empty dims array.
+bool ClassifySnapshotPointer(uintptr_t value, const SnapshotRanges& ranges,
+                             uint32_t* kind, uintptr_t* offset) {
+  if (value >= ranges.arena_start && value < ranges.arena_end) {
+    *kind = kMicroSnapshotArenaRelocation;
+    *offset = value - ranges.arena_start;
+    return true;
+  }
+  if (value >= ranges.model && value < ranges.model_end) {
+    *kind = kMicroSnapshotModelRelocation;
+    *offset = value - ranges.model;
+    return true;
+  }
+  if (value == ranges.zero_length_array) {
+    *kind = kMicroSnapshotZeroArrayRelocation;
+    *offset = 0;
+    return true;
+  }
+  return false;
+}
+
+// The structures AllocateTensors() leaves in the snapshot image.
+struct SnapshotRoots {
+  const Model* model;
+  const SubgraphAllocations* allocations;
+  int subgraph_count;
+  TfLiteTensor* const* input_tensors;
+  size_t input_count;
+  TfLiteTensor* const* output_tensors;
+  size_t output_count;
+  const ScratchBufferHandle* scratch_buffer_handles;
+  size_t scratch_buffer_count;
+};
+
+template <typename Visit>
+void VisitTensorPointers(const TfLiteTensor& tensor, Visit& visit) {
+  visit(&tensor.data.data);
+  visit(&tensor.dims);
+  visit(&tensor.quantization.params);
+  if (tensor.quantization.type == kTfLiteAffineQuantization &&
+      tensor.quantization.params != nullptr) {
+    const auto* params = static_cast<const TfLiteAffineQuantization*>(
+        tensor.quantization.params);
+    visit(&params->scale);
+    visit(&params->zero_point);
+  }
+#ifndef TF_LITE_STATIC_MEMORY
+  visit(&tensor.allocation);
+  visit(&tensor.name);
+  visit(&tensor.delegate);
+  visit(&tensor.sparsity);
+  visit(&tensor.dims_signature);
+#endif  // TF_LITE_STATIC_MEMORY
+}
+
+// Calls visit(field) with the address of every pointer field the allocator
+// and AllocateTensors() fill in, so that only those words are relocated.
+// Registrations are looked up again on restore; builtin data and kernel op
+// data are not walked.
+template <typename Visit>
+void VisitSnapshotPointers(const SnapshotRoots& roots, Visit visit) {
+  for (int subgraph_idx = 0; subgraph_idx < roots.subgraph_count;
+       subgraph_idx++) {
+    const SubgraphAllocations& allocations = roots.allocations[subgraph_idx];
+    visit(&allocations.node_and_registrations);
+    visit(&allocations.tensors);
+    const SubGraph* subgraph = roots.model->subgraphs()->Get(subgraph_idx);
+    const uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      const TfLiteNode& node = allocations.node_and_registrations[i].node;
+      visit(&node.inputs);
+      visit(&node.outputs);
+      visit(&node.intermediates);
+#ifndef TF_LITE_STATIC_MEMORY
+      visit(&node.temporaries);
+      visit(&node.delegate);
+#endif  // TF_LITE_STATIC_MEMORY
+      visit(&node.user_data);
+      visit(&node.builtin_data);
+      visit(&node.custom_initial_data);
+    }
+    const size_t tensors_size =
+        subgraph->tensors() == nullptr ? 0 : subgraph->tensors()->size();
+    for (size_t i = 0; i < tensors_size; ++i) {
+      visit(&allocations.tensors[i].data.data);
+      visit(&allocations.tensors[i].dims);
+    }
+  }
+  for (size_t i = 0; i < roots.input_count; ++i) {
+    visit(&roots.input_tensors[i]);
+    VisitTensorPointers(*roots.input_tensors[i], visit);
+  }
+  for (size_t i = 0; i < roots.output_count; ++i) {
+    visit(&roots.output_tensors[i]);
+    VisitTensorPointers(*roots.output_tensors[i], visit);
+  }
+  for (size_t i = 0; i < roots.scratch_buffer_count; ++i) {
+    visit(&roots.scratch_buffer_handles[i].data);
+  }
+}
+
+uint32_t SnapshotOffset(const void* pointer, const uint8_t* arena_start) {
+  if (pointer == nullptr) {
+    return kMicroSnapshotNull;
+  }
+  return static_cast<uint32_t>(static_cast<const uint8_t*>(pointer) -
+                               arena_start);
+}
 }  // namespace
 
 MicroInterpreter::MicroInterpreter(const Model* model,
@@ -280,6 +402,241 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroInterpreter::PrintSnapshot(const char* name,
+                                             size_t model_size) {
+  if (!tensors_allocated_) {
+    MicroPrintf("PrintSnapshot() called before AllocateTensors()");
+    return kTfLiteError;
+  }
+#ifdef USE_TFLM_COMPRESSION
+  MicroPrintf("Snapshots do not cover compressed tensors");
+  return kTfLiteError;
+#endif  // USE_TFLM_COMPRESSION
+  MicroSnapshot snapshot = {};
+  uint8_t* arena_start;
+  size_t scratch_buffer_count;
+  TF_LITE_ENSURE_STATUS(allocator_.GetSnapshotLayout(&snapshot, &arena_start,
+                                                     &scratch_buffer_count));
+  const uint8_t* image = arena_start + snapshot.image_offset;
+  const uint8_t* image_end = image + snapshot.image_size;
+  const uintptr_t model = reinterpret_cast<uintptr_t>(model_);
+  const SnapshotRanges ranges = {
+      reinterpret_cast<uintptr_t>(arena_start),
+      reinterpret_cast<uintptr_t>(arena_start) + snapshot.arena_size, model,
+      model + model_size,
+      reinterpret_cast<uintptr_t>(MicroAllocator::GetZeroLengthIntArray())};
+  const SnapshotRoots roots = {model_,
+                               graph_.GetAllocations(),
+                               graph_.NumSubgraphs(),
+                               input_tensors_,
+                               inputs_size(),
+                               output_tensors_,
+                               outputs_size(),
+                               scratch_buffer_handles_,
+                               scratch_buffer_count};
+
+  // Every pointer field has to sit in the image and lead somewhere a restore
+  // can rebuild.
+  bool relocatable = true;
+  VisitSnapshotPointers(roots, [&](const void* field) {
+    const uint8_t* word = static_cast<const uint8_t*>(field);
+    uintptr_t value;
+    uint32_t kind;
+    std::memcpy(&value, word, sizeof(value));
+    if (word < image || word + sizeof(value) > image_end) {
+      MicroPrintf("Snapshot pointer field outside the image");
+      relocatable = false;
+    } else if (value != 0) {
+      if (!ClassifySnapshotPointer(value, ranges, &kind, &value)) {
+        MicroPrintf("Snapshot pointer at image offset %u leads outside the "
+                    "arena and model",
+                    static_cast<unsigned>(word - image));
+        relocatable = false;
+      }
+      snapshot.relocation_count++;
+    }
+  });
+  if (!relocatable) {
+    return kTfLiteError;
+  }
+
+  // Kernel buffers that are neither a node's op data nor an eval tensor's
+  // dims can only be reached through op data, which is copied as it is: pin
+  // the snapshot to this arena.
+  size_t reachable_buffers = 0;
+  for (int subgraph_idx = 0; subgraph_idx < graph_.NumSubgraphs();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    const SubgraphAllocations& allocations =
+        graph_.GetAllocations()[subgraph_idx];
+    const uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      if (allocations.node_and_registrations[i].node.user_data != nullptr) {
+        reachable_buffers++;
+      }
+    }
+    const size_t tensors_size =
+        subgraph->tensors() == nullptr ? 0 : subgraph->tensors()->size();
+    for (size_t i = 0; i < tensors_size; ++i) {
+      const uintptr_t dims =
+          reinterpret_cast<uintptr_t>(allocations.tensors[i].dims);
+      if (dims >= ranges.arena_start && dims < ranges.arena_end) {
+        reachable_buffers++;
+      }
+    }
+  }
+  if (micro_context_.persistent_buffer_count() > reachable_buffers) {
+    snapshot.arena_address = ranges.arena_start;
+  }
+
+  constexpr size_t kBytesPerLine = 16;
+  char line[kBytesPerLine * 5 + 1];
+
+  MicroPrintf("// BEGIN MicroSnapshot %s", name);
+  MicroPrintf("// Printed by MicroInterpreter::PrintSnapshot(), do not edit.");
+  if (snapshot.arena_address != 0) {
+    MicroPrintf("// Kernel op data holds pointers into the arena; only restores");
+    MicroPrintf("// into an arena at the same address.");
+  }
+  MicroPrintf("#include \"tensorflow/lite/micro/micro_snapshot.h\"");
+  MicroPrintf("static const uint8_t %s_image[] = {", name);
+  for (size_t pos = 0; pos < snapshot.image_size; pos += kBytesPerLine) {
+    uint8_t bytes[kBytesPerLine];
+    const size_t count = snapshot.image_size - pos < kBytesPerLine
+                             ? snapshot.image_size - pos
+                             : kBytesPerLine;
+    std::memcpy(bytes, image + pos, count);
+    VisitSnapshotPointers(roots, [&](const void* field) {
+      const size_t offset = static_cast<const uint8_t*>(field) - image;
+      uintptr_t value;
+      uint32_t kind;
+      if (offset < pos || offset >= pos + count) {
+        return;
+      }
+      std::memcpy(&value, field, sizeof(value));
+      if (value != 0 && ClassifySnapshotPointer(value, ranges, &kind, &value)) {
+        std::memcpy(bytes + (offset - pos), &value, sizeof(value));
+      }
+    });
+    int length = 0;
+    for (size_t i = 0; i < count; ++i) {
+      length += MicroSnprintf(line + length, sizeof(line) - length, "0x%02x,",
+                              bytes[i]);
+    }
+    MicroPrintf("    %s", line);
+  }
+  MicroPrintf("};");
+
+  MicroPrintf("static const uint32_t %s_relocations[] = {", name);
+  if (snapshot.relocation_count == 0) {
+    MicroPrintf("    0,");
+  }
+  VisitSnapshotPointers(roots, [&](const void* field) {
+    uintptr_t value;
+    uint32_t kind;
+    std::memcpy(&value, field, sizeof(value));
+    if (value != 0 && ClassifySnapshotPointer(value, ranges, &kind, &value)) {
+      MicroPrintf("    0x%08x,",
+                  static_cast<unsigned>(
+                      (static_cast<const uint8_t*>(field) - image) | kind));
+    }
+  });
+  MicroPrintf("};");
+
+  MicroPrintf("const tflite::MicroSnapshot %s = {", name);
+  MicroPrintf("    %u, %u, %u, %u, %u, %u, %u,",
+              static_cast<unsigned>(kMicroSnapshotVersion),
+              static_cast<unsigned>(sizeof(uintptr_t)),
+              static_cast<unsigned>(model_size),
+              static_cast<unsigned>(snapshot.arena_size),
+              static_cast<unsigned>(snapshot.image_offset),
+              static_cast<unsigned>(snapshot.image_size),
+              static_cast<unsigned>(snapshot.non_persistent_size));
+  MicroPrintf(
+      "    %u, %u, %u, %u, %u, 0x%lx,",
+      static_cast<unsigned>(
+          SnapshotOffset(graph_.GetAllocations(), arena_start)),
+      static_cast<unsigned>(SnapshotOffset(input_tensors_, arena_start)),
+      static_cast<unsigned>(SnapshotOffset(output_tensors_, arena_start)),
+      static_cast<unsigned>(
+          SnapshotOffset(scratch_buffer_handles_, arena_start)),
+      static_cast<unsigned>(snapshot.relocation_count),
+      static_cast<unsigned long>(snapshot.arena_address));
+  MicroPrintf("    %s_image, %s_relocations};", name, name);
+  MicroPrintf("// END MicroSnapshot %s", name);
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::AllocateTensorsFromSnapshot(
+    const MicroSnapshot& snapshot, size_t model_size) {
+  if (snapshot.version != kMicroSnapshotVersion ||
+      snapshot.pointer_size != sizeof(uintptr_t) ||
+      snapshot.model_size != model_size) {
+    MicroPrintf("Snapshot was printed for another build or model");
+    return kTfLiteError;
+  }
+  uint8_t* image = allocator_.RestoreModelAllocation(snapshot);
+  if (image == nullptr) {
+    return kTfLiteError;
+  }
+  uint8_t* arena_start = image - snapshot.image_offset;
+
+  std::memcpy(image, snapshot.image, snapshot.image_size);
+  const uintptr_t bases[] = {
+      reinterpret_cast<uintptr_t>(arena_start),
+      reinterpret_cast<uintptr_t>(model_),
+      reinterpret_cast<uintptr_t>(MicroAllocator::GetZeroLengthIntArray())};
+  for (uint32_t i = 0; i < snapshot.relocation_count; ++i) {
+    const uint32_t entry = snapshot.relocations[i];
+    uint8_t* word = image + (entry & ~kMicroSnapshotRelocationKindMask);
+    uintptr_t value;
+    std::memcpy(&value, word, sizeof(value));
+    value += bases[(entry & kMicroSnapshotRelocationKindMask) >> 30];
+    std::memcpy(word, &value, sizeof(value));
+  }
+
+  graph_.SetSubgraphAllocations(reinterpret_cast<SubgraphAllocations*>(
+      arena_start + snapshot.subgraph_allocations));
+  input_tensors_ = reinterpret_cast<TfLiteTensor**>(
+      arena_start + snapshot.input_tensors);
+  output_tensors_ = reinterpret_cast<TfLiteTensor**>(
+      arena_start + snapshot.output_tensors);
+  if (snapshot.scratch_buffer_handles != kMicroSnapshotNull) {
+    scratch_buffer_handles_ = reinterpret_cast<ScratchBufferHandle*>(
+        arena_start + snapshot.scratch_buffer_handles);
+  }
+  micro_context_.SetScratchBufferHandles(scratch_buffer_handles_);
+
+  // Registrations live in the op resolver, which may have moved since the
+  // snapshot was printed.
+  auto* opcodes = model_->operator_codes();
+  for (int subgraph_idx = 0; subgraph_idx < graph_.NumSubgraphs();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    NodeAndRegistration* node_and_registrations =
+        graph_.GetAllocations()[subgraph_idx].node_and_registrations;
+    uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (size_t i = 0; i < operators_size; ++i) {
+      const auto* opcode =
+          opcodes->Get(subgraph->operators()->Get(i)->opcode_index());
+      TF_LITE_ENSURE_STATUS(GetRegistrationFromOpCode(
+          opcode, op_resolver_, &node_and_registrations[i].registration));
+      if (node_and_registrations[i].registration == nullptr) {
+        MicroPrintf("Missing registration for %s",
+                    EnumNameBuiltinOperator(GetBuiltinCode(opcode)));
+        return kTfLiteError;
+      }
+    }
+  }
+
+  TF_LITE_ENSURE_STATUS(Reset());
+
+  tensors_allocated_ = true;
+  micro_context_.SetInterpreterState(
+      MicroInterpreterContext::InterpreterState::kInvoke);
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroInterpreter::Invoke() {
   if (initialization_status_ != kTfLiteOk) {
     MicroPrintf("Invoke() called after initialization failed\n");
@@ -303,6 +660,127 @@ TfLiteTensor* MicroInterpreter::input(size_t index) {
   return input_tensors_[index];
 }
 
+TfLiteStatus MicroInterpreter::BindInput(size_t index, const void* buffer,
+                                         size_t bytes) {
+  if (!tensors_allocated_) {
+    MicroPrintf("BindInput() called before AllocateTensors()");
+    return kTfLiteError;
+  }
+  TfLiteTensor* tensor = input(index);
+  if (tensor == nullptr || buffer == nullptr) {
+    return kTfLiteError;
+  }
+  const int tensor_index = inputs().Get(index);
+  TfLiteEvalTensor* eval_tensor =
+      &graph_.GetAllocations()[0].tensors[tensor_index];
+
+  if (input_arena_data_ == nullptr) {
+    input_arena_data_ = reinterpret_cast<void**>(
+        allocator_.AllocatePersistentBuffer(sizeof(void*) * inputs_size()));
+    if (input_arena_data_ == nullptr) {
+      MicroPrintf("Failed to allocate %d bytes for bound inputs",
+                  static_cast<int>(sizeof(void*) * inputs_size()));
+      return kTfLiteError;
+    }
+    for (size_t i = 0; i < inputs_size(); ++i) {
+      input_arena_data_[i] = input_tensors_[i]->data.data;
+    }
+  }
+  if (buffer == input_arena_data_[index]) {
+    return UnbindInput(index);
+  }
+
+  if (bytes != tensor->bytes) {
+    MicroPrintf("BindInput(%d): buffer has %d bytes, the tensor needs %d",
+                static_cast<int>(index), static_cast<int>(bytes),
+                static_cast<int>(tensor->bytes));
+    return kTfLiteError;
+  }
+  size_t element_size = 1;
+  TF_LITE_ENSURE_STATUS(TfLiteTypeSizeOf(tensor->type, &element_size));
+  if (reinterpret_cast<uintptr_t>(buffer) % element_size != 0) {
+    MicroPrintf("BindInput(%d): buffer is not %d-byte aligned",
+                static_cast<int>(index), static_cast<int>(element_size));
+    return kTfLiteError;
+  }
+  if (allocator_.OverlapsNonPersistentMemory(buffer, bytes)) {
+    MicroPrintf("BindInput(%d): buffer overlaps the planned arena",
+                static_cast<int>(index));
+    return kTfLiteError;
+  }
+  if (tensor->is_variable) {
+    MicroPrintf("BindInput(%d): variable tensors are written in place",
+                static_cast<int>(index));
+    return kTfLiteError;
+  }
+  for (size_t i = 0; i < outputs_size(); ++i) {
+    if (outputs().Get(i) == tensor_index) {
+      MicroPrintf("BindInput(%d): input is also output %d",
+                  static_cast<int>(index), static_cast<int>(i));
+      return kTfLiteError;
+    }
+  }
+
+  // Kernels read inputs through the eval tensor; input() hands out the
+  // TfLiteTensor, so both point at the bound buffer.
+  void* previous = eval_tensor->data.data;
+  eval_tensor->data.data = const_cast<void*>(buffer);
+  tensor->data.data = const_cast<void*>(buffer);
+  RebindInPlaceViews(previous, eval_tensor->data.data);
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::UnbindInput(size_t index) {
+  TfLiteTensor* tensor = input(index);
+  if (tensor == nullptr) {
+    return kTfLiteError;
+  }
+  if (input_arena_data_ == nullptr) {
+    return kTfLiteOk;  // nothing was ever bound
+  }
+  TfLiteEvalTensor* eval_tensor =
+      &graph_.GetAllocations()[0].tensors[inputs().Get(index)];
+  void* previous = eval_tensor->data.data;
+  eval_tensor->data.data = input_arena_data_[index];
+  tensor->data.data = input_arena_data_[index];
+  RebindInPlaceViews(previous, input_arena_data_[index]);
+  return kTfLiteOk;
+}
+
+void MicroInterpreter::RebindInPlaceViews(void* from, void* to) {
+  if (from == to) {
+    return;
+  }
+  SubgraphAllocations* allocations = graph_.GetAllocations();
+  const SubGraph* subgraph = model_->subgraphs()->Get(0);
+  const uint32_t operators_size = NumSubgraphOperators(subgraph);
+  // Operators run in order, so views of views are moved as well.
+  for (uint32_t i = 0; i < operators_size; ++i) {
+    const NodeAndRegistration& node_and_registration =
+        allocations[0].node_and_registrations[i];
+    const TfLiteNode& node = node_and_registration.node;
+    if (!(node_and_registration.registration->inplace_operator &
+          kTfLiteInplaceOpDataUnmodified) ||
+        node.inputs->size < 1 || node.outputs->size < 1 ||
+        node.inputs->data[0] < 0) {
+      continue;
+    }
+    const int output_index = node.outputs->data[0];
+    bool is_model_output = false;
+    for (size_t j = 0; j < outputs_size(); ++j) {
+      is_model_output |= outputs().Get(j) == output_index;
+    }
+    TfLiteEvalTensor* input = &allocations[0].tensors[node.inputs->data[0]];
+    TfLiteEvalTensor* output = &allocations[0].tensors[output_index];
+    // output() hands out its own TfLiteTensor, so model outputs keep their
+    // buffer and the kernel copies.
+    if (input->data.data == to && output->data.data == from &&
+        !is_model_output) {
+      output->data.data = to;
+    }
+  }
+}
+
 TfLiteTensor* MicroInterpreter::output(size_t index) {
   const size_t length = outputs_size();
   if (index >= length) {
@@ -75,6 +75,24 @@ class MicroInterpreter {
   // intermediate tensors.
   TfLiteStatus AllocateTensors();
 
+  // Prints the state AllocateTensors() left in the persistent arena as a C
+  // header defining `const tflite::MicroSnapshot <name>` (see
+  // micro_snapshot.h), between "// BEGIN MicroSnapshot" and "// END" lines.
+  // Call it right after AllocateTensors() in a capture build running on the
+  // target; `model_size` is the length of the model flatbuffer. Needs an
+  // interpreter over a single arena and error strings (MicroPrintf).
+  TfLiteStatus PrintSnapshot(const char* name, size_t model_size);
+
+  // Replaces AllocateTensors() at boot: copies the snapshot into the arena,
+  // relocates it and looks up the kernel registrations again, so no
+  // flatbuffer parsing, kernel Init/Prepare or memory planning runs. Fails
+  // without touching the arena when the snapshot was printed for a different
+  // ABI, model size, arena layout or, when pinned, arena address;
+  // AllocateTensors() can then still be used. The op resolver must register
+  // the same kernels as at capture.
+  TfLiteStatus AllocateTensorsFromSnapshot(const MicroSnapshot& snapshot,
+                                           size_t model_size);
+
   // In order to support partial graph runs for strided models, this can return
   // values other than kTfLiteOk and kTfLiteError.
   // TODO(b/149795762): Add this to the TfLiteStatus enum.
@@ -104,6 +122,22 @@ class MicroInterpreter {
     return nullptr;
   }
 
+  // Makes input `index` read from a caller-owned buffer (a UART receive slot,
+  // an image in flash, ...) in the following Invoke() calls instead of its
+  // arena buffer, so the input does not have to be copied in. `buffer` must
+  // hold exactly input(index)->bytes, be aligned to the element size and stay
+  // valid and unchanged until UnbindInput() or the next BindInput(). It must
+  // not overlap the planned part of the arena, which other tensors reuse while
+  // the model runs. Kernels only read inputs, so `buffer` may be read-only;
+  // variable tensors and inputs that are also model outputs are rejected.
+  // Outputs of operators that leave the data unmodified (RESHAPE) and were
+  // planned in the input's buffer follow the binding, so they are not copied
+  // either. Only available after AllocateTensors().
+  TfLiteStatus BindInput(size_t index, const void* buffer, size_t bytes);
+
+  // Points input `index` back at its arena buffer.
+  TfLiteStatus UnbindInput(size_t index);
+
   TfLiteTensor* output(size_t index);
   size_t outputs_size() const {
     return model_->subgraphs()->Get(0)->outputs()->size();
@@ -183,6 +217,10 @@ class MicroInterpreter {
   // Gets the current subgraph index used from within context methods.
   int get_subgraph_index() { return graph_.GetCurrentSubgraphIndex(); }
 
+  // Moves the outputs of kTfLiteInplaceOpDataUnmodified operators that share
+  // their input's buffer at `from` over to `to`, after that input moved.
+  void RebindInPlaceViews(void* from, void* to);
+
   const Model* model_;
   const MicroOpResolver& op_resolver_;
   TfLiteContext context_ = {};
@@ -198,6 +236,8 @@ class MicroInterpreter {
   // from TfLiteEvalTensor.
   TfLiteTensor** input_tensors_;
   TfLiteTensor** output_tensors_;
+  // Arena buffer of each input, saved by the first BindInput().
+  void** input_arena_data_ = nullptr;
 
   MicroInterpreterContext micro_context_;
 };
@@ -62,7 +62,11 @@ MicroInterpreterContext::~MicroInterpreterContext() {}
 void* MicroInterpreterContext::AllocatePersistentBuffer(size_t bytes) {
   TFLITE_DCHECK(state_ == InterpreterState::kPrepare ||
                 state_ == InterpreterState::kInit);
-  return allocator_.AllocatePersistentBuffer(bytes);
+  void* buffer = allocator_.AllocatePersistentBuffer(bytes);
+  if (buffer != nullptr) {
+    ++persistent_buffer_count_;
+  }
+  return buffer;
 }
 
 TfLiteStatus MicroInterpreterContext::RequestScratchBufferInArena(
@@ -51,6 +51,9 @@ class MicroInterpreterContext : public MicroContext {
   // Virtual so that it can be faked for kernel tests.
   virtual void* AllocatePersistentBuffer(size_t bytes) override;
 
+  // Number of persistent buffers kernels allocated through this context.
+  size_t persistent_buffer_count() const { return persistent_buffer_count_; }
+
   // Request a scratch buffer in the arena through static memory planning.
   // This method is only available in Prepare stage and the buffer is allocated
   // by the interpreter between Prepare and Eval stage. In Eval stage,
@@ -166,6 +169,7 @@ class MicroInterpreterContext : public MicroContext {
   InterpreterState state_;
 
   ScratchBufferHandle* scratch_buffer_handles_ = nullptr;
+  size_t persistent_buffer_count_ = 0;
   void* external_context_payload_ = nullptr;
   MicroProfilerInterface* alt_profiler_ = nullptr;
 
@@ -68,8 +68,14 @@ class MicroProfiler : public MicroProfilerInterface {
  private:
   // Maximum number of events that this class can keep track of. The
   // MicroProfiler will abort if AddEvent is called more than kMaxEvents number
-  // of times. Increase this number if you need more events.
+  // of times. Increase this number if you need more events. Each event costs
+  // 20 bytes of RAM, so small targets define TF_LITE_MICRO_PROFILER_MAX_EVENTS
+  // to a few times their op count.
+#if defined(TF_LITE_MICRO_PROFILER_MAX_EVENTS)
+  static constexpr int kMaxEvents = TF_LITE_MICRO_PROFILER_MAX_EVENTS;
+#else
   static constexpr int kMaxEvents = 4096;
+#endif
 
   const char* tags_[kMaxEvents];
   uint32_t start_ticks_[kMaxEvents];
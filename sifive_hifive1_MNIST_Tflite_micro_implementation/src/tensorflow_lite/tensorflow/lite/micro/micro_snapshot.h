@@ -0,0 +1,74 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_SNAPSHOT_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tflite {
+
+// Bump when the layout of MicroSnapshot or of the image changes.
+constexpr uint32_t kMicroSnapshotVersion = 2;
+
+// Offset value for a null pointer in MicroSnapshot.
+constexpr uint32_t kMicroSnapshotNull = 0xFFFFFFFF;
+
+// Kind of a relocation entry, in its top two bits: the word is an offset
+// from the aligned arena start, an offset from the Model table, or points at
+// MicroAllocator's shared empty dims array.
+constexpr uint32_t kMicroSnapshotArenaRelocation = 0x00000000;
+constexpr uint32_t kMicroSnapshotModelRelocation = 0x40000000;
+constexpr uint32_t kMicroSnapshotZeroArrayRelocation = 0x80000000;
+constexpr uint32_t kMicroSnapshotRelocationKindMask = 0xC0000000;
+
+// The persistent arena state MicroInterpreter::AllocateTensors() leaves
+// behind: eval tensors, nodes, builtin data, kernel user data, scratch buffer
+// handles and the input/output TfLiteTensors. Printed as a C header by
+// MicroInterpreter::PrintSnapshot() and restored with
+// MicroInterpreter::AllocateTensorsFromSnapshot(), which skips flatbuffer
+// parsing, kernel Init/Prepare and memory planning.
+//
+// The image holds raw structs, so a snapshot is only valid for the ABI, model,
+// op resolver, memory planner and arena size it was printed with. The pointer
+// fields the allocator and AllocateTensors() fill in (subgraph allocations,
+// nodes, eval tensors, input/output tensors and their quantization, scratch
+// buffer handles) are stored as offsets and listed in `relocations`: the byte
+// offset of the word in the image ORed with its kind. Registration pointers
+// are resolved again on restore. Builtin data and kernel op data are copied
+// as they are; when a kernel keeps pointers to extra persistent buffers in
+// its op data, `arena_address` pins the snapshot to the arena address it was
+// printed at.
+struct MicroSnapshot {
+  uint32_t version;
+  uint32_t pointer_size;
+  uint32_t model_size;
+  uint32_t arena_size;            // aligned arena, as MicroAllocator sees it
+  uint32_t image_offset;          // start of the image in the arena
+  uint32_t image_size;
+  uint32_t non_persistent_size;   // head reserved by the memory plan
+  uint32_t subgraph_allocations;  // arena offsets of the interpreter's roots
+  uint32_t input_tensors;
+  uint32_t output_tensors;
+  uint32_t scratch_buffer_handles;
+  uint32_t relocation_count;
+  uintptr_t arena_address;        // 0, or the only arena it restores into
+  const uint8_t* image;
+  const uint32_t* relocations;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_SNAPSHOT_H_
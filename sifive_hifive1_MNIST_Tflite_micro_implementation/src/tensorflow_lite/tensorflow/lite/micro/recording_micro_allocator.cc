@@ -20,7 +20,10 @@ limitations under the License.
 #include "tensorflow/lite/micro/compatibility.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+#include "tensorflow/lite/micro/memory_planner/linear_memory_planner.h"
+#include "tensorflow/lite/micro/memory_planner/offline_memory_planner.h"
 #include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
 namespace tflite {
@@ -42,17 +45,28 @@ RecordingMicroAllocator::RecordingMicroAllocator(
     : MicroAllocator(recording_memory_allocator, memory_planner),
       recording_memory_allocator_(recording_memory_allocator) {}
 
-RecordingMicroAllocator* RecordingMicroAllocator::Create(uint8_t* tensor_arena,
-                                                         size_t arena_size) {
+RecordingMicroAllocator* RecordingMicroAllocator::Create(
+    uint8_t* tensor_arena, size_t arena_size,
+    MemoryPlannerType memory_planner_type) {
   RecordingSingleArenaBufferAllocator* simple_memory_allocator =
       RecordingSingleArenaBufferAllocator::Create(tensor_arena, arena_size);
   TFLITE_DCHECK(simple_memory_allocator != nullptr);
 
-  uint8_t* memory_planner_buffer =
-      simple_memory_allocator->AllocatePersistentBuffer(
-          sizeof(GreedyMemoryPlanner), alignof(GreedyMemoryPlanner));
-  GreedyMemoryPlanner* memory_planner =
-      new (memory_planner_buffer) GreedyMemoryPlanner();
+  uint8_t* memory_planner_buffer = nullptr;
+  MicroMemoryPlanner* memory_planner = nullptr;
+  if (memory_planner_type == MemoryPlannerType::kLinear) {
+    memory_planner_buffer = simple_memory_allocator->AllocatePersistentBuffer(
+        sizeof(LinearMemoryPlanner), alignof(LinearMemoryPlanner));
+    memory_planner = new (memory_planner_buffer) LinearMemoryPlanner();
+  } else if (memory_planner_type == MemoryPlannerType::kOffline) {
+    memory_planner_buffer = simple_memory_allocator->AllocatePersistentBuffer(
+        sizeof(OfflineMemoryPlanner), alignof(OfflineMemoryPlanner));
+    memory_planner = new (memory_planner_buffer) OfflineMemoryPlanner();
+  } else {
+    memory_planner_buffer = simple_memory_allocator->AllocatePersistentBuffer(
+        sizeof(GreedyMemoryPlanner), alignof(GreedyMemoryPlanner));
+    memory_planner = new (memory_planner_buffer) GreedyMemoryPlanner();
+  }
 
   uint8_t* allocator_buffer = simple_memory_allocator->AllocatePersistentBuffer(
       sizeof(RecordingMicroAllocator), alignof(RecordingMicroAllocator));
@@ -78,6 +92,8 @@ RecordedAllocation RecordingMicroAllocator::GetRecordedAllocation(
       return recorded_node_and_registration_array_data_;
     case RecordedAllocationType::kOpData:
       return recorded_op_data_;
+    case RecordedAllocationType::kScratchBufferData:
+      return recorded_scratch_buffer_data_;
 #ifdef USE_TFLM_COMPRESSION
     case RecordedAllocationType::kCompressionData:
       return recorded_compression_data_;
@@ -118,6 +134,8 @@ void RecordingMicroAllocator::PrintAllocations() const {
                           "NodeAndRegistration structs");
   PrintRecordedAllocation(RecordedAllocationType::kOpData,
                           "Operator runtime data", "OpData structs");
+  PrintRecordedAllocation(RecordedAllocationType::kScratchBufferData,
+                          "Scratch buffer requests", "scratch buffers");
 
 #ifdef USE_TFLM_COMPRESSION
 
@@ -135,6 +153,20 @@ void* RecordingMicroAllocator::AllocatePersistentBuffer(size_t bytes) {
   return buffer;
 }
 
+TfLiteStatus RecordingMicroAllocator::RequestScratchBufferInArena(
+    size_t bytes, int subgraph_idx, int* buffer_idx) {
+  TF_LITE_ENSURE_STATUS(MicroAllocator::RequestScratchBufferInArena(
+      bytes, subgraph_idx, buffer_idx));
+
+  // The request itself sits in the head until the plan is committed; record
+  // the buffer the plan will have to place.
+  recorded_scratch_buffer_data_.requested_bytes += bytes;
+  recorded_scratch_buffer_data_.used_bytes +=
+      AlignSizeUp(bytes, MicroArenaBufferAlignment());
+  recorded_scratch_buffer_data_.count++;
+  return kTfLiteOk;
+}
+
 void RecordingMicroAllocator::PrintRecordedAllocation(
     RecordedAllocationType allocation_type, const char* allocation_name,
     const char* allocation_description) const {
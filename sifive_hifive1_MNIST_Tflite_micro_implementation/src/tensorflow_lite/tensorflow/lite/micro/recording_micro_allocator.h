@@ -24,7 +24,6 @@ namespace tflite {
 
 // List of buckets currently recorded by this class. Each type keeps a list of
 // allocated information during model initialization.
-// TODO(b/169834511): Add tracking for scratch buffer allocations.
 enum class RecordedAllocationType {
   kTfLiteEvalTensorData,
   kPersistentTfLiteTensorData,
@@ -33,6 +32,8 @@ enum class RecordedAllocationType {
   kTfLiteTensorVariableBufferData,
   kNodeAndRegistrationArray,
   kOpData,
+  // Requests only: the buffers are planned into the head with the tensors.
+  kScratchBufferData,
 #ifdef USE_TFLM_COMPRESSION
   kCompressionData,
 #endif  // USE_TFLM_COMPRESSION
@@ -59,8 +60,9 @@ struct RecordedAllocation {
 // for auditing memory usage or integration testing.
 class RecordingMicroAllocator : public MicroAllocator {
  public:
-  static RecordingMicroAllocator* Create(uint8_t* tensor_arena,
-                                         size_t arena_size);
+  static RecordingMicroAllocator* Create(
+      uint8_t* tensor_arena, size_t arena_size,
+      MemoryPlannerType memory_planner_type = MemoryPlannerType::kGreedy);
 
   // Returns the fixed amount of memory overhead of RecordingMicroAllocator.
   static size_t GetDefaultTailUsage();
@@ -76,6 +78,8 @@ class RecordingMicroAllocator : public MicroAllocator {
   void PrintAllocations() const;
 
   void* AllocatePersistentBuffer(size_t bytes) override;
+  TfLiteStatus RequestScratchBufferInArena(size_t bytes, int subgraph_idx,
+                                           int* buffer_idx) override;
 
  protected:
   TfLiteStatus AllocateNodeAndRegistrations(
@@ -125,6 +129,7 @@ class RecordingMicroAllocator : public MicroAllocator {
   RecordedAllocation recorded_persistent_buffer_data_ = {};
   RecordedAllocation recorded_tflite_tensor_variable_buffer_data_ = {};
   RecordedAllocation recorded_node_and_registration_array_data_ = {};
+  RecordedAllocation recorded_scratch_buffer_data_ = {};
 #ifdef USE_TFLM_COMPRESSION
   RecordedAllocation recorded_compression_data_ = {};
 #endif  // USE_TFLM_COMPRESSION
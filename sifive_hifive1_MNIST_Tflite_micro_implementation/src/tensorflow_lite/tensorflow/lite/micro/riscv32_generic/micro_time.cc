@@ -0,0 +1,81 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// RISC-V implementation of the timer functions used by MicroProfiler.
+//
+// On RISC-V a tick is one core clock cycle, read from the cycle CSR (the
+// unprivileged shadow of mcycle) with rdcycle. Build with
+// -DTF_LITE_RISCV_METAL_TIMER to go through freedom-metal's
+// metal_timer_get_cyclecount() instead, for cores or privilege modes where
+// the CSR read traps. Anywhere else (host builds of the same sources) a tick
+// is one microsecond of clock_gettime(CLOCK_MONOTONIC).
+//
+// Ticks are the low 32 bits of the counter, so they wrap: every 268 s at the
+// FE310's 16 MHz reset clock, every 13 s at 320 MHz. MicroProfiler only ever
+// subtracts two tick values as uint32_t, which stays correct across one wrap,
+// so any event shorter than the wrap period is measured exactly.
+
+#include "tensorflow/lite/micro/micro_time.h"
+
+#if defined(__riscv)
+#if defined(TF_LITE_RISCV_METAL_TIMER)
+#include <metal/timer.h>
+#endif
+#else
+#include <time.h>
+#endif
+
+// Core clock the cycle counter runs at. The FE310-G002 comes out of reset on
+// the 16 MHz PLL bypass clock; define this to the rate the application sets
+// with metal_clock_set_rate_hz() if it changes the PLL.
+#ifndef TF_LITE_RISCV_CORE_CLOCK_HZ
+#define TF_LITE_RISCV_CORE_CLOCK_HZ 16000000
+#endif
+
+namespace tflite {
+
+#if defined(__riscv)
+
+uint32_t ticks_per_second() { return TF_LITE_RISCV_CORE_CLOCK_HZ; }
+
+uint32_t GetCurrentTimeTicks() {
+#if defined(TF_LITE_RISCV_METAL_TIMER)
+  unsigned long long cycles = 0;
+  metal_timer_get_cyclecount(0, &cycles);
+  return static_cast<uint32_t>(cycles);
+#else
+  // rdcycle reads the low XLEN bits; on RV64 the truncation below keeps the
+  // same 32-bit wrap as RV32.
+  unsigned long cycles;
+  __asm__ volatile("rdcycle %0" : "=r"(cycles));
+  return static_cast<uint32_t>(cycles);
+#endif
+}
+
+#else  // !defined(__riscv)
+
+uint32_t ticks_per_second() { return 1000000; }
+
+uint32_t GetCurrentTimeTicks() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  uint64_t us = static_cast<uint64_t>(now.tv_sec) * 1000000u +
+                static_cast<uint64_t>(now.tv_nsec) / 1000u;
+  return static_cast<uint32_t>(us);
+}
+
+#endif  // defined(__riscv)
+
+}  // namespace tflite
@@ -0,0 +1,269 @@
+'''
+    bitwidth_search.py
+    Author: Shwetank Shekhar
+
+    Mixed-precision search for the BitNet engine (Approach 1,
+    app_inference.h: processfclayer with 1/2/4/8-bit packed weights, no
+    bias, ReLUNorm between layers, prediction = ReLUNorm max position).
+
+    The int8 weights of the .tflite are requantized per layer to every width
+    the engine's word layout allows for that layer (the inner loops read
+    32/16/8/4 activations per word, so n_input must be a multiple), then each
+    combination is run through the real engine: app_inference.h is compiled
+    for the host into a shared library and driven over ctypes. Cost is the
+    FE310 cycle model below plus the weight flash. The Pareto front over
+    (accuracy, cycles, flash) is printed; --out-dir writes
+    mnist_model_params.[ch] in Approach 1's layout for the most accurate point
+    inside --max-cycles / --max-flash (or --pick N from the table).
+
+    Encodings (bits_per_weight in the engine, first weight in the top bits):
+        1   sign bit, set = +1, clear = -1
+        2   sign bit (set = negative) + magnitude bit: +-1, +-3
+        4   8 + 4, two's complement nibble
+        8   8 + 8, two's complement byte
+
+    python tools/model_compiler/bitwidth_search.py MODEL.tflite --engine src/app_inference.h --testset T.c
+    python tools/model_compiler/bitwidth_search.py MODEL.tflite --engine src/app_inference.h --max-flash 2048 --out-dir src
+'''
+import argparse
+import ctypes
+import itertools
+import os
+import subprocess
+import tempfile
+
+import numpy as np
+
+from compiler import _write, load_legacy_samples, mnist_samples
+from tflite_model import TFLiteModel
+
+WIDTHS = (1, 2, 4, 8)
+ENGINE_BPW = {1: "1", 2: "2", 4: "8 + 4", 8: "8 + 8"}
+ENGINE_BPW_VALUE = {1: 1, 2: 2, 4: 12, 8: 16}
+
+# FE310 cycles per weight from the processfclayer inner loops (rv32imac, so
+# the multiply paths are the ones compiled): activation load, weight
+# extract / sign test, multiply or add/sub, chunk shift, loop; plus one word
+# load per 32 / 16 / 8 / 4 weights.
+CYCLES_PER_WEIGHT = {1: 5.0, 2: 7.0, 4: 6.0, 8: 6.0}
+CYCLES_PER_WORD = 2.0
+CYCLES_PER_ROW = 6.0        # sum init, store, row loop
+CYCLES_PER_RELU_ELEMENT = 12.0  # ReLUNorm max scan + scaling pass
+
+
+def quantize(w, bits):
+    """int8 weights -> integer levels the engine represents at `bits`."""
+    w = w.astype(np.float64)
+    peak = np.abs(w).max() or 1.0
+    if bits == 8:
+        return w.astype(np.int64)
+    if bits == 4:
+        return np.clip(np.round(w / (peak / 7.0)), -8, 7).astype(np.int64)
+    if bits == 2:
+        q = w / (peak / 3.0)
+        return np.where(q < 0, -1, 1) * np.where(np.abs(q) >= 2.0, 3, 1)
+    return np.where(w >= 0, 1, -1)
+
+
+def pack(levels, bits):
+    """Row-major levels -> uint32 words, first weight in the top bits."""
+    per_word = 32 // bits
+    flat = levels.reshape(-1)
+    if bits == 1:
+        fields = (flat > 0).astype(np.uint64)
+    elif bits == 2:
+        fields = ((flat < 0).astype(np.uint64) << 1) | (np.abs(flat) == 3).astype(np.uint64)
+    else:
+        fields = (flat & ((1 << bits) - 1)).astype(np.uint64)
+    fields = fields.reshape(-1, per_word)
+    shifts = np.arange(per_word - 1, -1, -1, dtype=np.uint64) * np.uint64(bits)
+    return (fields << shifts).sum(axis=1).astype(np.uint32)
+
+
+def allowed_widths(n_input):
+    return [b for b in WIDTHS if n_input % (32 // b) == 0]
+
+
+class HostEngine:
+    """app_inference.h built for the host; runs a full BitMnistInference pass."""
+
+    def __init__(self, engine_header):
+        src_dir = os.path.dirname(os.path.abspath(engine_header))
+        self._tmp = tempfile.TemporaryDirectory()
+        shim = os.path.join(self._tmp.name, "engine.c")
+        lib = os.path.join(self._tmp.name, "libengine.so")
+        with open(shim, "w") as f:
+            f.write(f"#include \"{os.path.basename(engine_header)}\"\n")
+        subprocess.run(["cc", "-O2", "-shared", "-fPIC", "-Wall", "-I", src_dir, shim, "-o", lib], check=True)
+        self.lib = ctypes.CDLL(lib)
+        self.lib.ReLUNorm.restype = ctypes.c_uint32
+
+    def predict(self, image, layers):
+        """layers: [(packed words, bits_per_weight, n_input, n_output)]."""
+        act = np.ascontiguousarray(image, dtype=np.int8)
+        pred = 0
+        for words, bpw, n_in, n_out in layers:
+            out = np.zeros(n_out, dtype=np.int32)
+            nxt = np.zeros(n_out, dtype=np.int8)
+            self.lib.processfclayer(act.ctypes.data_as(ctypes.c_void_p), words.ctypes.data_as(ctypes.c_void_p),
+                                    ctypes.c_int32(bpw), ctypes.c_uint32(n_in), ctypes.c_uint32(n_out),
+                                    out.ctypes.data_as(ctypes.c_void_p))
+            pred = self.lib.ReLUNorm(out.ctypes.data_as(ctypes.c_void_p), nxt.ctypes.data_as(ctypes.c_void_p),
+                                     ctypes.c_uint32(n_out))
+            act = nxt
+        return int(pred)
+
+
+class Point:
+    def __init__(self, bits, correct, cycles, flash):
+        self.bits = bits
+        self.correct = correct
+        self.cycles = cycles
+        self.flash = flash
+        self.pareto = False
+
+    def dominated_by(self, other):
+        no_worse = other.correct >= self.correct and other.cycles <= self.cycles and other.flash <= self.flash
+        better = other.correct > self.correct or other.cycles < self.cycles or other.flash < self.flash
+        return no_worse and better
+
+
+def cost(weights, bits):
+    cycles = flash = 0.0
+    for w, b in zip(weights, bits):
+        n_out, n_in = w.shape
+        words = n_out * n_in // (32 // b)
+        cycles += w.size * CYCLES_PER_WEIGHT[b] + words * CYCLES_PER_WORD + n_out * (CYCLES_PER_ROW + CYCLES_PER_RELU_ELEMENT)
+        flash += words * 4
+    return cycles, int(flash)
+
+
+def search(weights, engine, samples):
+    """Every allowed per-layer width assignment, with the Pareto flag set."""
+    encoded = {}
+    for l, w in enumerate(weights):
+        for b in allowed_widths(w.shape[1]):
+            encoded[l, b] = pack(quantize(w, b), b)
+    points = []
+    for bits in itertools.product(*(allowed_widths(w.shape[1]) for w in weights)):
+        layers = [(encoded[l, b], ENGINE_BPW_VALUE[b], w.shape[1], w.shape[0])
+                  for l, (w, b) in enumerate(zip(weights, bits))]
+        correct = sum(int(engine.predict(image, layers) == label) for image, label in samples)
+        points.append(Point(bits, correct, *cost(weights, bits)))
+    for p in points:
+        p.pareto = not any(p.dominated_by(q) for q in points)
+    return points
+
+
+def print_points(points, n_samples):
+    print(f"  {'#':>3}  {'bits':<12} {'accuracy':>16} {'cycles':>8} {'flash B':>8}  pareto")
+    for i, p in enumerate(points):
+        bits = "/".join(str(b) for b in p.bits)
+        print(f"  {i:>3}  {bits:<12} {p.correct:>5}/{n_samples:<5} {100.0 * p.correct / n_samples:>5.1f}% "
+              f"{int(p.cycles):>8} {p.flash:>8}  {'*' if p.pareto else ''}")
+
+
+def bitnet_params(model, weights, bits, samples):
+    """mnist_model_params.[ch] in Approach 1's layout for one width assignment."""
+    widths = "/".join(str(b) for b in bits)
+    banner = ("/*\n * This file is auto-generated by tools/model_compiler/bitwidth_search.py\n"
+              f" * with per-layer weight bits {widths}. Rerun it to regenerate;\n"
+              " * generate_c_model_params.py would drop the chosen widths.\n"
+              " * Do not modify manually.\n */\n")
+    hf = [banner, "#ifndef MNIST_MODEL_PARAMS_H\n#define MNIST_MODEL_PARAMS_H\n\n#include <stdint.h>\n\n",
+          "#define MAX_N_ACTIVATIONS 64\n\n"]
+    sf = [banner, "#include \"mnist_model_params.h\"\n\n"]
+    fcs = [op for op in model.operators if op.op_name == "FULLY_CONNECTED"]
+    for idx, (op, w, b) in enumerate(zip(fcs, weights, bits), start=1):
+        t_in, t_w, t_out = (model.tensors[op.inputs[0]], model.tensors[op.inputs[1]], model.tensors[op.outputs[0]])
+        words = [f"0x{int(v):08X}" for v in pack(quantize(w, b), b)]
+        has_bias = len(op.inputs) > 2 and op.inputs[2] >= 0
+        biases = [str(v) for v in model.tensors[op.inputs[2]].data] if has_bias else []
+        hf.append(f"// Layer {idx} Parameters\n")
+        hf.append(f"extern const uint32_t L{idx}_weights[{len(words)}];\n")
+        sf.append(f"// Layer {idx} Parameters\n")
+        sf.append(f"const uint32_t L{idx}_weights[{len(words)}] = {{\n    {', '.join(words)}\n}};\n")
+        if has_bias:
+            hf.append(f"extern const int32_t L{idx}_biases[{len(biases)}];\n")
+            sf.append(f"const int32_t L{idx}_biases[{len(biases)}] = {{\n    {', '.join(biases)}\n}};\n")
+        hf.append(f"extern const int32_t L{idx}_bitperweight;\n")
+        hf.append(f"extern const uint32_t L{idx}_incoming_weights;\n")
+        hf.append(f"extern const uint32_t L{idx}_outgoing_weights;\n")
+        sf.append(f"const int32_t L{idx}_bitperweight = {ENGINE_BPW[b]};\n")
+        sf.append(f"const uint32_t L{idx}_incoming_weights = {w.shape[1]};\n")
+        sf.append(f"const uint32_t L{idx}_outgoing_weights = {w.shape[0]};\n")
+        for label, t in (("input", t_in), ("output", t_out), ("weights", t_w)):
+            hf.append(f"extern const float L{idx}_{label}_scale;\n")
+            hf.append(f"extern const int32_t L{idx}_{label}_zero_point;\n")
+            sf.append(f"const float L{idx}_{label}_scale = {t.scale[0]:.8f}f;\n")
+            sf.append(f"const int32_t L{idx}_{label}_zero_point = {t.zero_point[0]};\n")
+        hf.append("\n")
+        sf.append("\n")
+    if samples:
+        hf.append("// Quantized sample input images and their labels\n")
+        sf.append("// Quantized sample input images and their labels\n")
+    for i, (image, label) in enumerate(samples):
+        hf.append(f"extern const int8_t input_data_{i}[{len(image)}];\n")
+        hf.append(f"extern const uint8_t label_{i};\n")
+        sf.append(f"const int8_t input_data_{i}[{len(image)}] = {{\n    {', '.join(str(int(v)) for v in image)}\n}};\n")
+        sf.append(f"const uint8_t label_{i} = {label};\n")
+    hf.append(("\n" if samples else "") + "#endif // MNIST_MODEL_PARAMS_H\n")
+    return "".join(hf), "".join(sf)
+
+
+def choose(points, max_cycles, max_flash):
+    fits = [p for p in points if (max_cycles is None or p.cycles <= max_cycles)
+            and (max_flash is None or p.flash <= max_flash)]
+    if not fits:
+        return None
+    return max(fits, key=lambda p: (p.correct, -p.cycles, -p.flash))
+
+
+def main(argv=None):
+    from testset import load_testset
+
+    ap = argparse.ArgumentParser(description="Per-layer weight bit-width search for the BitNet engine.")
+    ap.add_argument("model")
+    ap.add_argument("--engine", required=True, help="the project's app_inference.h")
+    ap.add_argument("--mnist", default=os.path.expanduser("~/.keras/datasets/mnist.npz"))
+    ap.add_argument("--samples", type=int, default=1000, help="MNIST test images to score each point on")
+    ap.add_argument("--testset", help="generated mnist_testset.c to score on when mnist.npz is missing")
+    ap.add_argument("--max-cycles", type=float)
+    ap.add_argument("--max-flash", type=int, help="weight bytes")
+    ap.add_argument("--pick", type=int, metavar="N", help="write point N of the table instead of the best in budget")
+    ap.add_argument("--out-dir", help="write mnist_model_params.[ch] for the chosen point")
+    args = ap.parse_args(argv)
+
+    model = TFLiteModel(args.model)
+    t_in = model.tensors[model.inputs[0]]
+    fcs = [op for op in model.operators if op.op_name == "FULLY_CONNECTED"]
+    weights = [model.tensors[op.inputs[1]].data.reshape(model.tensors[op.inputs[1]].shape[0], -1) for op in fcs]
+    params_c = os.path.join(args.out_dir, "mnist_model_params.c") if args.out_dir else None
+    if os.path.exists(args.mnist):
+        samples = mnist_samples(args.mnist, t_in.size, args.samples, t_in.scale[0], int(t_in.zero_point[0]))
+    elif args.testset:
+        samples = load_testset(args.testset)
+    elif params_c and os.path.exists(params_c):
+        samples = load_legacy_samples(params_c)
+    else:
+        raise SystemExit("no evaluation images: pass --testset or provide mnist.npz")
+    print(f"{args.model}: {len(samples)} evaluation images, widths per layer: " +
+          ", ".join(f"L{l + 1} {allowed_widths(w.shape[1])}" for l, w in enumerate(weights)))
+
+    points = search(weights, HostEngine(args.engine), samples)
+    print_points(points, len(samples))
+    if not args.out_dir:
+        return
+    point = points[args.pick] if args.pick is not None else choose(points, args.max_cycles, args.max_flash)
+    if point is None:
+        raise SystemExit("no width assignment fits the budget")
+    print(f"writing {'/'.join(str(b) for b in point.bits)} bits")
+    # Approach 1's main.c still runs its input_data_N samples.
+    keep = load_legacy_samples(params_c) if os.path.exists(params_c) else []
+    hf, sf = bitnet_params(model, weights, point.bits, keep)
+    _write(os.path.join(args.out_dir, "mnist_model_params.h"), hf)
+    _write(params_c, sf)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,992 @@
+'''
+    compiler.py
+    Author: Shwetank Shekhar
+
+    Ahead-of-time compiler for the repo's int8 .tflite MNIST models. It
+    replaces the per-approach generate_c_model_params.py copies (packed uint32
+    for Approach 2, plain int8 for the 12x12 pipelines) with one tool that
+    reads any of the models without TensorFlow and emits, per model:
+
+      * a layer table (model_layer_t, see runtime/model_runtime.h),
+      * weights in a kernel variant picked per layer:
+            int8     row-major int8, reference layout
+            packed   4 int8 per uint32, one row at a time (Approach 2 layout)
+            blocked  4 output rows interleaved per uint32, so every activation
+                     load feeds 4 MACs
+            sparse   CSR rows (row_ptr / col_idx / values) for mostly-zero layers
+            pooled   rows cut into 4/8/16-weight blocks, identical blocks stored
+                     once in a shared pool plus a per-row index table; all-zero
+                     blocks are skipped
+            lut      weights clustered to 4-16 int8 centroids (--lut-centroids),
+                     stored as a value table plus 2/3/4-bit indices in TFLM's
+                     compressed_indices layout; lossy, so only used when
+                     forced with --variant
+      * requantization constants (TFLM multiplier/shift, input zero point
+        folded into the biases, LEAKY_RELU fused into the preceding FC or
+        conv),
+      * a conv front-end: CONV_2D, DEPTHWISE_CONV_2D and MAX_POOL_2D (int8,
+        NHWC, dilation 1), run row by row; a spatial layer feeding another
+        one only gets a ring of the consumer's kernel_h rows in the arena,
+      * a static memory plan: arena offsets for every activation tensor.
+
+    Output is deterministic (no timestamps, stable ordering) so it can be
+    diffed in CI. --legacy int8|packed instead reproduces the old
+    mnist_model_params.[ch] files the existing firmware includes, plus the
+    labelled sample images as one test-set blob (mnist_testset.[ch] and
+    runtime/testset.[ch], see testset.py), or with --inline-samples as the
+    old input_data_N arrays; the per-project generate_c_model_params.py
+    scripts are wrappers for that.
+
+    python tools/model_compiler/compiler.py MODEL.tflite --out-dir src --name mnist_model
+    python tools/model_compiler/compiler.py MODEL.tflite --report
+'''
+import argparse
+import os
+import sys
+
+import numpy as np
+
+import testset
+from quant import (activation_range, conv_multiplier, conv_padding, fc_multiplier,
+                   leaky_relu_multipliers, per_channel_fc_multiplier, quantize_multiplier)
+from tflite_model import TFLiteModel
+
+TOOL_DIR = os.path.dirname(os.path.abspath(__file__))
+RUNTIME_DIR = os.path.join(TOOL_DIR, "runtime")
+RUNTIME_FILES = ("model_runtime.h", "model_runtime.c", "hpm_profile.h", "hpm_profile.c")
+TESTSET_RUNTIME_FILES = ("testset.h", "testset.c")
+TESTSET_NAME = "mnist_testset"
+
+VARIANTS = ("int8", "packed", "blocked", "sparse", "pooled")
+# Kernels that change the weights; never picked by the cycle estimate.
+LOSSY_VARIANTS = ("lut",)
+C_VARIANT = {v: f"MODEL_FC_{v.upper()}" for v in VARIANTS + LOSSY_VARIANTS}
+
+# Rough FE310 (E31) cycle costs per multiply-accumulate, from the inner loops
+# in model_runtime.c: int8 = 2 loads + mul + add + loop; packed = 1 activation
+# load + 1/4 word load + sign-extend; blocked = 1/4 activation load + 1/4 word
+# load + sign-extend; sparse pays an extra index load per non-zero; pooled runs
+# the int8 loop over non-zero blocks plus an index load per block; lut adds a
+# nibble extract and a value-table load per weight but loads one byte per 2.
+CYCLES_PER_MAC = {"int8": 5.0, "packed": 4.25, "blocked": 3.5, "sparse": 6.0, "pooled": 5.0, "lut": 5.5}
+CYCLES_PER_ROW = 12.0  # bias load, requantize, clamp, store
+CYCLES_PER_BLOCK = 6.0  # pooled: index load, zero check, pool address
+POOL_BLOCK_SIZES = (4, 8, 16)
+LUT_CENTROIDS = (4, 16)  # allowed --lut-centroids range
+
+SPATIAL_KINDS = ("conv", "depthwise", "max_pool")
+C_KIND = {"fc": "MODEL_LAYER_FC", "leaky_relu": "MODEL_LAYER_LEAKY_RELU", "conv": "MODEL_LAYER_CONV",
+          "depthwise": "MODEL_LAYER_DEPTHWISE_CONV", "max_pool": "MODEL_LAYER_MAX_POOL"}
+# Conv taps run the int8 loop plus the input offset add; depthwise adds a
+# strided load, max pool is a load and a compare.
+CYCLES_PER_TAP = {"conv": 6.0, "depthwise": 7.0, "max_pool": 4.0}
+MAX_KERNEL = 16        # MODEL_MAX_KERNEL in model_runtime.h
+MAX_STREAM_LAYERS = 8  # MODEL_MAX_STREAM_LAYERS
+
+# Ops after the last FC that do not change the argmax.
+TRAILING_OPS = ("SOFTMAX", "DEQUANTIZE", "LOGISTIC")
+ARENA_ALIGN = 4
+
+
+class CompileError(Exception):
+    pass
+
+
+# --- Lowering: tflite graph -> layer list ---
+
+class Layer:
+    def __init__(self, kind, name, input_id, output_id):
+        self.kind = kind            # "fc", "leaky_relu" or one of SPATIAL_KINDS
+        self.name = name            # L1, L2, ...
+        self.input_id = input_id    # tensor ids after RESHAPE aliasing
+        self.output_id = output_id
+        self.variant = None
+        self.arrays = []            # (c_type, suffix, values)
+        self.fields = {}
+        self.leaky = None           # fused leaky relu constants
+        self.pooling = None         # cached best_pooling() result
+        self.lut = None             # (value table, indices, bit width) once clustered
+        self.stream = False         # spatial: output is a row ring pulled by the next layer
+
+
+def _fc_layer(model, op, name, alias):
+    t_in = model.tensors[op.inputs[0]]
+    t_w = model.tensors[op.inputs[1]]
+    t_out = model.tensors[op.outputs[0]]
+    for t in (t_in, t_w, t_out):
+        if t.dtype_name != "int8":
+            raise CompileError(f"{name}: only int8 FULLY_CONNECTED is supported ({t.name} is {t.dtype_name})")
+    if np.any(t_w.zero_point != 0):
+        raise CompileError(f"{name}: weights must be symmetric (zero point 0)")
+
+    layer = Layer("fc", name, alias(op.inputs[0]), op.outputs[0])
+    w = t_w.data.reshape(t_w.shape[0], -1).astype(np.int8)
+    n_out, n_in = w.shape
+    bias = np.zeros(n_out, dtype=np.int64)
+    if len(op.inputs) > 2 and op.inputs[2] >= 0:
+        bias = model.tensors[op.inputs[2]].data.astype(np.int64)
+
+    # sum_i w*(a - zp) + b == sum_i w*a + (b - zp * sum_i w): fold the input offset away.
+    zp_in = int(t_in.zero_point[0])
+    folded = bias - zp_in * w.astype(np.int64).sum(axis=1)
+    if folded.min() < -(1 << 31) or folded.max() >= (1 << 31):
+        raise CompileError(f"{name}: folded bias overflows int32")
+
+    if t_w.per_channel:
+        pairs = [quantize_multiplier(per_channel_fc_multiplier(t_in.scale[0], s, t_out.scale[0])) for s in t_w.scale]
+        layer.per_channel = (np.array([p[0] for p in pairs], np.int32), np.array([p[1] for p in pairs], np.int32))
+        mult, shift = 0, 0
+    else:
+        layer.per_channel = None
+        mult, shift = quantize_multiplier(fc_multiplier(t_in.scale[0], t_w.scale[0], t_out.scale[0]))
+    act_min, act_max = activation_range(op.options.get("activation", "NONE"),
+                                        t_out.scale[0], int(t_out.zero_point[0]))
+
+    layer.weights = w
+    layer.n_input, layer.n_output = n_in, n_out
+    layer.folded_bias = folded.astype(np.int32)
+    layer.fields = {
+        "multiplier": mult, "shift": shift,
+        "output_zero_point": int(t_out.zero_point[0]),
+        "act_min": act_min, "act_max": act_max,
+    }
+    # Kept for --legacy and the size report.
+    layer.src = {"input": t_in, "weights": t_w, "output": t_out, "bias": bias.astype(np.int32)}
+    return layer
+
+
+def _spatial_layer(model, op, name, alias):
+    """CONV_2D / DEPTHWISE_CONV_2D / MAX_POOL_2D -> Layer with the NHWC geometry in .fields."""
+    kind = {"CONV_2D": "conv", "DEPTHWISE_CONV_2D": "depthwise", "MAX_POOL_2D": "max_pool"}[op.op_name]
+    t_in, t_out = model.tensors[op.inputs[0]], model.tensors[op.outputs[0]]
+    for t in (t_in, t_out):
+        if t.dtype_name != "int8" or len(t.shape) != 4 or t.shape[0] != 1:
+            raise CompileError(f"{name}: only int8 NHWC {op.op_name} with batch 1 is supported ({t.name})")
+    opts = op.options
+    if opts.get("dilation_w", 1) != 1 or opts.get("dilation_h", 1) != 1:
+        raise CompileError(f"{name}: dilated {op.op_name} is not supported")
+    _, in_h, in_w, in_c = t_in.shape
+    _, out_h, out_w, out_c = t_out.shape
+
+    layer = Layer(kind, name, alias(op.inputs[0]), op.outputs[0])
+    layer.n_input, layer.n_output = t_in.size, t_out.size
+    layer.per_channel = None
+    layer.src = {"input": t_in, "output": t_out}
+    act_min, act_max = activation_range(opts.get("activation", "NONE"), t_out.scale[0], int(t_out.zero_point[0]))
+    if kind == "max_pool":
+        kernel_h, kernel_w = opts["filter_h"], opts["filter_w"]
+        if t_in.scale[0] != t_out.scale[0] or t_in.zero_point[0] != t_out.zero_point[0]:
+            raise CompileError(f"{name}: MAX_POOL_2D must keep the input quantization")
+        layer.fields = {"act_min": act_min, "act_max": act_max}
+    else:
+        t_w = model.tensors[op.inputs[1]]
+        if t_w.dtype_name != "int8" or np.any(t_w.zero_point != 0):
+            raise CompileError(f"{name}: filter must be symmetric int8")
+        kernel_h, kernel_w = t_w.shape[1], t_w.shape[2]
+        bias = np.zeros(out_c, dtype=np.int32)
+        if len(op.inputs) > 2 and op.inputs[2] >= 0:
+            bias = model.tensors[op.inputs[2]].data.astype(np.int32)
+        # Padding taps must contribute 0, so the input zero point stays in the
+        # kernel instead of being folded into the biases as for FC.
+        scales = t_w.scale if t_w.per_channel else np.repeat(t_w.scale, out_c)
+        pairs = [quantize_multiplier(conv_multiplier(t_in.scale[0], s, t_out.scale[0])) for s in scales]
+        layer.per_channel = (np.array([p[0] for p in pairs], np.int32), np.array([p[1] for p in pairs], np.int32))
+        layer.weights = t_w.data.astype(np.int8)
+        layer.folded_bias = bias
+        layer.fields = {
+            "multiplier": 0, "shift": 0,
+            "output_zero_point": int(t_out.zero_point[0]),
+            "act_min": act_min, "act_max": act_max,
+            "input_zero_point": int(t_in.zero_point[0]),
+        }
+        if kind == "depthwise":
+            layer.fields["depth_multiplier"] = opts["depth_multiplier"]
+            if out_c != in_c * opts["depth_multiplier"]:
+                raise CompileError(f"{name}: {out_c} output channels != {in_c} x depth multiplier")
+        layer.src["weights"] = t_w
+    if kernel_h > MAX_KERNEL:
+        raise CompileError(f"{name}: kernel height {kernel_h} > MODEL_MAX_KERNEL ({MAX_KERNEL})")
+    if max(t_in.size, t_out.size) > 0xFFFF or max(kernel_w, opts["stride_h"], opts["stride_w"]) > 0xFF:
+        raise CompileError(f"{name}: {op.op_name} is too large for the layer table")
+    layer.fields.update({
+        "in_h": in_h, "in_w": in_w, "in_c": in_c, "out_h": out_h, "out_w": out_w, "out_c": out_c,
+        "kernel_h": kernel_h, "kernel_w": kernel_w,
+        "stride_h": opts["stride_h"], "stride_w": opts["stride_w"],
+        "pad_top": conv_padding(opts["padding"], in_h, kernel_h, opts["stride_h"], out_h),
+        "pad_left": conv_padding(opts["padding"], in_w, kernel_w, opts["stride_w"], out_w),
+        "input_rows": in_h, "output_rows": out_h,
+    })
+    return layer
+
+
+def _leaky_constants(model, op):
+    t_in, t_out = model.tensors[op.inputs[0]], model.tensors[op.outputs[0]]
+    alpha_m, identity_m = leaky_relu_multipliers(t_in.scale[0], t_out.scale[0], op.options["alpha"])
+    mult_alpha, shift_alpha = quantize_multiplier(alpha_m)
+    mult_identity, shift_identity = quantize_multiplier(identity_m)
+    return {
+        "leaky_input_zero_point": int(t_in.zero_point[0]),
+        "leaky_output_zero_point": int(t_out.zero_point[0]),
+        "mult_identity": mult_identity, "shift_identity": shift_identity,
+        "mult_alpha": mult_alpha, "shift_alpha": shift_alpha,
+    }
+
+
+def lower(model):
+    """Returns (layers, input tensor id, output tensor id)."""
+    aliases = {}
+
+    def alias(t):
+        while t in aliases:
+            t = aliases[t]
+        return t
+
+    consumers = {}
+    for op in model.operators:
+        for t in op.inputs:
+            consumers.setdefault(t, []).append(op.index)
+
+    layers = []
+    output_id = None
+    for op in model.operators:
+        if op.op_name == "RESHAPE":
+            aliases[op.outputs[0]] = op.inputs[0]
+        elif op.op_name == "FULLY_CONNECTED":
+            layers.append(_fc_layer(model, op, f"L{len(layers) + 1}", alias))
+        elif op.op_name in ("CONV_2D", "DEPTHWISE_CONV_2D", "MAX_POOL_2D"):
+            layers.append(_spatial_layer(model, op, f"L{len(layers) + 1}", alias))
+        elif op.op_name == "LEAKY_RELU":
+            src = alias(op.inputs[0])
+            prev = layers[-1] if layers else None
+            if prev is not None and prev.kind in ("fc", "conv", "depthwise") and prev.output_id == src \
+                    and prev.leaky is None and len(consumers.get(op.inputs[0], [])) == 1:
+                # Fuse: requantize the FC output and apply the leaky ReLU before storing it.
+                prev.leaky = _leaky_constants(model, op)
+                prev.output_id = op.outputs[0]
+            else:
+                layer = Layer("leaky_relu", f"L{len(layers) + 1}", src, op.outputs[0])
+                layer.n_input = layer.n_output = model.tensors[src].size
+                layer.leaky = _leaky_constants(model, op)
+                layers.append(layer)
+        elif op.op_name in TRAILING_OPS and all(o2.op_name in TRAILING_OPS for o2 in model.operators[op.index:]):
+            output_id = alias(op.inputs[0]) if output_id is None else output_id
+        else:
+            raise CompileError(f"op #{op.index} {op.op_name} is not supported")
+    if not layers:
+        raise CompileError("model has no FULLY_CONNECTED layer")
+    stream_rows(layers, consumers)
+    return layers, alias(model.inputs[0]), output_id if output_id is not None else layers[-1].output_id
+
+
+def stream_rows(layers, consumers):
+    """Turns spatial -> spatial edges into row rings of the consumer's kernel_h rows.
+
+    Chains are cut every MAX_STREAM_LAYERS layers (model_invoke keeps one row
+    counter per layer of a chain on the stack).
+    """
+    chain = 1
+    for prev, layer in zip(layers, layers[1:]):
+        if prev.kind in SPATIAL_KINDS and layer.kind in SPATIAL_KINDS and layer.input_id == prev.output_id \
+                and len(consumers.get(prev.output_id, [])) == 1 and chain < MAX_STREAM_LAYERS:
+            rows = min(layer.fields["kernel_h"], prev.fields["out_h"])
+            prev.stream = True
+            prev.fields["output_rows"] = layer.fields["input_rows"] = rows
+            chain += 1
+        else:
+            chain = 1
+
+
+# --- Kernel variant selection and weight encoding ---
+
+def _pad_rows(w, multiple):
+    pad = (-w.shape[0]) % multiple
+    return np.vstack([w, np.zeros((pad, w.shape[1]), np.int8)]) if pad else w
+
+
+def _pad_cols(w, multiple):
+    pad = (-w.shape[1]) % multiple
+    return np.hstack([w, np.zeros((w.shape[0], pad), np.int8)]) if pad else w
+
+
+def pool_blocks(rows, block):
+    """Deduplicates fixed-size blocks of a 2-D int8 array.
+
+    Each row is zero-padded to a multiple of `block` and cut into blocks.
+    Returns (pool [n_unique, block], index [n_rows, n_blocks], index bytes);
+    all-zero blocks are not pooled and get the index 0xFF / 0xFFFF.
+    Pool order is first occurrence, so the output is deterministic.
+    """
+    rows = np.asarray(rows, dtype=np.int8)
+    blocks = _pad_cols(rows, block).reshape(rows.shape[0], -1, block)
+    first_seen = {}
+    index = np.zeros(blocks.shape[:2], dtype=np.int64)
+    for r in range(blocks.shape[0]):
+        for k in range(blocks.shape[1]):
+            b = blocks[r, k]
+            index[r, k] = -1 if not b.any() else first_seen.setdefault(b.tobytes(), len(first_seen))
+    pool = np.frombuffer(b"".join(first_seen), dtype=np.int8).reshape(-1, block)
+    if len(pool) >= 0xFFFF:
+        raise CompileError(f"{len(pool)} unique blocks do not fit a uint16_t index")
+    index_bytes = 1 if len(pool) < 0xFF else 2
+    index[index < 0] = 0xFF if index_bytes == 1 else 0xFFFF
+    return pool, index, index_bytes
+
+
+def best_pooling(weights):
+    """(block, pool, index, index bytes) with the fewest bytes; smaller blocks win ties."""
+    options = []
+    for block in POOL_BLOCK_SIZES:
+        pool, index, index_bytes = pool_blocks(weights, block)
+        options.append((pool.size + index.size * index_bytes, block, pool, index, index_bytes))
+    _, block, pool, index, index_bytes = min(options, key=lambda o: (o[0], o[1]))
+    return block, pool, index, index_bytes
+
+
+def cluster_weights(w, centroids):
+    """1-D k-means of the int8 weights -> (int8 value table, index per weight, bit width).
+
+    Centroids start at evenly spaced quantiles and are rounded to int8 after
+    Lloyd's iterations, so the result is deterministic. The table is padded
+    to 2**bits entries (TFLM's value_table layout).
+    """
+    values = w.astype(np.float64).reshape(-1)
+    bits = max(1, int(np.ceil(np.log2(centroids))))
+    # Quantiles of the distinct values, so a mostly-zero layer still spreads its centroids.
+    centers = np.quantile(np.unique(values), (np.arange(centroids) + 0.5) / centroids)
+    for _ in range(50):
+        assign = np.abs(values[:, None] - centers[None, :]).argmin(axis=1)
+        updated = np.array([values[assign == k].mean() if np.any(assign == k) else centers[k]
+                            for k in range(centroids)])
+        if np.allclose(updated, centers):
+            break
+        centers = updated
+    table = np.unique(np.clip(np.round(centers), -128, 127)).astype(np.int8)
+    assign = np.abs(values[:, None] - table[None, :].astype(np.float64)).argmin(axis=1)
+    table = np.concatenate([table, np.zeros((1 << bits) - len(table), np.int8)])
+    return table, assign.reshape(w.shape), bits
+
+
+def pack_indices(indices, bits):
+    """Bit stream, first index in the most significant bits (TFLM compressed_indices).
+
+    One zero byte is appended so the kernel can always read a 16-bit window.
+    """
+    flat = np.asarray(indices, dtype=np.int64).reshape(-1)
+    stream = ((flat[:, None] >> np.arange(bits - 1, -1, -1)) & 1).astype(np.uint8).reshape(-1)
+    return np.concatenate([np.packbits(stream), np.zeros(1, np.uint8)])
+
+
+def apply_lut(layer, centroids):
+    """Replaces the layer's weights with their clustered values and refolds the bias."""
+    table, indices, bits = cluster_weights(layer.weights, centroids)
+    layer.lut = (table, indices, bits)
+    layer.weights = table[indices]
+    zp_in = int(layer.src["input"].zero_point[0])
+    folded = layer.src["bias"].astype(np.int64) - zp_in * layer.weights.astype(np.int64).sum(axis=1)
+    if folded.min() < -(1 << 31) or folded.max() >= (1 << 31):
+        raise CompileError(f"{layer.name}: folded bias overflows int32")
+    layer.folded_bias = folded.astype(np.int32)
+
+
+def estimate(layer, variant):
+    """(estimated cycles, weight bytes) of one FC layer in a given variant."""
+    n_out, n_in = layer.weights.shape
+    if variant == "pooled":
+        if layer.pooling is None:
+            layer.pooling = best_pooling(layer.weights)
+        block, pool, index, index_bytes = layer.pooling
+        live = int(np.count_nonzero(index != (0xFF if index_bytes == 1 else 0xFFFF)))
+        cycles = live * block * CYCLES_PER_MAC["pooled"] + index.size * CYCLES_PER_BLOCK
+        return cycles + n_out * CYCLES_PER_ROW, pool.size + index.size * index_bytes
+    if variant == "lut":
+        table, _, bits = layer.lut
+        size = (n_out * n_in * bits + 7) // 8 + 1 + len(table)
+        return n_out * n_in * CYCLES_PER_MAC["lut"] + n_out * CYCLES_PER_ROW, size
+    if variant == "int8":
+        macs, size = n_out * n_in, n_out * n_in
+    elif variant == "packed":
+        cols = n_in + (-n_in) % 4
+        macs, size = n_out * cols, n_out * cols
+    elif variant == "blocked":
+        rows = n_out + (-n_out) % 4
+        macs, size = rows * n_in, rows * n_in
+    else:
+        nnz = int(np.count_nonzero(layer.weights))
+        macs = nnz
+        size = nnz * (1 + (1 if n_in <= 256 else 2)) + 2 * (n_out + 1)
+    return macs * CYCLES_PER_MAC[variant] + n_out * CYCLES_PER_ROW, size
+
+
+def estimate_spatial(layer):
+    """(estimated cycles, weight bytes) of a conv / depthwise / max pool layer."""
+    f = layer.fields
+    taps = f["kernel_h"] * f["kernel_w"] * (f["in_c"] if layer.kind == "conv" else 1)
+    outputs = f["out_h"] * f["out_w"] * f["out_c"]
+    cycles = outputs * (taps * CYCLES_PER_TAP[layer.kind] + CYCLES_PER_ROW)
+    return cycles, 0 if layer.kind == "max_pool" else layer.weights.size
+
+
+def available_variants(layer):
+    # row_ptr is uint16_t, so CSR only fits layers with up to 65535 non-zeros.
+    if np.count_nonzero(layer.weights) > 0xFFFF:
+        return tuple(v for v in VARIANTS if v != "sparse")
+    return VARIANTS
+
+
+def choose_variant(layer, forced=None):
+    if forced:
+        if forced not in available_variants(layer) + LOSSY_VARIANTS:
+            raise CompileError(f"{layer.name}: {forced} kernel does not fit this layer")
+        return forced
+    # Fewest estimated cycles; smaller weights break ties. Order keeps it deterministic.
+    return min(available_variants(layer), key=lambda v: (estimate(layer, v), VARIANTS.index(v)))
+
+
+def encode(layer, prefix):
+    """Fills layer.arrays / layer.fields for the chosen variant."""
+    w = layer.weights
+    n_out, n_in = w.shape
+    name = f"{prefix}_{layer.name}"
+    layer.arrays = []
+    fields = layer.fields
+    if layer.variant == "int8":
+        layer.arrays.append(("int8_t", f"{name}_weights", w.reshape(-1)))
+    elif layer.variant == "packed":
+        # Same byte order as Approach 2: first weight in bits 31..24.
+        b = _pad_cols(w, 4).astype(np.uint8).reshape(n_out, -1, 4).astype(np.uint32)
+        words = (b[..., 0] << 24) | (b[..., 1] << 16) | (b[..., 2] << 8) | b[..., 3]
+        layer.arrays.append(("uint32_t", f"{name}_weights", words.reshape(-1)))
+    elif layer.variant == "blocked":
+        # Word j of block k holds column j of rows 4k..4k+3, row 4k in the low byte.
+        b = _pad_rows(w, 4).astype(np.uint8).reshape(-1, 4, n_in).astype(np.uint32)
+        words = b[:, 0, :] | (b[:, 1, :] << 8) | (b[:, 2, :] << 16) | (b[:, 3, :] << 24)
+        layer.arrays.append(("uint32_t", f"{name}_weights", words.reshape(-1)))
+    elif layer.variant == "sparse":
+        rows, cols = np.nonzero(w)
+        row_ptr = np.concatenate([[0], np.cumsum(np.bincount(rows, minlength=n_out))]).astype(np.uint16)
+        idx_type = "uint8_t" if n_in <= 256 else "uint16_t"
+        layer.arrays.append(("int8_t", f"{name}_weights", w[rows, cols]))
+        layer.arrays.append(("uint16_t", f"{name}_row_ptr", row_ptr))
+        layer.arrays.append((idx_type, f"{name}_col_idx", cols))
+        fields["col_idx_bytes"] = 1 if idx_type == "uint8_t" else 2
+    elif layer.variant == "pooled":
+        if layer.pooling is None:
+            layer.pooling = best_pooling(w)
+        block, pool, index, index_bytes = layer.pooling
+        layer.arrays.append(("int8_t", f"{name}_weights", pool.reshape(-1)))
+        layer.arrays.append(("uint8_t" if index_bytes == 1 else "uint16_t", f"{name}_col_idx", index.reshape(-1)))
+        fields["col_idx_bytes"] = index_bytes
+        fields["block_size"] = block
+    elif layer.variant == "lut":
+        table, indices, bits = layer.lut
+        layer.arrays.append(("int8_t", f"{name}_weights", table))
+        layer.arrays.append(("uint8_t", f"{name}_col_idx", pack_indices(indices, bits)))
+        fields["lut_bits"] = bits
+    else:
+        raise CompileError(f"{layer.name}: unknown kernel variant {layer.variant}")
+    layer.arrays.append(("int32_t", f"{name}_biases", layer.folded_bias))
+    if layer.per_channel is not None:
+        layer.arrays.append(("int32_t", f"{name}_multipliers", layer.per_channel[0]))
+        layer.arrays.append(("int32_t", f"{name}_shifts", layer.per_channel[1]))
+
+
+def spatial_label(layer):
+    """e.g. conv3x3/2, dw10x8/2, maxpool2x2/2; a trailing ~ marks a streamed (row ring) output."""
+    f = layer.fields
+    kind = {"conv": "conv", "depthwise": "dw", "max_pool": "maxpool"}[layer.kind]
+    stride = f"/{f['stride_h']}" if f["stride_h"] == f["stride_w"] else f"/{f['stride_h']}x{f['stride_w']}"
+    return f"{kind}{f['kernel_h']}x{f['kernel_w']}{stride}{'~' if layer.stream else ''}"
+
+
+def encode_spatial(layer, prefix):
+    """Filter in the .tflite layout (OHWI, depthwise 1HWO), biases unfolded, per-channel requantization."""
+    name = f"{prefix}_{layer.name}"
+    layer.arrays = []
+    if layer.kind == "max_pool":
+        return
+    layer.arrays.append(("int8_t", f"{name}_weights", layer.weights.reshape(-1)))
+    layer.arrays.append(("int32_t", f"{name}_biases", layer.folded_bias))
+    layer.arrays.append(("int32_t", f"{name}_multipliers", layer.per_channel[0]))
+    layer.arrays.append(("int32_t", f"{name}_shifts", layer.per_channel[1]))
+
+
+# --- Static memory plan ---
+
+def buffer_size(layers, model, tensor):
+    """Arena bytes of an activation: the full tensor, or the row ring of a streamed layer."""
+    for layer in layers:
+        if layer.output_id == tensor and getattr(layer, "stream", False):
+            f = layer.fields
+            return f["output_rows"] * f["out_w"] * f["out_c"]
+    return model.tensors[tensor].size
+
+
+def plan_memory(layers, model, input_id, output_id):
+    """Greedy first-fit by size (like TFLM's GreedyMemoryPlanner). Returns ({tensor: offset}, arena size)."""
+    # A streamed chain runs interleaved, so all of its tensors live from the
+    # chain's first layer to its last one.
+    streamed = [getattr(layer, "stream", False) for layer in layers]
+    start = list(range(len(layers)))
+    end = list(range(len(layers)))
+    for i in range(1, len(layers)):
+        if streamed[i - 1]:
+            start[i] = start[i - 1]
+    for i in range(len(layers) - 2, -1, -1):
+        if streamed[i]:
+            end[i] = end[i + 1]
+    first, last = {input_id: 0}, {}
+    for i, layer in enumerate(layers):
+        first.setdefault(layer.output_id, start[i])
+        last[layer.input_id] = end[i]
+    last[output_id] = len(layers)
+    sizes = {t: buffer_size(layers, model, t) for t in first}
+
+    placed = []
+    offsets = {}
+    for t in sorted(first, key=lambda t: (-sizes[t], t)):
+        lo, hi = first[t], last.get(t, first[t])
+        offset = 0
+        for o, s, lo2, hi2 in sorted(placed):
+            overlaps_time = not (hi < lo2 or hi2 < lo)
+            if overlaps_time and offset < o + s and o < offset + sizes[t]:
+                offset = o + s + (-(o + s)) % ARENA_ALIGN
+        offsets[t] = offset
+        placed.append((offset, sizes[t], lo, hi))
+    arena = max(o + s for o, s, _, _ in placed)
+    return offsets, arena + (-arena) % ARENA_ALIGN
+
+
+# --- C emission ---
+
+def _c_array(c_type, name, values, per_line=16):
+    if c_type == "uint32_t":
+        items = [f"0x{int(v):08X}" for v in values]
+    else:
+        items = [str(int(v)) for v in values]
+    lines = [", ".join(items[i:i + per_line]) for i in range(0, len(items), per_line)]
+    body = ",\n    ".join(lines)
+    return f"static const {c_type} {name}[{len(values)}] = {{\n    {body}\n}};\n"
+
+
+def compile_model(model_path, name="mnist_model", variants=None, lut_centroids=16):
+    """Returns (header text, source text, layers, plan) for one model."""
+    model = TFLiteModel(model_path)
+    layers, input_id, output_id = lower(model)
+    prefix = name
+    for layer in layers:
+        if layer.kind == "fc":
+            forced = (variants or {}).get(layer.name) or (variants or {}).get("all")
+            layer.variant = choose_variant(layer, forced)
+            if layer.variant == "lut":
+                apply_lut(layer, lut_centroids)
+            encode(layer, prefix)
+        elif layer.kind in SPATIAL_KINDS:
+            encode_spatial(layer, prefix)
+    offsets, arena = plan_memory(layers, model, input_id, output_id)
+    macro = name.upper()
+    model_file = os.path.basename(model_path)
+
+    h = []
+    h.append("/*\n")
+    h.append(f" * This file is auto-generated by tools/model_compiler/compiler.py from {model_file}.\n")
+    h.append(" * Do not modify manually.\n")
+    h.append(" *\n")
+    h.append(" * Layer  Kernel      In   Out  Weight bytes  Est. cycles\n")
+    for layer in layers:
+        if layer.kind == "fc":
+            cycles, size = estimate(layer, layer.variant)
+            kernel = layer.variant + ("+leaky" if layer.leaky else "")
+            h.append(f" * {layer.name:<6} {kernel:<11} {layer.n_input:>4} {layer.n_output:>5} {size:>13} {int(cycles):>12}\n")
+        elif layer.kind in SPATIAL_KINDS:
+            cycles, size = estimate_spatial(layer)
+            kernel = spatial_label(layer) + ("+leaky" if layer.leaky else "")
+            h.append(f" * {layer.name:<6} {kernel:<11} {layer.n_input:>4} {layer.n_output:>5} {size:>13} {int(cycles):>12}\n")
+        else:
+            h.append(f" * {layer.name:<6} {'leaky_relu':<11} {layer.n_input:>4} {layer.n_output:>5} {0:>13}\n")
+    if any(layer.stream for layer in layers):
+        h.append(" * (~: output kept as a ring of rows, computed on demand by the next layer)\n")
+    h.append(" */\n")
+    h.append(f"#ifndef {macro}_H\n#define {macro}_H\n\n")
+    h.append("#include \"model_runtime.h\"\n\n")
+    h.append(f"#define {macro}_NUM_LAYERS {len(layers)}\n")
+    h.append(f"#define {macro}_ARENA_SIZE {arena}\n")
+    h.append(f"#define {macro}_INPUT_OFFSET {offsets[input_id]}\n")
+    h.append(f"#define {macro}_INPUT_SIZE {model.tensors[input_id].size}\n")
+    h.append(f"#define {macro}_OUTPUT_OFFSET {offsets[output_id]}\n")
+    h.append(f"#define {macro}_OUTPUT_SIZE {model.tensors[output_id].size}\n")
+    t_out = model.tensors[output_id]
+    h.append(f"#define {macro}_OUTPUT_SCALE {float(t_out.scale[0]):.8f}f\n")
+    h.append(f"#define {macro}_OUTPUT_ZERO_POINT {int(t_out.zero_point[0])}\n\n")
+    h.append(f"extern const model_layer_t {name}_layers[{macro}_NUM_LAYERS];\n\n")
+    h.append(f"// Runs all layers; the input goes to arena + {macro}_INPUT_OFFSET.\n")
+    h.append(f"#define {macro}_INVOKE(arena) model_invoke({name}_layers, {macro}_NUM_LAYERS, (arena))\n\n")
+    h.append(f"#endif // {macro}_H\n")
+
+    s = []
+    s.append("/*\n")
+    s.append(f" * This file is auto-generated by tools/model_compiler/compiler.py from {model_file}.\n")
+    s.append(" * Do not modify manually.\n")
+    s.append(" */\n")
+    s.append(f"#include \"{name}.h\"\n\n")
+    for layer in layers:
+        if not layer.arrays:
+            continue
+        kernel = f"{layer.variant} kernel" if layer.kind == "fc" else spatial_label(layer)
+        s.append(f"// {layer.name}: {kernel}, {layer.n_input} -> {layer.n_output}\n")
+        for c_type, arr_name, values in layer.arrays:
+            s.append(_c_array(c_type, arr_name, values))
+        s.append("\n")
+
+    s.append(f"const model_layer_t {name}_layers[{macro}_NUM_LAYERS] = {{\n")
+    for layer in layers:
+        f = dict(layer.fields)
+        entries = []
+        if layer.kind == "fc":
+            arrays = {a[1][len(prefix) + len(layer.name) + 2:]: a[1] for a in layer.arrays}
+            entries += [".kind = MODEL_LAYER_FC", f".variant = {C_VARIANT[layer.variant]}"]
+            if layer.leaky:
+                entries.append(".fused_leaky = 1")
+            if "col_idx_bytes" in f:
+                entries.append(f".col_idx_bytes = {f['col_idx_bytes']}")
+            if "block_size" in f:
+                entries.append(f".block_size = {f['block_size']}")
+            if "lut_bits" in f:
+                entries.append(f".lut_bits = {f['lut_bits']}")
+        elif layer.kind in SPATIAL_KINDS:
+            arrays = {a[1][len(prefix) + len(layer.name) + 2:]: a[1] for a in layer.arrays}
+            entries.append(f".kind = {C_KIND[layer.kind]}")
+            if layer.leaky:
+                entries.append(".fused_leaky = 1")
+            if layer.stream:
+                entries.append(".stream = 1")
+            for key in ("in_h", "in_w", "in_c", "out_h", "out_w", "out_c", "kernel_h", "kernel_w",
+                        "stride_h", "stride_w", "pad_top", "pad_left", "depth_multiplier",
+                        "input_rows", "output_rows", "input_zero_point"):
+                if key in f:
+                    entries.append(f".{key} = {f[key]}")
+        else:
+            arrays = {}
+            entries += [".kind = MODEL_LAYER_LEAKY_RELU"]
+        entries += [f".n_input = {layer.n_input}", f".n_output = {layer.n_output}",
+                    f".input_offset = {offsets[layer.input_id]}", f".output_offset = {offsets[layer.output_id]}"]
+        for key in ("weights", "biases", "row_ptr", "col_idx", "multipliers", "shifts"):
+            if key in arrays:
+                entries.append(f".{key} = {arrays[key]}")
+        for key in ("multiplier", "shift", "output_zero_point", "act_min", "act_max"):
+            if key in f:
+                entries.append(f".{key} = {f[key]}")
+        if layer.leaky:
+            for key, v in layer.leaky.items():
+                entries.append(f".{key} = {v}")
+        s.append("    {\n        " + ",\n        ".join(entries) + ",\n    },\n")
+    s.append("};\n")
+
+    plan = {"offsets": offsets, "arena": arena, "input": input_id, "output": output_id}
+    return "".join(h), "".join(s), layers, plan
+
+
+def report(model_path, layers, plan, model):
+    print(f"{model_path}: arena {plan['arena']} bytes")
+    print(f"  {'layer':<6} {'variant':<13} {'in':>5} {'out':>5} {'zeros':>6}   " +
+          "  ".join(f"{v:>16}" for v in VARIANTS))
+    for layer in layers:
+        if layer.kind in SPATIAL_KINDS:
+            cycles, size = estimate_spatial(layer)
+            fused = "+leaky" if layer.leaky else ""
+            f = layer.fields
+            print(f"  {layer.name:<6} {spatial_label(layer) + fused:<13} {layer.n_input:>5} {layer.n_output:>5} "
+                  f"{'':>6}   {int(cycles):>8}c {size:>6}B  "
+                  f"{f['in_h']}x{f['in_w']}x{f['in_c']} -> {f['out_h']}x{f['out_w']}x{f['out_c']}, "
+                  f"{f['output_rows']} of {f['out_h']} output rows held")
+            continue
+        if layer.kind != "fc":
+            print(f"  {layer.name:<6} leaky_relu (standalone)")
+            continue
+        zeros = 1.0 - np.count_nonzero(layer.weights) / layer.weights.size
+        est = "  ".join(f"{int(c):>8}c {b:>6}B" for c, b in (estimate(layer, v) for v in VARIANTS))
+        fused = "+leaky" if layer.leaky else ""
+        print(f"  {layer.name:<6} {layer.variant + fused:<13} {layer.n_input:>5} {layer.n_output:>5} {zeros:>6.1%}   {est}")
+        if layer.variant == "lut":
+            table, indices, bits = layer.lut
+            error = np.abs(layer.weights.astype(np.int64) - layer.src["weights"].data.reshape(layer.weights.shape))
+            cycles, size = estimate(layer, "lut")
+            print(f"  {'':<6} lut: {len(np.unique(table[indices]))} centroids, {bits}-bit indices, "
+                  f"{int(cycles)}c {size}B, max |w - w_lut| {int(error.max())}, mean {error.mean():.2f}")
+    for t, o in sorted(plan["offsets"].items(), key=lambda kv: kv[1]):
+        print(f"  arena[{o:>5}:{o + buffer_size(layers, model, t):>5}] {model.tensors[t].name}")
+    dedup_report([(layer.name, layer.weights) for layer in layers if layer.kind == "fc"])
+
+
+def dedup_report(named_arrays):
+    """Flash saved by block pooling, per array, against the plain int8 const array."""
+    print(f"  {'dedup':<14} {'block':>5} {'blocks':>7} {'zero':>6} {'unique':>7} {'int8 B':>8} {'pooled B':>9} {'saved B':>8}")
+    total_before = total_after = 0
+    for name, rows in named_arrays:
+        block, pool, index, index_bytes = best_pooling(rows)
+        zero = int(np.count_nonzero(index == (0xFF if index_bytes == 1 else 0xFFFF)))
+        before, after = int(np.asarray(rows).size), pool.size + index.size * index_bytes
+        total_before += before
+        total_after += min(before, after)
+        print(f"  {name:<14} {block:>5} {index.size:>7} {zero:>6} {len(pool):>7} {before:>8} {after:>9} {before - after:>8}")
+    print(f"  {'total':<14} {'':>5} {'':>7} {'':>6} {'':>7} {total_before:>8} {total_after:>9} {total_before - total_after:>8}"
+          "   (pooled only where it saves)")
+
+
+# --- Legacy mnist_model_params.[ch] (what the existing main.c / app_inference.h include) ---
+
+def legacy_params(model_path, style, samples, relu_shifts=None, relu_calibration=0):
+    """Byte-compatible output of the old generate_c_model_params.py copies.
+
+    style "packed": Approach 1/2 (uint32 words, 4 int8 each, ALIGN_16);
+    style "int8":   12x12 pipelines (plain int8 arrays).
+    samples: [(int8 image, label)] written as input_data_N / label_N; the
+    firmware reads them from mnist_testset.[ch], so main() passes [] unless
+    --inline-samples (Approach 1's main.c still calls input_data_0..3).
+    relu_shifts: packed only, static ReLUNorm shift per hidden layer
+    (relunorm.calibrate), written as L<n>_relu_shift.
+    relu_calibration: leading mnist_testset samples the shifts were
+    calibrated on (0 for MNIST training images), written as
+    relu_shift_calibration_samples so the firmware can leave them out.
+    """
+    model = TFLiteModel(model_path)
+    fcs = [op for op in model.operators if op.op_name == "FULLY_CONNECTED"]
+    hf, sf = [], []
+    if style == "packed":
+        banner = ("/*\n * This file is auto-generated by generate_c_model_params.py.\n"
+                  " * Do not modify manually.\n */\n")
+        hf.append(banner + "#ifndef MNIST_MODEL_PARAMS_H\n#define MNIST_MODEL_PARAMS_H\n\n#include <stdint.h>\n\n")
+        sf.append(banner + "#include \"mnist_model_params.h\"\n\n")
+        hf.append("#define MAX_N_ACTIVATIONS 64\n#define INPUT_SCALE_FACTOR 64\n#define ACTIVATION_BITS 8\n#define BATCH_SIZE 16\n\n")
+        hf.append("// Add buffer overflow protection\n#define SAFE_ACCESS(arr, idx, max) ((idx) < (max) ? arr[idx] : 0)\n\n")
+        hf.append("// Add memory alignment for better performance\n#define ALIGN_16 __attribute__((aligned(16)))\n\n")
+    else:
+        hf.append("#ifndef MNIST_MODEL_PARAMS_H\n#define MNIST_MODEL_PARAMS_H\n\n#include <stdint.h>\n\n")
+        hf.append("#define MAX_N_ACTIVATIONS 144\n#define ACTIVATION_BITS 8\n\n")
+        sf.append("#include \"mnist_model_params.h\"\n\n")
+
+    for idx, op in enumerate(fcs, start=1):
+        t_in, t_w, t_out = (model.tensors[op.inputs[0]], model.tensors[op.inputs[1]], model.tensors[op.outputs[0]])
+        w = t_w.data
+        b = model.tensors[op.inputs[2]].data if len(op.inputs) > 2 and op.inputs[2] >= 0 else None
+        q = [(t_in.scale[0], t_in.zero_point[0]), (t_out.scale[0], t_out.zero_point[0]),
+             (t_w.scale[0], t_w.zero_point[0])]
+        biases = [f"{v}" for v in b] if b is not None else []
+        if style == "packed":
+            flat = w.flatten()
+            if len(flat) % 4:
+                flat = np.pad(flat, (0, 4 - len(flat) % 4))
+            u = flat.astype(np.uint8).astype(np.uint32).reshape(-1, 4)
+            words = (u[:, 0] << 24) | (u[:, 1] << 16) | (u[:, 2] << 8) | u[:, 3]
+            packed = [f"0x{int(v):08X}" for v in words]
+            hf.append(f"// Layer {idx} Parameters\n")
+            hf.append(f"extern const uint32_t ALIGN_16 L{idx}_weights[{len(packed)}];\n")
+            if b is not None:
+                hf.append(f"extern const int32_t ALIGN_16 L{idx}_biases[{len(biases)}];\n")
+            hf.append(f"extern const int32_t L{idx}_bitperweight;\n")
+            hf.append(f"extern const uint32_t L{idx}_incoming_weights;\n")
+            hf.append(f"extern const uint32_t L{idx}_outgoing_weights;\n")
+            sf.append(f"// Layer {idx} Parameters\n")
+            sf.append(f"const uint32_t ALIGN_16 L{idx}_weights[{len(packed)}] = {{\n    {', '.join(packed)}\n}};\n")
+            if b is not None:
+                sf.append(f"const int32_t ALIGN_16 L{idx}_biases[{len(biases)}] = {{\n    {', '.join(biases)}\n}};\n")
+            sf.append(f"const int32_t L{idx}_bitperweight = 8;\n")
+            sf.append(f"const uint32_t L{idx}_incoming_weights = {w.shape[1]};\n")
+            sf.append(f"const uint32_t L{idx}_outgoing_weights = {w.shape[0]};\n")
+            if relu_shifts and idx <= len(relu_shifts):
+                hf.append(f"extern const uint32_t L{idx}_relu_shift;\n")
+                sf.append(f"const uint32_t L{idx}_relu_shift = {relu_shifts[idx - 1]};\n")
+        else:
+            flat = w.flatten()
+            hf.append(f"// --- Layer {idx} Parameters ---\n")
+            hf.append(f"extern const int8_t L{idx}_weights[{len(flat)}];\n")
+            if b is not None:
+                hf.append(f"extern const int32_t L{idx}_biases[{len(biases)}];\n")
+            sf.append(f"// Layer {idx} Parameters\n")
+            sf.append(f"const int8_t L{idx}_weights[{len(flat)}] = {{\n    {', '.join(str(v) for v in flat)}\n}};\n")
+            if b is not None:
+                sf.append(f"const int32_t L{idx}_biases[{len(biases)}] = {{\n    {', '.join(biases)}\n}};\n")
+        for label, (scale, zp) in zip(("input", "output", "weights"), q):
+            hf.append(f"extern const float L{idx}_{label}_scale;\n")
+            hf.append(f"extern const int32_t L{idx}_{label}_zero_point;\n")
+            sf.append(f"const float L{idx}_{label}_scale = {scale:.8f}f;\n")
+            sf.append(f"const int32_t L{idx}_{label}_zero_point = {zp};\n")
+        hf.append("\n")
+        sf.append("\n")
+
+    if relu_shifts and style == "packed":
+        hf.append("// Leading mnist_testset samples the ReLUNorm shifts were calibrated on\n"
+                  "extern const uint32_t relu_shift_calibration_samples;\n\n")
+        sf.append(f"const uint32_t relu_shift_calibration_samples = {relu_calibration};\n")
+
+    if samples and style == "packed":
+        hf.append("// Quantized sample input images and their labels\n")
+    elif samples:
+        hf.append("// --- Quantized sample input images and their labels ---\n")
+    if samples:
+        sf.append("// Quantized sample input images and their labels\n")
+    for i, (image, label) in enumerate(samples):
+        content = ", ".join(str(int(v)) for v in image)
+        hf.append(f"extern const int8_t input_data_{i}[{len(image)}];\n")
+        hf.append(f"extern const uint8_t label_{i};\n")
+        sf.append(f"const int8_t input_data_{i}[{len(image)}] = {{\n    {content}\n}};\n")
+        sf.append(f"const uint8_t label_{i} = {label};\n")
+    hf.append(("\n" if samples else "") + "#endif // MNIST_MODEL_PARAMS_H\n")
+    return "".join(hf), "".join(sf)
+
+
+def load_legacy_samples(c_file):
+    """input_data_N / label_N pairs from an existing mnist_model_params.c."""
+    import re
+    with open(c_file) as f:
+        src = f.read()
+    samples = []
+    i = 0
+    while True:
+        m = re.search(rf"const int8_t input_data_{i}\[\d+\] = \{{(.*?)\}};", src, re.S)
+        lm = re.search(rf"const uint8_t label_{i} = (\d+);", src)
+        if not m or not lm:
+            break
+        samples.append((np.array([int(v) for v in m.group(1).split(",")], np.int8), int(lm.group(1))))
+        i += 1
+    return samples
+
+
+def mnist_samples(npz_path, input_size, count, input_scale, input_zero_point, split="test"):
+    """First `count` MNIST images of `split`, preprocessed the way each pipeline expects."""
+    data = np.load(npz_path)
+    x, y = data[f"x_{split}"][:count], data[f"y_{split}"][:count]
+    if input_size == 784:
+        images = x.reshape(count, -1).astype("float32") / 255.0
+    elif input_size == 144:
+        sys.path.insert(0, os.path.join(TOOL_DIR, "..", "..",
+                                        "sifive_hifive1_Cam_Cap_Pred_Complete_Inference_Pipeline", "src"))
+        from preprocess import preprocess_batch
+        images = preprocess_batch(x).reshape(count, -1)
+    else:
+        raise CompileError(f"no MNIST preprocessing for a {input_size}-input model")
+    q = np.clip(np.round(images / input_scale + input_zero_point), -128, 127).astype(np.int8)
+    return list(zip(q, (int(v) for v in y)))
+
+
+def calibrate_relu_shifts(args, t_in, samples):
+    """Static ReLUNorm shifts and the number of leading test samples they were calibrated on.
+
+    Uses MNIST training images, or the first half of the test set without
+    mnist.npz; the report only covers test samples calibration did not see.
+    """
+    import relunorm
+    engine = relunorm.Engine(args.model)
+    if os.path.exists(args.mnist):
+        calib = mnist_samples(args.mnist, t_in.size, args.calibrate, t_in.scale[0], int(t_in.zero_point[0]), "train")
+        held_out = samples
+    else:
+        calib, held_out = relunorm.holdout_split(samples)
+        print(f"{args.mnist} not found, calibrating the ReLUNorm shifts on the first {len(calib)} "
+              f"of the {len(samples)} test samples")
+    shifts, observed = relunorm.calibrate(engine, calib)
+    if args.report:
+        print(f"ReLUNorm shifts (report on the {len(held_out)} held-out test samples):")
+        relunorm.report(engine, shifts, observed, held_out)
+    return shifts, len(samples) - len(held_out)
+
+
+def _write(path, text):
+    with open(path, "w", newline="\n") as f:
+        f.write(text)
+    print(f"Wrote {path}")
+
+
+def parse_variants(items):
+    variants = {}
+    for item in items or []:
+        key, _, value = item.partition("=")
+        if value not in VARIANTS + LOSSY_VARIANTS:
+            raise SystemExit(f"--variant {item}: kernel must be one of {', '.join(VARIANTS + LOSSY_VARIANTS)}")
+        variants[key] = value
+    return variants
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Compile an int8 .tflite MNIST model to C tables.")
+    ap.add_argument("model")
+    ap.add_argument("--out-dir", help="where to write the generated files")
+    ap.add_argument("--name", default="mnist_model", help="base name of the generated .h/.c and symbols")
+    ap.add_argument("--variant", action="append", metavar="LAYER=KERNEL",
+                    help="force a kernel, e.g. L1=sparse or all=packed")
+    ap.add_argument("--lut-centroids", type=int, default=16,
+                    help=f"weight clusters per layer for --variant L=lut ({LUT_CENTROIDS[0]}-{LUT_CENTROIDS[1]})")
+    ap.add_argument("--no-runtime", action="store_true", help="do not copy model_runtime.[ch] to --out-dir")
+    ap.add_argument("--report", action="store_true", help="print per-layer cost estimates and the memory plan")
+    ap.add_argument("--legacy", choices=("packed", "int8"),
+                    help="write mnist_model_params.[ch] in the old per-approach format instead")
+    ap.add_argument("--mnist", default=os.path.expanduser("~/.keras/datasets/mnist.npz"),
+                    help="MNIST npz for the legacy sample images")
+    ap.add_argument("--samples", type=int, default=100, help="MNIST test images in the test-set blob")
+    ap.add_argument("--no-compress", action="store_true", help="store the test-set images raw, without RLE")
+    ap.add_argument("--inline-samples", action="store_true",
+                    help="--legacy only: write the samples as input_data_N / label_N in mnist_model_params.c "
+                         "instead of a test-set blob (Approach 1's main.c)")
+    ap.add_argument("--calibrate", type=int, default=1000,
+                    help="MNIST training images used to calibrate the static ReLUNorm shifts (packed only)")
+    args = ap.parse_args(argv)
+    if not LUT_CENTROIDS[0] <= args.lut_centroids <= LUT_CENTROIDS[1]:
+        ap.error(f"--lut-centroids must be {LUT_CENTROIDS[0]}-{LUT_CENTROIDS[1]}")
+
+    try:
+        header, source, layers, plan = compile_model(args.model, args.name, parse_variants(args.variant),
+                                                     args.lut_centroids)
+    except CompileError as e:
+        raise SystemExit(f"{args.model}: {e}")
+    if args.report or not args.out_dir:
+        report(args.model, layers, plan, TFLiteModel(args.model))
+    if not args.out_dir:
+        return
+
+    if args.legacy:
+        params_c = os.path.join(args.out_dir, "mnist_model_params.c")
+        testset_c = os.path.join(args.out_dir, f"{TESTSET_NAME}.c")
+        model = TFLiteModel(args.model)
+        t_in = model.tensors[model.inputs[0]]
+        if os.path.exists(args.mnist):
+            samples = mnist_samples(args.mnist, t_in.size, args.samples, t_in.scale[0], int(t_in.zero_point[0]))
+        elif os.path.exists(testset_c):
+            print(f"{args.mnist} not found, keeping the sample images from {testset_c}")
+            samples = testset.load_testset(testset_c)
+        elif os.path.exists(params_c):
+            print(f"{args.mnist} not found, keeping the sample images from {params_c}")
+            samples = load_legacy_samples(params_c)
+        else:
+            samples = []
+        if args.inline_samples:
+            hf, sf = legacy_params(args.model, args.legacy, samples)
+            _write(os.path.join(args.out_dir, "mnist_model_params.h"), hf)
+            _write(params_c, sf)
+            return
+        relu_shifts, relu_calibration = None, 0
+        if args.legacy == "packed" and samples:
+            relu_shifts, relu_calibration = calibrate_relu_shifts(args, t_in, samples)
+        hf, sf = legacy_params(args.model, args.legacy, [], relu_shifts, relu_calibration)
+        _write(os.path.join(args.out_dir, "mnist_model_params.h"), hf)
+        _write(params_c, sf)
+        if not samples:
+            return
+        if args.report:
+            print("sample images:")
+            dedup_report([("testset", np.array([image for image, _ in samples]))])
+        hf, sf = testset.emit(samples, TESTSET_NAME, compress=not args.no_compress)
+        _write(os.path.join(args.out_dir, f"{TESTSET_NAME}.h"), hf)
+        _write(testset_c, sf)
+        for f in TESTSET_RUNTIME_FILES:
+            with open(os.path.join(RUNTIME_DIR, f)) as src:
+                _write(os.path.join(args.out_dir, f), src.read())
+        return
+
+    _write(os.path.join(args.out_dir, f"{args.name}.h"), header)
+    _write(os.path.join(args.out_dir, f"{args.name}.c"), source)
+    if not args.no_runtime:
+        for f in RUNTIME_FILES:
+            with open(os.path.join(RUNTIME_DIR, f)) as src:
+                _write(os.path.join(args.out_dir, f), src.read())
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,328 @@
+'''
+    crosscheck.py
+    Author: Shwetank Shekhar
+
+    Bit-exact cross-validation of the C inference engines against the
+    TFLite interpreter. Each engine is built natively as a shared library
+    (cc, driven over ctypes like bitwidth_search.py) and run side by side
+    with the interpreter on every image; the int8 activations of each layer,
+    the int32 accumulators where the engine exposes them and the final
+    logits are diffed element by element.
+
+    Interpreter: tensorflow.lite / tflite_runtime with all intermediate
+    tensors preserved when one is installed, otherwise reference.py (the
+    NumPy port of the TFLM reference kernels). The int32 accumulators are
+    always recomputed from the interpreter's input tensor of each layer.
+
+    Engines:
+        runtime[=KERNEL]  runtime/model_runtime.c with the layer table
+                          compile_model() emits; KERNEL forces one variant
+                          for every layer (default: the compiler's choice).
+                          The lossy lut kernel is diffed against reference.py
+                          run on the clustered weights it encodes
+        qint8=SRC_DIR     a project's app_inference.h + mnist_model_params.c
+                          (12x12, camera pipeline), layer by layer as
+                          QInt8Predict() in its main.c runs them
+
+    Images: the MNIST test set from --mnist (all 10000 by default,
+    preprocessed for the model's input size), else --testset, plus
+    --random N uniform int8 inputs. Prints, per engine, the mismatch count of
+    every stage and the first divergent layer and element; exits with
+    status 1 if any engine is not bit-exact.
+
+    python tools/model_compiler/crosscheck.py MODEL.tflite --engine runtime --engine runtime=pooled \
+        --engine qint8=sifive_hifive1_MNIST_Approach_3_2_12x12/src
+'''
+import argparse
+import copy
+import ctypes
+import os
+import re
+import subprocess
+import tempfile
+
+import numpy as np
+
+import reference
+from compiler import (LOSSY_VARIANTS, RUNTIME_DIR, VARIANTS, CompileError, compile_model, lower,
+                      mnist_samples)
+from tflite_model import TFLiteModel
+
+
+def _build(sources, include_dirs, lib_name, tmp):
+    lib = os.path.join(tmp, lib_name)
+    cmd = ["cc", "-O2", "-shared", "-fPIC", "-Wall"]
+    for d in include_dirs:
+        cmd += ["-I", d]
+    subprocess.run(cmd + list(sources) + ["-o", lib, "-lm"], check=True)
+    return ctypes.CDLL(lib)
+
+
+def _ptr(array):
+    return array.ctypes.data_as(ctypes.c_void_p)
+
+
+class Interpreter:
+    """Per-sample {tensor id: int8 array} from the TFLite interpreter, or reference.py without it."""
+
+    def __init__(self, model_path, model, use_tflite="auto"):
+        self.model = model
+        self.tflite = None
+        if use_tflite != "reference":
+            try:
+                try:
+                    from tflite_runtime.interpreter import Interpreter as TFLiteInterpreter
+                except ImportError:
+                    from tensorflow.lite import Interpreter as TFLiteInterpreter
+                self.tflite = TFLiteInterpreter(model_path=model_path, experimental_preserve_all_tensors=True)
+                self.tflite.allocate_tensors()
+            except ImportError:
+                if use_tflite == "tflite":
+                    raise SystemExit("--interpreter tflite: neither tflite_runtime nor tensorflow is installed")
+        self.name = "TFLite interpreter" if self.tflite else "reference.py (TFLite not installed)"
+
+    def run(self, image):
+        if self.tflite is None:
+            return reference.run(self.model, image)
+        t_in = self.model.tensors[self.model.inputs[0]]
+        self.tflite.set_tensor(self.model.inputs[0], np.asarray(image, dtype=np.int8).reshape(t_in.shape))
+        self.tflite.invoke()
+        values = {}
+        for op in self.model.operators:
+            for t in op.outputs:
+                if self.model.tensors[t].dtype_name == "int8":
+                    values[t] = self.tflite.get_tensor(t)
+        values[self.model.inputs[0]] = np.asarray(image, dtype=np.int8)
+        return values
+
+
+class RuntimeEngine:
+    """model_runtime.c + a compiled layer table; layer k is read back after model_invoke(layers, k)."""
+
+    def __init__(self, model_path, model, kernel, tmp, lut_centroids=16):
+        self.name = f"runtime ({kernel or 'auto'})"
+        variants = {"all": kernel} if kernel else None
+        header, source, self.layers, self.plan = compile_model(model_path, "crosscheck_model", variants,
+                                                               lut_centroids)
+        for name, text in (("crosscheck_model.h", header), ("crosscheck_model.c", source)):
+            with open(os.path.join(tmp, name), "w") as f:
+                f.write(text)
+        self.lib = _build([os.path.join(tmp, "crosscheck_model.c"), os.path.join(RUNTIME_DIR, "model_runtime.c")],
+                          [tmp, RUNTIME_DIR], f"libcrosscheck_{kernel or 'auto'}.so", tmp)
+        self.table = ctypes.addressof(ctypes.c_char.in_dll(self.lib, "crosscheck_model_layers"))
+        self.arena = np.zeros(self.plan["arena"], dtype=np.int8)
+        # Streamed layers only keep a ring of rows, so only full tensors are compared.
+        self.checked = [layer for layer in self.layers if not layer.stream]
+        self.stages = [(f"{layer.name} {layer.variant or layer.kind}", "tensor", layer.output_id)
+                       for layer in self.checked]
+        self.input_offset = self.plan["offsets"][self.plan["input"]]
+        self.input_size = model.tensors[self.plan["input"]].size
+        self.reference_model = None
+        if kernel in LOSSY_VARIANTS:
+            self.reference_model = copy.deepcopy(model)
+            by_name = {t.name: t for t in self.reference_model.tensors}
+            for layer in self.layers:
+                if layer.kind == "fc":
+                    t_w = by_name[layer.src["weights"].name]
+                    t_w.data = layer.weights.reshape(t_w.data.shape).astype(t_w.data.dtype)
+            self.name += " vs clustered weights"
+
+    def run(self, image):
+        out = []
+        for layer in self.checked:
+            k = self.layers.index(layer)
+            self.arena[:] = 0
+            self.arena[self.input_offset:self.input_offset + self.input_size] = image
+            self.lib.model_invoke(ctypes.c_void_p(self.table), ctypes.c_uint32(k + 1), _ptr(self.arena))
+            offset = self.plan["offsets"][layer.output_id]
+            out.append(self.arena[offset:offset + layer.n_output].copy())
+        return out
+
+
+class QInt8Engine:
+    """A project's processfclayer + quantized_relu_requantize, wired like its QInt8Predict()."""
+
+    reference_model = None
+
+    def __init__(self, src_dir, model, tmp):
+        self.name = f"qint8 ({os.path.basename(os.path.dirname(os.path.abspath(src_dir)))})"
+        with open(os.path.join(src_dir, "mnist_model_params.h")) as f:
+            n = len(re.findall(r"\bL(\d+)_weights\[", f.read()))
+        fc_ops = [op for op in model.operators if op.op_name == "FULLY_CONNECTED"]
+        layers = [layer for layer in lower(model)[0] if layer.kind == "fc"]
+        if n != len(fc_ops):
+            raise SystemExit(f"{src_dir}: {n} layers in mnist_model_params.h, {len(fc_ops)} in the model")
+
+        shim = ["#include \"app_inference.h\"\n"]
+        for l in range(1, n + 1):
+            shim.append(f"void crosscheck_L{l}(const int8_t* input, int32_t* sum, int8_t* out) {{\n"
+                        f"    processfclayer(input, L{l}_weights, L{l}_biases, L{l}_incoming_weights, "
+                        f"L{l}_outgoing_weights, sum,\n"
+                        f"                   L{l}_input_zero_point, L{l}_weights_zero_point);\n")
+            if l < n:
+                shim.append(f"    quantized_relu_requantize(sum, out, L{l}_outgoing_weights,\n"
+                            f"                              L{l}_output_scale, L{l + 1}_input_scale, "
+                            f"L{l + 1}_input_zero_point);\n")
+            shim.append("}\n")
+        path = os.path.join(tmp, "qint8_shim.c")
+        with open(path, "w") as f:
+            f.write("".join(shim))
+        self.lib = _build([path, os.path.join(src_dir, "mnist_model_params.c")], [src_dir],
+                          f"libqint8_{len(os.listdir(tmp))}.so", tmp)
+        self.sizes = [layer.n_output for layer in layers]
+        self.stages = []
+        for l, (op, layer) in enumerate(zip(fc_ops, layers)):
+            self.stages.append((f"L{l + 1} acc", "acc", op.index))
+            if l < n - 1:
+                self.stages.append((f"L{l + 1} out", "tensor", layer.output_id))
+
+    def run(self, image):
+        out, act = [], np.ascontiguousarray(image, dtype=np.int8)
+        for l, size in enumerate(self.sizes):
+            acc = np.zeros(size, dtype=np.int32)
+            nxt = np.zeros(size, dtype=np.int8)
+            getattr(self.lib, f"crosscheck_L{l + 1}")(_ptr(act), _ptr(acc), _ptr(nxt))
+            out.append(acc)
+            if l < len(self.sizes) - 1:
+                out.append(nxt)
+            act = nxt
+        return out
+
+
+def expected(model, values, stages):
+    """Interpreter values in the engine's stage order."""
+    result = []
+    for _, kind, key in stages:
+        if kind == "acc":
+            op = model.operators[key]
+            result.append(reference.accumulate(model, op, values[op.inputs[0]]))
+        else:
+            result.append(values[key])
+    return result
+
+
+class Diff:
+    def __init__(self, engine):
+        self.engine = engine
+        self.samples = 0
+        self.stage_samples = [0] * len(engine.stages)
+        self.stage_elements = [0] * len(engine.stages)
+        self.stage_max = [0] * len(engine.stages)
+        self.first = None
+        self.argmax_agree = 0
+        self.correct = 0
+
+    def add(self, index, label, got, want):
+        self.samples += 1
+        first_here = None
+        for s, (g, w) in enumerate(zip(got, want)):
+            g = np.asarray(g, dtype=np.int64).reshape(-1)
+            w = np.asarray(w, dtype=np.int64).reshape(-1)
+            bad = np.flatnonzero(g != w)
+            if bad.size:
+                self.stage_samples[s] += 1
+                self.stage_elements[s] += bad.size
+                self.stage_max[s] = max(self.stage_max[s], int(np.abs(g - w).max()))
+                if first_here is None:
+                    first_here = (s, int(bad[0]), int(g[bad[0]]), int(w[bad[0]]))
+        if first_here and self.first is None:
+            self.first = (index, label) + first_here
+        pred, ref_pred = int(np.argmax(got[-1])), int(np.argmax(want[-1]))
+        self.argmax_agree += pred == ref_pred
+        self.correct += label is not None and pred == label
+
+    @property
+    def exact(self):
+        return self.first is None
+
+    def report(self, labelled):
+        print(f"\n{self.engine.name}: {'bit-exact' if self.exact else 'DIVERGES'} on {self.samples} inputs")
+        print(f"  {'stage':<22} {'samples':>8} {'elements':>9} {'max |diff|':>11}")
+        for s, (name, _, _) in enumerate(self.engine.stages):
+            print(f"  {name:<22} {self.stage_samples[s]:>8} {self.stage_elements[s]:>9} {self.stage_max[s]:>11}")
+        print(f"  argmax agrees with the interpreter on {self.argmax_agree}/{self.samples}", end="")
+        print(f", accuracy {self.correct}/{labelled}" if labelled else "")
+        if self.first:
+            index, label, s, element, got, want = self.first
+            print(f"  first divergence: input #{index}{'' if label is None else f' (label {label})'}, "
+                  f"{self.engine.stages[s][0]}[{element}] = {got}, interpreter {want}")
+
+
+def load_images(args, model):
+    t_in = model.tensors[model.inputs[0]]
+    images = []
+    if os.path.exists(args.mnist):
+        images += mnist_samples(args.mnist, t_in.size, args.count, t_in.scale[0], int(t_in.zero_point[0]))
+        print(f"{args.mnist}: {len(images)} test images")
+    elif args.testset:
+        from testset import load_testset
+        images += load_testset(args.testset)
+        print(f"{args.mnist} not found, using the {len(images)} images of {args.testset}")
+    if args.random:
+        rng = np.random.default_rng(0)
+        images += [(rng.integers(-128, 128, t_in.size).astype(np.int8), None) for _ in range(args.random)]
+    if not images:
+        raise SystemExit("no inputs: provide mnist.npz, --testset or --random N")
+    return images
+
+
+def make_engine(spec, model_path, model, tmp, lut_centroids):
+    kind, _, arg = spec.partition("=")
+    if kind == "runtime":
+        if arg and arg not in VARIANTS + LOSSY_VARIANTS:
+            raise SystemExit(f"--engine {spec}: kernel must be one of {', '.join(VARIANTS + LOSSY_VARIANTS)}")
+        try:
+            return RuntimeEngine(model_path, model, arg or None, tmp, lut_centroids)
+        except CompileError as e:
+            raise SystemExit(f"--engine {spec}: {e}")
+    if kind == "qint8" and arg:
+        return QInt8Engine(arg, model, tmp)
+    raise SystemExit(f"--engine {spec}: expected runtime[=KERNEL] or qint8=SRC_DIR")
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Diff the C engines against the TFLite interpreter, layer by layer.")
+    ap.add_argument("model")
+    ap.add_argument("--engine", action="append", metavar="SPEC",
+                    help="runtime, runtime=KERNEL or qint8=SRC_DIR (default: runtime with every kernel)")
+    ap.add_argument("--lut-centroids", type=int, default=16, help="weight clusters for runtime=lut")
+    ap.add_argument("--interpreter", choices=("auto", "tflite", "reference"), default="auto")
+    ap.add_argument("--mnist", default=os.path.expanduser("~/.keras/datasets/mnist.npz"))
+    ap.add_argument("--count", type=int, default=10000, help="MNIST test images to check")
+    ap.add_argument("--testset", help="generated mnist_testset.c, used when mnist.npz is missing")
+    ap.add_argument("--random", type=int, default=0, help="extra uniform random int8 inputs")
+    args = ap.parse_args(argv)
+
+    model = TFLiteModel(args.model)
+    images = load_images(args, model)
+    interpreter = Interpreter(args.model, model, args.interpreter)
+    with tempfile.TemporaryDirectory() as tmp:
+        if args.engine:
+            engines = [make_engine(spec, args.model, model, tmp, args.lut_centroids) for spec in args.engine]
+        else:
+            engines = [RuntimeEngine(args.model, model, None, tmp)]
+            for kernel in VARIANTS:
+                try:
+                    engines.append(RuntimeEngine(args.model, model, kernel, tmp))
+                except CompileError as e:
+                    print(f"skipping runtime={kernel}: {e}")
+        diffs = [Diff(engine) for engine in engines]
+        print(f"checking {len(engines)} engine(s) against {interpreter.name}")
+        for index, (image, label) in enumerate(images):
+            values = interpreter.run(image)
+            for engine, diff in zip(engines, diffs):
+                if engine.reference_model is None:
+                    want = expected(model, values, engine.stages)
+                else:
+                    want = expected(engine.reference_model, reference.run(engine.reference_model, image),
+                                    engine.stages)
+                diff.add(index, label, engine.run(image), want)
+    labelled = sum(1 for _, label in images if label is not None)
+    for diff in diffs:
+        diff.report(labelled)
+    if not all(diff.exact for diff in diffs):
+        raise SystemExit(1)
+
+
+if __name__ == "__main__":
+    main()
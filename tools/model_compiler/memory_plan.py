@@ -0,0 +1,472 @@
+'''
+    memory_plan.py
+    Author: Shwetank Shekhar
+
+    Offline memory planner for the TFLite Micro build. Computes the tensor
+    lifetimes MicroAllocator uses (allocation scope = op index + 1, subgraph
+    inputs live from 0, outputs to the last op, sizes rounded up to the 16-byte
+    arena alignment, the outputs of in-place kernels such as RESHAPE and
+    LEAKY_RELU sharing their input's buffer), runs GreedyMemoryPlanner's
+    placement exactly as the device would, then searches for a smaller plan
+    and writes the offsets into the model's "OfflineMemoryAllocation" metadata:
+
+        buffer = uint32 [version 1, subgraph 0, n_tensors, int32 offset per tensor]
+
+    with -1 for tensors the arena does not plan (weights, variables). On the
+    device MemoryPlannerType::kOffline (offline_memory_planner.h) takes those
+    offsets as they are, with no sorting or gap search; the stock greedy
+    planner honours them as well.
+
+    The search is a branch and bound over placement orders: each order is
+    packed first-fit (lowest offset that clears every time-overlapping buffer
+    already placed) and a branch is cut as soon as it is no lower than the best
+    plan so far. It starts from the greedy plan and stops at the lower bound
+    (most bytes live at one time), where the plan is provably optimal, or
+    after --max-nodes placements. Only single-subgraph models are planned.
+
+    python tools/model_compiler/memory_plan.py MODEL.tflite [MODEL.tflite ...]       # report
+    python tools/model_compiler/memory_plan.py MODEL.tflite --out planned.tflite \
+        --header src/mnist_model_data.h --name mnist_model_int8
+'''
+import argparse
+import os
+import struct
+import sys
+
+import numpy as np
+
+from compiler import _write
+from tflite_model import TENSOR_TYPES, TFLiteModel, _Table
+
+ARENA_ALIGN = 16             # MicroArenaBufferAlignment()
+METADATA_NAME = "OfflineMemoryAllocation"
+METADATA_VERSION = 1
+ONLINE = -1                  # kOnlinePlannedBuffer
+MODEL_FIELDS = 8             # version, operator_codes, subgraphs, description, buffers,
+                             # metadata_buffer, metadata, signature_defs
+BUFFERS_FIELD, METADATA_FIELD = 4, 6
+
+# Kernels whose TFLMRegistration::inplace_operator lets the output share the
+# first input's buffer: op -> data left unmodified (kTfLiteInplaceOpDataUnmodified).
+# Keep in sync with the kernels; MicroAllocator applies the same rules.
+INPLACE_OPS = {"RESHAPE": True, "LEAKY_RELU": False}
+
+
+class Buffer:
+    def __init__(self, tensor, size, first, last, aliases=()):
+        self.tensor = tensor
+        self.size = size
+        self.first = first
+        self.last = last
+        self.aliases = list(aliases)  # outputs computed in place in this buffer
+
+    def overlaps(self, other):
+        return not (self.first > other.last or other.first > self.last)
+
+    def __repr__(self):
+        return f"Buffer(t{self.tensor}, {self.size}, {self.first}..{self.last})"
+
+
+def _align(n, a=ARENA_ALIGN):
+    return n + (-n) % a
+
+
+def tensor_bytes(tensor):
+    dtype = TENSOR_TYPES.get(_type_code(tensor.dtype_name))
+    if dtype is None:
+        raise ValueError(f"tensor {tensor.index} ({tensor.name}): unsupported type {tensor.dtype_name}")
+    return tensor.size * np.dtype(dtype[1]).itemsize
+
+
+def _type_code(name):
+    for code, (type_name, _) in TENSOR_TYPES.items():
+        if type_name == name:
+            return code
+    return None
+
+
+def arena_buffers(model, inplace=True):
+    """Planned tensors in MicroAllocator's AddBuffer order, with its lifetimes.
+    With inplace, outputs of INPLACE_OPS join their input's buffer as
+    AllocationInfoBuilder::MarkInPlaceOutputs() does."""
+    if model.subgraph_count != 1:
+        raise ValueError(f"{model.path}: {model.subgraph_count} subgraphs, only single-subgraph models are planned")
+    first, last = {}, {}
+
+    def use(t, scope, create=False):
+        if create:
+            first.setdefault(t, scope)
+        last[t] = max(last.get(t, scope), scope)
+
+    for t in model.inputs:
+        use(t, 0, create=True)
+    for scope, op in enumerate(model.operators, 1):
+        for t in op.outputs:
+            first.setdefault(t, scope)
+        for t in op.inputs:
+            if t >= 0:
+                use(t, scope)
+        for t in op.outputs:
+            use(t, scope)
+    for t in model.outputs:
+        use(t, len(model.operators), create=True)
+
+    sizes = {}
+    for tensor in model.tensors:
+        if tensor.is_const or tensor.is_variable:
+            continue
+        size = tensor_bytes(tensor)
+        if size == 0:
+            continue
+        if tensor.index not in first:
+            raise ValueError(f"tensor {tensor.index} ({tensor.name}) is never produced or used")
+        sizes[tensor.index] = size
+
+    alias = {}
+    for scope, op in enumerate(model.operators, 1):
+        unmodified = INPLACE_OPS.get(op.op_name)
+        if not inplace or unmodified is None or not op.inputs or not op.outputs:
+            continue
+        i, o = op.inputs[0], op.outputs[0]
+        root = alias.get(i, i)
+        if i < 0 or i == o or root not in sizes or o not in sizes or sizes[o] > sizes[root]:
+            continue
+        group = {root} | {t for t, r in alias.items() if r == root}
+        if not unmodified and (last[root] != scope or group & set(model.inputs + model.outputs)):
+            continue
+        alias[o] = root
+        first[root] = min(first[root], first[o])
+        last[root] = max(last[root], last[o])
+
+    return [Buffer(t, _align(size), first[t], last[t], [a for a, r in alias.items() if r == t])
+            for t, size in sizes.items() if t not in alias]
+
+
+def _first_fit(buffer, placed):
+    """Lowest offset where buffer clears every time-overlapping (offset, Buffer) in placed."""
+    busy = sorted((o, o + b.size) for o, b in placed if b.overlaps(buffer))
+    offset = 0
+    for start, end in busy:
+        if start - offset >= buffer.size:
+            break
+        offset = max(offset, end)
+    return offset
+
+
+def greedy_plan(buffers):
+    """GreedyMemoryPlanner::CalculateOffsetsIfNeeded: biggest first, ties in reverse add order."""
+    order = sorted(reversed(range(len(buffers))), key=lambda i: -buffers[i].size)
+    offsets = [0] * len(buffers)
+    placed = []
+    for i in order:
+        offsets[i] = _first_fit(buffers[i], placed)
+        placed.append((offsets[i], buffers[i]))
+    return offsets
+
+
+def plan_size(buffers, offsets):
+    return max((o + b.size for o, b in zip(offsets, buffers)), default=0)
+
+
+def lower_bound(buffers):
+    """Most bytes live in any one allocation scope; no plan can be smaller."""
+    scopes = {s for b in buffers for s in (b.first, b.last)}
+    return max((sum(b.size for b in buffers if b.first <= s <= b.last) for s in scopes), default=0)
+
+
+def optimal_plan(buffers, max_nodes=200000):
+    """Branch and bound over first-fit placement orders. Returns (offsets, optimal?)."""
+    best = greedy_plan(buffers)
+    best_size = plan_size(buffers, best)
+    bound = lower_bound(buffers)
+    if best_size == bound:
+        return best, True
+    n = len(buffers)
+    offsets = [0] * n
+    used = [False] * n
+    placed = []
+    nodes = 0
+
+    def search(height):
+        nonlocal best, best_size, nodes
+        if len(placed) == n:
+            best, best_size = list(offsets), height
+            return best_size == bound
+        seen = set()
+        # Big buffers first finds good plans early, so more branches are cut.
+        for i in sorted(range(n), key=lambda i: -buffers[i].size):
+            b = buffers[i]
+            key = (b.size, b.first, b.last)
+            if used[i] or key in seen:
+                continue
+            seen.add(key)
+            nodes += 1
+            if nodes > max_nodes:
+                return True
+            offset = _first_fit(b, placed)
+            top = max(height, offset + b.size)
+            if top >= best_size:
+                continue
+            used[i] = True
+            offsets[i] = offset
+            placed.append((offset, b))
+            done = search(top)
+            placed.pop()
+            used[i] = False
+            if done:
+                return True
+        return False
+
+    search(0)
+    return best, best_size == bound
+
+
+def check_plan(buffers, offsets):
+    for i, (a, oa) in enumerate(zip(buffers, offsets)):
+        for b, ob in zip(buffers[i + 1:], offsets[i + 1:]):
+            if a.overlaps(b) and oa < ob + b.size and ob < oa + a.size:
+                raise AssertionError(f"plan overlaps {a} at {oa} and {b} at {ob}")
+
+
+def metadata_words(model, buffers, offsets):
+    words = [ONLINE] * len(model.tensors)
+    for b, o in zip(buffers, offsets):
+        for t in [b.tensor] + b.aliases:
+            words[t] = o
+    return struct.pack(f"<III{len(words)}i", METADATA_VERSION, 0, len(words), *words)
+
+
+# --- Flatbuffer rewrite ---
+
+class _Block:
+    """Bytes laid out at an absolute position in the new file (little endian).
+    Offsets may name a label placed later; they are patched in resolve()."""
+
+    def __init__(self, base):
+        self.base = base
+        self.data = bytearray()
+        self.labels = {}
+        self.patches = []
+
+    @property
+    def pos(self):
+        return self.base + len(self.data)
+
+    def align(self, a, extra=0):
+        self.data += bytes((-(self.pos + extra)) % a)
+
+    def label(self, name):
+        self.labels[name] = self.pos
+
+    def u16(self, *v):
+        self.data += struct.pack(f"<{len(v)}H", *v)
+
+    def u32(self, *v):
+        self.data += struct.pack(f"<{len(v)}I", *v)
+
+    def uoffset(self, target):
+        self.patches.append((self.pos, target))
+        self.u32(0)
+
+    def table(self, name, fields):
+        """fields: (kind, value) per slot, kind "u32", "off" or None (absent).
+        The vtable goes right before the table, which is labelled name."""
+        self.align(2)
+        vtable = self.pos
+        slots, at = [], 4
+        for kind, _ in fields:
+            slots.append(at if kind else 0)
+            at += 4 if kind else 0
+        self.u16(4 + 2 * len(fields), at, *slots)
+        self.align(4)
+        self.label(name)
+        self.data += struct.pack("<i", self.pos - vtable)
+        for kind, value in fields:
+            if kind == "u32":
+                self.u32(value)
+            elif kind == "off":
+                self.uoffset(value)
+
+    def resolve(self):
+        for pos, target in self.patches:
+            target = self.labels.get(target, target)
+            if target <= pos:
+                raise AssertionError("flatbuffer offsets must point forward")
+            struct.pack_into("<I", self.data, pos - self.base, target - pos)
+
+
+def _find_metadata(buf, model):
+    """(Buffer table position, data vector position) of an existing OfflineMemoryAllocation."""
+    buffers = model.tables(BUFFERS_FIELD)
+    for md in model.tables(METADATA_FIELD):
+        if md.string(0) == METADATA_NAME:
+            index = md.scalar(1, "I")
+            if index < len(buffers):
+                return index, buffers[index]._indirect(0)
+    return None, None
+
+
+def embed_plan(buf, words):
+    """Returns a copy of the .tflite buf with the metadata words in OfflineMemoryAllocation."""
+    buf = bytes(buf)
+    root = struct.unpack_from("<I", buf, 0)[0]
+    model = _Table(buf, root)
+    _, data = _find_metadata(buf, model)
+    if data is not None and struct.unpack_from("<I", buf, data)[0] == len(words):
+        out = bytearray(buf)
+        out[data + 4:data + 4 + len(words)] = words
+        return bytes(out)
+    if model.vtable_size > 4 + 2 * MODEL_FIELDS:
+        raise ValueError("Model table has fields this tool does not know; not rewriting it")
+
+    # The new root table, the extended buffers / metadata vectors and the new
+    # Buffer and Metadata tables go in a block right after the 8-byte header,
+    # parents first because flatbuffer offsets only point forward. Old tables
+    # are only referenced, never moved relative to each other, and the block is
+    # a multiple of 16 bytes, so the old constant buffers keep their alignment.
+    header = 8 if buf[4:8] == b"TFL3" else 4
+    old_buffers = _vector_entries(buf, model, BUFFERS_FIELD)
+    old_metadata = [p for p in _vector_entries(buf, model, METADATA_FIELD)
+                    if _Table(buf, p).string(0) != METADATA_NAME]
+    new_index = len(old_buffers)
+
+    def build(shift):
+        blk = _Block(header)
+        fields = [("u32", model.scalar(0, "I"))]
+        for field in range(1, MODEL_FIELDS):
+            p = model._indirect(field)
+            fields.append(("off", p + shift) if p is not None else (None, None))
+        fields[BUFFERS_FIELD] = ("off", "buffers")
+        fields[METADATA_FIELD] = ("off", "metadata")
+        blk.table("model", fields)
+        blk.label("buffers")
+        blk.u32(len(old_buffers) + 1)
+        for p in old_buffers:
+            blk.uoffset(p + shift)
+        blk.uoffset("buffer")
+        blk.label("metadata")
+        blk.u32(len(old_metadata) + 1)
+        for p in old_metadata:
+            blk.uoffset(p + shift)
+        blk.uoffset("metadata_table")
+        blk.table("buffer", [("off", "data")])
+        blk.table("metadata_table", [("off", "name"), ("u32", new_index)])
+        blk.label("name")
+        name = METADATA_NAME.encode()
+        blk.u32(len(name))
+        blk.data += name + b"\0"
+        blk.align(ARENA_ALIGN, extra=4)
+        blk.label("data")
+        blk.u32(len(words))
+        blk.data += words
+        blk.align(ARENA_ALIGN)
+        blk.resolve()
+        return blk
+
+    size = len(build(0).data)
+    blk = build(size)
+    assert len(blk.data) == size
+    out = bytearray(struct.pack("<I", blk.labels["model"])) + buf[4:header] + blk.data + buf[header:]
+    return bytes(out)
+
+
+def _vector_entries(buf, table, field):
+    """Absolute positions of the tables in a vector of tables, [] when absent."""
+    p = table._indirect(field)
+    if p is None:
+        return []
+    n = struct.unpack_from("<I", buf, p)[0]
+    return [p + 4 + 4 * i + struct.unpack_from("<I", buf, p + 4 + 4 * i)[0] for i in range(n)]
+
+
+def read_plan(buf, raw=False):
+    """Offsets stored in a model's OfflineMemoryAllocation (or in the raw metadata words), or None."""
+    if raw:
+        words = struct.unpack(f"<{len(buf) // 4}i", buf)
+        return list(words[3:3 + words[2]])
+    model = _Table(buf, struct.unpack_from("<I", buf, 0)[0])
+    _, data = _find_metadata(buf, model)
+    if data is None:
+        return None
+    n = struct.unpack_from("<I", buf, data)[0] // 4
+    words = struct.unpack_from(f"<{n}i", buf, data + 4)
+    return list(words[3:3 + words[2]])
+
+
+def c_header(buf, name, guard, banner):
+    lines = [", ".join(f"0x{b:02x}" for b in buf[i:i + 16]) for i in range(0, len(buf), 16)]
+    return (f"{banner}\n#ifndef {guard}\n#define {guard}\n\n#include <stdint.h>\n\n"
+            f"const unsigned char {name}_data[] = {{\n    " + ",\n    ".join(lines) + "\n};\n\n"
+            f"const int {name}_len = {len(buf)};\n\n#endif // {guard}\n")
+
+
+def plan_model(path, max_nodes, inplace=True):
+    model = TFLiteModel(path)
+    buffers = arena_buffers(model, inplace)
+    greedy = greedy_plan(buffers)
+    offsets, optimal = optimal_plan(buffers, max_nodes)
+    check_plan(buffers, greedy)
+    check_plan(buffers, offsets)
+    return model, buffers, greedy, offsets, optimal
+
+
+def report(path, buffers, greedy, offsets, optimal):
+    g, o = plan_size(buffers, greedy), plan_size(buffers, offsets)
+    print(f"{path}: {len(buffers)} arena tensors, lower bound {lower_bound(buffers)} B, "
+          f"greedy {g} B, offline {o} B ({'optimal' if optimal else 'best found'}), saves {g - o} B")
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Plan TFLM tensor offsets offline and embed them in a .tflite.")
+    ap.add_argument("models", nargs="+")
+    ap.add_argument("--out", help="write the model with OfflineMemoryAllocation metadata (one model only)")
+    ap.add_argument("--header", help="also write it as a C array header, in the layout of mnist_model_data.h")
+    ap.add_argument("--name", default="mnist_model_int8", help="C symbol prefix for --header")
+    ap.add_argument("--title", default="MNIST", help="model name in the --header banner")
+    ap.add_argument("--description", default="8x8 MNIST Classifier", help="model line of the --header banner")
+    ap.add_argument("--greedy", action="store_true", help="embed the greedy plan instead of the searched one")
+    ap.add_argument("--no-inplace", action="store_true",
+                    help="plan every output in its own buffer (kernels without inplace_operator)")
+    ap.add_argument("--max-nodes", type=int, default=200000, help="search budget, in placements")
+    ap.add_argument("-v", "--verbose", action="store_true", help="list every buffer and its offsets")
+    args = ap.parse_args(argv)
+    if (args.out or args.header) and len(args.models) != 1:
+        ap.error("--out / --header take a single model")
+
+    for path in args.models:
+        try:
+            model, buffers, greedy, offsets, optimal = plan_model(path, args.max_nodes, not args.no_inplace)
+        except ValueError as e:
+            print(f"{path}: skipped, {e}", file=sys.stderr)
+            continue
+        report(path, buffers, greedy, offsets, optimal)
+        if args.verbose:
+            for b, g, o in zip(buffers, greedy, offsets):
+                shared = f"  + t{', t'.join(map(str, b.aliases))} in place" if b.aliases else ""
+                print(f"  t{b.tensor:<3} {b.size:>6} B  scopes {b.first}..{b.last}  greedy @{g:<6} offline @{o}{shared}")
+        if not (args.out or args.header):
+            continue
+        with open(path, "rb") as f:
+            buf = f.read()
+        chosen = greedy if args.greedy else offsets
+        planned = embed_plan(buf, metadata_words(model, buffers, chosen))
+        assert read_plan(planned) == read_plan(metadata_words(model, buffers, chosen), raw=True), \
+            "metadata did not round-trip"
+        print(f"{path}: {len(buf)} -> {len(planned)} bytes with {METADATA_NAME}")
+        if args.out:
+            with open(args.out, "wb") as f:
+                f.write(planned)
+            print(f"Wrote {args.out}")
+        if args.header:
+            banner = (f"/*\n * {args.title} Model Data - INT8 Quantized Version\n"
+                      " * Auto-generated header file for SiFive HiFive1 Board\n"
+                      f" * Model: {args.description}\n * Quantization: INT8\n"
+                      f" * Memory plan: {METADATA_NAME} metadata, {plan_size(buffers, chosen)} B arena\n"
+                      " * (tools/model_compiler/memory_plan.py)\n */\n")
+            guard = os.path.basename(args.header).upper().replace(".", "_") + "_"
+            _write(args.header, c_header(planned, args.name, guard, banner))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
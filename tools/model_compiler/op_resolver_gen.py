@@ -0,0 +1,248 @@
+'''
+    op_resolver_gen.py
+    Author: Shwetank Shekhar
+
+    Op resolver generator for the TFLite Micro build, after
+    tensorflow/lite/tools/gen_op_registration.cc: reads the operator codes of a
+    .tflite (ReadOpsFromModel: builtin ops by enum name with their min / max
+    version, custom ops by name, registered as Register_<NORMALIZED_NAME>())
+    and writes a header with a tflite::MicroOpResolver that holds exactly
+    those kernels.
+
+    Unlike MicroMutableOpResolver<N> there is nothing to Add*() at setup and no
+    linear search per lookup: a constexpr table indexed by BuiltinOperator
+    gives the op's slot, and the parse functions sit in a constexpr array
+    next to it. Only the Register_*() / Parse*() functions of the model's ops
+    are referenced, so --gc-sections drops every other kernel. The
+    TFLMRegistration structs come from the kernels' Register_*() functions,
+    which are not constexpr, so they are copied into the resolver once by its
+    constructor.
+
+    The op -> Register_*() / Parse*() mapping is read from the TFLM tree's
+    micro_mutable_op_resolver.h and the enum values from schema_generated.h,
+    so the generator needs no table of its own.
+
+    python tools/model_compiler/op_resolver_gen.py MODEL.tflite --out src/mnist_op_resolver.h \
+        --name MnistOpResolver
+'''
+import argparse
+import os
+import re
+import sys
+
+from compiler import _write
+from tflite_model import TFLiteModel
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_TFLM = os.path.join(HERE, "..", "..", "sifive_hifive1_MNIST_Tflite_micro_implementation",
+                            "src", "tensorflow_lite")
+MUTABLE_RESOLVER = "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+SCHEMA = "tensorflow/lite/schema/schema_generated.h"
+MICRO_OPS = "tensorflow/lite/micro/kernels/micro_ops.h"
+KERNELS_DIR = "tensorflow/lite/micro/kernels"
+CUSTOM = 32                  # BuiltinOperator_CUSTOM
+NO_SLOT = 0xFF
+
+
+def normalize_custom_op_name(op):
+    """NormalizeCustomOpName(): "CustomOp" / "custom_op" -> "CUSTOM_OP". Characters
+    that cannot go in an identifier are dropped, as for Register_ETHOSU()."""
+    return re.sub(r"\W", "", re.sub(r"([a-z])([A-Z])", r"\1_\2", op)).upper()
+
+
+def read_ops_from_model(model):
+    """ReadOpsFromModel(): ({builtin code: (min, max version)}, {custom name: (min, max)})."""
+    builtin_ops, custom_ops = {}, {}
+    for code, custom_code, version in model.op_codes:
+        ops, key = (custom_ops, custom_code) if code == CUSTOM else (builtin_ops, code)
+        lo, hi = ops.get(key, (version, version))
+        ops[key] = (min(lo, version), max(hi, version))
+    return builtin_ops, custom_ops
+
+
+def builtin_enum(tflm):
+    """BuiltinOperator value -> enum name, from schema_generated.h."""
+    with open(os.path.join(tflm, SCHEMA)) as f:
+        text = f.read()
+    body = re.search(r"enum BuiltinOperator : int32_t \{(.*?)\};", text, re.S).group(1)
+    return {int(v): n for n, v in re.findall(r"BuiltinOperator_(\w+) = (-?\d+),", body)}
+
+
+def resolver_entries(tflm):
+    """Enum name -> (Register_*, Parse*) from MicroMutableOpResolver's Add*() functions."""
+    with open(os.path.join(tflm, MUTABLE_RESOLVER)) as f:
+        text = f.read()
+    entries = {}
+    for signature, body in re.findall(r"TfLiteStatus Add\w+\(([^)]*(?:\(\))?[^)]*)\)\s*\{(.*?)\n  \}", text, re.S):
+        m = re.search(r"AddBuiltin\(\s*BuiltinOperator_(\w+),\s*([\w:]+(?:\(\))?),\s*([\w:]+)\)", body)
+        if not m:
+            continue
+        name, registration, parser = m.groups()
+        if registration == "registration":
+            default = re.search(r"=\s*([\w:]+)\(\)", signature)
+            if not default:
+                continue
+            registration = default.group(1)
+        registration = registration.replace("tflite::", "").replace("()", "")
+        entries[name] = (registration, parser.replace("tflite::", ""))
+    return entries
+
+
+def declaring_header(tflm, function):
+    """Kernel header that declares `function`, micro_ops.h when it does."""
+    pattern = re.compile(r"\bTFLMRegistration\s+" + re.escape(function) + r"\(\)")
+    with open(os.path.join(tflm, MICRO_OPS)) as f:
+        if pattern.search(f.read()):
+            return MICRO_OPS
+    kernels = os.path.join(tflm, KERNELS_DIR)
+    for name in sorted(os.listdir(kernels)):
+        if name.endswith(".h"):
+            with open(os.path.join(kernels, name)) as f:
+                if pattern.search(f.read()):
+                    return f"{KERNELS_DIR}/{name}"
+    return None
+
+
+def generate(model_path, name, tflm):
+    model = TFLiteModel(model_path)
+    builtin_ops, custom_ops = read_ops_from_model(model)
+    enum = builtin_enum(tflm)
+    entries = resolver_entries(tflm)
+
+    ops = []                 # (code, enum name, Register_*, Parse*, versions)
+    for code in sorted(builtin_ops):
+        op = enum.get(code)
+        if op is None or op not in entries:
+            raise ValueError(f"{model_path}: no TFLM kernel for builtin op {op or code}")
+        ops.append((code, op, *entries[op], builtin_ops[code]))
+    customs = [(c, "Register_" + normalize_custom_op_name(c), custom_ops[c]) for c in sorted(custom_ops)]
+    if len(ops) + len(customs) >= NO_SLOT:
+        raise ValueError(f"{model_path}: too many ops for 8-bit slots")
+
+    includes = {"tensorflow/lite/core/api/flatbuffer_conversions.h",
+                "tensorflow/lite/micro/micro_op_resolver.h",
+                "tensorflow/lite/schema/schema_generated.h"}
+    for _, op, registration, _, _ in ops:
+        header = declaring_header(tflm, registration)
+        if header is None:
+            raise ValueError(f"{registration}() for {op} is not declared in {KERNELS_DIR}")
+        includes.add(header)
+
+    slots = [NO_SLOT] * (max((c for c, *_ in ops), default=-1) + 1)
+    for slot, (code, *_) in enumerate(ops):
+        slots[code] = slot
+    count = len(ops) + len(customs)
+    snake = re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).lower()
+    guard = snake.upper() + "_H_"
+    ns = snake + "_internal"
+    base = os.path.basename(model_path)
+
+    out = [f"// Generated by tools/model_compiler/op_resolver_gen.py from {base}, do not edit.",
+           "// Ops (min..max version in the model):"]
+    out += [f"//   {op:<24} v{v[0]}..v{v[1]}  {registration}() / {parser}()"
+            for _, op, registration, parser, v in ops]
+    out += [f"//   {c:<24} v{v[0]}..v{v[1]}  {registration}() (custom)" for c, registration, v in customs]
+    out += [f"#ifndef {guard}", f"#define {guard}", "", "#include <stdint.h>"]
+    if customs:
+        out.append("#include <string.h>")
+    out.append("")
+    out += [f'#include "{h}"' for h in sorted(includes)]
+    if customs:
+        out += ["", "namespace tflite {", "// Custom kernels, provided by the application."]
+        out += [f"TFLMRegistration {registration}();" for _, registration, _ in customs]
+        out.append("}  // namespace tflite")
+    # The tables live at namespace scope: a static constexpr member indexed at
+    # run time is odr-used and needs an out-of-class definition before C++17.
+    out += ["",
+            f"namespace {ns} {{",
+            "",
+            f"constexpr uint8_t kNoSlot = 0x{NO_SLOT:02X};",
+            f"// Slot in {name}'s registrations_ and in kParsers by BuiltinOperator,",
+            "// up to the largest op the model uses.",
+            f"constexpr uint8_t kSlots[{len(slots)}] = {{"]
+    items = [str(s) if s != NO_SLOT else "kNoSlot" for s in slots]
+    for i in range(0, len(items), 8):
+        out.append("    " + ", ".join(items[i:i + 8]) + ",")
+    out += ["};",
+            f"constexpr tflite::TfLiteBridgeBuiltinParseFunction kParsers[{max(len(ops), 1)}] = {{"]
+    out += [f"    tflite::{parser}," for _, _, _, parser, _ in ops] or ["    nullptr,"]
+    out += ["};",
+            "",
+            f"}}  // namespace {ns}",
+            "",
+            f"class {name} : public tflite::MicroOpResolver {{",
+            " public:",
+            f"  {name}() {{",
+            "    // Register_*() is not constexpr; copy each registration once."]
+    for slot, (code, op, registration, _, _) in enumerate(ops):
+        out += [f"    registrations_[{slot}] = tflite::{registration}();",
+                f"    registrations_[{slot}].builtin_code = tflite::BuiltinOperator_{op};"]
+    for slot, (custom, registration, _) in enumerate(customs, len(ops)):
+        out += [f"    registrations_[{slot}] = tflite::{registration}();",
+                f"    registrations_[{slot}].builtin_code = tflite::BuiltinOperator_CUSTOM;",
+                f'    registrations_[{slot}].custom_name = "{custom}";']
+    out += ["  }",
+            "",
+            "  const TFLMRegistration* FindOp(tflite::BuiltinOperator op) const override {",
+            "    const uint8_t slot = Slot(op);",
+            f"    return slot == {ns}::kNoSlot ? nullptr : &registrations_[slot];",
+            "  }",
+            "",
+            "  const TFLMRegistration* FindOp(const char* op) const override {"]
+    if customs:
+        out += [f"    for (int i = {len(ops)}; i < kOpCount; ++i) {{",
+                "      if (strcmp(registrations_[i].custom_name, op) == 0) return &registrations_[i];",
+                "    }"]
+    else:
+        out.append("    (void)op;")
+    out += ["    return nullptr;",
+            "  }",
+            "",
+            "  tflite::TfLiteBridgeBuiltinParseFunction GetOpDataParser(",
+            "      tflite::BuiltinOperator op) const override {",
+            "    const uint8_t slot = Slot(op);",
+            f"    return slot == {ns}::kNoSlot ? nullptr : {ns}::kParsers[slot];",
+            "  }",
+            "",
+            " private:",
+            f"  static constexpr int kOpCount = {count};",
+            "",
+            "  static uint8_t Slot(tflite::BuiltinOperator op) {",
+            "    const uint32_t code = static_cast<uint32_t>(op);",
+            f"    return code < sizeof({ns}::kSlots) ? {ns}::kSlots[code] : {ns}::kNoSlot;",
+            "  }",
+            "",
+            "  TFLMRegistration registrations_[kOpCount];",
+            "};",
+            "",
+            f"#endif  // {guard}",
+            ""]
+    return "\n".join(out), ops, customs
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Generate a static TFLM op resolver for the ops a .tflite uses.")
+    ap.add_argument("model")
+    ap.add_argument("--out", help="header to write (default: print the op list only)")
+    ap.add_argument("--name", default="MnistOpResolver", help="C++ class name")
+    ap.add_argument("--tflm", default=DEFAULT_TFLM,
+                    help="TFLM tree with micro_mutable_op_resolver.h and schema_generated.h")
+    args = ap.parse_args(argv)
+
+    try:
+        text, ops, customs = generate(args.model, args.name, os.path.normpath(args.tflm))
+    except ValueError as e:
+        print(e, file=sys.stderr)
+        return 1
+    print(f"{args.model}: {len(ops)} builtin op(s), {len(customs)} custom")
+    for code, op, registration, parser, v in ops:
+        print(f"  {code:>4} {op:<24} v{v[0]}..v{v[1]}  {registration} / {parser}")
+    for custom, registration, v in customs:
+        print(f"       {custom:<24} v{v[0]}..v{v[1]}  {registration} (custom)")
+    if args.out:
+        _write(args.out, text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
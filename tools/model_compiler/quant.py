@@ -0,0 +1,124 @@
+'''
+    quant.py
+    Author: Shwetank Shekhar
+
+    Integer requantization helpers, written to match TFLite Micro bit for bit
+    (kernels/internal/quantization_util.cc and common.cc, double-rounding
+    MultiplyByQuantizedMultiplier, i.e. TFLITE_SINGLE_ROUNDING unset as in the
+    repo's TFLM builds).
+'''
+import math
+
+import numpy as np
+
+INT32_MIN = -(1 << 31)
+INT32_MAX = (1 << 31) - 1
+
+
+def _round_half_away(x):
+    # TfLiteRound() == std::round()
+    return math.floor(x + 0.5) if x >= 0 else -math.floor(-x + 0.5)
+
+
+def quantize_multiplier(double_multiplier):
+    """QuantizeMultiplier(): real multiplier -> (int32 significand, shift), shift > 0 means left."""
+    if double_multiplier == 0.0:
+        return 0, 0
+    q, shift = math.frexp(double_multiplier)
+    q_fixed = int(_round_half_away(q * (1 << 31)))
+    if q_fixed == (1 << 31):
+        q_fixed //= 2
+        shift += 1
+    if shift < -31:
+        return 0, 0
+    return q_fixed, shift
+
+
+def fc_multiplier(input_scale, weight_scale, output_scale):
+    """GetQuantizedConvolutionMultipler(): the scale product is taken in float32, the division in double."""
+    product = float(np.float32(input_scale) * np.float32(weight_scale))
+    return product / float(np.float32(output_scale))
+
+
+def per_channel_fc_multiplier(input_scale, weight_scale, output_scale):
+    # fully_connected_common.cc per-channel path: everything in double.
+    return float(np.float32(input_scale)) * float(np.float32(weight_scale)) / float(np.float32(output_scale))
+
+
+def conv_multiplier(input_scale, weight_scale, output_scale):
+    """PopulateConvolutionQuantizationParams() (CONV_2D, DEPTHWISE_CONV_2D): per channel, in double."""
+    return float(np.float32(input_scale)) * float(np.float32(weight_scale)) / float(np.float32(output_scale))
+
+
+def conv_padding(padding, in_size, kernel, stride, out_size):
+    """ComputePaddingHeightWidth() for one dimension (dilation 1): leading pad, the odd pixel goes last."""
+    if padding != "SAME":
+        return 0
+    return max((out_size - 1) * stride + kernel - in_size, 0) // 2
+
+
+def leaky_relu_multipliers(input_scale, output_scale, alpha):
+    """leaky_relu_common.cc: (alpha multiplier, identity multiplier), both computed in float32."""
+    alpha_m = float(np.float32(np.float32(input_scale) * np.float32(alpha)) / np.float32(output_scale))
+    identity_m = float(np.float32(input_scale) / np.float32(output_scale))
+    return alpha_m, identity_m
+
+
+def softmax_params(input_scale, beta, input_integer_bits=5):
+    """CalculateSoftmaxParams() for int8 -> int8: (input_multiplier, input_left_shift, diff_min)."""
+    max_real_multiplier = (1 << 31) - 1.0
+    real = min(beta * float(np.float32(input_scale)) * (1 << (31 - input_integer_bits)), max_real_multiplier)
+    multiplier, left_shift = quantize_multiplier(real)
+    # CalculateInputRadius(input_integer_bits, left_shift, 31)
+    radius = math.floor(1.0 * ((1 << input_integer_bits) - 1) * (1 << (31 - input_integer_bits)) / (1 << left_shift))
+    return multiplier, left_shift, -radius
+
+
+def _rdbpot(x, exponent):
+    """gemmlowp::RoundingDivideByPOT."""
+    x = np.asarray(x, dtype=np.int64)
+    mask = (1 << exponent) - 1
+    remainder = x & mask
+    threshold = (mask >> 1) + (x < 0)
+    return (x >> exponent) + (remainder > threshold)
+
+
+def multiply_by_quantized_multiplier(x, multiplier, shift):
+    """MultiplyByQuantizedMultiplier(int32 x, ...) elementwise; multiplier/shift may be arrays."""
+    x = np.asarray(x, dtype=np.int64)
+    multiplier = np.broadcast_to(np.asarray(multiplier, dtype=np.int64), x.shape)
+    shift = np.broadcast_to(np.asarray(shift, dtype=np.int64), x.shape)
+    out = np.empty(x.shape, dtype=np.int64)
+    for s in np.unique(shift):
+        sel = shift == s
+        left = int(max(s, 0))
+        right = int(max(-s, 0))
+        xs = (x[sel] * (1 << left)).astype(np.int32).astype(np.int64)  # wraps like the C int32 multiply
+        out[sel] = _rdbpot(_srdhm(xs, multiplier[sel]), right)
+    return out
+
+
+def _srdhm(a, b):
+    """gemmlowp::SaturatingRoundingDoublingHighMul, elementwise on int64 arrays."""
+    a = np.asarray(a, dtype=np.int64)
+    b = np.asarray(b, dtype=np.int64)
+    ab = a * b
+    nudge = np.where(ab >= 0, 1 << 30, 1 - (1 << 30))
+    s = ab + nudge
+    res = np.where(s >= 0, s >> 31, -((-s) >> 31))
+    return np.where((a == INT32_MIN) & (b == INT32_MIN), INT32_MAX, res)
+
+
+def activation_range(activation, scale, zero_point, qmin=-128, qmax=127):
+    """CalculateActivationRangeQuantized() for int8 outputs."""
+    def q(v):
+        return zero_point + int(_round_half_away(float(np.float32(v) / np.float32(scale))))
+    if activation == "RELU":
+        return max(qmin, q(0.0)), qmax
+    if activation == "RELU6":
+        return max(qmin, q(0.0)), min(qmax, q(6.0))
+    if activation == "RELU_N1_TO_1":
+        return max(qmin, q(-1.0)), min(qmax, q(1.0))
+    if activation == "NONE":
+        return qmin, qmax
+    raise ValueError(f"unsupported fused activation {activation}")
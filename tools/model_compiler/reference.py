@@ -0,0 +1,150 @@
+'''
+    reference.py
+    Author: Shwetank Shekhar
+
+    NumPy interpreter for the int8 .tflite graphs in this repo, following the
+    TFLite Micro reference kernels (RESHAPE, FULLY_CONNECTED, LEAKY_RELU,
+    CONV_2D, DEPTHWISE_CONV_2D, MAX_POOL_2D).
+    It walks the original graph, not the compiled layer table, so it is an
+    independent check of what compiler.py emits.
+'''
+import numpy as np
+
+from quant import (activation_range, conv_multiplier, conv_padding, fc_multiplier,
+                   leaky_relu_multipliers, multiply_by_quantized_multiplier,
+                   per_channel_fc_multiplier, quantize_multiplier)
+
+# Ops whose output only matters as a monotonic transform of the logits.
+TRAILING_OPS = ("SOFTMAX", "DEQUANTIZE", "LOGISTIC")
+
+
+def accumulate(model, op, x):
+    """int32 accumulators of a FULLY_CONNECTED: W (x - input zero point) + bias."""
+    t_in, t_w = model.tensors[op.inputs[0]], model.tensors[op.inputs[1]]
+    w = t_w.data.astype(np.int64).reshape(t_w.shape[0], -1)
+    acc = w @ (x.astype(np.int64).reshape(-1) - int(t_in.zero_point[0]))
+    if len(op.inputs) > 2 and op.inputs[2] >= 0:
+        acc = acc + model.tensors[op.inputs[2]].data.astype(np.int64)
+    return acc
+
+
+def fully_connected(model, op, x):
+    t_in, t_w = model.tensors[op.inputs[0]], model.tensors[op.inputs[1]]
+    t_out = model.tensors[op.outputs[0]]
+    acc = accumulate(model, op, x)
+    if t_w.per_channel:
+        pairs = [quantize_multiplier(per_channel_fc_multiplier(t_in.scale[0], s, t_out.scale[0])) for s in t_w.scale]
+        mult, shift = np.array([p[0] for p in pairs]), np.array([p[1] for p in pairs])
+    else:
+        mult, shift = quantize_multiplier(fc_multiplier(t_in.scale[0], t_w.scale[0], t_out.scale[0]))
+    y = multiply_by_quantized_multiplier(acc, mult, shift) + int(t_out.zero_point[0])
+    lo, hi = activation_range(op.options.get("activation", "NONE"), t_out.scale[0], int(t_out.zero_point[0]))
+    return np.clip(y, lo, hi).astype(np.int8)
+
+
+def leaky_relu(model, op, x):
+    t_in, t_out = model.tensors[op.inputs[0]], model.tensors[op.outputs[0]]
+    alpha_m, identity_m = leaky_relu_multipliers(t_in.scale[0], t_out.scale[0], op.options["alpha"])
+    ma, sa = quantize_multiplier(alpha_m)
+    mi, si = quantize_multiplier(identity_m)
+    v = x.astype(np.int64) - int(t_in.zero_point[0])
+    y = np.where(v >= 0, multiply_by_quantized_multiplier(v, mi, si), multiply_by_quantized_multiplier(v, ma, sa))
+    return np.clip(y + int(t_out.zero_point[0]), -128, 127).astype(np.int8)
+
+
+def _windows(model, op, x, kernel_h, kernel_w, fill):
+    """Yields (ky, kx, input taps [out_h, out_w, channels]) for every kernel position.
+
+    x is padded the TFLM way; padding taps read `fill`, which the callers
+    pick so that they drop out of the result.
+    """
+    _, in_h, in_w, c = x.shape
+    _, out_h, out_w, _ = model.tensors[op.outputs[0]].shape
+    sh, sw = op.options["stride_h"], op.options["stride_w"]
+    pad_t = conv_padding(op.options["padding"], in_h, kernel_h, sh, out_h)
+    pad_l = conv_padding(op.options["padding"], in_w, kernel_w, sw, out_w)
+    rows, cols = (out_h - 1) * sh + kernel_h, (out_w - 1) * sw + kernel_w
+    padded = np.full((max(rows, pad_t + in_h), max(cols, pad_l + in_w), c), fill, dtype=np.int64)
+    padded[pad_t:pad_t + in_h, pad_l:pad_l + in_w] = x[0]
+    for ky in range(kernel_h):
+        for kx in range(kernel_w):
+            yield ky, kx, padded[ky:ky + (out_h - 1) * sh + 1:sh, kx:kx + (out_w - 1) * sw + 1:sw]
+
+
+def _conv_requantize(model, op, acc):
+    t_in, t_w = model.tensors[op.inputs[0]], model.tensors[op.inputs[1]]
+    t_out = model.tensors[op.outputs[0]]
+    if len(op.inputs) > 2 and op.inputs[2] >= 0:
+        acc = acc + model.tensors[op.inputs[2]].data.astype(np.int64)
+    n_out = acc.shape[-1]
+    scales = t_w.scale if t_w.per_channel else np.repeat(t_w.scale, n_out)
+    pairs = [quantize_multiplier(conv_multiplier(t_in.scale[0], s, t_out.scale[0])) for s in scales]
+    mult, shift = np.array([p[0] for p in pairs]), np.array([p[1] for p in pairs])
+    y = multiply_by_quantized_multiplier(acc, mult, shift) + int(t_out.zero_point[0])
+    lo, hi = activation_range(op.options.get("activation", "NONE"), t_out.scale[0], int(t_out.zero_point[0]))
+    return np.clip(y, lo, hi).astype(np.int8)[None]
+
+
+def conv_2d(model, op, x):
+    """ConvPerChannel: filter [out_c, kh, kw, in_c]; padding taps contribute 0."""
+    t_in, t_w = model.tensors[op.inputs[0]], model.tensors[op.inputs[1]]
+    w = t_w.data.astype(np.int64)
+    zp = int(t_in.zero_point[0])
+    acc = 0
+    for ky, kx, win in _windows(model, op, x, w.shape[1], w.shape[2], zp):
+        acc = acc + (win - zp) @ w[:, ky, kx, :].T
+    return _conv_requantize(model, op, acc)
+
+
+def depthwise_conv_2d(model, op, x):
+    """DepthwiseConvPerChannel: filter [1, kh, kw, in_c * depth_multiplier]."""
+    t_in, t_w = model.tensors[op.inputs[0]], model.tensors[op.inputs[1]]
+    w = t_w.data.astype(np.int64)
+    zp = int(t_in.zero_point[0])
+    dm = op.options["depth_multiplier"]
+    acc = 0
+    for ky, kx, win in _windows(model, op, x, w.shape[1], w.shape[2], zp):
+        acc = acc + np.repeat(win - zp, dm, axis=-1) * w[0, ky, kx]
+    return _conv_requantize(model, op, acc)
+
+
+def max_pool_2d(model, op, x):
+    """MaxPool int8: max over the in-bounds taps, clamped to the activation range."""
+    t_out = model.tensors[op.outputs[0]]
+    out = None
+    for _, _, win in _windows(model, op, x, op.options["filter_h"], op.options["filter_w"], -(1 << 16)):
+        out = win if out is None else np.maximum(out, win)
+    lo, hi = activation_range(op.options.get("activation", "NONE"), t_out.scale[0], int(t_out.zero_point[0]))
+    return np.clip(out, lo, hi).astype(np.int8)[None]
+
+
+def run(model, input_int8):
+    """Returns {tensor index: int8 ndarray} for every activation computed."""
+    values = {model.inputs[0]: np.asarray(input_int8, dtype=np.int8).reshape(model.tensors[model.inputs[0]].shape)}
+    for op in model.operators:
+        if op.op_name in TRAILING_OPS:
+            continue
+        x = values[op.inputs[0]]
+        if op.op_name == "RESHAPE":
+            y = x.reshape(model.tensors[op.outputs[0]].shape)
+        elif op.op_name == "FULLY_CONNECTED":
+            y = fully_connected(model, op, x)
+        elif op.op_name == "LEAKY_RELU":
+            y = leaky_relu(model, op, x)
+        elif op.op_name == "CONV_2D":
+            y = conv_2d(model, op, x.reshape(model.tensors[op.inputs[0]].shape))
+        elif op.op_name == "DEPTHWISE_CONV_2D":
+            y = depthwise_conv_2d(model, op, x.reshape(model.tensors[op.inputs[0]].shape))
+        elif op.op_name == "MAX_POOL_2D":
+            y = max_pool_2d(model, op, x.reshape(model.tensors[op.inputs[0]].shape))
+        else:
+            raise NotImplementedError(op.op_name)
+        values[op.outputs[0]] = y
+    return values
+
+
+def logits(model, input_int8):
+    """Output of the last non-trailing op (pre-softmax int8 logits)."""
+    values = run(model, input_int8)
+    last = [op for op in model.operators if op.op_name not in TRAILING_OPS][-1]
+    return values[last.outputs[0]].reshape(-1)
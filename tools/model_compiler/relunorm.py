@@ -0,0 +1,151 @@
+'''
+    relunorm.py
+    Author: Shwetank Shekhar
+
+    NumPy model of the Approach 2 engine (app_inference.h: packed int8
+    processfclayer + ReLUNorm, argmax over the raw last-layer sums) and the
+    calibration of static ReLUNorm shifts for it.
+
+    ReLUNorm scans every output for the maximum and picks the smallest right
+    shift that brings it under 128, so each inference pays an extra pass per
+    layer and the scaling depends on the input. calibrate() runs the engine
+    over a representative set, collects the shift dynamic mode would use per
+    layer, and picks one static shift per layer by searching the observed
+    range (one step wider on each side) for the best argmax accuracy (ties: closest to dynamic mode's
+    predictions, then the median observed shift). compiler.py --legacy packed
+    writes the result as L<n>_relu_shift; ReLUNormStatic() uses it and skips
+    the scan. Accuracy is only reported on samples the calibration did not
+    see: without MNIST training images, holdout_split() calibrates on the
+    first half of the test set and reports on the rest.
+
+    python tools/model_compiler/relunorm.py MODEL.tflite --testset src/mnist_testset.c
+'''
+import argparse
+import itertools
+
+import numpy as np
+
+from compiler import CYCLES_PER_ROW, estimate, lower
+from tflite_model import TFLiteModel
+
+# FE310 cycles per element of ReLUNorm (see app_inference.h): the max scan is
+# load + compare + branch + index update, the scaling pass is load + add +
+# shift + clamp + store.
+CYCLES_PER_SCAN = 5.0
+CYCLES_PER_SCALE = 7.0
+CYCLES_SHIFT_SEARCH = 40.0  # while (temp_max_val > 127) loop, ~10 iterations of 4 cycles
+
+
+class Engine:
+    """int8 weights and int32 biases of every FULLY_CONNECTED, in graph order."""
+
+    def __init__(self, model_path):
+        model = TFLiteModel(model_path)
+        self.layers = [layer for layer in lower(model)[0] if layer.kind == "fc"]
+        self.weights = [layer.weights.astype(np.int64) for layer in self.layers]
+        self.biases = [layer.src["bias"].astype(np.int64) for layer in self.layers]
+
+    @property
+    def hidden(self):
+        """Layers followed by a ReLUNorm (all but the last)."""
+        return len(self.layers) - 1
+
+    def run(self, image, shifts=None):
+        """Returns (prediction, [dynamic shift per hidden layer])."""
+        x = np.asarray(image, dtype=np.int64)
+        used = []
+        for l, (w, b) in enumerate(zip(self.weights, self.biases)):
+            acc = w @ x + b
+            if l == len(self.weights) - 1:
+                return int(np.argmax(acc)), used
+            dyn = dynamic_shift(acc)
+            used.append(dyn)
+            x = relu_norm(acc, dyn if shifts is None else shifts[l])
+
+    def accuracy(self, samples, shifts=None):
+        preds = [self.run(image, shifts)[0] for image, _ in samples]
+        return sum(int(p == label) for p, (_, label) in zip(preds, samples)), preds
+
+
+def dynamic_shift(acc):
+    """Shift ReLUNorm derives from the maximum (0 when nothing is positive)."""
+    max_val = int(max(acc.max(), 0))
+    return max(0, max_val.bit_length() - 7)
+
+
+def relu_norm(acc, shift):
+    """ReLUNorm / ReLUNormStatic scaling: round-to-nearest shift, clamp to [0, 127]."""
+    rounding = (1 << (shift - 1)) if shift > 0 else 0
+    out = (np.maximum(acc, 0) + rounding) >> shift
+    return np.where(acc < 0, 0, np.minimum(out, 127))
+
+
+def calibrate(engine, samples):
+    """Returns (static shifts, {layer: observed dynamic shifts})."""
+    observed = [[] for _ in range(engine.hidden)]
+    dynamic_preds = []
+    for image, _ in samples:
+        pred, used = engine.run(image)
+        dynamic_preds.append(pred)
+        for l, s in enumerate(used):
+            observed[l].append(s)
+    ranges = [range(max(0, min(obs) - 1), max(obs) + 2) for obs in observed]
+    medians = [int(np.median(obs)) for obs in observed]
+
+    best, best_key = None, None
+    for shifts in itertools.product(*ranges):
+        correct, preds = engine.accuracy(samples, shifts)
+        agree = sum(int(a == b) for a, b in zip(preds, dynamic_preds))
+        distance = sum(abs(s - m) for s, m in zip(shifts, medians))
+        key = (correct, agree, -distance)
+        if best_key is None or key > best_key:
+            best, best_key = list(shifts), key
+    return best, observed
+
+
+def holdout_split(samples):
+    """(calibration, held-out): the first half calibrates, the report only sees the rest."""
+    half = len(samples) // 2
+    return samples[:half], samples[half:]
+
+
+def cycles(engine, static):
+    """Estimated cycles per inference: packed FC loops plus ReLUNorm."""
+    fc = sum(estimate(layer, "packed")[0] for layer in engine.layers)
+    relu = 0.0
+    for layer in engine.layers[:-1]:
+        relu += layer.n_output * CYCLES_PER_SCALE
+        if not static:
+            relu += layer.n_output * CYCLES_PER_SCAN + CYCLES_SHIFT_SEARCH + CYCLES_PER_ROW
+    return fc + relu, relu
+
+
+def report(engine, shifts, observed, samples):
+    print("  layer  observed shifts  static")
+    for l, obs in enumerate(observed):
+        print(f"  L{l + 1:<5} {min(obs):>3} .. {max(obs):<9} {shifts[l]:>6}")
+    print(f"  {'mode':<8} {'accuracy':>16} {'cycles':>8} {'relunorm':>9}")
+    for name, mode_shifts in (("dynamic", None), ("static", shifts)):
+        correct, _ = engine.accuracy(samples, mode_shifts)
+        total, relu = cycles(engine, mode_shifts is not None)
+        print(f"  {name:<8} {correct:>5}/{len(samples):<5} {100.0 * correct / len(samples):>5.1f}% "
+              f"{int(total):>8} {int(relu):>9}")
+
+
+def main(argv=None):
+    from testset import load_testset
+
+    ap = argparse.ArgumentParser(description="Calibrate static ReLUNorm shifts for the Approach 2 engine.")
+    ap.add_argument("model")
+    ap.add_argument("--testset", required=True,
+                    help="generated mnist_testset.c; the first half calibrates, the report runs on the rest")
+    args = ap.parse_args(argv)
+    engine = Engine(args.model)
+    calib, held_out = holdout_split(load_testset(args.testset))
+    shifts, observed = calibrate(engine, calib)
+    print(f"calibrated on {len(calib)} samples, report on the {len(held_out)} held-out samples:")
+    report(engine, shifts, observed, held_out)
+
+
+if __name__ == "__main__":
+    main()
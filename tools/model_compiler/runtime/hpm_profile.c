@@ -0,0 +1,122 @@
+/*
+    Per-op hardware performance counter profile for the FE310
+    Author: Shwetank Shekhar
+*/
+
+#include "hpm_profile.h"
+
+#include <stdio.h>
+
+#if !HPM_PROFILE_STUB
+#include <metal/cpu.h>
+#include <metal/hpm.h>
+
+// E31 event selectors: class in bits 7..0, event mask above it.
+#define HPM_EVENT_LOAD_USE (METAL_HPM_EVENTCLASS_1 | METAL_HPM_EVENTID_8)     // load-use interlock
+#define HPM_EVENT_ICACHE_MISS (METAL_HPM_EVENTCLASS_2 | METAL_HPM_EVENTID_8)  // instruction cache miss
+
+static struct metal_cpu* cpu;
+#elif !defined(__riscv)
+#include <time.h>
+#endif
+
+static hpm_event_t events[HPM_PROFILE_MAX_EVENTS];
+static uint32_t n_events;
+
+// Low 32 bits of every counter; deltas are taken modulo 2^32.
+static void ReadCounters(uint32_t count[HPM_N_COUNTERS]) {
+#if !HPM_PROFILE_STUB
+    count[HPM_CYCLES] = (uint32_t)metal_hpm_read_counter(cpu, METAL_HPM_CYCLE);
+    count[HPM_INSTRET] = (uint32_t)metal_hpm_read_counter(cpu, METAL_HPM_INSTRET);
+    count[HPM_ICACHE_MISS] = (uint32_t)metal_hpm_read_counter(cpu, METAL_HPM_COUNTER_3);
+    count[HPM_LOAD_USE] = (uint32_t)metal_hpm_read_counter(cpu, METAL_HPM_COUNTER_4);
+#elif defined(__riscv)
+    unsigned long cycles, instret;
+    __asm__ volatile("rdcycle %0" : "=r"(cycles));
+    __asm__ volatile("rdinstret %0" : "=r"(instret));
+    count[HPM_CYCLES] = (uint32_t)cycles;
+    count[HPM_INSTRET] = (uint32_t)instret;
+    count[HPM_ICACHE_MISS] = 0;
+    count[HPM_LOAD_USE] = 0;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    count[HPM_CYCLES] = (uint32_t)((uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec);
+    count[HPM_INSTRET] = 0;
+    count[HPM_ICACHE_MISS] = 0;
+    count[HPM_LOAD_USE] = 0;
+#endif
+}
+
+int hpm_profile_init(void) {
+    n_events = 0;
+#if !HPM_PROFILE_STUB
+    if (cpu != NULL) {
+        return 0;
+    }
+    cpu = metal_cpu_get(metal_cpu_get_current_hartid());
+    // metal_hpm_init() probes how many mhpmcounters exist; on the E31 it finds
+    // counters 3 and 4, and metal_hpm_set_event() rejects anything above.
+    if (cpu == NULL || metal_hpm_init(cpu) != 0) {
+        cpu = NULL;
+        return 1;
+    }
+    if (metal_hpm_set_event(cpu, METAL_HPM_COUNTER_3, HPM_EVENT_ICACHE_MISS) != 0 ||
+        metal_hpm_set_event(cpu, METAL_HPM_COUNTER_4, HPM_EVENT_LOAD_USE) != 0) {
+        cpu = NULL;
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+uint32_t hpm_profile_begin(const char* tag) {
+    if (n_events == HPM_PROFILE_MAX_EVENTS) {
+        return HPM_PROFILE_MAX_EVENTS;
+    }
+    hpm_event_t* event = &events[n_events];
+    event->tag = tag;
+    ReadCounters(event->count);
+    return n_events++;
+}
+
+void hpm_profile_end(uint32_t handle) {
+    uint32_t now[HPM_N_COUNTERS];
+    ReadCounters(now);
+    if (handle >= n_events) {
+        return;
+    }
+    for (uint32_t c = 0; c < HPM_N_COUNTERS; c++) {
+        events[handle].count[c] = now[c] - events[handle].count[c];
+    }
+}
+
+uint32_t hpm_profile_count(void) {
+    return n_events;
+}
+
+const hpm_event_t* hpm_profile_event(uint32_t index) {
+    return index < n_events ? &events[index] : NULL;
+}
+
+void hpm_profile_clear(void) {
+    n_events = 0;
+}
+
+void hpm_profile_dump_csv(void) {
+    uint32_t total[HPM_N_COUNTERS] = {0};
+
+    printf("\"Event\",\"Tag\",\"Cycles\",\"Instret\",\"ICacheMiss\",\"LoadUse\"\n");
+    for (uint32_t i = 0; i < n_events; i++) {
+        const uint32_t* count = events[i].count;
+        printf("%lu,%s,%lu,%lu,%lu,%lu\n", (unsigned long)i, events[i].tag,
+               (unsigned long)count[HPM_CYCLES], (unsigned long)count[HPM_INSTRET],
+               (unsigned long)count[HPM_ICACHE_MISS], (unsigned long)count[HPM_LOAD_USE]);
+        for (uint32_t c = 0; c < HPM_N_COUNTERS; c++) {
+            total[c] += count[c];
+        }
+    }
+    printf("total,,%lu,%lu,%lu,%lu\n", (unsigned long)total[HPM_CYCLES], (unsigned long)total[HPM_INSTRET],
+           (unsigned long)total[HPM_ICACHE_MISS], (unsigned long)total[HPM_LOAD_USE]);
+    n_events = 0;
+}
@@ -0,0 +1,105 @@
+/*
+    Per-op hardware performance counter profile for the FE310
+    Author: Shwetank Shekhar
+
+    Each event records four counters between hpm_profile_begin() and
+    hpm_profile_end(): core cycles (mcycle), retired instructions (minstret),
+    I-cache misses (mhpmcounter3) and load-use interlock stalls
+    (mhpmcounter4). The E31 core has exactly those two programmable
+    counters. Together they tell a compute-bound kernel (IPC close to 1, few
+    misses) from one stalled on XIP flash fetches (I-cache misses and low IPC):
+
+        hpm_profile_init();
+        uint32_t event = hpm_profile_begin("FULLY_CONNECTED");
+        ...
+        hpm_profile_end(event);
+        hpm_profile_dump_csv();   // after the inference, one row per event
+
+    Build with -DHPM_PROFILE_STUB=1 for qemu or the host, where the
+    mhpmevent selectors are not implemented. That build does not use
+    freedom-metal. It reads cycle and instret directly on RISC-V and
+    clock_gettime() nanoseconds elsewhere. The two HPM columns stay 0.
+*/
+
+#ifndef HPM_PROFILE_H
+#define HPM_PROFILE_H
+
+#include <stdint.h>
+
+#ifndef HPM_PROFILE_MAX_EVENTS
+#define HPM_PROFILE_MAX_EVENTS 32  // 20 bytes of RAM each
+#endif
+
+#ifndef HPM_PROFILE_STUB
+#define HPM_PROFILE_STUB 0
+#endif
+
+typedef enum {
+    HPM_CYCLES = 0,
+    HPM_INSTRET = 1,
+    HPM_ICACHE_MISS = 2,
+    HPM_LOAD_USE = 3,
+    HPM_N_COUNTERS = 4,
+} hpm_counter_t;
+
+typedef struct {
+    const char* tag;
+    uint32_t count[HPM_N_COUNTERS];  // start snapshot until hpm_profile_end(), then the delta
+} hpm_event_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Programs the HPM event selectors and clears the event table.
+ *
+ * @return 0 on success, nonzero when the counters could not be set up.
+ */
+int hpm_profile_init(void);
+
+/**
+ * @brief Opens an event and snapshots the counters.
+ *
+ * @param tag Label printed in the CSV; must outlive the profile.
+ * @return Handle for hpm_profile_end(), HPM_PROFILE_MAX_EVENTS once the table is full.
+ */
+uint32_t hpm_profile_begin(const char* tag);
+
+/**
+ * @brief Closes an event; its counters become the deltas since hpm_profile_begin().
+ *
+ * @param handle Value returned by hpm_profile_begin(); out-of-range handles are ignored.
+ */
+void hpm_profile_end(uint32_t handle);
+
+/**
+ * @brief Number of events recorded since the last hpm_profile_clear().
+ */
+uint32_t hpm_profile_count(void);
+
+/**
+ * @brief Recorded event, for callers that aggregate the profile themselves.
+ *
+ * @param index 0 .. hpm_profile_count() - 1.
+ */
+const hpm_event_t* hpm_profile_event(uint32_t index);
+
+/**
+ * @brief Drops all recorded events.
+ */
+void hpm_profile_clear(void);
+
+/**
+ * @brief Prints the events as CSV followed by a total row, then clears them.
+ *
+ * Columns: event, tag, cycles, instret, icache_miss, load_use. The total
+ * row is only meaningful when the events do not nest.
+ */
+void hpm_profile_dump_csv(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HPM_PROFILE_H
@@ -0,0 +1,398 @@
+/*
+    Runtime for models compiled by tools/model_compiler/compiler.py
+    Author: Shwetank Shekhar
+*/
+
+#include "model_runtime.h"
+
+#include <stddef.h>
+
+// 1: record cycles, instructions, I-cache misses and load-use stalls per layer
+// with hpm_profile.[ch]; the caller runs hpm_profile_init() once and
+// hpm_profile_dump_csv() after each inference.
+#ifndef MODEL_PROFILE
+#define MODEL_PROFILE 0
+#endif
+
+#if MODEL_PROFILE
+#include "hpm_profile.h"
+
+// TFLite op names, so the CSV lines up with a TFLM profile of the same model.
+static const char* const kLayerTags[] = {
+    "FULLY_CONNECTED", "LEAKY_RELU", "CONV_2D", "DEPTHWISE_CONV_2D", "MAX_POOL_2D",
+};
+#endif
+
+static int32_t SaturatingRoundingDoublingHighMul(int32_t a, int32_t b) {
+    if (a == INT32_MIN && b == INT32_MIN) {
+        return INT32_MAX;
+    }
+    int64_t ab = (int64_t)a * (int64_t)b;
+    int32_t nudge = ab >= 0 ? (1 << 30) : (1 - (1 << 30));
+    return (int32_t)((ab + nudge) / (1LL << 31));
+}
+
+static int32_t RoundingDivideByPOT(int32_t x, int32_t exponent) {
+    int32_t mask = (int32_t)((1LL << exponent) - 1);
+    int32_t remainder = x & mask;
+    int32_t threshold = (mask >> 1) + (x < 0 ? 1 : 0);
+    return (x >> exponent) + (remainder > threshold ? 1 : 0);
+}
+
+int32_t model_multiply_by_quantized_multiplier(int32_t x, int32_t multiplier, int32_t shift) {
+    int32_t left_shift = shift > 0 ? shift : 0;
+    int32_t right_shift = shift > 0 ? 0 : -shift;
+    // Wraps on overflow like the int32 multiply in TFLM.
+    int32_t shifted = (int32_t)((uint32_t)x << left_shift);
+    return RoundingDivideByPOT(SaturatingRoundingDoublingHighMul(shifted, multiplier), right_shift);
+}
+
+static int8_t LeakyRelu(const model_layer_t* layer, int32_t value) {
+    int32_t v = value - layer->leaky_input_zero_point;
+    int32_t out = v >= 0
+        ? model_multiply_by_quantized_multiplier(v, layer->mult_identity, layer->shift_identity)
+        : model_multiply_by_quantized_multiplier(v, layer->mult_alpha, layer->shift_alpha);
+    out += layer->leaky_output_zero_point;
+    if (out < -128) out = -128;
+    if (out > 127) out = 127;
+    return (int8_t)out;
+}
+
+static int8_t Requantize(const model_layer_t* layer, uint32_t row, int32_t acc) {
+    int32_t mult = layer->multipliers ? layer->multipliers[row] : layer->multiplier;
+    int32_t shift = layer->shifts ? layer->shifts[row] : layer->shift;
+    int32_t out = model_multiply_by_quantized_multiplier(acc, mult, shift) + layer->output_zero_point;
+    if (out < layer->act_min) out = layer->act_min;
+    if (out > layer->act_max) out = layer->act_max;
+    return layer->fused_leaky ? LeakyRelu(layer, out) : (int8_t)out;
+}
+
+static void FcInt8(const model_layer_t* layer, const int8_t* input, int8_t* output) {
+    const int8_t* w = (const int8_t*)layer->weights;
+    for (uint32_t o = 0; o < layer->n_output; o++) {
+        int32_t acc = layer->biases[o];
+        for (uint32_t i = 0; i < layer->n_input; i++) {
+            acc += (int32_t)w[i] * input[i];
+        }
+        w += layer->n_input;
+        output[o] = Requantize(layer, o, acc);
+    }
+}
+
+static void FcPacked(const model_layer_t* layer, const int8_t* input, int8_t* output) {
+    const uint32_t* w = (const uint32_t*)layer->weights;
+    uint32_t full_words = layer->n_input / 4;
+    uint32_t tail = layer->n_input % 4;
+    for (uint32_t o = 0; o < layer->n_output; o++) {
+        int32_t acc = layer->biases[o];
+        const int8_t* a = input;
+        for (uint32_t k = 0; k < full_words; k++, a += 4) {
+            uint32_t word = *w++;
+            acc += (int32_t)(int8_t)(word >> 24) * a[0];
+            acc += (int32_t)(int8_t)(word >> 16) * a[1];
+            acc += (int32_t)(int8_t)(word >> 8) * a[2];
+            acc += (int32_t)(int8_t)word * a[3];
+        }
+        if (tail) {
+            // Padding weights are zero, but the input past n_input must not be read.
+            uint32_t word = *w++;
+            for (uint32_t j = 0; j < tail; j++) {
+                acc += (int32_t)(int8_t)(word >> (24 - 8 * j)) * a[j];
+            }
+        }
+        output[o] = Requantize(layer, o, acc);
+    }
+}
+
+static void FcBlocked(const model_layer_t* layer, const int8_t* input, int8_t* output) {
+    const uint32_t* w = (const uint32_t*)layer->weights;
+    for (uint32_t o = 0; o < layer->n_output; o += 4) {
+        int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        for (uint32_t i = 0; i < layer->n_input; i++) {
+            uint32_t word = *w++;
+            int32_t a = input[i];
+            acc0 += (int32_t)(int8_t)word * a;
+            acc1 += (int32_t)(int8_t)(word >> 8) * a;
+            acc2 += (int32_t)(int8_t)(word >> 16) * a;
+            acc3 += (int32_t)(int8_t)(word >> 24) * a;
+        }
+        int32_t acc[4] = {acc0, acc1, acc2, acc3};
+        for (uint32_t r = 0; r < 4 && o + r < layer->n_output; r++) {
+            output[o + r] = Requantize(layer, o + r, acc[r] + layer->biases[o + r]);
+        }
+    }
+}
+
+static void FcSparse(const model_layer_t* layer, const int8_t* input, int8_t* output) {
+    const int8_t* w = (const int8_t*)layer->weights;
+    const uint8_t* col8 = (const uint8_t*)layer->col_idx;
+    const uint16_t* col16 = (const uint16_t*)layer->col_idx;
+    for (uint32_t o = 0; o < layer->n_output; o++) {
+        int32_t acc = layer->biases[o];
+        uint32_t end = layer->row_ptr[o + 1];
+        if (layer->col_idx_bytes == 1) {
+            for (uint32_t j = layer->row_ptr[o]; j < end; j++) {
+                acc += (int32_t)w[j] * input[col8[j]];
+            }
+        } else {
+            for (uint32_t j = layer->row_ptr[o]; j < end; j++) {
+                acc += (int32_t)w[j] * input[col16[j]];
+            }
+        }
+        output[o] = Requantize(layer, o, acc);
+    }
+}
+
+static void FcPooled(const model_layer_t* layer, const int8_t* input, int8_t* output) {
+    const int8_t* pool = (const int8_t*)layer->weights;
+    const uint8_t* idx8 = (const uint8_t*)layer->col_idx;
+    const uint16_t* idx16 = (const uint16_t*)layer->col_idx;
+    uint32_t block = layer->block_size;
+    uint32_t n_blocks = (layer->n_input + block - 1) / block;
+    uint32_t zero_block = layer->col_idx_bytes == 1 ? 0xFF : 0xFFFF;
+    for (uint32_t o = 0; o < layer->n_output; o++) {
+        int32_t acc = layer->biases[o];
+        for (uint32_t k = 0; k < n_blocks; k++) {
+            uint32_t idx = layer->col_idx_bytes == 1 ? idx8[o * n_blocks + k] : idx16[o * n_blocks + k];
+            if (idx == zero_block) {
+                continue;
+            }
+            const int8_t* w = pool + idx * block;
+            const int8_t* a = input + k * block;
+            // The last block of a row may run past n_input; its padding weights are zero.
+            uint32_t len = layer->n_input - k * block < block ? layer->n_input - k * block : block;
+            for (uint32_t i = 0; i < len; i++) {
+                acc += (int32_t)w[i] * a[i];
+            }
+        }
+        output[o] = Requantize(layer, o, acc);
+    }
+}
+
+// Palette weights (TFLM DecompressionState layout), decoded while the row is
+// accumulated so the int8 matrix never exists in RAM. 4- and 2-bit indices of
+// byte-aligned rows take the unpacking fast path; other widths and the row
+// tails read a 16-bit window (the stream carries one padding byte for it).
+static void FcLut(const model_layer_t* layer, const int8_t* input, int8_t* output) {
+    const int8_t* table = (const int8_t*)layer->weights;
+    const uint8_t* idx = (const uint8_t*)layer->col_idx;
+    uint32_t bits = layer->lut_bits;
+    uint32_t mask = (1u << bits) - 1;
+    uint32_t pos = 0;
+    for (uint32_t o = 0; o < layer->n_output; o++) {
+        int32_t acc = layer->biases[o];
+        uint32_t i = 0;
+        if ((pos & 7) == 0 && bits == 4) {
+            const uint8_t* p = idx + (pos >> 3);
+            for (; i + 2 <= layer->n_input; i += 2) {
+                uint32_t b = *p++;
+                acc += (int32_t)table[b >> 4] * input[i];
+                acc += (int32_t)table[b & 0x0F] * input[i + 1];
+            }
+            pos += i * 4;
+        } else if ((pos & 7) == 0 && bits == 2) {
+            const uint8_t* p = idx + (pos >> 3);
+            for (; i + 4 <= layer->n_input; i += 4) {
+                uint32_t b = *p++;
+                acc += (int32_t)table[b >> 6] * input[i];
+                acc += (int32_t)table[(b >> 4) & 0x03] * input[i + 1];
+                acc += (int32_t)table[(b >> 2) & 0x03] * input[i + 2];
+                acc += (int32_t)table[b & 0x03] * input[i + 3];
+            }
+            pos += i * 2;
+        }
+        for (; i < layer->n_input; i++, pos += bits) {
+            uint32_t window = ((uint32_t)idx[pos >> 3] << 8) | idx[(pos >> 3) + 1];
+            acc += (int32_t)table[(window >> (16 - (pos & 7) - bits)) & mask] * input[i];
+        }
+        output[o] = Requantize(layer, o, acc);
+    }
+}
+
+// Rows of the kernel window that fall inside the input: [*ky_start, *ky_end).
+static void KernelRange(int32_t origin, uint32_t kernel, uint32_t size, uint32_t* start, uint32_t* end) {
+    *start = origin < 0 ? (uint32_t)(-origin) : 0;
+    *end = origin + (int32_t)kernel > (int32_t)size ? (uint32_t)((int32_t)size - origin) : kernel;
+}
+
+// Input taps are contiguous along kx and channels in both NHWC and the
+// OHWI filter, so each kernel row is one run of (kx_end - kx_start) * in_c.
+static void ConvRow(const model_layer_t* layer, const int8_t* const* rows, uint32_t ky_start, uint32_t ky_end,
+                    int8_t* output) {
+    const int8_t* w = (const int8_t*)layer->weights;
+    int32_t input_offset = -layer->input_zero_point;
+    uint32_t filter_size = (uint32_t)layer->kernel_h * layer->kernel_w * layer->in_c;
+    for (uint32_t ox = 0; ox < layer->out_w; ox++) {
+        int32_t x0 = (int32_t)(ox * layer->stride_w) - layer->pad_left;
+        uint32_t kx_start, kx_end;
+        KernelRange(x0, layer->kernel_w, layer->in_w, &kx_start, &kx_end);
+        uint32_t run = (kx_end - kx_start) * layer->in_c;
+        for (uint32_t oc = 0; oc < layer->out_c; oc++) {
+            int32_t acc = layer->biases[oc];
+            for (uint32_t ky = ky_start; ky < ky_end; ky++) {
+                const int8_t* in = rows[ky] + (x0 + (int32_t)kx_start) * (int32_t)layer->in_c;
+                const int8_t* f = w + oc * filter_size + (ky * layer->kernel_w + kx_start) * layer->in_c;
+                for (uint32_t i = 0; i < run; i++) {
+                    acc += (int32_t)f[i] * (in[i] + input_offset);
+                }
+            }
+            *output++ = Requantize(layer, oc, acc);
+        }
+    }
+}
+
+static void DepthwiseConvRow(const model_layer_t* layer, const int8_t* const* rows, uint32_t ky_start,
+                             uint32_t ky_end, int8_t* output) {
+    const int8_t* w = (const int8_t*)layer->weights;
+    int32_t input_offset = -layer->input_zero_point;
+    for (uint32_t ox = 0; ox < layer->out_w; ox++) {
+        int32_t x0 = (int32_t)(ox * layer->stride_w) - layer->pad_left;
+        uint32_t kx_start, kx_end;
+        KernelRange(x0, layer->kernel_w, layer->in_w, &kx_start, &kx_end);
+        for (uint32_t oc = 0; oc < layer->out_c; oc++) {
+            uint32_t ic = oc / layer->depth_multiplier;
+            int32_t acc = layer->biases[oc];
+            for (uint32_t ky = ky_start; ky < ky_end; ky++) {
+                const int8_t* in = rows[ky] + (x0 + (int32_t)kx_start) * (int32_t)layer->in_c + ic;
+                const int8_t* f = w + (ky * layer->kernel_w + kx_start) * layer->out_c + oc;
+                for (uint32_t kx = kx_start; kx < kx_end; kx++) {
+                    acc += (int32_t)*f * (*in + input_offset);
+                    in += layer->in_c;
+                    f += layer->out_c;
+                }
+            }
+            *output++ = Requantize(layer, oc, acc);
+        }
+    }
+}
+
+static void MaxPoolRow(const model_layer_t* layer, const int8_t* const* rows, uint32_t ky_start, uint32_t ky_end,
+                       int8_t* output) {
+    for (uint32_t ox = 0; ox < layer->out_w; ox++) {
+        int32_t x0 = (int32_t)(ox * layer->stride_w) - layer->pad_left;
+        uint32_t kx_start, kx_end;
+        KernelRange(x0, layer->kernel_w, layer->in_w, &kx_start, &kx_end);
+        for (uint32_t c = 0; c < layer->out_c; c++) {
+            int32_t max = -128;
+            for (uint32_t ky = ky_start; ky < ky_end; ky++) {
+                const int8_t* in = rows[ky] + (x0 + (int32_t)kx_start) * (int32_t)layer->in_c + c;
+                for (uint32_t kx = kx_start; kx < kx_end; kx++, in += layer->in_c) {
+                    if (*in > max) max = *in;
+                }
+            }
+            if (max < layer->act_min) max = layer->act_min;
+            if (max > layer->act_max) max = layer->act_max;
+            *output++ = (int8_t)max;
+        }
+    }
+}
+
+// Output row y of a spatial layer. Input row r lives at slot r % input_rows,
+// which is row r itself for a full tensor.
+static void SpatialRow(const model_layer_t* layer, int8_t* arena, uint32_t y) {
+    const int8_t* rows[MODEL_MAX_KERNEL];
+    uint32_t in_row = (uint32_t)layer->in_w * layer->in_c;
+    int32_t y0 = (int32_t)(y * layer->stride_h) - layer->pad_top;
+    uint32_t ky_start, ky_end;
+    KernelRange(y0, layer->kernel_h, layer->in_h, &ky_start, &ky_end);
+    for (uint32_t ky = ky_start; ky < ky_end; ky++) {
+        rows[ky] = arena + layer->input_offset + ((uint32_t)(y0 + (int32_t)ky) % layer->input_rows) * in_row;
+    }
+    int8_t* output = arena + layer->output_offset + (y % layer->output_rows) * layer->out_w * layer->out_c;
+    if (layer->kind == MODEL_LAYER_CONV) {
+        ConvRow(layer, rows, ky_start, ky_end, output);
+    } else if (layer->kind == MODEL_LAYER_DEPTHWISE_CONV) {
+        DepthwiseConvRow(layer, rows, ky_start, ky_end, output);
+    } else {
+        MaxPoolRow(layer, rows, ky_start, ky_end, output);
+    }
+}
+
+// Produces the next output row of layers[l], first pulling the input rows its
+// kernel window needs from the streamed layers before it (layers[first..l-1]).
+// A ring of kernel_h rows is enough: the row written last replaces the one
+// just above the window.
+static void PullRow(const model_layer_t* layers, uint32_t first, uint32_t l, int8_t* arena, uint16_t* done) {
+    const model_layer_t* layer = &layers[l];
+    uint32_t y = done[l - first];
+    if (l > first) {
+        int32_t last = (int32_t)(y * layer->stride_h) - layer->pad_top + layer->kernel_h - 1;
+        if (last >= (int32_t)layer->in_h) last = layer->in_h - 1;
+        while ((int32_t)done[l - 1 - first] <= last) {
+            PullRow(layers, first, l - 1, arena, done);
+        }
+    }
+    SpatialRow(layer, arena, y);
+    done[l - first]++;
+}
+
+static void InvokeLayer(const model_layer_t* layers, uint32_t l, int8_t* arena) {
+    const model_layer_t* layer = &layers[l];
+    const int8_t* input = arena + layer->input_offset;
+    int8_t* output = arena + layer->output_offset;
+
+    if (layer->kind >= MODEL_LAYER_CONV) {
+        // Runs the whole streamed chain ending at l, one output row at a time.
+        uint32_t first = l;
+        while (first > 0 && layers[first - 1].stream) {
+            first--;
+        }
+        uint16_t done[MODEL_MAX_STREAM_LAYERS] = {0};
+        for (uint32_t y = 0; y < layer->out_h; y++) {
+            PullRow(layers, first, l, arena, done);
+        }
+        return;
+    }
+    if (layer->kind == MODEL_LAYER_LEAKY_RELU) {
+        for (uint32_t i = 0; i < layer->n_output; i++) {
+            output[i] = LeakyRelu(layer, input[i]);
+        }
+        return;
+    }
+    switch (layer->variant) {
+        case MODEL_FC_PACKED:
+            FcPacked(layer, input, output);
+            break;
+        case MODEL_FC_BLOCKED:
+            FcBlocked(layer, input, output);
+            break;
+        case MODEL_FC_SPARSE:
+            FcSparse(layer, input, output);
+            break;
+        case MODEL_FC_POOLED:
+            FcPooled(layer, input, output);
+            break;
+        case MODEL_FC_LUT:
+            FcLut(layer, input, output);
+            break;
+        default:
+            FcInt8(layer, input, output);
+            break;
+    }
+}
+
+void model_invoke(const model_layer_t* layers, uint32_t n_layers, int8_t* arena) {
+    for (uint32_t l = 0; l < n_layers; l++) {
+        // Streamed layers run when the last layer of their chain pulls their rows.
+        if (layers[l].stream) {
+            continue;
+        }
+#if MODEL_PROFILE
+        uint32_t event = hpm_profile_begin(kLayerTags[layers[l].kind]);
+#endif
+        InvokeLayer(layers, l, arena);
+#if MODEL_PROFILE
+        hpm_profile_end(event);
+#endif
+    }
+}
+
+uint32_t model_argmax(const int8_t* output, uint32_t size) {
+    uint32_t best = 0;
+    for (uint32_t i = 1; i < size; i++) {
+        if (output[i] > output[best]) {
+            best = i;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,117 @@
+/*
+    Runtime for models compiled by tools/model_compiler/compiler.py
+    Author: Shwetank Shekhar
+
+    A compiled model is a const table of model_layer_t entries plus one static
+    arena. Every layer reads its int8 input from arena + input_offset and writes
+    its int8 output to arena + output_offset; the offsets come from the
+    compiler's memory plan, so no buffers are allocated at run time.
+    Requantization follows TFLite Micro (double-rounding
+    MultiplyByQuantizedMultiplier), so the outputs match the .tflite model.
+
+    Conv, depthwise conv and max pool layers (NHWC) are computed one output
+    row at a time. When a spatial layer feeds another spatial layer, the
+    compiler gives it a ring of output_rows rows instead of the full tensor
+    (stream = 1) and the consumer pulls rows from it as its kernel window
+    moves down, so a conv front-end only holds a few rows per layer.
+*/
+
+#ifndef MODEL_RUNTIME_H
+#define MODEL_RUNTIME_H
+
+#include <stdint.h>
+
+#define MODEL_MAX_KERNEL 16        // largest kernel_h of a spatial layer
+#define MODEL_MAX_STREAM_LAYERS 8  // longest chain of streamed spatial layers
+
+typedef enum {
+    MODEL_LAYER_FC = 0,
+    MODEL_LAYER_LEAKY_RELU = 1,
+    MODEL_LAYER_CONV = 2,            // weights: int8 [out_c][kernel_h][kernel_w][in_c]
+    MODEL_LAYER_DEPTHWISE_CONV = 3,  // weights: int8 [kernel_h][kernel_w][out_c], out_c = in_c * depth_multiplier
+    MODEL_LAYER_MAX_POOL = 4,
+} model_layer_kind_t;
+
+typedef enum {
+    MODEL_FC_INT8 = 0,     // int8 weights, row-major
+    MODEL_FC_PACKED = 1,   // uint32 words, 4 weights of one row, first weight in bits 31..24
+    MODEL_FC_BLOCKED = 2,  // uint32 words, column i of 4 consecutive rows, lowest row in bits 7..0
+    MODEL_FC_SPARSE = 3,   // CSR: row_ptr[n_output + 1], col_idx[nnz], int8 weights[nnz]
+    MODEL_FC_POOLED = 4,   // col_idx[row][block] indexes int8 weights[block_size * n], 0xFF/0xFFFF = zero block
+    MODEL_FC_LUT = 5,      // col_idx: lut_bits-bit indices, MSB first, rows back to back; weights: int8 value table
+} model_fc_variant_t;
+
+typedef struct {
+    uint8_t kind;
+    uint8_t variant;
+    uint8_t fused_leaky;      // FC output goes through LEAKY_RELU before it is stored
+    uint8_t col_idx_bytes;    // sparse / pooled: 1 (uint8_t indices) or 2 (uint16_t)
+    uint16_t block_size;      // pooled only: weights per pool block
+    uint16_t n_input;
+    uint16_t n_output;
+    uint8_t lut_bits;         // lut only: index width, 1..7 (value table has 1 << lut_bits entries)
+    uint32_t input_offset;
+    uint32_t output_offset;
+
+    // Spatial layers only (conv, depthwise conv, max pool).
+    uint16_t in_h, in_w, in_c;
+    uint16_t out_h, out_w, out_c;
+    uint8_t kernel_h, kernel_w;
+    uint8_t stride_h, stride_w;
+    uint8_t pad_top, pad_left;
+    uint8_t depth_multiplier;
+    uint8_t stream;           // output is a row ring the next layer pulls from
+    uint16_t input_rows;      // rows held at input_offset (in_h, or the producer's ring)
+    uint16_t output_rows;     // rows held at output_offset (out_h, or a ring of the consumer's kernel_h)
+    int32_t input_zero_point; // conv: not folded into the biases, padding taps must add 0
+
+    const void* weights;
+    const int32_t* biases;    // FC: input zero point already folded in
+    const uint16_t* row_ptr;
+    const void* col_idx;
+    const int32_t* multipliers;  // per-channel requantization, NULL if per-tensor
+    const int32_t* shifts;
+
+    int32_t multiplier;
+    int32_t shift;
+    int32_t output_zero_point;
+    int32_t act_min;
+    int32_t act_max;
+
+    int32_t leaky_input_zero_point;
+    int32_t leaky_output_zero_point;
+    int32_t mult_identity;
+    int32_t shift_identity;
+    int32_t mult_alpha;
+    int32_t shift_alpha;
+} model_layer_t;
+
+/**
+ * @brief TFLite MultiplyByQuantizedMultiplier (SaturatingRoundingDoublingHighMul + RoundingDivideByPOT).
+ *
+ * @param x Value to scale.
+ * @param multiplier Q31 significand.
+ * @param shift Power of two exponent, positive means left shift.
+ * @return The rounded product.
+ */
+int32_t model_multiply_by_quantized_multiplier(int32_t x, int32_t multiplier, int32_t shift);
+
+/**
+ * @brief Runs every layer of a compiled model in order.
+ *
+ * @param layers Layer table generated by compiler.py.
+ * @param n_layers Number of entries in the table.
+ * @param arena Arena of at least <NAME>_ARENA_SIZE bytes holding the input.
+ */
+void model_invoke(const model_layer_t* layers, uint32_t n_layers, int8_t* arena);
+
+/**
+ * @brief Index of the largest value (first one on ties).
+ *
+ * @param output Pointer to the int8 output logits.
+ * @param size Number of logits.
+ * @return The predicted class.
+ */
+uint32_t model_argmax(const int8_t* output, uint32_t size);
+
+#endif // MODEL_RUNTIME_H
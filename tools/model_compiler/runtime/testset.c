@@ -0,0 +1,48 @@
+/*
+    Iterator over the labelled test-set blob written by tools/model_compiler/testset.py
+    Author: Shwetank Shekhar
+*/
+
+#include "testset.h"
+
+#include <string.h>
+
+static const uint8_t* RleDecode(const uint8_t* src, int8_t* dst, uint32_t size) {
+    uint32_t n = 0;
+    while (n < size) {
+        uint32_t ctrl = *src++;
+        if (ctrl < 128) {
+            memcpy(dst + n, src, ctrl + 1);
+            src += ctrl + 1;
+            n += ctrl + 1;
+        } else {
+            memset(dst + n, *src++, ctrl - 125);
+            n += ctrl - 125;
+        }
+    }
+    return src;
+}
+
+void testset_begin(testset_iter_t* it, const testset_t* set) {
+    it->set = set;
+    it->next = set->blob;
+    it->index = 0;
+}
+
+const int8_t* testset_next(testset_iter_t* it, int8_t* buffer, uint8_t* label) {
+    const testset_t* set = it->set;
+    const int8_t* image;
+
+    if (it->index >= set->count) {
+        return NULL;
+    }
+    if (set->encoding == TESTSET_RLE) {
+        it->next = RleDecode(it->next, buffer, set->sample_size);
+        image = buffer;
+    } else {
+        image = (const int8_t*)it->next;
+        it->next += set->sample_size;
+    }
+    *label = set->labels[it->index++];
+    return image;
+}
@@ -0,0 +1,456 @@
+'''
+    size_report.py
+    Author: Shwetank Shekhar
+
+    Flash / RAM budget report for a Freedom-E-SDK build. Reads the GNU ld map
+    the Makefile leaves next to the ELF (src/<CONFIGURATION>/<PROGRAM>.map),
+    the MEMORY regions of bsp/metal.default.lds (FE310: 16 KB DTIM at
+    0x80000000 and the SPI flash window at 0x20100000) and, optionally, the
+    ELF symbol table for exact array and function sizes, then breaks the image
+    down by object file, inference kernel, weight array and TFLite Micro
+    component.
+
+    Every allocated input section counts against the region its output
+    section lives in; initialised data (.data/.sdata) counts twice, once in
+    RAM and once in flash for its load image. Bytes the map does not attribute
+    to an input section (alignment fill, merged strings, .stack, .heap) are
+    reported under "(linker)".
+
+    Budgets: every region must fit its LENGTH, and --budget KEY=BYTES adds
+    limits on flash, ram, a region name, "weights", "kernels", "tflm" or one
+    entry ("object:NAME", "kernel:NAME", "weight:NAME", "tflm:NAME"). BYTES
+    takes a K / M suffix. The exit status is 1 when any budget is exceeded.
+
+    python tools/model_compiler/size_report.py src/debug/sifive-welcome.map --elf src/debug/sifive-welcome.elf \
+        --lds bsp/metal.default.lds --budget ram=12K --budget weights=32K
+'''
+import argparse
+import os
+import re
+import struct
+from collections import OrderedDict, defaultdict
+
+REGION_RE = re.compile(r"^\s*(\w+)\s*\([^)]*\)\s*:\s*ORIGIN\s*=\s*(\w+)\s*,\s*LENGTH\s*=\s*(\w+)", re.M)
+MAP_REGION_RE = re.compile(r"^(\w+)\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)")
+OUTPUT_RE = re.compile(r"^(\.\S+)(?:\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)(?:\s+load address\s+(0x[0-9a-fA-F]+))?)?\s*$")
+INPUT_RE = re.compile(r"^ (\S+)(?:\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)(?:\s+(.*\S))?)?\s*$")
+ADDR_SIZE_RE = re.compile(r"^\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)(?:\s+(.*\S))?\s*$")
+SYMBOL_RE = re.compile(r"^\s{16}(0x[0-9a-fA-F]+)\s{16}(\S.*)$")
+
+# Inference kernels of the hand-written engines (app_inference.h, runtime/model_runtime.c).
+KERNEL_RE = re.compile(r"^(processfclayer|ReLUNorm\w*|quantized_relu_requantize|model_invoke|"
+                       r"model_multiply_by_quantized_multiplier|Fc(Int8|Packed|Blocked|Sparse|Pooled|Lut)|"
+                       r"LeakyRelu|Requantize|SaturatingRoundingDoublingHighMul|RoundingDivideByPOT|"
+                       r"(Conv|DepthwiseConv|MaxPool|Spatial|Pull)Row|KernelRange)$")
+# Weights, biases and other model constants emitted by compiler.py, tflm_aot.py and the TFLM flatbuffer.
+WEIGHT_RE = re.compile(r"((?<!_incoming)(?<!_outgoing)_weights|_biases|_bias|_row_ptr|_col_idx|_multipliers|_shifts)$|"
+                       r"^kOp\d+(Weights|Bias)$|model\w*_data$|^g_model$|^input_data_\w+$|testset_(blob|labels)$")
+ARENA_RE = re.compile(r"(tensor_arena|g_arena|_arena)$")
+
+# (path fragment, component), first match wins.
+TFLM_COMPONENTS = [
+    ("tensorflow/lite/micro/kernels/", "kernels"),
+    ("tensorflow/lite/kernels/", "reference ops"),
+    ("tensorflow/lite/micro/memory_planner/", "memory planner"),
+    ("tensorflow/lite/micro/arena_allocator/", "arena allocator"),
+    ("tensorflow/lite/micro/riscv32_generic/", "platform"),
+    ("tensorflow/lite/micro/", "interpreter"),
+    ("tensorflow/lite/core/", "core api"),
+    ("tensorflow/compiler/mlir/lite/", "schema"),
+    ("third_party/eyalroz_printf/", "printf"),
+    ("third_party/flatbuffers/", "flatbuffers"),
+]
+
+LINKER = "(linker)"
+
+
+class Region:
+    def __init__(self, name, origin, length):
+        self.name = name
+        self.origin = origin
+        self.length = length
+
+    def contains(self, addr):
+        return self.origin <= addr < self.origin + self.length
+
+
+class Item:
+    """One allocated input section (or unattributed output-section bytes)."""
+
+    def __init__(self, out, section, addr, size, obj):
+        self.out = out
+        self.section = section
+        self.addr = addr
+        self.size = size
+        self.obj = obj
+        self.ram = False
+        self.flash = False
+
+
+def _int(text):
+    text = text.strip()
+    scale = {"K": 1024, "M": 1024 * 1024}.get(text[-1:].upper(), 1)
+    if scale != 1:
+        text = text[:-1]
+    return int(text, 0) * scale
+
+
+def parse_lds(path):
+    """MEMORY { name (attrs) : ORIGIN = .., LENGTH = .. } -> [Region]."""
+    with open(path) as f:
+        src = f.read()
+    memory = re.search(r"MEMORY\s*\{(.*?)\}", src, re.S)
+    if not memory:
+        raise ValueError(f"{path}: no MEMORY block")
+    return [Region(n, _int(o), _int(l)) for n, o, l in REGION_RE.findall(memory.group(1))]
+
+
+def object_name(path):
+    """Short, host-independent name: lib.a(member.o), the TFLM source path, or the basename."""
+    path = path.replace("\\", "/")
+    if "(" in path:
+        archive, member = path.split("(", 1)
+        return f"{os.path.basename(archive)}({member}"
+    for root in ("tensorflow/", "third_party/"):
+        if root in path:
+            return path[path.index(root):]
+    return os.path.basename(path)
+
+
+def symbol_name(section):
+    """.rodata._ZL21mnist_model_int8_data -> mnist_model_int8_data, .text.main -> main."""
+    for prefix in (".text.startup.", ".text.", ".srodata.", ".rodata.", ".sdata.", ".data.", ".sbss.", ".bss."):
+        if section.startswith(prefix):
+            name = section[len(prefix):]
+            m = re.match(r"_ZL?(\d+)(\w+)", name)
+            if m and len(m.group(2)) >= int(m.group(1)):
+                return m.group(2)[:int(m.group(1))]
+            return name
+    return None
+
+
+def _settle(out, out_addr, out_size, items):
+    """Clips input sections to the bytes they really occupy and adds the unattributed rest.
+
+    SHF_MERGE string sections are listed with their pre-merge size at a shared
+    address, so sizes are capped at the gap to the next address (strings last
+    within a group, so the real object at that address keeps the bytes).
+    """
+    items.sort(key=lambda it: (it.addr, ".str" in it.section))
+    end = out_addr + out_size
+    for i, it in enumerate(items):
+        nxt = next((o.addr for o in items[i + 1:] if o.addr > it.addr), end)
+        taken = sum(o.size for o in items[:i] if o.addr == it.addr)
+        it.size = max(0, min(it.size, nxt - it.addr - taken))
+    rest = out_size - sum(it.size for it in items)
+    if rest > 0:
+        items.append(Item(out, out, end - rest, rest, LINKER))
+    return items
+
+
+def parse_map(path):
+    """Returns ([Region] from 'Memory Configuration', [(out, vma, size, lma, [Item])])."""
+    with open(path, errors="replace") as f:
+        lines = f.read().splitlines()
+
+    regions, outputs = [], []
+    try:
+        start = lines.index("Memory Configuration")
+        for line in lines[start + 1:]:
+            if line.startswith("Linker script and memory map"):
+                break
+            m = MAP_REGION_RE.match(line)
+            if m and m.group(1) != "default":
+                regions.append(Region(m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+        body = lines.index("Linker script and memory map")
+    except ValueError:
+        raise ValueError(f"{path}: not a GNU ld map (-Wl,-Map)")
+
+    current, pending_out, pending_in = None, None, None
+    for line in lines[body + 1:]:
+        if not line.strip():
+            continue
+        if pending_out:
+            m = ADDR_SIZE_RE.match(line)
+            if m:
+                current = [pending_out, int(m.group(1), 16), int(m.group(2), 16), None, []]
+                lma = re.search(r"load address (0x[0-9a-fA-F]+)", m.group(3) or "")
+                current[3] = int(lma.group(1), 16) if lma else None
+                outputs.append(current)
+            pending_out = None
+            continue
+        if pending_in:
+            m = ADDR_SIZE_RE.match(line)
+            if m and current:
+                current[4].append(Item(current[0], pending_in, int(m.group(1), 16), int(m.group(2), 16),
+                                       object_name(m.group(3) or LINKER)))
+            pending_in = None
+            if m:
+                continue
+
+        if line.startswith("OUTPUT(") or line.startswith("LOAD ") or line.startswith("/DISCARD/"):
+            current = None
+            continue
+        if line[0] == ".":
+            m = OUTPUT_RE.match(line)
+            if not m:
+                current = None
+                continue
+            if m.group(2) is None:
+                pending_out = m.group(1)
+                current = None
+            else:
+                lma = int(m.group(4), 16) if m.group(4) else None
+                current = [m.group(1), int(m.group(2), 16), int(m.group(3), 16), lma, []]
+                outputs.append(current)
+            continue
+        if current is None:
+            continue
+        if SYMBOL_RE.match(line):
+            continue  # symbol or assignment inside the last input section
+        m = INPUT_RE.match(line)
+        if m and not m.group(1).startswith("*("):
+            if m.group(1) == "*fill*" or m.group(2) is None:
+                if m.group(1) != "*fill*" and not m.group(1).startswith("*"):
+                    pending_in = m.group(1)
+                continue
+            current[4].append(Item(current[0], m.group(1), int(m.group(2), 16), int(m.group(3), 16),
+                                   object_name(m.group(4) or LINKER)))
+    return regions, [tuple(o) for o in outputs]
+
+
+def read_elf_symbols(path):
+    """FUNC / OBJECT symbols with a size from an ELF32 little-endian file: [(name, addr, size, kind)]."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+        raise ValueError(f"{path}: expected a 32-bit little-endian ELF")
+    e_shoff, = struct.unpack_from("<I", data, 0x20)
+    e_shentsize, e_shnum = struct.unpack_from("<HH", data, 0x2E)
+    sections = [struct.unpack_from("<IIIIIIIIII", data, e_shoff + i * e_shentsize) for i in range(e_shnum)]
+    symbols = []
+    for sh in sections:
+        if sh[1] != 2:  # SHT_SYMTAB
+            continue
+        strtab = sections[sh[6]]
+        for off in range(sh[4], sh[4] + sh[5], 16):
+            st_name, st_value, st_size, st_info, _, st_shndx = struct.unpack_from("<IIIBBH", data, off)
+            kind = {1: "object", 2: "func"}.get(st_info & 0xF)
+            if not kind or not st_size or st_shndx == 0:
+                continue
+            start = strtab[4] + st_name
+            name = data[start:data.index(b"\0", start)].decode(errors="replace")
+            m = re.match(r"_ZL?(\d+)(\w+)$", name)
+            if m and len(m.group(2)) == int(m.group(1)):
+                name = m.group(2)
+            symbols.append((name, st_value, st_size, kind))
+    return symbols
+
+
+class Image:
+    """Allocated bytes of one linked program, split by region."""
+
+    def __init__(self, regions, outputs, symbols=None):
+        self.regions = regions
+        self.items = []
+        self.used = OrderedDict((r.name, 0) for r in regions)
+        self.ram_name = next((r.name for r in regions if r.name in ("ram", "dtim")), None)
+        self.sections = []
+        for out, vma, size, lma, items in outputs:
+            vma_region = self.region(vma) if size else None
+            if vma_region is None:
+                continue  # debug info, comments, empty placeholders
+            lma_region = self.region(lma) if lma is not None and lma != vma else None
+            nobits = out.startswith((".bss", ".sbss", ".tbss", ".stack", ".heap"))
+            self.used[vma_region.name] += size
+            if lma_region and not nobits:
+                self.used[lma_region.name] += size
+            self.sections.append((out, vma_region.name, size, lma_region.name if lma_region and not nobits else None))
+            for it in _settle(out, vma, size, items):
+                it.ram = vma_region.name == self.ram_name
+                it.flash = not it.ram or (lma_region is not None and not nobits)
+                self.items.append(it)
+        self.symbols = symbols
+
+    def region(self, addr):
+        return next((r for r in self.regions if r.contains(addr)), None)
+
+    def totals(self, key):
+        """{group: [flash, ram]} for key(item) -> group name or None."""
+        groups = defaultdict(lambda: [0, 0])
+        for it in self.items:
+            name = key(it)
+            if name is None:
+                continue
+            groups[name][0] += it.size if it.flash else 0
+            groups[name][1] += it.size if it.ram else 0
+        return groups
+
+    def by_object(self):
+        return self.totals(lambda it: it.obj if it.obj != LINKER else f"{LINKER} {it.out}")
+
+    def named(self, pattern, kind):
+        """{symbol: [flash, ram]} for symbols matching pattern (ELF symtab when given, else map sections)."""
+        if self.symbols is not None:
+            groups = defaultdict(lambda: [0, 0])
+            for name, addr, size, sym_kind in self.symbols:
+                region = self.region(addr & ~1)
+                if sym_kind != kind or region is None or not pattern.search(name):
+                    continue
+                in_ram = region.name == self.ram_name
+                item = next((it for it in self.items if it.addr <= addr < it.addr + max(it.size, 1)), None)
+                groups[name][0] += size if not in_ram or (item and item.flash) else 0
+                groups[name][1] += size if in_ram else 0
+            return groups
+
+        def key(it):
+            name = symbol_name(it.section)
+            text = it.section.startswith(".text")
+            if name and text == (kind == "func") and pattern.search(name):
+                return name
+            return None
+        return self.totals(key)
+
+    def kernels(self):
+        groups = self.named(KERNEL_RE, "func")
+        for name, (flash, ram) in self.totals(_tflm_kernel).items():
+            groups[name][0] += flash
+            groups[name][1] += ram
+        return groups
+
+    def weights(self):
+        return self.named(WEIGHT_RE, "object")
+
+    def tflm(self):
+        groups = self.totals(_tflm_component)
+        if not groups:
+            return groups
+        for label, pattern in (("model flatbuffer", re.compile(r"model\w*_data$|^g_model$")),
+                               ("tensor arena", ARENA_RE)):
+            for flash, ram in self.named(pattern, "object").values():
+                groups[label][0] += flash
+                groups[label][1] += ram
+        return groups
+
+
+def _tflm_kernel(it):
+    if it.obj.startswith("tensorflow/lite/micro/kernels/"):
+        stem = os.path.splitext(os.path.basename(it.obj))[0]
+        return "tflm " + re.sub(r"_common$", "", stem)
+    if it.obj.startswith("mnist_model_aot"):
+        return "tflm aot graph"
+    return None
+
+
+def _tflm_component(it):
+    return next((name for fragment, name in TFLM_COMPONENTS if it.obj.startswith(fragment)), None)
+
+
+def print_table(title, groups, top):
+    if not groups:
+        return
+    rows = sorted(groups.items(), key=lambda kv: (-(kv[1][0] + kv[1][1]), kv[0]))
+    print(f"\n{title}")
+    print(f"  {'flash':>8} {'ram':>7}  name")
+    for name, (flash, ram) in rows[:top] if top else rows:
+        print(f"  {flash:>8} {ram:>7}  {name}")
+    if top and len(rows) > top:
+        flash = sum(v[0] for _, v in rows[top:])
+        ram = sum(v[1] for _, v in rows[top:])
+        print(f"  {flash:>8} {ram:>7}  ({len(rows) - top} more)")
+    print(f"  {sum(v[0] for _, v in rows):>8} {sum(v[1] for _, v in rows):>7}  total")
+
+
+def report(image, top=10):
+    print(f"  {'region':<8} {'origin':>10} {'length':>10} {'used':>8} {'free':>10} {'use':>6}")
+    for r in image.regions:
+        used = image.used[r.name]
+        print(f"  {r.name:<8} {r.origin:#010x} {r.length:>10} {used:>8} {r.length - used:>10} "
+              f"{100.0 * used / r.length:>5.1f}%")
+    print(f"\n  {'section':<20} {'region':<8} {'bytes':>8}  load image")
+    sections = OrderedDict()
+    for out, region, size, load in image.sections:
+        # .gcc_except_table.<function> and friends are one row per kind.
+        name = out if len(out) <= 20 else out[:out.index(".", 1)] + ".*" if "." in out[1:] else out
+        key = (name, region, load)
+        sections[key] = sections.get(key, 0) + size
+    for (name, region, load), size in sections.items():
+        print(f"  {name:<20} {region:<8} {size:>8}  {load or ''}")
+    print_table("By object:", image.by_object(), top)
+    print_table("Inference kernels:", image.kernels(), 0)
+    print_table("Weight arrays:", image.weights(), 0)
+    print_table("TFLite Micro components:", image.tflm(), 0)
+
+
+def check_budgets(image, budgets):
+    """Returns [(label, used, limit)] for every budget, regions' LENGTH included.
+
+    --budget rows are labelled "KEY (--budget)" so a limit on a region name
+    is not mistaken for the region's own LENGTH row.
+    """
+    flash = sum(it.size for it in image.items if it.flash)
+    ram = sum(it.size for it in image.items if it.ram)
+    results = [(r.name, image.used[r.name], r.length) for r in image.regions]
+    groups = {"object": image.by_object(), "kernel": image.kernels(),
+              "weight": image.weights(), "tflm": image.tflm()}
+    for key, limit in budgets:
+        if key == "flash":
+            used = flash
+        elif key == "ram":
+            used = ram
+        elif key in image.used:
+            used = image.used[key]
+        elif key in ("weights", "kernels", "tflm"):
+            group = groups[key.rstrip("s")]
+            used = sum(f + r for name, (f, r) in group.items() if name != "tensor arena")
+        elif ":" in key and key.split(":", 1)[0] in groups:
+            kind, name = key.split(":", 1)
+            used = sum(groups[kind].get(name, [0, 0]))
+        else:
+            raise ValueError(f"unknown budget '{key}'")
+        results.append((f"{key} (--budget)", used, limit))
+    return results
+
+
+def parse_budget(text):
+    if "=" not in text:
+        raise argparse.ArgumentTypeError(f"{text}: expected KEY=BYTES")
+    key, value = text.split("=", 1)
+    try:
+        return key.strip(), _int(value)
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"{text}: bad byte count")
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Flash/RAM breakdown of a linked FE310 image with budget checks.")
+    ap.add_argument("map", help="GNU ld map file (-Wl,-Map)")
+    ap.add_argument("--elf", help="linked ELF, for exact symbol sizes")
+    ap.add_argument("--lds", help="linker script with the MEMORY regions (default: the map's Memory Configuration)")
+    ap.add_argument("--budget", action="append", type=parse_budget, default=[], metavar="KEY=BYTES")
+    ap.add_argument("--top", type=int, default=10, help="objects listed before the rest is summed (0: all)")
+    args = ap.parse_args(argv)
+
+    try:
+        map_regions, outputs = parse_map(args.map)
+        regions = parse_lds(args.lds) if args.lds else map_regions
+        symbols = read_elf_symbols(args.elf) if args.elf else None
+        image = Image(regions, outputs, symbols)
+        results = check_budgets(image, args.budget)
+    except (OSError, ValueError) as e:
+        raise SystemExit(str(e))
+
+    print(f"{args.map}")
+    report(image, args.top)
+    print("\nBudgets:")
+    over = 0
+    for key, used, limit in results:
+        status = "ok" if used <= limit else "OVER"
+        over += status == "OVER"
+        print(f"  {key:<24} {used:>8} / {limit:<8} {status}")
+    if over:
+        raise SystemExit(f"{over} budget(s) exceeded")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,175 @@
+'''
+    testset.py
+    Author: Shwetank Shekhar
+
+    Packs the labelled sample images into one flash blob plus a label array
+    (mnist_testset.[ch]) instead of one input_data_N / label_N pair per image,
+    so the firmware can sweep any number of samples with the iterator in
+    runtime/testset.h. Each image is stored raw or run-length encoded
+    (PackBits-style, one image at a time, so the iterator decodes a single
+    image into a caller buffer without any state beyond the blob offset);
+    RLE is only used when it makes the blob smaller.
+
+    RLE stream, repeated until sample_size bytes are produced:
+        ctrl 0..127    ctrl + 1 literal bytes follow
+        ctrl 128..255  the next byte is repeated ctrl - 125 times (3..130)
+
+    It also runs the whole set through reference.py on the host and reports
+    accuracy and the compiler's cycle estimate for the chosen kernels:
+
+    python tools/model_compiler/testset.py MODEL.tflite --testset src/mnist_testset.c
+'''
+import argparse
+import os
+import re
+
+import numpy as np
+
+RLE_MAX_LITERAL = 128
+RLE_MIN_RUN = 3
+RLE_MAX_RUN = 130
+
+DESCRIPTOR_RE = re.compile(r"const testset_t (\w+) = \{\s*(\w+),\s*(\w+),\s*(\w+),\s*(\w+),\s*(\w+),?\s*\};")
+
+
+def rle_encode(image):
+    data = np.asarray(image, dtype=np.int8).view(np.uint8).tolist()
+    out, literal = bytearray(), bytearray()
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            out.extend(literal)
+            literal.clear()
+
+    i = 0
+    while i < len(data):
+        j = i
+        while j < len(data) and data[j] == data[i] and j - i < RLE_MAX_RUN:
+            j += 1
+        if j - i >= RLE_MIN_RUN:
+            flush()
+            out += bytes((j - i + 125, data[i]))
+            i = j
+        else:
+            literal.append(data[i])
+            i += 1
+            if len(literal) == RLE_MAX_LITERAL:
+                flush()
+    flush()
+    return bytes(out)
+
+
+def rle_decode(blob, offset, size):
+    """Returns (int8 image, offset of the next image)."""
+    out = bytearray()
+    while len(out) < size:
+        ctrl = blob[offset]
+        if ctrl < 128:
+            out += bytes(blob[offset + 1:offset + 2 + ctrl])
+            offset += 2 + ctrl
+        else:
+            out += bytes((blob[offset + 1],)) * (ctrl - 125)
+            offset += 2
+    return np.frombuffer(bytes(out), dtype=np.int8), offset
+
+
+def build(samples, compress=True):
+    """Returns (blob bytes, encoding name) for [(int8 image, label)]."""
+    raw = b"".join(np.asarray(image, dtype=np.int8).tobytes() for image, _ in samples)
+    if compress:
+        rle = b"".join(rle_encode(image) for image, _ in samples)
+        if len(rle) < len(raw):
+            return rle, "TESTSET_RLE"
+    return raw, "TESTSET_RAW"
+
+
+def decode(blob, count, sample_size, encoding):
+    """Inverse of build(): list of int8 images."""
+    images, offset = [], 0
+    for _ in range(count):
+        if encoding == "TESTSET_RLE":
+            image, offset = rle_decode(blob, offset, sample_size)
+        else:
+            image, offset = np.frombuffer(bytes(blob[offset:offset + sample_size]), dtype=np.int8), offset + sample_size
+        images.append(image)
+    return images
+
+
+def emit(samples, name="mnist_testset", compress=True):
+    """Returns (header text, source text) for the blob, labels and descriptor."""
+    if not samples:
+        raise ValueError("test set is empty")
+    sample_size = len(samples[0][0])
+    blob, encoding = build(samples, compress)
+    macro = name.upper()
+    banner = ("/*\n * This file is auto-generated by tools/model_compiler/testset.py.\n"
+              " * Do not modify manually.\n */\n")
+    h = (banner +
+         f"#ifndef {macro}_H\n#define {macro}_H\n\n#include \"testset.h\"\n\n"
+         f"#define {macro}_COUNT {len(samples)}\n"
+         f"#define {macro}_SAMPLE_SIZE {sample_size}\n"
+         f"#define {macro}_BLOB_SIZE {len(blob)}  // {encoding}, raw {len(samples) * sample_size}\n\n"
+         f"extern const testset_t {name};\n\n"
+         f"#endif // {macro}_H\n")
+
+    rows = [", ".join(str(b) for b in blob[i:i + 24]) for i in range(0, len(blob), 24)]
+    labels = [", ".join(str(label) for _, label in samples[i:i + 32]) for i in range(0, len(samples), 32)]
+    s = (banner + f"#include \"{name}.h\"\n\n" +
+         f"static const uint8_t {name}_blob[{macro}_BLOB_SIZE] = {{\n    " + ",\n    ".join(rows) + "\n};\n\n" +
+         f"static const uint8_t {name}_labels[{macro}_COUNT] = {{\n    " + ",\n    ".join(labels) + "\n};\n\n" +
+         f"const testset_t {name} = {{\n    {name}_blob,\n    {name}_labels,\n"
+         f"    {macro}_COUNT,\n    {macro}_SAMPLE_SIZE,\n    {encoding},\n}};\n")
+    return h, s
+
+
+def load_testset(c_file):
+    """[(int8 image, label)] from a generated mnist_testset.c."""
+    with open(c_file) as f:
+        src = f.read()
+    m = DESCRIPTOR_RE.search(src)
+    if not m:
+        raise ValueError(f"{c_file}: no testset_t descriptor")
+    _, blob_name, labels_name, _, _, encoding = m.groups()
+    header = os.path.splitext(c_file)[0] + ".h"
+    with open(header) as f:
+        defines = dict(re.findall(r"#define (\w+) (\d+)", f.read()))
+    macro = os.path.basename(os.path.splitext(c_file)[0]).upper()
+    count, sample_size = int(defines[f"{macro}_COUNT"]), int(defines[f"{macro}_SAMPLE_SIZE"])
+
+    def array(array_name):
+        body = re.search(rf"{array_name}\[\w+\] = \{{(.*?)\}};", src, re.S).group(1)
+        return bytes(int(v) for v in body.split(",") if v.strip())
+
+    images = decode(array(blob_name), count, sample_size, encoding)
+    return list(zip(images, array(labels_name)))
+
+
+def evaluate(model_path, samples):
+    """Host sweep: reference.py accuracy plus the compiler's cycle estimate per inference."""
+    from compiler import SPATIAL_KINDS, compile_model, estimate, estimate_spatial
+    from reference import logits
+    from tflite_model import TFLiteModel
+
+    model = TFLiteModel(model_path)
+    _, _, layers, _ = compile_model(model_path)
+    cycles = sum(estimate(layer, layer.variant)[0] for layer in layers if layer.kind == "fc")
+    cycles += sum(estimate_spatial(layer)[0] for layer in layers if layer.kind in SPATIAL_KINDS)
+    correct = sum(int(np.argmax(logits(model, image)) == label) for image, label in samples)
+    print(f"{model_path}: {correct}/{len(samples)} correct ({100.0 * correct / len(samples):.2f}%), "
+          f"~{int(cycles)} cycles per inference (estimate)")
+    return correct, cycles
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Evaluate a model on a generated test-set blob.")
+    ap.add_argument("model")
+    ap.add_argument("--testset", required=True, help="generated mnist_testset.c")
+    args = ap.parse_args(argv)
+    samples = load_testset(args.testset)
+    print(f"{args.testset}: {len(samples)} samples")
+    evaluate(args.model, samples)
+
+
+if __name__ == "__main__":
+    main()
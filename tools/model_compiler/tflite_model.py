@@ -0,0 +1,245 @@
+'''
+    tflite_model.py
+    Author: Shwetank Shekhar
+
+    Dependency-free reader for .tflite flatbuffers (only NumPy is needed).
+    Covers the part of tensorflow/lite/schema/schema.fbs the model compiler
+    uses: operator codes, the first subgraph's tensors / operators / inputs /
+    outputs, constant buffers, per-tensor and per-channel quantization and the
+    builtin options of the supported ops.
+'''
+import struct
+
+import numpy as np
+
+# BuiltinOperator values from schema_generated.h
+BUILTIN_OPS = {
+    1: "AVERAGE_POOL_2D",
+    3: "CONV_2D",
+    4: "DEPTHWISE_CONV_2D",
+    6: "DEQUANTIZE",
+    9: "FULLY_CONNECTED",
+    14: "LOGISTIC",
+    17: "MAX_POOL_2D",
+    19: "RELU",
+    22: "RESHAPE",
+    25: "SOFTMAX",
+    98: "LEAKY_RELU",
+    114: "QUANTIZE",
+}
+
+# TensorType -> (name, numpy dtype)
+TENSOR_TYPES = {
+    0: ("float32", np.float32),
+    1: ("float16", np.float16),
+    2: ("int32", np.int32),
+    3: ("uint8", np.uint8),
+    4: ("int64", np.int64),
+    7: ("int16", np.int16),
+    9: ("int8", np.int8),
+}
+
+# ActivationFunctionType
+ACTIVATIONS = {0: "NONE", 1: "RELU", 2: "RELU_N1_TO_1", 3: "RELU6", 4: "TANH"}
+
+# Padding
+PADDINGS = {0: "SAME", 1: "VALID"}
+
+
+class _Table:
+    """Minimal flatbuffer table accessor (little endian, vtable based)."""
+
+    def __init__(self, buf, pos):
+        self.buf = buf
+        self.pos = pos
+        vtable = pos - struct.unpack_from("<i", buf, pos)[0]
+        self.vtable = vtable
+        self.vtable_size = struct.unpack_from("<H", buf, vtable)[0]
+
+    def _offset(self, field):
+        slot = 4 + 2 * field
+        if slot >= self.vtable_size:
+            return 0
+        return struct.unpack_from("<H", self.buf, self.vtable + slot)[0]
+
+    def scalar(self, field, fmt, default=0):
+        off = self._offset(field)
+        return struct.unpack_from("<" + fmt, self.buf, self.pos + off)[0] if off else default
+
+    def _indirect(self, field):
+        off = self._offset(field)
+        if not off:
+            return None
+        p = self.pos + off
+        return p + struct.unpack_from("<I", self.buf, p)[0]
+
+    def table(self, field):
+        p = self._indirect(field)
+        return _Table(self.buf, p) if p is not None else None
+
+    def vector(self, field, dtype):
+        p = self._indirect(field)
+        if p is None:
+            return np.zeros(0, dtype=dtype)
+        n = struct.unpack_from("<I", self.buf, p)[0]
+        return np.frombuffer(self.buf, dtype=np.dtype(dtype).newbyteorder("<"), count=n, offset=p + 4)
+
+    def tables(self, field):
+        p = self._indirect(field)
+        if p is None:
+            return []
+        n = struct.unpack_from("<I", self.buf, p)[0]
+        out = []
+        for i in range(n):
+            e = p + 4 + 4 * i
+            out.append(_Table(self.buf, e + struct.unpack_from("<I", self.buf, e)[0]))
+        return out
+
+    def string(self, field):
+        p = self._indirect(field)
+        if p is None:
+            return ""
+        n = struct.unpack_from("<I", self.buf, p)[0]
+        return self.buf[p + 4:p + 4 + n].decode("utf-8", errors="replace")
+
+
+class Tensor:
+    def __init__(self, index, name, dtype_name, shape, data, scale, zero_point, quantized_dimension,
+                 is_variable=False):
+        self.index = index
+        self.name = name
+        self.dtype_name = dtype_name
+        self.shape = shape
+        self.data = data              # ndarray for constants, None for activations
+        self.scale = scale            # float32 ndarray (empty if not quantized)
+        self.zero_point = zero_point  # int64 ndarray
+        self.quantized_dimension = quantized_dimension
+        self.is_variable = is_variable
+
+    @property
+    def size(self):
+        return int(np.prod(self.shape)) if len(self.shape) else 1
+
+    @property
+    def is_const(self):
+        return self.data is not None
+
+    @property
+    def per_channel(self):
+        return len(self.scale) > 1
+
+    def __repr__(self):
+        return f"Tensor({self.index}, {self.name!r}, {self.dtype_name}, {list(self.shape)})"
+
+
+class Operator:
+    def __init__(self, index, op_name, builtin_code, inputs, outputs, options):
+        self.index = index
+        self.op_name = op_name
+        self.builtin_code = builtin_code
+        self.inputs = inputs      # tensor indices, -1 = optional input absent
+        self.outputs = outputs
+        self.options = options    # dict of the builtin options the compiler cares about
+
+    def __repr__(self):
+        return f"Operator({self.index}, {self.op_name}, in={self.inputs}, out={self.outputs})"
+
+
+def _options(op_name, t):
+    if t is None:
+        return {}
+    if op_name == "FULLY_CONNECTED":
+        return {"activation": ACTIVATIONS.get(t.scalar(0, "b"), "?"),
+                "keep_num_dims": bool(t.scalar(2, "B"))}
+    if op_name in ("CONV_2D", "DEPTHWISE_CONV_2D"):
+        if op_name == "CONV_2D":
+            act, dh, dw = 3, 4, 5
+        else:  # DepthwiseConv2DOptions has depth_multiplier in slot 3
+            act, dh, dw = 4, 5, 6
+        opts = {"padding": PADDINGS.get(t.scalar(0, "b"), "?"),
+                "stride_w": t.scalar(1, "i"), "stride_h": t.scalar(2, "i"),
+                "activation": ACTIVATIONS.get(t.scalar(act, "b"), "?"),
+                "dilation_w": t.scalar(dh, "i", 1), "dilation_h": t.scalar(dw, "i", 1)}
+        if op_name == "DEPTHWISE_CONV_2D":
+            opts["depth_multiplier"] = t.scalar(3, "i")
+        return opts
+    if op_name in ("MAX_POOL_2D", "AVERAGE_POOL_2D"):
+        return {"padding": PADDINGS.get(t.scalar(0, "b"), "?"),
+                "stride_w": t.scalar(1, "i"), "stride_h": t.scalar(2, "i"),
+                "filter_w": t.scalar(3, "i"), "filter_h": t.scalar(4, "i"),
+                "activation": ACTIVATIONS.get(t.scalar(5, "b"), "?")}
+    if op_name == "SOFTMAX":
+        return {"beta": t.scalar(0, "f", 0.0)}
+    if op_name == "LEAKY_RELU":
+        return {"alpha": t.scalar(0, "f", 0.0)}
+    return {}
+
+
+class TFLiteModel:
+    """First subgraph of a .tflite file: .tensors, .operators, .inputs, .outputs."""
+
+    def __init__(self, path):
+        self.path = path
+        with open(path, "rb") as f:
+            buf = f.read()
+        if buf[4:8] != b"TFL3":
+            raise ValueError(f"{path}: not a TFLite flatbuffer")
+        model = _Table(buf, struct.unpack_from("<I", buf, 0)[0])
+        self.version = model.scalar(0, "I")
+        self.description = model.string(3)
+
+        op_codes = []
+        self.op_codes = []   # (builtin code, custom code or "", version) per OperatorCode
+        for oc in model.tables(1):
+            # builtin_code (field 3) supersedes deprecated_builtin_code (field 0) from schema v3a.
+            code = max(oc.scalar(0, "b"), oc.scalar(3, "i"))
+            op_codes.append(code)
+            self.op_codes.append((code, oc.string(1), oc.scalar(2, "i", 1)))
+
+        buffers = [b.vector(0, np.uint8) for b in model.tables(4)]
+        subgraphs = model.tables(2)
+        if not subgraphs:
+            raise ValueError(f"{path}: model has no subgraph")
+        self.subgraph_count = len(subgraphs)
+        sg = subgraphs[0]
+
+        self.tensors = []
+        for i, t in enumerate(sg.tables(0)):
+            type_name, dtype = TENSOR_TYPES.get(t.scalar(1, "b"), (f"type{t.scalar(1, 'b')}", None))
+            shape = tuple(int(d) for d in t.vector(0, np.int32))
+            raw = buffers[t.scalar(2, "I")] if t.scalar(2, "I") < len(buffers) else np.zeros(0, np.uint8)
+            data = None
+            if len(raw) and dtype is not None:
+                data = np.frombuffer(raw.tobytes(), dtype=np.dtype(dtype).newbyteorder("<")).astype(dtype)
+                data = data.reshape(shape) if shape else data
+            q = t.table(4)
+            scale = q.vector(2, np.float32).astype(np.float32) if q else np.zeros(0, np.float32)
+            zero_point = q.vector(3, np.int64).astype(np.int64) if q else np.zeros(0, np.int64)
+            qdim = q.scalar(6, "i") if q else 0
+            self.tensors.append(Tensor(i, t.string(3), type_name, shape, data, scale, zero_point, qdim,
+                                       bool(t.scalar(5, "B"))))
+
+        self.operators = []
+        for i, op in enumerate(sg.tables(3)):
+            code = op_codes[op.scalar(0, "I")]
+            name = BUILTIN_OPS.get(code, f"BUILTIN_{code}")
+            self.operators.append(Operator(i, name, code,
+                                           [int(x) for x in op.vector(1, np.int32)],
+                                           [int(x) for x in op.vector(2, np.int32)],
+                                           _options(name, op.table(4))))
+
+        self.inputs = [int(x) for x in sg.vector(1, np.int32)]
+        self.outputs = [int(x) for x in sg.vector(2, np.int32)]
+
+    def summary(self):
+        lines = [f"{self.path}: {len(self.operators)} ops, {len(self.tensors)} tensors"]
+        for op in self.operators:
+            ins = ", ".join(str(self.tensors[i]) for i in op.inputs if i >= 0)
+            lines.append(f"  #{op.index} {op.op_name} {op.options} <- {ins}")
+        return "\n".join(lines)
+
+
+if __name__ == "__main__":
+    import sys
+    for p in sys.argv[1:]:
+        print(TFLiteModel(p).summary())
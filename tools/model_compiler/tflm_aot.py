@@ -0,0 +1,236 @@
+'''
+    tflm_aot.py
+    Author: Shwetank Shekhar
+
+    Ahead-of-time code generator for the TFLite Micro build. Instead of shipping
+    the flatbuffer and running MicroInterpreter (GetModel, op resolver lookup,
+    AllocateTensors, per-node dispatch), it reads the .tflite once on the host
+    and writes straight-line C++ that calls the same TFLM reference kernels
+    (reference_integer_ops::FullyConnected, reference_ops::QuantizeLeakyRelu,
+    reference_ops::Softmax) with the shapes, quantization parameters and
+    arena offsets baked in. Everything Prepare() would compute is computed
+    here with the same rounding, so the output is bit-exact with
+    MicroInterpreter::Invoke.
+
+    python tools/model_compiler/tflm_aot.py MODEL.tflite --out-dir src --name mnist_model_aot
+'''
+import argparse
+import os
+
+import numpy as np
+
+from compiler import CompileError, _c_array, _write, plan_memory
+from quant import (activation_range, fc_multiplier, leaky_relu_multipliers,
+                   per_channel_fc_multiplier, quantize_multiplier, softmax_params)
+from tflite_model import TFLiteModel
+
+
+class Step:
+    def __init__(self, op, input_id, output_id):
+        self.op = op
+        self.input_id = input_id
+        self.output_id = output_id
+
+
+def build_steps(model):
+    """Graph -> kernel calls. RESHAPE only renames a buffer, so it becomes an alias."""
+    aliases = {}
+
+    def alias(t):
+        while t in aliases:
+            t = aliases[t]
+        return t
+
+    steps = []
+    for op in model.operators:
+        if op.op_name == "RESHAPE":
+            aliases[op.outputs[0]] = op.inputs[0]
+            continue
+        if op.op_name not in ("FULLY_CONNECTED", "LEAKY_RELU", "SOFTMAX"):
+            raise CompileError(f"op #{op.index} {op.op_name} has no AOT kernel")
+        for t in (op.inputs[0], op.outputs[0]):
+            if model.tensors[t].dtype_name != "int8":
+                raise CompileError(f"op #{op.index} {op.op_name}: only int8 tensors are supported")
+        steps.append(Step(op, alias(op.inputs[0]), op.outputs[0]))
+    if not steps:
+        raise CompileError("model has no operators")
+    output_id = alias(model.outputs[0])
+    return steps, alias(model.inputs[0]), output_id
+
+
+# Dims arrays shared by all kernel calls; this RuntimeShape has no initializer-list constructor.
+_DIMS = {}
+
+
+def _shape(t):
+    dims = tuple(int(d) for d in t.shape)
+    _DIMS.setdefault(dims, "kDims" + "x".join(str(d) for d in dims))
+    return f"tflite::RuntimeShape({len(dims)}, {_DIMS[dims]})"
+
+
+def _buffer(offset):
+    return f"g_arena + {offset}"
+
+
+def _fc_call(model, step, offsets, n, consts):
+    op = step.op
+    t_in, t_w, t_out = model.tensors[op.inputs[0]], model.tensors[op.inputs[1]], model.tensors[op.outputs[0]]
+    if np.any(t_w.zero_point != 0):
+        raise CompileError(f"op #{op.index}: weights must be symmetric (zero point 0)")
+    has_bias = len(op.inputs) > 2 and op.inputs[2] >= 0
+    act_min, act_max = activation_range(op.options.get("activation", "NONE"), t_out.scale[0], int(t_out.zero_point[0]))
+    weights, bias = f"kOp{n}Weights", f"kOp{n}Bias"
+    consts.append(_c_array("int8_t", weights, t_w.data.reshape(-1)).replace("static const", "alignas(4) const"))
+    if has_bias:
+        consts.append(_c_array("int32_t", bias, model.tensors[op.inputs[2]].data).replace("static ", ""))
+    bias_shape = _shape(model.tensors[op.inputs[2]]) if has_bias else "tflite::RuntimeShape()"
+
+    lines = [f"  // Op {op.index}: FULLY_CONNECTED {t_w.shape[1]} -> {t_w.shape[0]}, "
+             f"{op.options.get('activation', 'NONE')}",
+             "  {",
+             "    tflite::FullyConnectedParams params = {};",
+             f"    params.input_offset = {-int(t_in.zero_point[0])};",
+             "    params.weights_offset = 0;",
+             f"    params.output_offset = {int(t_out.zero_point[0])};"]
+    if t_w.per_channel:
+        pairs = [quantize_multiplier(per_channel_fc_multiplier(t_in.scale[0], s, t_out.scale[0])) for s in t_w.scale]
+        consts.append(_c_array("int32_t", f"kOp{n}Multipliers", [p[0] for p in pairs]).replace("static ", ""))
+        consts.append(_c_array("int", f"kOp{n}Shifts", [p[1] for p in pairs]).replace("static ", ""))
+    else:
+        mult, shift = quantize_multiplier(fc_multiplier(t_in.scale[0], t_w.scale[0], t_out.scale[0]))
+        lines += [f"    params.output_multiplier = {mult};", f"    params.output_shift = {shift};"]
+    lines += [f"    params.quantized_activation_min = {act_min};",
+              f"    params.quantized_activation_max = {act_max};"]
+    args = (f"{_shape(t_in)}, {_buffer(offsets[step.input_id])},\n"
+            f"        {_shape(t_w)}, {weights},\n"
+            f"        {bias_shape}, {bias if has_bias else 'nullptr'},\n"
+            f"        {_shape(t_out)}, {_buffer(offsets[step.output_id])});")
+    if t_w.per_channel:
+        lines.append(f"    tflite::reference_integer_ops::FullyConnectedPerChannel(\n"
+                     f"        params, kOp{n}Multipliers, kOp{n}Shifts,\n        {args}")
+    else:
+        lines.append(f"    tflite::reference_integer_ops::FullyConnected(\n        params, {args}")
+    lines.append("  }")
+    return lines
+
+
+def _leaky_call(model, step, offsets):
+    op = step.op
+    t_in, t_out = model.tensors[op.inputs[0]], model.tensors[op.outputs[0]]
+    alpha_m, identity_m = leaky_relu_multipliers(t_in.scale[0], t_out.scale[0], op.options["alpha"])
+    mult_alpha, shift_alpha = quantize_multiplier(alpha_m)
+    mult_identity, shift_identity = quantize_multiplier(identity_m)
+    return [f"  // Op {op.index}: LEAKY_RELU alpha={op.options['alpha']:.8f}",
+            "  {",
+            "    tflite::LeakyReluParams params = {};",
+            f"    params.input_offset = {int(t_in.zero_point[0])};",
+            f"    params.output_offset = {int(t_out.zero_point[0])};",
+            f"    params.output_multiplier_alpha = {mult_alpha};",
+            f"    params.output_shift_alpha = {shift_alpha};",
+            f"    params.output_multiplier_identity = {mult_identity};",
+            f"    params.output_shift_identity = {shift_identity};",
+            "    tflite::reference_ops::QuantizeLeakyRelu(\n"
+            f"        params, {_shape(t_in)}, {_buffer(offsets[step.input_id])},\n"
+            f"        {_shape(t_out)}, {_buffer(offsets[step.output_id])});",
+            "  }"]
+
+
+def _softmax_call(model, step, offsets):
+    op = step.op
+    t_in, t_out = model.tensors[op.inputs[0]], model.tensors[op.outputs[0]]
+    if int(t_out.zero_point[0]) != -128 or float(t_out.scale[0]) != 1.0 / 256:
+        raise CompileError(f"op #{op.index}: int8 SOFTMAX output must be scale 1/256, zero point -128")
+    mult, left_shift, diff_min = softmax_params(t_in.scale[0], op.options["beta"])
+    return [f"  // Op {op.index}: SOFTMAX beta={op.options['beta']:.8f}",
+            "  {",
+            "    tflite::SoftmaxParams params = {};",
+            f"    params.input_multiplier = {mult};",
+            f"    params.input_left_shift = {left_shift};",
+            f"    params.diff_min = {diff_min};",
+            "    tflite::reference_ops::Softmax(\n"
+            f"        params, {_shape(t_in)}, {_buffer(offsets[step.input_id])},\n"
+            f"        {_shape(t_out)}, {_buffer(offsets[step.output_id])});",
+            "  }"]
+
+
+def generate(model_path, name="mnist_model_aot"):
+    """Returns (header text, source text, steps, plan)."""
+    model = TFLiteModel(model_path)
+    steps, input_id, output_id = build_steps(model)
+    offsets, arena = plan_memory(steps, model, input_id, output_id)
+    macro = name.upper()
+    banner = ("/*\n"
+              f" * This file is auto-generated by tools/model_compiler/tflm_aot.py from {os.path.basename(model_path)}.\n"
+              " * Do not modify manually.\n"
+              " */\n")
+    t_in, t_out = model.tensors[input_id], model.tensors[output_id]
+
+    h = [banner,
+         f"#ifndef {macro}_H\n#define {macro}_H\n\n#include <stdint.h>\n\n",
+         f"#define {macro}_ARENA_SIZE {arena}\n",
+         f"#define {macro}_INPUT_SIZE {t_in.size}\n",
+         f"#define {macro}_INPUT_SCALE {float(t_in.scale[0]):.8f}f\n",
+         f"#define {macro}_INPUT_ZERO_POINT {int(t_in.zero_point[0])}\n",
+         f"#define {macro}_OUTPUT_SIZE {t_out.size}\n",
+         f"#define {macro}_OUTPUT_SCALE {float(t_out.scale[0]):.8f}f\n",
+         f"#define {macro}_OUTPUT_ZERO_POINT {int(t_out.zero_point[0])}\n\n",
+         "// Same numerics as MicroInterpreter::Invoke() on the original model, without the interpreter.\n",
+         f"int8_t* {name}_input(void);\n",
+         f"const int8_t* {name}_output(void);\n",
+         f"void {name}_invoke(void);\n\n",
+         f"#endif // {macro}_H\n"]
+
+    _DIMS.clear()
+    consts, body = [], []
+    kinds = set()
+    for step in steps:
+        kind = step.op.op_name
+        kinds.add(kind)
+        if kind == "FULLY_CONNECTED":
+            body += _fc_call(model, step, offsets, step.op.index, consts)
+        elif kind == "LEAKY_RELU":
+            body += _leaky_call(model, step, offsets)
+        else:
+            body += _softmax_call(model, step, offsets)
+
+    s = [banner, f"#include \"{name}.h\"\n\n",
+         "#include \"tensorflow/lite/kernels/internal/runtime_shape.h\"\n",
+         "#include \"tensorflow/lite/kernels/internal/types.h\"\n"]
+    includes = {"FULLY_CONNECTED": "integer_ops/fully_connected.h", "LEAKY_RELU": "leaky_relu.h", "SOFTMAX": "softmax.h"}
+    for kind in sorted(kinds):
+        s.append(f"#include \"tensorflow/lite/kernels/internal/reference/{includes[kind]}\"\n")
+    s.append("\nnamespace {\n\n")
+    s.append("// Activation buffers; offsets come from a greedy first-fit plan over tensor lifetimes.\n")
+    for t, o in sorted(offsets.items(), key=lambda kv: (kv[1], kv[0])):
+        s.append(f"//   [{o:>5}, {o + model.tensors[t].size:>5}) {model.tensors[t].name}\n")
+    s.append(f"alignas(16) int8_t g_arena[{macro}_ARENA_SIZE];\n\n")
+    for dims, dims_name in _DIMS.items():
+        s.append(f"const int32_t {dims_name}[] = {{{', '.join(str(d) for d in dims)}}};\n")
+    s.append("\n")
+    s += consts
+    s.append("\n}  // namespace\n\n")
+    s.append(f"int8_t* {name}_input(void) {{ return {_buffer(offsets[input_id])}; }}\n\n")
+    s.append(f"const int8_t* {name}_output(void) {{ return {_buffer(offsets[output_id])}; }}\n\n")
+    s.append(f"void {name}_invoke(void) {{\n")
+    s.append("\n".join(body))
+    s.append("\n}\n")
+    return "".join(h), "".join(s), steps, {"offsets": offsets, "arena": arena}
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Generate interpreter-free TFLM C++ for an int8 .tflite model.")
+    ap.add_argument("model")
+    ap.add_argument("--out-dir", required=True)
+    ap.add_argument("--name", default="mnist_model_aot")
+    args = ap.parse_args(argv)
+    try:
+        header, source, steps, plan = generate(args.model, args.name)
+    except CompileError as e:
+        raise SystemExit(f"{args.model}: {e}")
+    _write(os.path.join(args.out_dir, f"{args.name}.h"), header)
+    _write(os.path.join(args.out_dir, f"{args.name}.cc"), source)
+    print(f"{len(steps)} kernel calls, arena {plan['arena']} bytes")
+
+
+if __name__ == "__main__":
+    main()